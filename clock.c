@@ -176,7 +176,6 @@ static        U64       set_tod_epoch_all( const U64 epoch );
 
               S64       get_cpu_timer( REGS* regs );
               void      set_cpu_timer( REGS* regs, const S64 timer );
-              void      update_cpu_timer();
               U64       thread_cputime_us( const REGS* regs );
 
 /*-------------------------------------------------------------------*/
@@ -778,6 +777,9 @@ int cpu;
         release_lock( &sysblk.cpulock[ cpu ]);
     }
 
+    /* Have the timer thread recheck all clock comparators */
+    arm_timer_deadline( 0 );
+
     return epoch;
 }
 
@@ -867,6 +869,8 @@ void set_tod_offset( const S64 offset )
         episode_new.base_offset = offset;
     }
     release_lock( &sysblk.todlock );
+
+    arm_timer_deadline( 0 );
 }
 
 /*-------------------------------------------------------------------*/
@@ -880,6 +884,8 @@ void adjust_tod_offset( const S64 offset )
         episode_new.base_offset = episode_old.base_offset + offset;
     }
     release_lock( &sysblk.todlock );
+
+    arm_timer_deadline( 0 );
 }
 
 /*-------------------------------------------------------------------*/
@@ -926,6 +932,9 @@ void set_cpu_timer( REGS* regs, const S64 timer )
     }
 
     regs->cpu_timer = TOD_high64_to_ETOD_high56( timer ) + hw_clock();
+
+    /* Have the timer thread wake up when the timer goes negative */
+    arm_timer_deadline( (TOD) regs->cpu_timer + 1 );
 }
 
 /*-------------------------------------------------------------------*/
@@ -1220,17 +1229,12 @@ int query_tzoffset()
 /*                      update_tod_clock                             */
 /*-------------------------------------------------------------------*/
 /*                                                                   */
-/* This function is called by timer_thread and by cpu_thread         */
-/* instructions that manipulate any of the timer related entities    */
-/* (clock comparator, cpu timer and interval timer).                 */
-/*                                                                   */
-/* Internal function 'check_timer_event' is called which will signal */
-/* any timer related interrupts to the appropriate cpu_thread.       */
+/* This function is called by timer_thread and by every TOD_CLOCK   */
+/* read, since timer_thread only runs at timer deadlines.            */
 /*                                                                   */
-/* Callers *must* own the todlock and *must not* own the intlock.    */
+/* Callers *must not* own the todlock; they may own the intlock.     */
 /*                                                                   */
-/* update_tod_clock() returns the tod delta, by which the cpu timer  */
-/* has been adjusted.                                                */
+/* update_tod_clock() returns the updated TOD clock value.           */
 /*                                                                   */
 /*-------------------------------------------------------------------*/
 TOD update_tod_clock()
@@ -1253,10 +1257,6 @@ TOD update_tod_clock()
     }
     release_lock( &sysblk.todlock );
 
-    /* Update the timers and check if either a clock related event has
-       become pending */
-    update_cpu_timer();
-
     return new_clock;
 }
 
@@ -672,9 +672,12 @@ extern              U64  thread_cputime_us(const REGS*);    /* Thread real CPU u
 #define ITIMER_TO_TOD(_units)       (((S64)(_units) * 625) / 3)
 #define TOD_TO_ITIMER(_units)       ((S32)(((S64)(_units) * 3) / 625))
 
+// The timer thread only updates tod_value when it wakes up for a
+// timer deadline, so TOD_CLOCK updates the TOD clock before using it.
+
 #define TOD_CLOCK(_regs)            \
                                     \
-    ((tod_value.high & 0x00FFFFFFFFFFFFFFULL) + (_regs)->tod_epoch)
+    ((update_tod_clock() & 0x00FFFFFFFFFFFFFFULL) + (_regs)->tod_epoch)
 
 #define INT_TIMER(_regs)            \
                                     \
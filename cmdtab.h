@@ -709,14 +709,16 @@
 
 #define i_cmd_desc              "Generate I/O attention interrupt for device"
 
-#define icount_cmd_desc         "Display individual instruction counts"
+#define icount_cmd_desc         "Display or export individual instruction counts"
 #define icount_cmd_help         \
                                 \
   "Format: \"icount [[Enable|STArt] | [Disable|STOp] | [Clear|Reset|Zero]]\".\n" \
+  "        \"icount RAte [n]\"\n"                                               \
+  "        \"icount EXPort filename [CSV|JSON]\"\n"                             \
   "\n"                                                                          \
   "Enables or disables the counting of, resets the counts for, or\n"            \
   "displays how often each instruction opcode is executed. This is a\n"         \
-  "debugging command used to determine which instruction opcodes are\n"         \
+  "profiling command used to determine which instruction opcodes are\n"         \
   "executed the most frequently for a given workload to help determine\n"       \
   "which instructions are the best candidates for further optimization.\n"      \
   "\n"                                                                          \
@@ -725,7 +727,17 @@
   "before enabling counting when your workload begins. Use the stop\n"          \
   "option when your workload ends to stop counting. Enter the command\n"        \
   "with no options to display a list of executed instruction opcodes\n"         \
-  "sorted by frequency/popularity.\n"
+  "sorted by frequency/popularity.\n"                                           \
+  "\n"                                                                          \
+  "Each CPU counts into its own private set of counters, so counting\n"         \
+  "is cheap enough to be left enabled on production systems. Only one\n"       \
+  "of every 'n' instructions is timed (default 1024); use the RATE\n"           \
+  "option to display or change 'n'. RATE 1 times every instruction.\n"          \
+  "\n"                                                                          \
+  "The EXPORT option writes the counts, opcode mnemonics and average\n"         \
+  "sampled execution times to the specified file in either CSV or JSON\n"      \
+  "format. If not specified the format is JSON if the file's extension\n"       \
+  "is '.json', and CSV otherwise.\n"
 
 #define iodelay_cmd_desc        "Display or set I/O delay value"
 #define iodelay_cmd_help        \
@@ -1117,6 +1129,34 @@
   "to display the current value. Use the'cpu' command beforehand to choose\n"   \
   "which processor's prefix register should be displayed or altered.\n"
 
+#define psample_cmd_desc        "Sample guest PSWs for flame graphs"
+#define psample_cmd_help        \
+                                \
+  "Format: \"psample [[Enable|STArt [rate]] | [Disable|STOp] | [Clear]]\".\n"   \
+  "        \"psample RAte [n]\"\n"                                              \
+  "        \"psample DEPth [n]\"\n"                                             \
+  "        \"psample DUMP filename [bytes]\"\n"                                 \
+  "\n"                                                                          \
+  "Periodically records each running CPU's PSW instruction address,\n"         \
+  "primary ASN and primary ASCE into a per-CPU ring buffer. The timer\n"        \
+  "thread requests a sample 'rate' times per second (default 100) and\n"       \
+  "each CPU takes its own sample between instruction bursts, so the\n"         \
+  "system keeps running at full speed. A CPU which is stopped or in a\n"       \
+  "wait state is not sampled. If an SIE guest is running, the guest\n"         \
+  "PSW is sampled instead.\n"                                                  \
+  "\n"                                                                          \
+  "DEPTH sets how many linkage stack (BAKR and PC) return addresses are\n"     \
+  "also recorded for each sample, from 0 (the default) to 16.\n"               \
+  "\n"                                                                          \
+  "DUMP writes the samples from all CPUs to the specified file in the\n"        \
+  "\"folded stacks\" format used by flame graph tools, one line per\n"         \
+  "unique stack: ASID, ASCE, linkage stack return addresses outermost\n"       \
+  "first, then the sampled instruction address, followed by a count.\n"       \
+  "The optional 'bytes' value (a power of 2) rounds each instruction\n"       \
+  "address down so that samples can be grouped by e.g. 4096 byte page.\n"     \
+  "\n"                                                                          \
+  "Enter the command with no options to display the sampling status.\n"
+
 #define psw_cmd_desc            "Display or alter program status word"
 #define psw_cmd_help            \
                                 \
@@ -1895,6 +1935,18 @@
   "the current PSW mode, which is the default.\n"
 
 #define version_cmd_desc        "Display version information"
+#define waitspin_cmd_desc       "Display or set enabled wait spin limit"
+#define waitspin_cmd_help       \
+                                \
+  "Specifies how long, in microseconds, a CPU which loads an enabled\n"          \
+  "wait PSW polls for an interrupt before giving up its host thread.\n"         \
+  "A CPU only polls while its recent waits have on average been shorter\n"      \
+  "than this limit, so that a guest which waits briefly for an I/O or a\n"      \
+  "SIGP is resumed sooner, while an idle guest does not use host CPU.\n"        \
+  "\n"                                                                          \
+  "The default is "QSTR( DEF_WAIT_SPIN_USECS )", which disables polling.\n"     \
+  "The maximum allowed limit is "QSTR( MAX_WAIT_SPIN_USECS )" microseconds.\n"
+
 #define xpndsize_cmd_desc       "Define/Display xpndsize parameter"
 #define xpndsize_cmd_help       \
                                 \
@@ -2020,6 +2072,7 @@ COMMAND( "osa",                     qeth_cmd,               SYSCMDNOPER,
 COMMAND( "ostailor",                ostailor_cmd,           SYSCMDNOPER,        ostailor_cmd_desc,      ostailor_cmd_help   )
 COMMAND( "pgmtrace",                pgmtrace_cmd,           SYSCMDNOPER,        pgmtrace_cmd_desc,      pgmtrace_cmd_help   )
 COMMAND( "pr",                      pr_cmd,                 SYSCMDNOPER,        pr_cmd_desc,            pr_cmd_help         )
+COMMAND( "psample",                 psample_cmd,            SYSCMDNOPER,        psample_cmd_desc,       psample_cmd_help    )
 COMMAND( "psw",                     psw_cmd,                SYSCMDNOPER,        psw_cmd_desc,           psw_cmd_help        )
 COMMAND( "ptp",                     ptp_cmd,                SYSCMDNOPER,        ptp_cmd_desc,           ptp_cmd_help        )
 COMMAND( "ptt",                     EXTCMD( ptt_cmd ),      SYSCMDNOPER,        ptt_cmd_desc,           ptt_cmd_help        )
@@ -2056,6 +2109,7 @@ COMMAND( "traceopt",                traceopt_cmd,           SYSCMDNOPER,
 COMMAND( "u",                       u_cmd,                  SYSCMDNOPER,        u_cmd_desc,             u_cmd_help          )
 COMMAND( "v",                       v_cmd,                  SYSCMDNOPER,        v_cmd_desc,             v_cmd_help          )
 COMMAND( "vr",                      vr_cmd,                 SYSCMDNOPER,        vr_cmd_desc,            vr_cmd_help         )
+COMMAND( "waitspin",                waitspin_cmd,           SYSCMDNOPER,        waitspin_cmd_desc,      waitspin_cmd_help   )
 
 COMMAND( "i",                       i_cmd,                  SYSCMDNDIAG8,       i_cmd_desc,             NULL                )
 COMMAND( "ipl",                     ipl_cmd,                SYSCMDNDIAG8,       ipl_cmd_desc,           ipl_cmd_help        )
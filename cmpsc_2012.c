@@ -61,27 +61,13 @@ DISABLE_GCC_UNUSED_FUNCTION_WARNING;
 #ifndef EXP_ONCE                    // (we only need to define these once)
 #define EXP_ONCE                    // (we only need to define these once)
 
-#ifdef CMPSC_SYMCACHE               // (Symbol caching option)
-
-struct SYMCTL                       // Symbol Cache Control Entry
-{
-    U16   idx;                      // Cache index    (sym's pos in cache)
-    U16   len;                      // Symbol length  (sym's expanded len)
-};
-typedef struct SYMCTL SYMCTL;
-
-#endif // CMPSC_SYMCACHE            // (we only need to define this once)
-
 ///////////////////////////////////////////////////////////////////////////////
 // EXPAND Index Symbol parameters block
 
 struct EXPBLK                 // EXPAND Index Symbol parameters block
 {
-#ifdef CMPSC_SYMCACHE                        // (Symbol caching option)
-    SYMCTL  symcctl[ MAX_DICT_ENTRIES ];     // Symbols cache control entries
-    U8      symcache[ CMPSC_SYMCACHE_SIZE ]; // Previously expanded symbols
-    U16     symindex;                        // Next available cache location
-#endif // CMPSC_SYMCACHE                     // (Symbol caching option)
+    CMPSCCACHE* pCache;       // Per-CPU dictionary cache (NULL = none)
+    U64         pages;        // Dictionary pages symbol was built from
     DCTBLK      dctblk;       // GetDCT parameters block
     ECEBLK      eceblk;       // GetECE parameters block
     MEMBLK      op1blk;       // Operand-1 memory access control block
@@ -287,9 +273,14 @@ U8 (CMPSC_FASTCALL ARCH_DEP( cmpsc_Expand ))( CMPSCBLK* pCMPSCBLK )
     expblk.dctblk.pkey      = pCMPSCBLK->regs->psw.pkey;
     expblk.dctblk.pDict     = pCMPSCBLK->pDict;
 
+    expblk.pCache           = ARCH_DEP( GetCMPSCCACHE )( pCMPSCBLK->regs );
+
+    ARCH_DEP( OpenDCT )( &expblk.dctblk, expblk.pCache ? &expblk.pCache->expdct : NULL, 0, pCMPSCBLK->cdss );
+
     expblk.eceblk.pDCTBLK   = &expblk.dctblk;
     expblk.eceblk.max_index = 0xFFFF >> (16 - bits);
     expblk.eceblk.pECE      = &expblk.ece;
+    expblk.eceblk.ece       = expblk.pCache ? expblk.pCache->ece : NULL;
 
     expblk.op1blk.arn       = pCMPSCBLK->r1;
     expblk.op1blk.regs      = pCMPSCBLK->regs;
@@ -446,12 +437,74 @@ U8 (CMPSC_FASTCALL ARCH_DEP( cmpsc_Expand ))( CMPSCBLK* pCMPSCBLK )
     RETCC3( &expblk.op1blk );
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// Store the last 'n' bytes of an ECE's characters so they END at 'p'
+//
+// Always stores 8 bytes. The garbage preceding the characters is over-
+// written by the next (lower offset) chunk of the symbol, which is why
+// symbols are assembled from their highest offset downward.
+
+#ifndef EXP_TAIL_ONCE
+#define EXP_TAIL_ONCE
+static CMPSC_INLINE void exp_store_tail( U8* p, U64 ec_dw, U8 n )
+{
+    U64 dw = CSWAP64( CSWAP64( ec_dw ) >> ((8 - n) << 3) );
+    memcpy( p - 8, &dw, 8 );
+}
+#endif // EXP_TAIL_ONCE
+
+///////////////////////////////////////////////////////////////////////////////
+// Assemble a preceded index symbol into a host buffer with 8-byte stores
+//
+// 'sym' must have at least 8 bytes of slack in front of it. On entry the
+// index's own ECE is in pEXPBLK->ece and pEXPBLK->symlen is its length.
+//
+// Returns TRUE if the symbol was assembled. Returns FALSE if the chunks
+// do not exactly tile the symbol (or the dictionary is invalid) so that
+// the caller can redo the expansion one chunk at a time, which gives the
+// architected result (including any partial results) in every case.
+
+static U8 (CMPSC_FASTCALL ARCH_DEP( cmpsc_Expand_Chain ))( EXPBLK* pEXPBLK, U8* sym )
+{
+    U64  pages  = INDEX_TO_PAGEBIT( pEXPBLK->index );
+    U16  lo     = pEXPBLK->symlen;  // (lowest offset stored so far)
+    U8   dicts  = 1;                // (counts dictionary entries)
+
+    do
+    {
+        if (unlikely( pEXPBLK->ece.ofst + pEXPBLK->ece.psl != lo ))
+            return FALSE;
+
+        exp_store_tail( sym + lo, pEXPBLK->ece.ec_dw, pEXPBLK->ece.psl );
+        lo = pEXPBLK->ece.ofst;
+
+        pages |= INDEX_TO_PAGEBIT( pEXPBLK->ece.pptr );
+
+        if (unlikely( !ARCH_DEP( GetECE )( pEXPBLK->ece.pptr, &pEXPBLK->eceblk )))
+            return FALSE;
+
+        if (unlikely( ++dicts > 127 ))
+            return FALSE;
+    }
+    while (pEXPBLK->ece.psl);
+
+    if (unlikely( pEXPBLK->ece.csl != lo ))
+        return FALSE;
+
+    exp_store_tail( sym + lo, pEXPBLK->ece.ec_dw, pEXPBLK->ece.csl );
+
+    pEXPBLK->pages = pages;
+    return TRUE;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // EXPAND Index Symbol; TRUE == success, FALSE == error; rc == return code
 
 U8 (CMPSC_FASTCALL ARCH_DEP( cmpsc_Expand_Index ))( CMPSCBLK* pCMPSCBLK, EXPBLK* pEXPBLK )
 {
-    U8  dicts;  // Counts dictionary entries processed
+    U8   dicts;                     // Counts dictionary entries processed
+    U8   buf[ 8 + MAX_SYMLEN ];     // Symbol assembly buffer (+8 slack)
+    U8*  sym;                       // Expanded symbol
 
     if (unlikely( !pCMPSCBLK->nLen1 ))
         EXP_RETCC1();
@@ -459,16 +512,22 @@ U8 (CMPSC_FASTCALL ARCH_DEP( cmpsc_Expand_Index ))( CMPSCBLK* pCMPSCBLK, EXPBLK*
     if (likely( pEXPBLK->index >= 256 ))
     {
 #ifdef CMPSC_SYMCACHE
+        SYMCTL*  pSymCtl = pEXPBLK->pCache ? &pEXPBLK->pCache->symcctl[ pEXPBLK->index ] : NULL;
+
         // Check our cache of previously expanded index symbols
         // to see if we've already expanded this symbol before
         // and if we have room in the o/p buffer to expand it.
+        // The symbol may have been cached by a prior execution
+        // so its dictionary pages must still be as they were.
 
         if (1
-            && (pEXPBLK->symlen  = pEXPBLK->symcctl[ pEXPBLK->index ].len) > 0
+            && pSymCtl
+            && (pEXPBLK->symlen  = pSymCtl->len) > 0
             &&  pEXPBLK->symlen <= pCMPSCBLK->nLen1
+            && ARCH_DEP( DCTValid )( pSymCtl->pages, pSymCtl->gen, &pEXPBLK->dctblk )
         )
         {
-            store_op_str( &pEXPBLK->symcache[ pEXPBLK->symcctl[ pEXPBLK->index ].idx ], pEXPBLK->symlen-1, pCMPSCBLK->pOp1, &pEXPBLK->op1blk );
+            store_op_str( &pEXPBLK->pCache->symcache[ pSymCtl->idx ], pEXPBLK->symlen-1, pCMPSCBLK->pOp1, &pEXPBLK->op1blk );
         }
         else
 #endif // CMPSC_SYMCACHE
@@ -486,27 +545,45 @@ U8 (CMPSC_FASTCALL ARCH_DEP( cmpsc_Expand_Index ))( CMPSCBLK* pCMPSCBLK, EXPBLK*
                 if (unlikely( pCMPSCBLK->nLen1 < (pEXPBLK->symlen = pEXPBLK->ece.psl + pEXPBLK->ece.ofst)))
                     EXP_RETCC1();
 
-                dicts = 1;
+                sym = &buf[8];
 
-                do
+                if (likely( ARCH_DEP( cmpsc_Expand_Chain )( pEXPBLK, sym )))
                 {
-                    // Expand this partial ("preceded") chunk of this index symbol...
+                    // Store the whole assembled symbol at once
 
-                    store_op_str( pEXPBLK->ece.ec, pEXPBLK->ece.psl-1, pCMPSCBLK->pOp1 + pEXPBLK->ece.ofst, &pEXPBLK->op1blk );
+                    store_op_str( sym, pEXPBLK->symlen-1, pCMPSCBLK->pOp1, &pEXPBLK->op1blk );
+                }
+                else
+                {
+                    // Unusual dictionary: expand it the hard way,
+                    // one partial ("preceded") chunk at a time...
 
-                    // Get the ECE for the next chunk...
+                    ARCH_DEP( GetECE )( pEXPBLK->index, &pEXPBLK->eceblk );
 
-                    if (unlikely( !ARCH_DEP( GetECE )( pEXPBLK->ece.pptr, &pEXPBLK->eceblk )))
-                        EXP_RETERR();
+                    dicts = 1;
 
-                    if (unlikely( ++dicts > 127 ))
-                        EXP_RETERR();
-                }
-                while (pEXPBLK->ece.psl);
+                    do
+                    {
+                        // Expand this partial ("preceded") chunk of this index symbol...
+
+                        store_op_str( pEXPBLK->ece.ec, pEXPBLK->ece.psl-1, pCMPSCBLK->pOp1 + pEXPBLK->ece.ofst, &pEXPBLK->op1blk );
+
+                        // Get the ECE for the next chunk...
+
+                        if (unlikely( !ARCH_DEP( GetECE )( pEXPBLK->ece.pptr, &pEXPBLK->eceblk )))
+                            EXP_RETERR();
+
+                        if (unlikely( ++dicts > 127 ))
+                            EXP_RETERR();
+                    }
+                    while (pEXPBLK->ece.psl);
 
-                // we're done with the partial ("preceded") part of this
-                // symbol's expansion. Fall through to the "complete" symbol
-                // expansion logic to finish up this symbol's expansion...
+                    // Complete the expansion of this index symbol...
+
+                    store_op_str( pEXPBLK->ece.ec, pEXPBLK->ece.csl-1, pCMPSCBLK->pOp1, &pEXPBLK->op1blk );
+
+                    pEXPBLK->pages = 0;     // (don't cache this one)
+                }
             }
             else
             {
@@ -515,25 +592,44 @@ U8 (CMPSC_FASTCALL ARCH_DEP( cmpsc_Expand_Index ))( CMPSCBLK* pCMPSCBLK, EXPBLK*
 
                 if (unlikely( pCMPSCBLK->nLen1 < (pEXPBLK->symlen = pEXPBLK->ece.csl)))
                     EXP_RETCC1();
-            }
 
-            // Complete the expansion of this index symbol...
+                // Complete the expansion of this index symbol...
+
+                sym = pEXPBLK->ece.ec;
+
+                store_op_str( sym, pEXPBLK->symlen-1, pCMPSCBLK->pOp1, &pEXPBLK->op1blk );
 
-            store_op_str( pEXPBLK->ece.ec, pEXPBLK->ece.csl-1, pCMPSCBLK->pOp1, &pEXPBLK->op1blk );
+                pEXPBLK->pages = INDEX_TO_PAGEBIT( pEXPBLK->index );
+            }
 
 #ifdef CMPSC_SYMCACHE
             // If there's room for it, add this symbol to our expanded symbols cache
 
-            if (pEXPBLK->symlen <= (sizeof( pEXPBLK->symcache ) - pEXPBLK->symindex))
+            if (pSymCtl && pEXPBLK->pages)
             {
-                pEXPBLK->symcctl[ pEXPBLK->index ].len = pEXPBLK->symlen;
-                pEXPBLK->symcctl[ pEXPBLK->index ].idx = pEXPBLK->symindex;
+                CMPSCCACHE*  pCache = pEXPBLK->pCache;
+
+                // (symbols from an older generation are all stale)
+
+                if (pCache->symgen != pCache->expdct.gen)
+                {
+                    pCache->symgen   = pCache->expdct.gen;
+                    pCache->symindex = 0;
+                }
+
+                if (pEXPBLK->symlen <= (sizeof( pCache->symcache ) - pCache->symindex))
+                {
+                    pSymCtl->len   = pEXPBLK->symlen;
+                    pSymCtl->idx   = pCache->symindex;
+                    pSymCtl->gen   = pCache->expdct.gen;
+                    pSymCtl->pages = pEXPBLK->pages;
 
-                // (add this symbol to our previously expanded symbols cache)
+                    // (add this symbol to our previously expanded symbols cache)
 
-                fetch_op_str( &pEXPBLK->symcache[ pEXPBLK->symindex ], pEXPBLK->symlen-1, pCMPSCBLK->pOp1, &pEXPBLK->op1blk );
+                    memcpy( &pCache->symcache[ pCache->symindex ], sym, pEXPBLK->symlen );
 
-                pEXPBLK->symindex += pEXPBLK->symlen;
+                    pCache->symindex += pEXPBLK->symlen;
+                }
             }
 #endif // CMPSC_SYMCACHE
         }
@@ -568,6 +664,7 @@ U8 (CMPSC_FASTCALL ARCH_DEP( cmpsc_Compress ))( CMPSCBLK* pCMPSCBLK )
     SDE         sibling;            // Sibling Descriptor Entry data
     MEMBLK      op1blk;             // Operand-1 memory access control block
     MEMBLK      op2blk;             // Operand-2 memory access control block
+    CMPSCCACHE* pCache;             // Per-CPU dictionary cache
     DCTBLK      dctblk;             // GetDCT parameters block  (cmp dict)
     DCTBLK      dctblk2;            // GetDCT parameters block  (exp dict)
     CCEBLK      cceblk;             // GetCCE parameters block
@@ -606,18 +703,25 @@ U8 (CMPSC_FASTCALL ARCH_DEP( cmpsc_Compress ))( CMPSCBLK* pCMPSCBLK )
     dctblk2.pkey      = pCMPSCBLK->regs->psw.pkey;
     dctblk2.pDict     = pCMPSCBLK->pDict + g_nDictSize[ pCMPSCBLK->cdss - 1 ];
 
+    // (both dictionaries share one snapshot; the expansion
+    //  dictionary's pages follow the compression dictionary's)
+
+    pCache = ARCH_DEP( GetCMPSCCACHE )( pCMPSCBLK->regs );
+
+    ARCH_DEP( OpenDCT )( &dctblk,  pCache ? &pCache->cmpdct : NULL, 0, pCMPSCBLK->cdss );
+    ARCH_DEP( OpenDCT )( &dctblk2, pCache ? &pCache->cmpdct : NULL,
+        (U16)(g_nDictSize[ pCMPSCBLK->cdss - 1 ] >> PAGEFRAME_PAGESHIFT), pCMPSCBLK->cdss );
+
     cceblk.pDCTBLK    = &dctblk;
     cceblk.max_index  = max_index;
     cceblk.pCCE       = NULL;           // (filled in before each call)
-
-    memset( &cceblk.cce, 0, sizeof( cceblk.cce ) );
+    cceblk.cce        = pCache ? pCache->cce : NULL;
 
     sdeblk.pDCTBLK    = &dctblk;
     sdeblk.pDCTBLK2   = &dctblk2;
     sdeblk.pSDE       = &sibling;
     sdeblk.pCCE       = NULL;           // (depends if first sibling)
-
-    memset( &sdeblk.sde, 0, sizeof( sdeblk.sde ) );
+    sdeblk.sde        = pCache ? pCache->sde : NULL;
 
     piblk.ppPutIndex  = (void**) &pPutIndex;
     piblk.pCMPSCBLK   = pCMPSCBLK;
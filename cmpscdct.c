@@ -18,8 +18,65 @@
 #include "cmpsc.h"              // (Master header)
 
 #ifdef FEATURE_CMPSC
+///////////////////////////////////////////////////////////////////////////////
+// GetCMPSCCACHE: locate (or create) this CPU's dictionary cache
+//
+// Returns: ptr to CMPSCCACHE or NULL if one could not be allocated. The
+// cache is only ever accessed by its own CPU and, once allocated, remains
+// allocated for the life of Hercules.
+
+CMPSCCACHE* (CMPSC_FASTCALL ARCH_DEP( GetCMPSCCACHE ))( REGS* regs )
+{
+#if !defined( NOT_HERC )
+    CMPSCCACHE** ppCache = &sysblk.cmpsc_cache[ regs->cpuad ];
+
+    if (unlikely( !*ppCache ))
+        *ppCache = calloc_aligned( sizeof( CMPSCCACHE ), _4K );
+#else
+    static CMPSCCACHE* pStatic = NULL;
+    CMPSCCACHE** ppCache = &pStatic;
+    UNREFERENCED( regs );
+
+    if (!*ppCache)
+        *ppCache = calloc( 1, sizeof( CMPSCCACHE ));
+#endif
+    return *ppCache;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// OpenDCT: attach a dictionary snapshot to a GetDCT parameters block
+//
+// A block with a page offset of zero owns the snapshot: if the snapshot
+// was taken of a different dictionary it is discarded and a new content
+// generation is started. Blocks with a non-zero page offset share the
+// snapshot of the dictionary that precedes them.
+
+void (CMPSC_FASTCALL ARCH_DEP( OpenDCT ))( DCTBLK* pDCTBLK, DCTCACHE* pCache, U16 pgofs, U8 cdss )
+{
+    pDCTBLK->pCache = pCache;
+    pDCTBLK->pgofs  = pgofs;
+
+    if (pCache && !pgofs && (0
+        || pCache->pDict   != pDCTBLK->pDict
+        || pCache->cdss    != cdss
+        || pCache->pgshift != PAGEFRAME_PAGESHIFT
+    ))
+    {
+        pCache->pDict   = pDCTBLK->pDict;
+        pCache->cdss    = cdss;
+        pCache->pgshift = PAGEFRAME_PAGESHIFT;
+        pCache->loaded  = 0;
+
+        if (!++pCache->gen)
+            pCache->gen = 1;
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // GetDCT: fetch 8-byte dictionary entry as a 64-bit unsigned integer
+//
+// The first fetch from each dictionary page translates the page and, if
+// a snapshot is attached, checks the page against it.
 
 U64  (CMPSC_FASTCALL ARCH_DEP( GetDCT ))( U16 index, DCTBLK* pDCTBLK )
 {
@@ -28,6 +85,10 @@ U64  (CMPSC_FASTCALL ARCH_DEP( GetDCT ))( U16 index, DCTBLK* pDCTBLK )
 
     if (!pDCTBLK->maddr[ pagenum ])
     {
+        DCTCACHE*  pCache;
+        U8*        pSnap;
+        U64        pagebit;
+
         pDCTBLK->maddr[ pagenum ] = MADDR
         (
             pDCTBLK->pDict + PAGENUM_TO_BYTES( pagenum ),
@@ -36,10 +97,69 @@ U64  (CMPSC_FASTCALL ARCH_DEP( GetDCT ))( U16 index, DCTBLK* pDCTBLK )
             ACCTYPE_READ,
             pDCTBLK->pkey
         );
+
+        if ((pCache = pDCTBLK->pCache) != NULL)
+        {
+            pagebit = (U64)1 << (pDCTBLK->pgofs + pagenum);
+            pSnap   = &pCache->dict[ PAGENUM_TO_BYTES( pDCTBLK->pgofs + pagenum ) ];
+
+            if (0
+                || !(pCache->loaded & pagebit)
+                || memcmp( pSnap, pDCTBLK->maddr[ pagenum ], PAGEFRAME_PAGESIZE ) != 0
+            )
+            {
+                // Page changed since we last saw it: everything
+                // parsed from the previous contents is now stale.
+
+                if ((pCache->loaded & pagebit) && !++pCache->gen)
+                    pCache->gen = 1;
+
+                memcpy( pSnap, pDCTBLK->maddr[ pagenum ], PAGEFRAME_PAGESIZE );
+                pCache->loaded |= pagebit;
+            }
+        }
     }
     return CSWAP64(*(U64*)(uintptr_t)(&pDCTBLK->maddr[ pagenum ][ pageidx ]));
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// DCTValid: is something cached in generation 'gen' still valid?
+//
+// 'pages' is the set of dictionary pages the cached item was derived
+// from. Any of them not yet checked during this execution are checked
+// now, which may start a new generation.
+//
+// Returns: TRUE/FALSE (valid/stale)
+
+U8 (CMPSC_FASTCALL ARCH_DEP( DCTValid ))( U64 pages, U32 gen, DCTBLK* pDCTBLK )
+{
+    U16  pagenum;
+
+    if (!gen || gen != pDCTBLK->pCache->gen)
+        return FALSE;
+
+    for (pagenum=0; pages; pagenum++, pages >>= 1)
+        if ((pages & 1) && !pDCTBLK->maddr[ pagenum ])
+            ARCH_DEP( GetDCT )( (U16)(pagenum << INDEX_PAGE_SHIFT), pDCTBLK );
+
+    return (gen == pDCTBLK->pCache->gen) ? TRUE : FALSE;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// DCTHit: is the cached entry for 'index' still valid?
+
+static CMPSC_INLINE U8 (CMPSC_FASTCALL ARCH_DEP( DCTHit ))( U16 index, U32 gen, DCTBLK* pDCTBLK )
+{
+    if (likely( 1
+        && gen
+        && gen == pDCTBLK->pCache->gen
+        && pDCTBLK->maddr[ INDEX_TO_PAGENUM( index ) ]
+    ))
+        return TRUE;
+
+    return ARCH_DEP( DCTValid )( INDEX_TO_PAGEBIT( index ), gen, pDCTBLK );
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // GetECE: Extract EXPANSION Character Entry into portable ECE structure
 //
@@ -50,7 +170,7 @@ U8 (CMPSC_FASTCALL ARCH_DEP( GetECE ))( U16 index, ECEBLK* pECEBLK )
     register U64 ece;
     register ECE* pECE = pECEBLK->pECE;
 
-    if (pECEBLK->ece[ index ].cached)
+    if (pECEBLK->ece && ARCH_DEP( DCTHit )( index, pECEBLK->ece[ index ].gen, pECEBLK->pDCTBLK ))
     {
         *pECE = pECEBLK->ece[ index ];
         return TRUE;
@@ -75,8 +195,11 @@ U8 (CMPSC_FASTCALL ARCH_DEP( GetECE ))( U16 index, ECEBLK* pECEBLK )
         pECE->csl = 0;
     }
 
-    pECE->cached = TRUE;
-    pECEBLK->ece[ index ] = *pECE;
+    if (pECEBLK->ece)
+    {
+        pECE->gen = pECEBLK->pDCTBLK->pCache->gen;
+        pECEBLK->ece[ index ] = *pECE;
+    }
 
     return TRUE;
 }
@@ -91,7 +214,7 @@ U8 (CMPSC_FASTCALL ARCH_DEP( GetCCE ))( U16 index, CCEBLK* pCCEBLK )
     register U64 cce;
     register CCE* pCCE = pCCEBLK->pCCE;
 
-    if (pCCEBLK->cce[ index ].cached)
+    if (pCCEBLK->cce && ARCH_DEP( DCTHit )( index, pCCEBLK->cce[ index ].gen, pCCEBLK->pDCTBLK ))
     {
         *pCCE = pCCEBLK->cce[ index ];
         return TRUE;
@@ -108,8 +231,11 @@ U8 (CMPSC_FASTCALL ARCH_DEP( GetCCE ))( U16 index, CCEBLK* pCCEBLK )
         if (pCCE->act)
             pCCE->ec_dw = CSWAP64( cce << 24 );
 
-        pCCE->cached = TRUE;
-        pCCEBLK->cce[ index ] = *pCCE;
+        if (pCCEBLK->cce)
+        {
+            pCCE->gen = pCCEBLK->pDCTBLK->pCache->gen;
+            pCCEBLK->cce[ index ] = *pCCE;
+        }
 
         return TRUE;
     }
@@ -160,10 +286,18 @@ U8 (CMPSC_FASTCALL ARCH_DEP( GetCCE ))( U16 index, CCEBLK* pCCEBLK )
         pCCE->yy   = CCE_U16L(  8,  2 );
     }
 
-    pCCE->cached = TRUE;
-    pCCEBLK->cce[ index ] = *pCCE;
+    if (pCCE->cptr > pCCEBLK->max_index)
+        return FALSE;
+
+    // (never cache an entry that caused a data exception)
 
-    return (pCCE->cptr > pCCEBLK->max_index) ? FALSE : TRUE;
+    if (pCCEBLK->cce)
+    {
+        pCCE->gen = pCCEBLK->pDCTBLK->pCache->gen;
+        pCCEBLK->cce[ index ] = *pCCE;
+    }
+
+    return TRUE;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -176,7 +310,7 @@ U8 (CMPSC_FASTCALL ARCH_DEP( GetSD0 ))( U16 index, SDEBLK* pSDEBLK )
     register U64 sd1;
     register SDE* pSDE = pSDEBLK->pSDE;
 
-    if (pSDEBLK->sde[ index ].cached)
+    if (pSDEBLK->sde && ARCH_DEP( DCTHit )( index, pSDEBLK->sde[ index ].gen, pSDEBLK->pDCTBLK ))
     {
         *pSDE = pSDEBLK->sde[ index ];
         return TRUE;
@@ -216,8 +350,11 @@ U8 (CMPSC_FASTCALL ARCH_DEP( GetSD0 ))( U16 index, SDEBLK* pSDEBLK )
 
     pSDE->sc_dw = CSWAP64( sd1 << 8 );
 
-    pSDE->cached = TRUE;
-    pSDEBLK->sde[ index ] = *pSDE;
+    if (pSDEBLK->sde)
+    {
+        pSDE->gen = pSDEBLK->pDCTBLK->pCache->gen;
+        pSDEBLK->sde[ index ] = *pSDE;
+    }
 
     return TRUE;
 }
@@ -232,7 +369,17 @@ U8 (CMPSC_FASTCALL ARCH_DEP( GetSD1 ))( U16 index, SDEBLK* pSDEBLK )
     register U64 sd1;
     register SDE* pSDE = pSDEBLK->pSDE;
 
-    if (pSDEBLK->sde[ index ].cached)
+    // (entries with more than 6 sibling characters also depend
+    //  on the expansion dictionary which shares our snapshot)
+
+    if (1
+        && pSDEBLK->sde
+        && ARCH_DEP( DCTHit )( index, pSDEBLK->sde[ index ].gen, pSDEBLK->pDCTBLK )
+        && (0
+            || pSDEBLK->sde[ index ].sct <= 6
+            || ARCH_DEP( DCTHit )( index, pSDEBLK->sde[ index ].gen, pSDEBLK->pDCTBLK2 )
+           )
+    )
     {
         *pSDE = pSDEBLK->sde[ index ];
         return TRUE;
@@ -285,8 +432,11 @@ U8 (CMPSC_FASTCALL ARCH_DEP( GetSD1 ))( U16 index, SDEBLK* pSDEBLK )
         pSDE->sc_dw2 = CSWAP64( sd2 );        // (store next 6)
     }
 
-    pSDE->cached = TRUE;
-    pSDEBLK->sde[ index ] = *pSDE;
+    if (pSDEBLK->sde)
+    {
+        pSDE->gen = pSDEBLK->pDCTBLK->pCache->gen;
+        pSDEBLK->sde[ index ] = *pSDE;
+    }
 
     return TRUE;
 }
@@ -16,6 +16,31 @@
 #define INDEX_TO_PAGENUM(i)   ((U16)( (U16)(i) >> INDEX_PAGE_SHIFT))
 #define INDEX_TO_PAGEIDX(i)   ((U16)(((U32)(i) << INDEX_SHIFT) & PAGEFRAME_BYTEMASK))
 #define PAGENUM_TO_BYTES(n)   ((U32)( (U32)(n) << PAGEFRAME_PAGESHIFT))
+#define INDEX_TO_PAGEBIT(i)   ((U64)1 << INDEX_TO_PAGENUM(i))
+
+///////////////////////////////////////////////////////////////////////////////
+// Dictionary snapshot
+//
+// Each CPU keeps a private copy of the last compression and expansion
+// dictionaries it used. Parsed dictionary entries and expanded symbols
+// are tagged with the snapshot's generation number so they can survive
+// from one CMPSC execution to the next. The first time a dictionary page
+// is touched during an execution it is compared against the snapshot;
+// if it differs (or the dictionary origin, size or page size changed)
+// the generation is bumped, invalidating everything parsed before.
+// A compression snapshot also covers the expansion dictionary which
+// immediately follows it (format-1 sibling descriptors span both).
+
+struct DCTCACHE             // Dictionary snapshot
+{
+    U64    pDict;           // VADR of dictionary origin
+    U64    loaded;          // Pages present in the snapshot
+    U32    gen;             // Content generation number (never 0)
+    U8     cdss;            // Compressed-data symbol size
+    U8     pgshift;         // Page size the snapshot was taken with
+    U8     dict[ 2 * MAX_DICT_ENTRIES * 8 ];  // Dictionary contents
+};
+typedef struct DCTCACHE DCTCACHE;
 
 ///////////////////////////////////////////////////////////////////////////////
 // GetDCT parameters block
@@ -25,6 +50,8 @@ struct DCTBLK               // GetDCT parameters block
     REGS*  regs;            // Pointer to register context
     U64    pDict;           // VADR of dictionary to retrieve entry from
     U8*    maddr[32];       // Cached mainstor addrs of dictionary pages
+    DCTCACHE* pCache;       // Dictionary snapshot (NULL = none)
+    U16    pgofs;           // This dictionary's first page in pCache
     int    arn;             // Operand-2 register number
     U8     pkey;            // PSW key
 };
@@ -46,7 +73,8 @@ struct ECE              //  Portable Expansion Character Entry
     U8      csl;        // 10:1  Complete-symbol length
     U8      psl;        // 11:1  Partial-symbol length
     U8      ofst;       // 12:1  Offset
-    U8      cached;     // 13:1  Cache entry active flag
+    U8      pad2[3];    // 13:3  (alignment)
+    U32     gen;        // 16:4  Generation cached in (0 = not cached)
 };
 typedef struct ECE ECE;
 
@@ -76,7 +104,8 @@ struct CCE              //  Portable Compression Character Entry
     U8      cct;        // 22:1  Child count
     U8      act;        // 23:1  Additional-extension-character count
     U8      mc;         // 24:1  More children flag
-    U8      cached;     // 25:1  Cache entry active flag
+    U8      pad3[3];    // 25:3  (alignment)
+    U32     gen;        // 28:4  Generation cached in (0 = not cached)
 };
 typedef struct CCE CCE;
 
@@ -96,7 +125,7 @@ struct SDE              //  Portable Sibling Descriptor Entry
     U16     ecb;        // 16:2  Examine-child bits for children 1-7 or 1-14
     U8      sct;        // 18:1  Sibling count
     U8      ms;         // 19:1  More siblings flag
-    U8      cached;     // 13:1  Cache entry active flag
+    U32     gen;        // 20:4  Generation cached in (0 = not cached)
 };
 typedef struct SDE SDE;
 
@@ -108,7 +137,7 @@ struct ECEBLK               // GetECE parameters block
     DCTBLK*  pDCTBLK;       // Ptr to GetDCT parameters block
     ECE*     pECE;          // Ptr to destination ECE structure
     U16      max_index;     // Max index value (same as index's bitmask value)
-    ECE      ece[ MAX_DICT_ENTRIES ];   // ECE cache
+    ECE*     ece;           // ECE cache  (NULL = none)
 };
 typedef struct ECEBLK ECEBLK;
 
@@ -120,7 +149,7 @@ struct CCEBLK               // GetCCE parameters block
     DCTBLK*  pDCTBLK;       // Ptr to GetDCT parameters block
     CCE*     pCCE;          // Ptr to destination CCE structure
     U16      max_index;     // Max index value (same as index's bitmask value)
-    CCE      cce[ MAX_DICT_ENTRIES ];   // CCE cache
+    CCE*     cce;           // CCE cache  (NULL = none)
 };
 typedef struct CCEBLK CCEBLK;
 
@@ -135,15 +164,52 @@ struct SDEBLK               // GetSDn parameters block
     CCE*     pCCE;          // Ptr to Parent CCE structure where extra
                             // Examine-child bits reside, but ONLY if this
                             // is the parent's first sibling. Otherwise NULL.
-    SDE      sde[ MAX_DICT_ENTRIES ];   // SDE cache
+    SDE*     sde;           // SDE cache  (NULL = none)
 };
 typedef struct SDEBLK SDEBLK;
 
 typedef U8 (CMPSC_FASTCALL GETSD)( U16 index, SDEBLK* pSDEBLK );
 
+///////////////////////////////////////////////////////////////////////////////
+// Per-CPU dictionary cache
+
+#ifdef CMPSC_SYMCACHE               // (Symbol caching option)
+
+struct SYMCTL                       // Symbol Cache Control Entry
+{
+    U16   idx;                      // Cache index    (sym's pos in cache)
+    U16   len;                      // Symbol length  (sym's expanded len)
+    U32   gen;                      // Generation symbol was cached in
+    U64   pages;                    // Dictionary pages symbol came from
+};
+typedef struct SYMCTL SYMCTL;
+
+#endif // CMPSC_SYMCACHE
+
+struct CMPSCCACHE                   // Per-CPU dictionary cache
+{
+    DCTCACHE  expdct;               // Expansion dictionary snapshot
+    DCTCACHE  cmpdct;               // Compression dictionary snapshot
+    ECE       ece[ MAX_DICT_ENTRIES ];  // Parsed expansion entries
+    CCE       cce[ MAX_DICT_ENTRIES ];  // Parsed compression entries
+    SDE       sde[ MAX_DICT_ENTRIES ];  // Parsed sibling descriptors
+#ifdef CMPSC_SYMCACHE               // (Symbol caching option)
+    SYMCTL    symcctl[ MAX_DICT_ENTRIES ];     // Symbols cache control
+    U8        symcache[ CMPSC_SYMCACHE_SIZE ]; // Previously expanded symbols
+    U32       symgen;               // Generation symcache was filled in
+    U16       symindex;             // Next available cache location
+#endif // CMPSC_SYMCACHE
+};
+#if defined( NOT_HERC )             // (Hercules typedefs it in htypes.h)
+typedef struct CMPSCCACHE CMPSCCACHE;
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 #endif // _CMPSCDCT_H_     // Place all 'ARCH_DEP' code after this statement
 
+extern CMPSCCACHE* (CMPSC_FASTCALL ARCH_DEP( GetCMPSCCACHE ))( REGS* regs );
+extern void (CMPSC_FASTCALL ARCH_DEP( OpenDCT ))( DCTBLK* pDCTBLK, DCTCACHE* pCache, U16 pgofs, U8 cdss );
+extern U8  (CMPSC_FASTCALL ARCH_DEP( DCTValid ))( U64 pages, U32 gen, DCTBLK* pDCTBLK );
 extern U64 (CMPSC_FASTCALL ARCH_DEP( GetDCT ))( U16 index, DCTBLK* pDCTBLK );
 extern U8  (CMPSC_FASTCALL ARCH_DEP( GetECE ))( U16 index, ECEBLK* pECEBLK );
 extern U8  (CMPSC_FASTCALL ARCH_DEP( GetCCE ))( U16 index, CCEBLK* pCCEBLK );
@@ -4850,6 +4850,7 @@ DEF_INST( set_clock_comparator )
 int     b2;                             /* Base of effective addr    */
 VADR    effective_addr2;                /* Effective address         */
 U64     dreg;                           /* Clock value               */
+TOD     tod;                            /* Current TOD clock value   */
 
     S( inst, regs, b2, effective_addr2 );
 
@@ -4877,10 +4878,17 @@ U64     dreg;                           /* Clock value               */
 
         /* reset the clock comparator pending flag according to
            the setting of the tod clock */
-        if (get_tod_clock( regs ) > dreg)
+        tod = get_tod_clock( regs );
+        if (tod > dreg)
             ON_IC_CLKC( regs );
         else
+        {
             OFF_IC_CLKC( regs );
+
+            /* Have the timer thread wake up when the TOD clock
+               passes the new clock comparator value */
+            arm_timer_deadline( hw_clock() + (dreg - tod) + 1 );
+        }
     }
     RELEASE_INTLOCK( regs );
 
@@ -68,6 +68,7 @@
 #if !defined( FWD_REFS)
     #define   FWD_REFS
   static void  CPU_Wait( REGS* regs );
+  static bool  CPU_Wait_Spin( REGS* regs );
   static void* cpu_uninit( int cpu, REGS* regs );
 #endif
 
@@ -1838,6 +1839,9 @@ cpustate_stopping:
         regs->ints_state |= sysblk.ints_state;
         set_cpu_timer(regs,saved_timer);
 
+        /* Recheck the clock comparator now that we're started again */
+        arm_timer_deadline( 0 );
+
         ON_IC_INTERRUPT(regs);
 
         /* Purge the lookaside buffers */
@@ -1857,6 +1861,8 @@ cpustate_stopping:
     /* Test for wait state */
     if (WAITSTATE(&regs->psw))
     {
+        TOD waited;                     /* Time waited               */
+
         regs->waittod = host_tod();
 
         /* Test for disabled wait PSW and issue message */
@@ -1903,9 +1909,13 @@ cpustate_stopping:
         sysblk.waiting_mask &= ~(regs->cpubit);
 
         /* Calculate the time we waited */
-        regs->waittime += host_tod() - regs->waittod;
+        waited = host_tod() - regs->waittod;
+        regs->waittime += waited;
         regs->waittod = 0;
 
+        /* Keep a running average of recent wait times for spinning */
+        regs->waitavg = (regs->waitavg * 7 + waited) / 8;
+
         /* If late state change to stopping, go reprocess */
         if (unlikely(regs->cpustate == CPUSTATE_STOPPING))
             goto cpustate_stopping;
@@ -2107,6 +2117,9 @@ enter_fastest_no_txf_loop:
 
     /* Perform automatic instruction tracing if it's enabled */
     DO_AUTOMATIC_TRACING();
+
+    /* Take a PSW sample if the timer thread asked for one */
+    DO_PSW_SAMPLING();
     goto fastest_no_txf_loop;
 
 #if defined( FEATURE_073_TRANSACT_EXEC_FACILITY )
@@ -2145,6 +2158,9 @@ enter_txf_faster_loop:
     /* Perform automatic instruction tracing if it's enabled */
     DO_AUTOMATIC_TRACING();
 
+    /* Take a PSW sample if the timer thread asked for one */
+    DO_PSW_SAMPLING();
+
 //txf_slower_loop:
 
     if (INTERRUPT_PENDING( regs ))
@@ -2178,6 +2194,9 @@ enter_txf_slower_loop:
 
     /* Perform automatic instruction tracing if it's enabled */
     DO_AUTOMATIC_TRACING();
+
+    /* Take a PSW sample if the timer thread asked for one */
+    DO_PSW_SAMPLING();
     goto txf_facility_loop;
 
 #endif /* defined( FEATURE_073_TRANSACT_EXEC_FACILITY ) */
@@ -2245,6 +2264,9 @@ void ARCH_DEP( process_trace )( REGS* regs, BYTE* dest )
             set_cpu_timer( regs,     saved_timer[0] );
             set_cpu_timer( hostregs, saved_timer[1] );
 
+            /* Recheck the clock comparator now that we're started again */
+            arm_timer_deadline( 0 );
+
             hostregs->waittime += host_tod() - hostregs->waittod;
             hostregs->waittod = 0;
         }
@@ -2252,6 +2274,29 @@ void ARCH_DEP( process_trace )( REGS* regs, BYTE* dest )
     }
 } /* process_trace */
 
+/*-------------------------------------------------------------------*/
+/* Fill in a PSW sample for this CPU  (see psample_record)           */
+/*-------------------------------------------------------------------*/
+void ARCH_DEP( psample_fill )( REGS* regs, PSAMPLE* ent )
+{
+    /* The PSW is only up to date when the AIA is invalid */
+    ent->ia = VALID_AIE( regs ) ? PSW_IA_FROM_IP( regs, 0 )
+                                : (regs->psw.IA & ADDRESS_MAXWRAP( regs ));
+
+    ent->asce      = regs->CR(1);
+    ent->asid      = regs->CR_LHL(4);
+    ent->arch_mode = regs->arch_mode;
+    ent->flags     = (SIE_MODE( regs )          ? PSAMPLE_SIE  : 0)
+                   | (PROBSTATE( &regs->psw )   ? PSAMPLE_PROB : 0);
+
+#if defined( FEATURE_LINKAGE_STACK )
+    ent->depth = (BYTE) ARCH_DEP( stack_backtrace )( regs, ent->frame,
+                                         (int) sysblk.psample_depth );
+#else
+    ent->depth = 0;
+#endif
+}
+
 /*-------------------------------------------------------------------*/
 /*          (delineates ARCH_DEP from non-arch_dep)                  */
 /*-------------------------------------------------------------------*/
@@ -2596,9 +2641,14 @@ static void *cpu_uninit (int cpu, REGS *regs)
 /*-------------------------------------------------------------------*/
 static void CPU_Wait( REGS* regs )
 {
+bool    woken;                          /* true == woken while spinning */
+
     /* Indicate we are giving up intlock */
     sysblk.intowner = LOCK_OWNER_NONE;
 
+    /* Poll for an interrupt for a short while before blocking */
+    woken = CPU_Wait_Spin( regs );
+
     /* Wait while SYNCHRONIZE_CPUS is in progress */
     while (sysblk.syncing)
     {
@@ -2631,13 +2681,59 @@ static void CPU_Wait( REGS* regs )
         release_lock( &sysblk.scrlock );
     }
 
-    /* Wait for interrupt */
-    wait_condition (&regs->intcond, &sysblk.intlock);
+    /* Wait for interrupt unless one arrived while spinning (its
+       signal was then sent before we were waiting for it) */
+    if (!woken)
+        wait_condition (&regs->intcond, &sysblk.intlock);
 
     /* And we're the owner of intlock once again */
     sysblk.intowner = regs->cpuad;
 }
 
+/*-------------------------------------------------------------------*/
+/* CPU Wait Spin - Poll for an interrupt before blocking             */
+/*                                                                   */
+/* An enabled wait is spun for up to WAITSPIN microseconds with the  */
+/* intlock released, but only while the recent waits of this CPU     */
+/* have been shorter than that on average, so that a guest waiting   */
+/* briefly for an I/O or a SIGP is resumed without a thread switch.  */
+/* Returns true if an interrupt became pending while spinning.       */
+/*                                                                   */
+/* Locks Held                                                        */
+/*      sysblk.intlock                                               */
+/*-------------------------------------------------------------------*/
+static bool CPU_Wait_Spin( REGS* regs )
+{
+TOD     limit;                          /* Spin limit                */
+TOD     end;                            /* End of spin               */
+
+    limit = (TOD) sysblk.waitspin * ETOD_USEC;
+
+    if (0
+        || !limit
+        || regs->cpustate != CPUSTATE_STARTED
+        || !WAITSTATE( &regs->psw )
+        || IS_IC_DISABLED_WAIT_PSW( regs )
+        || regs->waitavg >= limit
+    )
+        return false;
+
+    end = host_tod() + limit;
+
+    release_lock( &sysblk.intlock );
+    {
+        while (1
+            && !IS_IC_INTERRUPT( regs )
+            && !sysblk.syncing
+            && host_tod() < end
+        )
+            sched_yield();
+    }
+    obtain_lock( &sysblk.intlock );
+
+    return IS_IC_INTERRUPT( regs ) ? true : false;
+}
+
 /*-------------------------------------------------------------------*/
 /* Copy program status word                                          */
 /*-------------------------------------------------------------------*/
@@ -2815,6 +2911,47 @@ void do_automatic_tracing()
     }
 }
 
+/*-------------------------------------------------------------------*/
+/*                      PSW Sampling                                 */
+/*-------------------------------------------------------------------*/
+/* Called by the CPU thread between instruction bursts whenever the  */
+/* timer thread has set its 'psample_req' flag. The sample is stored */
+/* into this CPU's own ring so no locking is needed; the 'psample'   */
+/* command reads the rings to produce folded stacks for flame graphs.*/
+/*-------------------------------------------------------------------*/
+void psample_record( REGS* regs )
+{
+    PSAMPLE_RING*  ring;
+    PSAMPLE*       ent;
+
+    regs->psample_req = false;
+
+    if (!sysblk.psample || !(ring = sysblk.psample_ring[ regs->cpuad ]))
+        return;
+
+    /* Sample the guest instead if running under SIE */
+    if (regs->sie_active && regs->guestregs)
+        regs = regs->guestregs;
+
+    ent = &ring->ent[ ring->count % ring->size ];
+
+    switch (regs->arch_mode)
+    {
+#if defined( _370 )
+        case ARCH_370_IDX: s370_psample_fill( regs, ent ); break;
+#endif
+#if defined( _390 )
+        case ARCH_390_IDX: s390_psample_fill( regs, ent ); break;
+#endif
+#if defined( _900 )
+        case ARCH_900_IDX: z900_psample_fill( regs, ent ); break;
+#endif
+        default: return;
+    }
+
+    ring->count++;
+}
+
 /*-------------------------------------------------------------------*/
 /*                        make_psw64                                 */
 /*-------------------------------------------------------------------*/
@@ -1854,13 +1854,16 @@ tran_excp_addr:
 
 
 /*-------------------------------------------------------------------*/
-/*                      is_tlbe_match                                */
+/*                      is_pte_match                                 */
 /*-------------------------------------------------------------------*/
-bool ARCH_DEP( is_tlbe_match )( REGS* regs, REGS* host_regs, U64 pfra, int i )
+/* Returns true if the page table entry value 'tlbpte' (as saved in  */
+/* a TLB entry or in the AIA) designates page frame real address     */
+/* 'pfra' as specified by the IPTE/IDTE/IESBE instructions.          */
+/*-------------------------------------------------------------------*/
+static inline bool ARCH_DEP( is_pte_match )( REGS* regs, U64 pfra, RADR tlbpte )
 {
 RADR pte;
 RADR ptemask;
-bool match = false;
 
 #if !defined( FEATURE_S390_DAT ) && !defined( FEATURE_001_ZARCH_INSTALLED_FACILITY )
     ptemask = ((regs->CR(0) & CR0_PAGE_SIZE) == CR0_PAGE_SZ_4K) ?
@@ -1868,15 +1871,27 @@ bool match = false;
     pte = ((pfra & 0xFFFFFF) >> 8) & ptemask;
 #endif
 #if defined( FEATURE_S390_DAT )
+    UNREFERENCED( regs );
     ptemask = PAGETAB_PFRA;
     pte = pfra & ptemask;
 #endif
 #if defined( FEATURE_001_ZARCH_INSTALLED_FACILITY )
+    UNREFERENCED( regs );
     ptemask = (RADR)ZPGETAB_PFRA;
     pte = pfra & ptemask;
 #endif
 
-    if ((regs->tlb.TLB_PTE(i) & ptemask) == pte)
+    return ((tlbpte & ptemask) == pte);
+}
+
+/*-------------------------------------------------------------------*/
+/*                      is_tlbe_match                                */
+/*-------------------------------------------------------------------*/
+bool ARCH_DEP( is_tlbe_match )( REGS* regs, REGS* host_regs, U64 pfra, int i )
+{
+bool match = false;
+
+    if (ARCH_DEP( is_pte_match )( regs, pfra, regs->tlb.TLB_PTE(i) ))
         match = true;
     else if (!host_regs)
         match = false;
@@ -1898,7 +1913,18 @@ void ARCH_DEP( do_purge_tlbe )( REGS* regs, REGS* host_regs, U64 pfra )
 {
 int  i;
 
-    INVALIDATE_AIA( regs );
+    /* The AIA only needs to be invalidated when the page it maps is
+       the one being purged. Every IPTE is broadcast to all CPUs, so
+       unconditionally invalidating here would force an instfetch
+       slow path on every other CPU for every page-out. A purge of a
+       SIE host page is conservatively always honored since the AIA
+       does not record the host translation of the guest page.
+    */
+    if (0
+        || host_regs
+        || ARCH_DEP( is_pte_match )( regs, pfra, regs->aipte )
+    )
+        INVALIDATE_AIA( regs );
 
     for (i=0; i < TLBN; i++)
         if (ARCH_DEP( is_tlbe_match )( regs, host_regs, pfra, i ))
@@ -256,6 +256,145 @@ int     d;                              /* Decimal digit or sign     */
 
 } /* end function(binary_to_packed) */
 
+/*-------------------------------------------------------------------*/
+/* Binary fast paths for short packed decimal operands               */
+/*                                                                   */
+/* Operands of at most MAX_BINARY_LENGTH bytes (15 digits) are       */
+/* converted straight from packed decimal to a binary integer, the   */
+/* arithmetic is done with host integers, and the result is packed   */
+/* again.  Conversion in both directions works on all 16 digits at   */
+/* once within a 64-bit register rather than a digit at a time.      */
+/*-------------------------------------------------------------------*/
+#define MAX_BINARY_LENGTH       8
+
+static const U64 dec_pow10[ MAX_BINARY_LENGTH * 2 ] =
+{
+    1ULL,
+    10ULL,
+    100ULL,
+    1000ULL,
+    10000ULL,
+    100000ULL,
+    1000000ULL,
+    10000000ULL,
+    100000000ULL,
+    1000000000ULL,
+    10000000000ULL,
+    100000000000ULL,
+    1000000000000ULL,
+    10000000000000ULL,
+    100000000000000ULL,
+    1000000000000000ULL,
+};
+
+/*-------------------------------------------------------------------*/
+/* Convert an 8-byte packed decimal number to binary                 */
+/*                                                                   */
+/* Input:                                                            */
+/*      pack    The packed decimal operand right-aligned in a U64    */
+/*              and padded on the left with zero digits.             */
+/* Output:                                                           */
+/*      result  Points to a U64 to receive the absolute value.       */
+/*      count   Points to an integer to receive the number of        */
+/*              digits in the result excluding leading zeroes.       */
+/*      sign    Points to an integer which will be set to -1 if      */
+/*              the sign is negative, or +1 if it is positive.       */
+/* Return value:                                                     */
+/*      false if the operand contains an invalid digit or sign.      */
+/*-------------------------------------------------------------------*/
+static inline bool packed_to_u64 (U64 pack, U64 *result,
+                        int *count, int *sign)
+{
+U64     x;                              /* Digits being converted    */
+U32     hi;                             /* High-order digits         */
+int     h;                              /* Sign digit                */
+
+    /* Check for valid sign */
+    h = pack & 0x0F;
+    if (h < 0x0A)
+        return false;
+
+    /* A digit is invalid if its 8 bit and its 4 or 2 bit are on */
+    x = pack >> 4;
+    if (x & ((x << 1) | (x << 2)) & 0x8888888888888888ULL)
+        return false;
+
+    /* Count significant digits from the highest non-zero nibble */
+    hi = (U32)(x >> 32);
+    if (hi)
+        *count = (int)(highest_set_bit( hi ) + 32) / 4 + 1;
+    else if ((U32) x)
+        *count = (int) highest_set_bit( (U32) x ) / 4 + 1;
+    else
+        *count = 0;
+
+    /* Combine adjacent digits, pairs, quads and octets in place */
+    x = (x & 0x0F0F0F0F0F0F0F0FULL)
+      + ((x >>  4) & 0x0F0F0F0F0F0F0F0FULL) * 10;
+    x = (x & 0x00FF00FF00FF00FFULL)
+      + ((x >>  8) & 0x00FF00FF00FF00FFULL) * 100;
+    x = (x & 0x0000FFFF0000FFFFULL)
+      + ((x >> 16) & 0x0000FFFF0000FFFFULL) * 10000;
+    x = (x & 0x00000000FFFFFFFFULL)
+      + (x >> 32) * 100000000;
+
+    *result = x;
+    *sign = (h == 0x0B || h == 0x0D) ? -1 : 1;
+    return true;
+
+} /* end function packed_to_u64 */
+
+/*-------------------------------------------------------------------*/
+/* Convert eight digits (0-99999999) to packed BCD in a U32          */
+/*-------------------------------------------------------------------*/
+static inline U64 u32_to_bcd (U32 bin)
+{
+U64     x;                              /* Digit lanes               */
+U64     q;                              /* Lane quotients            */
+
+    /* Split into two 4-digit groups in 32-bit lanes */
+    x = ((U64)(bin / 10000) << 32) | (bin % 10000);
+
+    /* Split each group into 2-digit 16-bit lanes (v/100 for
+       v < 10000 is exactly (v * 5243) >> 19) */
+    q = ((x * 5243) >> 19) & 0x0000007F0000007FULL;
+    x = (q << 16) | (x - q * 100);
+
+    /* Split each pair into single-digit byte lanes (v/10 for
+       v < 100 is exactly (v * 103) >> 10) */
+    q = ((x * 103) >> 10) & 0x000F000F000F000FULL;
+    x = (q << 8) | (x - q * 10);
+
+    /* Squeeze the digits together into adjacent nibbles */
+    x = (x | (x >>  4)) & 0x00FF00FF00FF00FFULL;
+    x = (x | (x >>  8)) & 0x0000FFFF0000FFFFULL;
+    x = (x | (x >> 16)) & 0x00000000FFFFFFFFULL;
+
+    return x;
+
+} /* end function u32_to_bcd */
+
+/*-------------------------------------------------------------------*/
+/* Convert binary number to an 8-byte packed decimal number          */
+/*                                                                   */
+/* Input:                                                            */
+/*      bin     Absolute value to be converted (less than 10**16).   */
+/*              Only the rightmost 15 digits are returned.           */
+/*      sign    -1 for a negative sign, or +1 for a positive sign.   */
+/* Return value:                                                     */
+/*      The packed decimal result right-aligned in a U64.            */
+/*-------------------------------------------------------------------*/
+static inline U64 u64_to_packed (U64 bin, int sign)
+{
+U64     bcd;                            /* Packed digits             */
+
+    bcd = (u32_to_bcd( (U32)(bin / 100000000) ) << 32)
+        |  u32_to_bcd( (U32)(bin % 100000000) );
+
+    return (bcd << 4) | (sign < 0 ? 0x0D : 0x0C);
+
+} /* end function u64_to_packed */
+
 /*-------------------------------------------------------------------*/
 /* Add two decimal byte strings as unsigned decimal numbers          */
 /*                                                                   */
@@ -691,6 +830,112 @@ BYTE    pack[MAX_DECIMAL_LENGTH];       /* Packed decimal work area  */
 
 } /* end function ARCH_DEP(store_decimal) */
 
+/*-------------------------------------------------------------------*/
+/* Load a packed decimal storage operand as a binary number          */
+/*                                                                   */
+/* Input:                                                            */
+/*      addr    Logical address of packed decimal storage operand    */
+/*      len     Length minus one of storage operand (range 0-7)      */
+/*      arn     Access register number associated with operand       */
+/*      regs    CPU register context                                 */
+/* Output:                                                           */
+/*      result  Points to a U64 to receive the absolute value.       */
+/*      count   Points to an integer to receive the number of        */
+/*              digits in the result excluding leading zeroes.       */
+/*      sign    Points to an integer which will be set to -1 if a    */
+/*              negative sign was loaded from the operand, or +1 if  */
+/*              a positive sign was loaded from the operand.         */
+/*                                                                   */
+/*      Program checks are the same as for load_decimal.             */
+/*-------------------------------------------------------------------*/
+static void ARCH_DEP(load_packed_u64) (VADR addr, int len, int arn,
+                        REGS *regs, U64 *result, int *count, int *sign)
+{
+BYTE    pack[MAX_BINARY_LENGTH];        /* Packed decimal work area  */
+
+    /* Fetch the packed decimal operand into work area */
+    memset( pack, 0, sizeof(pack) );
+    ARCH_DEP(vfetchc) (pack+sizeof(pack)-len-1, len, addr, arn, regs);
+
+    /* Convert to binary, checking for valid digits and sign */
+    if (!packed_to_u64( fetch_dw( pack ), result, count, sign ))
+    {
+        regs->dxc = DXC_DECIMAL;
+        ARCH_DEP(program_interrupt) (regs, PGM_DATA_EXCEPTION);
+    }
+
+} /* end function ARCH_DEP(load_packed_u64) */
+
+/*-------------------------------------------------------------------*/
+/* Store binary number into packed decimal storage operand           */
+/*                                                                   */
+/* Input:                                                            */
+/*      addr    Logical address of packed decimal storage operand    */
+/*      len     Length minus one of storage operand (range 0-15)     */
+/*      arn     Access register number associated with operand       */
+/*      regs    CPU register context                                 */
+/*      bin     Absolute value to be stored (less than 10**16).      */
+/*              Digits which do not fit the operand are lost.        */
+/*      sign    -1 if a negative sign is to be stored, or +1 if a    */
+/*              positive sign is to be stored.                       */
+/*                                                                   */
+/*      Program checks are the same as for store_decimal.            */
+/*-------------------------------------------------------------------*/
+static void ARCH_DEP(store_packed_u64) (VADR addr, int len, int arn,
+                        REGS *regs, U64 bin, int sign)
+{
+BYTE    pack[MAX_DECIMAL_LENGTH];       /* Packed decimal work area  */
+
+    /* if operand crosses page, make sure both pages are accessible */
+    if((addr & PAGEFRAME_PAGEMASK) !=
+        ((addr + len) & PAGEFRAME_PAGEMASK))
+        ARCH_DEP(validate_operand) (addr, arn, len, ACCTYPE_WRITE_SKP, regs);
+
+    /* Pack the value into the rightmost bytes of the work area */
+    memset( pack, 0, sizeof(pack) - MAX_BINARY_LENGTH );
+    store_dw( pack + sizeof(pack) - MAX_BINARY_LENGTH,
+              u64_to_packed( bin, sign ));
+
+    /* Store the result at the operand location */
+    ARCH_DEP(vstorec) (pack+sizeof(pack)-len-1, len, addr, arn, regs);
+
+} /* end function ARCH_DEP(store_packed_u64) */
+
+/*-------------------------------------------------------------------*/
+/* Store signed result of AP, SP or ZAP and return condition code    */
+/*                                                                   */
+/* Input:                                                            */
+/*      addr    Logical address of packed decimal storage operand    */
+/*      len     Length minus one of storage operand (range 0-15)     */
+/*      arn     Access register number associated with operand       */
+/*      regs    CPU register context                                 */
+/*      result  Signed result (absolute value less than 10**16)      */
+/* Return value:                                                     */
+/*      Condition code 0, 1 or 2 for a zero, negative or positive    */
+/*      result, or 3 if the result does not fit the operand.         */
+/*-------------------------------------------------------------------*/
+static int ARCH_DEP(store_packed_result) (VADR addr, int len, int arn,
+                        REGS *regs, S64 result)
+{
+int     cc;                             /* Condition code            */
+int     digits;                         /* Operand length in digits  */
+U64     bin;                            /* Absolute value of result  */
+
+    bin = (result < 0) ? (U64) -result : (U64) result;
+    cc  = (result == 0) ? 0 : (result < 0) ? 1 : 2;
+
+    /* Overflow if result exceeds operand length */
+    digits = (len+1) * 2 - 1;
+    if (digits < (int) _countof( dec_pow10 ) && bin >= dec_pow10[ digits ])
+        cc = 3;
+
+    /* Zero result is always stored with a positive sign */
+    ARCH_DEP(store_packed_u64) (addr, len, arn, regs, bin,
+                                (result < 0) ? -1 : 1);
+    return cc;
+
+} /* end function ARCH_DEP(store_packed_result) */
+
 
 /*-------------------------------------------------------------------*/
 /* FA   AP    - Add Decimal                                   [SS-b] */
@@ -707,11 +952,29 @@ BYTE    dec2[MAX_DECIMAL_DIGITS];       /* Work area for operand 2   */
 BYTE    dec3[MAX_DECIMAL_DIGITS];       /* Work area for result      */
 int     count1, count2, count3;         /* Significant digit counters*/
 int     sign1, sign2, sign3;            /* Sign of operands & result */
+U64     bin1, bin2;                     /* Binary operand values     */
 
     SS(inst, regs, l1, l2, b1, effective_addr1, b2, effective_addr2);
     PER_ZEROADDR_XCHECK2( regs, b1, b2 );
     TXFC_INSTR_CHECK( regs );
 
+    /* Operands of up to 15 digits are added in binary */
+    if (l1 < MAX_BINARY_LENGTH && l2 < MAX_BINARY_LENGTH)
+    {
+        ARCH_DEP(load_packed_u64) (effective_addr1, l1, b1, regs, &bin1, &count1, &sign1);
+        ARCH_DEP(load_packed_u64) (effective_addr2, l2, b2, regs, &bin2, &count2, &sign2);
+
+        /* Store the signed sum and set condition code */
+        cc = ARCH_DEP(store_packed_result) (effective_addr1, l1, b1, regs,
+                    sign1 * (S64) bin1 + sign2 * (S64) bin2);
+        regs->psw.cc = cc;
+
+        /* Program check if overflow and PSW program mask is set */
+        if (cc == 3 && DOMASK(&regs->psw))
+            ARCH_DEP(program_interrupt) (regs, PGM_DECIMAL_OVERFLOW_EXCEPTION);
+        return;
+    }
+
     /* Load operands into work areas */
     ARCH_DEP(load_decimal) (effective_addr1, l1, b1, regs, dec1, &count1, &sign1);
     ARCH_DEP(load_decimal) (effective_addr2, l2, b2, regs, dec2, &count2, &sign2);
@@ -782,11 +1045,26 @@ BYTE    dec2[MAX_DECIMAL_DIGITS];       /* Work area for operand 2   */
 int     count1, count2;                 /* Significant digit counters*/
 int     sign1, sign2;                   /* Sign of each operand      */
 int     rc;                             /* Return code               */
+U64     bin1, bin2;                     /* Binary operand values     */
+S64     val1, val2;                     /* Signed operand values     */
 
     SS(inst, regs, l1, l2, b1, effective_addr1, b2, effective_addr2);
     PER_ZEROADDR_XCHECK2( regs, b1, b2 );
     TXFC_INSTR_CHECK( regs );
 
+    /* Operands of up to 15 digits are compared in binary */
+    if (l1 < MAX_BINARY_LENGTH && l2 < MAX_BINARY_LENGTH)
+    {
+        ARCH_DEP(load_packed_u64) (effective_addr1, l1, b1, regs, &bin1, &count1, &sign1);
+        ARCH_DEP(load_packed_u64) (effective_addr2, l2, b2, regs, &bin2, &count2, &sign2);
+
+        /* Negative zero compares equal to positive zero */
+        val1 = sign1 * (S64) bin1;
+        val2 = sign2 * (S64) bin2;
+        regs->psw.cc = (val1 < val2) ? 1 : (val1 > val2) ? 2 : 0;
+        return;
+    }
+
     /* Load operands into work areas */
     ARCH_DEP(load_decimal) (effective_addr1, l1, b1, regs, dec1, &count1, &sign1);
     ARCH_DEP(load_decimal) (effective_addr2, l2, b2, regs, dec2, &count2, &sign2);
@@ -843,6 +1121,7 @@ BYTE    rem[MAX_DECIMAL_DIGITS];        /* Remainder                 */
 int     count1, count2;                 /* Significant digit counters*/
 int     sign1, sign2;                   /* Sign of operands          */
 int     signq, signr;                   /* Sign of quotient/remainder*/
+U64     bin1, bin2;                     /* Binary operand values     */
 
     SS(inst, regs, l1, l2, b1, effective_addr1, b2, effective_addr2);
     PER_ZEROADDR_XCHECK2( regs, b1, b2 );
@@ -853,6 +1132,31 @@ int     signq, signr;                   /* Sign of quotient/remainder*/
     if (l2 > 7 || l2 >= l1)
         ARCH_DEP(program_interrupt) (regs, PGM_SPECIFICATION_EXCEPTION);
 
+    /* A dividend of up to 15 digits is divided in binary */
+    if (l1 < MAX_BINARY_LENGTH)
+    {
+        ARCH_DEP(load_packed_u64) (effective_addr1, l1, b1, regs, &bin1, &count1, &sign1);
+        ARCH_DEP(load_packed_u64) (effective_addr2, l2, b2, regs, &bin2, &count2, &sign2);
+
+        /* Program check if second operand value is zero */
+        if (bin2 == 0)
+            ARCH_DEP(program_interrupt) (regs, PGM_DECIMAL_DIVIDE_EXCEPTION);
+
+        /* Divide exception if the divisor is less than or equal to
+           the leftmost digits of the dividend (see trial comparison
+           below), that is, if the quotient would not fit into the
+           (l1-l2)*2-1 digits of the quotient field */
+        if (bin2 <= bin1 / dec_pow10[ (l1 - l2) * 2 - 1 ])
+            ARCH_DEP(program_interrupt) (regs, PGM_DECIMAL_DIVIDE_EXCEPTION);
+
+        /* Store remainder, then quotient, as described below */
+        signq = (sign1 == sign2) ? 1 : -1;
+        signr = sign1;
+        ARCH_DEP(store_packed_u64) (effective_addr1, l1, b1, regs, bin1 % bin2, signr);
+        ARCH_DEP(store_packed_u64) (effective_addr1, l1-l2-1, b1, regs, bin1 / bin2, signq);
+        return;
+    }
+
     /* Load operands into work areas */
     ARCH_DEP(load_decimal) (effective_addr1, l1, b1, regs, dec1, &count1, &sign1);
     ARCH_DEP(load_decimal) (effective_addr2, l2, b2, regs, dec2, &count2, &sign2);
@@ -1106,6 +1410,7 @@ int     sign1, sign2, sign3;            /* Sign of operands & result */
 int     d;                              /* Decimal digit             */
 int     i1, i2, i3;                     /* Array subscripts          */
 int     carry;                          /* Carry indicator           */
+U64     bin1, bin2;                     /* Binary operand values     */
 
     SS(inst, regs, l1, l2, b1, effective_addr1, b2, effective_addr2);
     PER_ZEROADDR_XCHECK2( regs, b1, b2 );
@@ -1116,6 +1421,25 @@ int     carry;                          /* Carry indicator           */
     if (l2 > 7 || l2 >= l1)
         ARCH_DEP(program_interrupt) (regs, PGM_SPECIFICATION_EXCEPTION);
 
+    /* A product of up to 15 digits is computed in binary */
+    if (l1 < MAX_BINARY_LENGTH)
+    {
+        ARCH_DEP(load_packed_u64) (effective_addr1, l1, b1, regs, &bin1, &count1, &sign1);
+        ARCH_DEP(load_packed_u64) (effective_addr2, l2, b2, regs, &bin2, &count2, &sign2);
+
+        /* Data exception unless the product is sure to fit (below) */
+        if (l2 > l1 - (count1/2 + 1))
+        {
+            regs->dxc = DXC_DECIMAL;
+            ARCH_DEP(program_interrupt) (regs, PGM_DATA_EXCEPTION);
+        }
+
+        /* Result sign follows the operand signs even if zero */
+        sign3 = (sign1 == sign2) ? 1 : -1;
+        ARCH_DEP(store_packed_u64) (effective_addr1, l1, b1, regs, bin1 * bin2, sign3);
+        return;
+    }
+
     /* Load operands into work areas */
     ARCH_DEP(load_decimal) (effective_addr1, l1, b1, regs, dec1, &count1, &sign1);
     ARCH_DEP(load_decimal) (effective_addr2, l2, b2, regs, dec2, &count2, &sign2);
@@ -1273,11 +1597,29 @@ BYTE    dec2[MAX_DECIMAL_DIGITS];       /* Work area for operand 2   */
 BYTE    dec3[MAX_DECIMAL_DIGITS];       /* Work area for result      */
 int     count1, count2, count3;         /* Significant digit counters*/
 int     sign1, sign2, sign3;            /* Sign of operands & result */
+U64     bin1, bin2;                     /* Binary operand values     */
 
     SS(inst, regs, l1, l2, b1, effective_addr1, b2, effective_addr2);
     PER_ZEROADDR_XCHECK2( regs, b1, b2 );
     TXFC_INSTR_CHECK( regs );
 
+    /* Operands of up to 15 digits are subtracted in binary */
+    if (l1 < MAX_BINARY_LENGTH && l2 < MAX_BINARY_LENGTH)
+    {
+        ARCH_DEP(load_packed_u64) (effective_addr1, l1, b1, regs, &bin1, &count1, &sign1);
+        ARCH_DEP(load_packed_u64) (effective_addr2, l2, b2, regs, &bin2, &count2, &sign2);
+
+        /* Store the signed difference and set condition code */
+        cc = ARCH_DEP(store_packed_result) (effective_addr1, l1, b1, regs,
+                    sign1 * (S64) bin1 - sign2 * (S64) bin2);
+        regs->psw.cc = cc;
+
+        /* Program check if overflow and PSW program mask is set */
+        if (cc == 3 && DOMASK(&regs->psw))
+            ARCH_DEP(program_interrupt) (regs, PGM_DECIMAL_OVERFLOW_EXCEPTION);
+        return;
+    }
+
     /* Load operands into work areas */
     ARCH_DEP(load_decimal) (effective_addr1, l1, b1, regs, dec1, &count1, &sign1);
     ARCH_DEP(load_decimal) (effective_addr2, l2, b2, regs, dec2, &count2, &sign2);
@@ -1347,11 +1689,28 @@ int     cc;                             /* Condition code            */
 BYTE    dec[MAX_DECIMAL_DIGITS];        /* Work area for operand     */
 int     count;                          /* Significant digit counter */
 int     sign;                           /* Sign                      */
+U64     bin;                            /* Binary operand value      */
 
     SS(inst, regs, l1, l2, b1, effective_addr1, b2, effective_addr2);
     PER_ZEROADDR_XCHECK2( regs, b1, b2 );
     TXFC_INSTR_CHECK( regs );
 
+    /* A second operand of up to 15 digits is moved in binary */
+    if (l2 < MAX_BINARY_LENGTH)
+    {
+        ARCH_DEP(load_packed_u64) (effective_addr2, l2, b2, regs, &bin, &count, &sign);
+
+        /* Store the signed result and set condition code */
+        cc = ARCH_DEP(store_packed_result) (effective_addr1, l1, b1, regs,
+                                            sign * (S64) bin);
+        regs->psw.cc = cc;
+
+        /* Program check if overflow and PSW program mask is set */
+        if (cc == 3 && DOMASK(&regs->psw))
+            ARCH_DEP(program_interrupt) (regs, PGM_DECIMAL_OVERFLOW_EXCEPTION);
+        return;
+    }
+
     /* Load second operand into work area */
     ARCH_DEP(load_decimal) (effective_addr2, l2, b2, regs, dec, &count, &sign);
 
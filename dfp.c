@@ -808,6 +808,770 @@ int             exp;                    /* Adjusted exponent         */
 
 } /* end function dfp_test_data_group */
 
+/*-------------------------------------------------------------------*/
+/* Integer coefficient fast paths                                    */
+/*                                                                   */
+/* Most additions, subtractions and multiplications in commercial    */
+/* workloads have finite operands and an exact result that fits the  */
+/* coefficient of the format, so the result needs no rounding and    */
+/* recognizes no exception. The routines below handle those cases    */
+/* without decNumber: the densely packed coefficients are decoded    */
+/* into binary integers, the arithmetic is done on the host, and the */
+/* result is encoded with the exponent decNumber would choose.       */
+/*                                                                   */
+/* Each routine returns 1 if it produced the result, or 0 if the     */
+/* operation must be done by decNumber: an operand is an infinity    */
+/* or NaN, the exact result does not fit, or the result exponent is  */
+/* outside the range in which every coefficient is a normal number   */
+/* that needs no clamping.                                           */
+/*-------------------------------------------------------------------*/
+#define DFP32_DIGITS    7               /* Short coefficient digits  */
+#define DFP32_BIAS      101             /* Short exponent bias       */
+#define DFP32_EMIN      (-95)           /* Short minimum exponent    */
+#define DFP32_ETOP      90              /* Short maximum exponent    */
+                                        /* for a full coefficient    */
+#define DFP64_DIGITS    16              /* Long coefficient digits   */
+#define DFP64_BIAS      398             /* Long exponent bias        */
+#define DFP64_EMIN      (-383)          /* Long minimum exponent     */
+#define DFP64_ETOP      369             /* Long maximum exponent     */
+                                        /* for a full coefficient    */
+#define DFP128_DIGITS   34              /* Ext coefficient digits    */
+#define DFP128_BIAS     6176            /* Ext exponent bias         */
+#define DFP128_EMIN     (-6143)         /* Ext minimum exponent      */
+#define DFP128_ETOP     6111            /* Ext maximum exponent      */
+                                        /* for a full coefficient    */
+
+/* 1 if the FPC rounding mode is round toward -infinity, which
+   gives an exact zero sum of opposite signs a minus sign */
+#define DFP_FPC_RTMI(_regs) \
+        (((_regs)->fpc & FPC_DRM) == (DRM_RTMI << FPC_DRM_SHIFT))
+
+/* Binary value (0-999) of each 10-bit densely packed declet.
+   The 24 non-canonical declets decode like their canonical forms */
+static const U16
+dfp_dpd2bin[1024] = {
+      0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 80, 81,800,801,880,881,
+     10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 90, 91,810,811,890,891,
+     20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 82, 83,820,821,808,809,
+     30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 92, 93,830,831,818,819,
+     40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 84, 85,840,841, 88, 89,
+     50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 94, 95,850,851, 98, 99,
+     60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 86, 87,860,861,888,889,
+     70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 96, 97,870,871,898,899,
+    100,101,102,103,104,105,106,107,108,109,180,181,900,901,980,981,
+    110,111,112,113,114,115,116,117,118,119,190,191,910,911,990,991,
+    120,121,122,123,124,125,126,127,128,129,182,183,920,921,908,909,
+    130,131,132,133,134,135,136,137,138,139,192,193,930,931,918,919,
+    140,141,142,143,144,145,146,147,148,149,184,185,940,941,188,189,
+    150,151,152,153,154,155,156,157,158,159,194,195,950,951,198,199,
+    160,161,162,163,164,165,166,167,168,169,186,187,960,961,988,989,
+    170,171,172,173,174,175,176,177,178,179,196,197,970,971,998,999,
+    200,201,202,203,204,205,206,207,208,209,280,281,802,803,882,883,
+    210,211,212,213,214,215,216,217,218,219,290,291,812,813,892,893,
+    220,221,222,223,224,225,226,227,228,229,282,283,822,823,828,829,
+    230,231,232,233,234,235,236,237,238,239,292,293,832,833,838,839,
+    240,241,242,243,244,245,246,247,248,249,284,285,842,843,288,289,
+    250,251,252,253,254,255,256,257,258,259,294,295,852,853,298,299,
+    260,261,262,263,264,265,266,267,268,269,286,287,862,863,888,889,
+    270,271,272,273,274,275,276,277,278,279,296,297,872,873,898,899,
+    300,301,302,303,304,305,306,307,308,309,380,381,902,903,982,983,
+    310,311,312,313,314,315,316,317,318,319,390,391,912,913,992,993,
+    320,321,322,323,324,325,326,327,328,329,382,383,922,923,928,929,
+    330,331,332,333,334,335,336,337,338,339,392,393,932,933,938,939,
+    340,341,342,343,344,345,346,347,348,349,384,385,942,943,388,389,
+    350,351,352,353,354,355,356,357,358,359,394,395,952,953,398,399,
+    360,361,362,363,364,365,366,367,368,369,386,387,962,963,988,989,
+    370,371,372,373,374,375,376,377,378,379,396,397,972,973,998,999,
+    400,401,402,403,404,405,406,407,408,409,480,481,804,805,884,885,
+    410,411,412,413,414,415,416,417,418,419,490,491,814,815,894,895,
+    420,421,422,423,424,425,426,427,428,429,482,483,824,825,848,849,
+    430,431,432,433,434,435,436,437,438,439,492,493,834,835,858,859,
+    440,441,442,443,444,445,446,447,448,449,484,485,844,845,488,489,
+    450,451,452,453,454,455,456,457,458,459,494,495,854,855,498,499,
+    460,461,462,463,464,465,466,467,468,469,486,487,864,865,888,889,
+    470,471,472,473,474,475,476,477,478,479,496,497,874,875,898,899,
+    500,501,502,503,504,505,506,507,508,509,580,581,904,905,984,985,
+    510,511,512,513,514,515,516,517,518,519,590,591,914,915,994,995,
+    520,521,522,523,524,525,526,527,528,529,582,583,924,925,948,949,
+    530,531,532,533,534,535,536,537,538,539,592,593,934,935,958,959,
+    540,541,542,543,544,545,546,547,548,549,584,585,944,945,588,589,
+    550,551,552,553,554,555,556,557,558,559,594,595,954,955,598,599,
+    560,561,562,563,564,565,566,567,568,569,586,587,964,965,988,989,
+    570,571,572,573,574,575,576,577,578,579,596,597,974,975,998,999,
+    600,601,602,603,604,605,606,607,608,609,680,681,806,807,886,887,
+    610,611,612,613,614,615,616,617,618,619,690,691,816,817,896,897,
+    620,621,622,623,624,625,626,627,628,629,682,683,826,827,868,869,
+    630,631,632,633,634,635,636,637,638,639,692,693,836,837,878,879,
+    640,641,642,643,644,645,646,647,648,649,684,685,846,847,688,689,
+    650,651,652,653,654,655,656,657,658,659,694,695,856,857,698,699,
+    660,661,662,663,664,665,666,667,668,669,686,687,866,867,888,889,
+    670,671,672,673,674,675,676,677,678,679,696,697,876,877,898,899,
+    700,701,702,703,704,705,706,707,708,709,780,781,906,907,986,987,
+    710,711,712,713,714,715,716,717,718,719,790,791,916,917,996,997,
+    720,721,722,723,724,725,726,727,728,729,782,783,926,927,968,969,
+    730,731,732,733,734,735,736,737,738,739,792,793,936,937,978,979,
+    740,741,742,743,744,745,746,747,748,749,784,785,946,947,788,789,
+    750,751,752,753,754,755,756,757,758,759,794,795,956,957,798,799,
+    760,761,762,763,764,765,766,767,768,769,786,787,966,967,988,989,
+    770,771,772,773,774,775,776,777,778,779,796,797,976,977,998,999
+};
+
+/* Densely packed declet for each binary value 0-999 */
+static const U16
+dfp_bin2dpd[1000] = {
+    0x000, 0x001, 0x002, 0x003, 0x004, 0x005, 0x006, 0x007, 0x008, 0x009,
+    0x010, 0x011, 0x012, 0x013, 0x014, 0x015, 0x016, 0x017, 0x018, 0x019,
+    0x020, 0x021, 0x022, 0x023, 0x024, 0x025, 0x026, 0x027, 0x028, 0x029,
+    0x030, 0x031, 0x032, 0x033, 0x034, 0x035, 0x036, 0x037, 0x038, 0x039,
+    0x040, 0x041, 0x042, 0x043, 0x044, 0x045, 0x046, 0x047, 0x048, 0x049,
+    0x050, 0x051, 0x052, 0x053, 0x054, 0x055, 0x056, 0x057, 0x058, 0x059,
+    0x060, 0x061, 0x062, 0x063, 0x064, 0x065, 0x066, 0x067, 0x068, 0x069,
+    0x070, 0x071, 0x072, 0x073, 0x074, 0x075, 0x076, 0x077, 0x078, 0x079,
+    0x00A, 0x00B, 0x02A, 0x02B, 0x04A, 0x04B, 0x06A, 0x06B, 0x04E, 0x04F,
+    0x01A, 0x01B, 0x03A, 0x03B, 0x05A, 0x05B, 0x07A, 0x07B, 0x05E, 0x05F,
+    0x080, 0x081, 0x082, 0x083, 0x084, 0x085, 0x086, 0x087, 0x088, 0x089,
+    0x090, 0x091, 0x092, 0x093, 0x094, 0x095, 0x096, 0x097, 0x098, 0x099,
+    0x0A0, 0x0A1, 0x0A2, 0x0A3, 0x0A4, 0x0A5, 0x0A6, 0x0A7, 0x0A8, 0x0A9,
+    0x0B0, 0x0B1, 0x0B2, 0x0B3, 0x0B4, 0x0B5, 0x0B6, 0x0B7, 0x0B8, 0x0B9,
+    0x0C0, 0x0C1, 0x0C2, 0x0C3, 0x0C4, 0x0C5, 0x0C6, 0x0C7, 0x0C8, 0x0C9,
+    0x0D0, 0x0D1, 0x0D2, 0x0D3, 0x0D4, 0x0D5, 0x0D6, 0x0D7, 0x0D8, 0x0D9,
+    0x0E0, 0x0E1, 0x0E2, 0x0E3, 0x0E4, 0x0E5, 0x0E6, 0x0E7, 0x0E8, 0x0E9,
+    0x0F0, 0x0F1, 0x0F2, 0x0F3, 0x0F4, 0x0F5, 0x0F6, 0x0F7, 0x0F8, 0x0F9,
+    0x08A, 0x08B, 0x0AA, 0x0AB, 0x0CA, 0x0CB, 0x0EA, 0x0EB, 0x0CE, 0x0CF,
+    0x09A, 0x09B, 0x0BA, 0x0BB, 0x0DA, 0x0DB, 0x0FA, 0x0FB, 0x0DE, 0x0DF,
+    0x100, 0x101, 0x102, 0x103, 0x104, 0x105, 0x106, 0x107, 0x108, 0x109,
+    0x110, 0x111, 0x112, 0x113, 0x114, 0x115, 0x116, 0x117, 0x118, 0x119,
+    0x120, 0x121, 0x122, 0x123, 0x124, 0x125, 0x126, 0x127, 0x128, 0x129,
+    0x130, 0x131, 0x132, 0x133, 0x134, 0x135, 0x136, 0x137, 0x138, 0x139,
+    0x140, 0x141, 0x142, 0x143, 0x144, 0x145, 0x146, 0x147, 0x148, 0x149,
+    0x150, 0x151, 0x152, 0x153, 0x154, 0x155, 0x156, 0x157, 0x158, 0x159,
+    0x160, 0x161, 0x162, 0x163, 0x164, 0x165, 0x166, 0x167, 0x168, 0x169,
+    0x170, 0x171, 0x172, 0x173, 0x174, 0x175, 0x176, 0x177, 0x178, 0x179,
+    0x10A, 0x10B, 0x12A, 0x12B, 0x14A, 0x14B, 0x16A, 0x16B, 0x14E, 0x14F,
+    0x11A, 0x11B, 0x13A, 0x13B, 0x15A, 0x15B, 0x17A, 0x17B, 0x15E, 0x15F,
+    0x180, 0x181, 0x182, 0x183, 0x184, 0x185, 0x186, 0x187, 0x188, 0x189,
+    0x190, 0x191, 0x192, 0x193, 0x194, 0x195, 0x196, 0x197, 0x198, 0x199,
+    0x1A0, 0x1A1, 0x1A2, 0x1A3, 0x1A4, 0x1A5, 0x1A6, 0x1A7, 0x1A8, 0x1A9,
+    0x1B0, 0x1B1, 0x1B2, 0x1B3, 0x1B4, 0x1B5, 0x1B6, 0x1B7, 0x1B8, 0x1B9,
+    0x1C0, 0x1C1, 0x1C2, 0x1C3, 0x1C4, 0x1C5, 0x1C6, 0x1C7, 0x1C8, 0x1C9,
+    0x1D0, 0x1D1, 0x1D2, 0x1D3, 0x1D4, 0x1D5, 0x1D6, 0x1D7, 0x1D8, 0x1D9,
+    0x1E0, 0x1E1, 0x1E2, 0x1E3, 0x1E4, 0x1E5, 0x1E6, 0x1E7, 0x1E8, 0x1E9,
+    0x1F0, 0x1F1, 0x1F2, 0x1F3, 0x1F4, 0x1F5, 0x1F6, 0x1F7, 0x1F8, 0x1F9,
+    0x18A, 0x18B, 0x1AA, 0x1AB, 0x1CA, 0x1CB, 0x1EA, 0x1EB, 0x1CE, 0x1CF,
+    0x19A, 0x19B, 0x1BA, 0x1BB, 0x1DA, 0x1DB, 0x1FA, 0x1FB, 0x1DE, 0x1DF,
+    0x200, 0x201, 0x202, 0x203, 0x204, 0x205, 0x206, 0x207, 0x208, 0x209,
+    0x210, 0x211, 0x212, 0x213, 0x214, 0x215, 0x216, 0x217, 0x218, 0x219,
+    0x220, 0x221, 0x222, 0x223, 0x224, 0x225, 0x226, 0x227, 0x228, 0x229,
+    0x230, 0x231, 0x232, 0x233, 0x234, 0x235, 0x236, 0x237, 0x238, 0x239,
+    0x240, 0x241, 0x242, 0x243, 0x244, 0x245, 0x246, 0x247, 0x248, 0x249,
+    0x250, 0x251, 0x252, 0x253, 0x254, 0x255, 0x256, 0x257, 0x258, 0x259,
+    0x260, 0x261, 0x262, 0x263, 0x264, 0x265, 0x266, 0x267, 0x268, 0x269,
+    0x270, 0x271, 0x272, 0x273, 0x274, 0x275, 0x276, 0x277, 0x278, 0x279,
+    0x20A, 0x20B, 0x22A, 0x22B, 0x24A, 0x24B, 0x26A, 0x26B, 0x24E, 0x24F,
+    0x21A, 0x21B, 0x23A, 0x23B, 0x25A, 0x25B, 0x27A, 0x27B, 0x25E, 0x25F,
+    0x280, 0x281, 0x282, 0x283, 0x284, 0x285, 0x286, 0x287, 0x288, 0x289,
+    0x290, 0x291, 0x292, 0x293, 0x294, 0x295, 0x296, 0x297, 0x298, 0x299,
+    0x2A0, 0x2A1, 0x2A2, 0x2A3, 0x2A4, 0x2A5, 0x2A6, 0x2A7, 0x2A8, 0x2A9,
+    0x2B0, 0x2B1, 0x2B2, 0x2B3, 0x2B4, 0x2B5, 0x2B6, 0x2B7, 0x2B8, 0x2B9,
+    0x2C0, 0x2C1, 0x2C2, 0x2C3, 0x2C4, 0x2C5, 0x2C6, 0x2C7, 0x2C8, 0x2C9,
+    0x2D0, 0x2D1, 0x2D2, 0x2D3, 0x2D4, 0x2D5, 0x2D6, 0x2D7, 0x2D8, 0x2D9,
+    0x2E0, 0x2E1, 0x2E2, 0x2E3, 0x2E4, 0x2E5, 0x2E6, 0x2E7, 0x2E8, 0x2E9,
+    0x2F0, 0x2F1, 0x2F2, 0x2F3, 0x2F4, 0x2F5, 0x2F6, 0x2F7, 0x2F8, 0x2F9,
+    0x28A, 0x28B, 0x2AA, 0x2AB, 0x2CA, 0x2CB, 0x2EA, 0x2EB, 0x2CE, 0x2CF,
+    0x29A, 0x29B, 0x2BA, 0x2BB, 0x2DA, 0x2DB, 0x2FA, 0x2FB, 0x2DE, 0x2DF,
+    0x300, 0x301, 0x302, 0x303, 0x304, 0x305, 0x306, 0x307, 0x308, 0x309,
+    0x310, 0x311, 0x312, 0x313, 0x314, 0x315, 0x316, 0x317, 0x318, 0x319,
+    0x320, 0x321, 0x322, 0x323, 0x324, 0x325, 0x326, 0x327, 0x328, 0x329,
+    0x330, 0x331, 0x332, 0x333, 0x334, 0x335, 0x336, 0x337, 0x338, 0x339,
+    0x340, 0x341, 0x342, 0x343, 0x344, 0x345, 0x346, 0x347, 0x348, 0x349,
+    0x350, 0x351, 0x352, 0x353, 0x354, 0x355, 0x356, 0x357, 0x358, 0x359,
+    0x360, 0x361, 0x362, 0x363, 0x364, 0x365, 0x366, 0x367, 0x368, 0x369,
+    0x370, 0x371, 0x372, 0x373, 0x374, 0x375, 0x376, 0x377, 0x378, 0x379,
+    0x30A, 0x30B, 0x32A, 0x32B, 0x34A, 0x34B, 0x36A, 0x36B, 0x34E, 0x34F,
+    0x31A, 0x31B, 0x33A, 0x33B, 0x35A, 0x35B, 0x37A, 0x37B, 0x35E, 0x35F,
+    0x380, 0x381, 0x382, 0x383, 0x384, 0x385, 0x386, 0x387, 0x388, 0x389,
+    0x390, 0x391, 0x392, 0x393, 0x394, 0x395, 0x396, 0x397, 0x398, 0x399,
+    0x3A0, 0x3A1, 0x3A2, 0x3A3, 0x3A4, 0x3A5, 0x3A6, 0x3A7, 0x3A8, 0x3A9,
+    0x3B0, 0x3B1, 0x3B2, 0x3B3, 0x3B4, 0x3B5, 0x3B6, 0x3B7, 0x3B8, 0x3B9,
+    0x3C0, 0x3C1, 0x3C2, 0x3C3, 0x3C4, 0x3C5, 0x3C6, 0x3C7, 0x3C8, 0x3C9,
+    0x3D0, 0x3D1, 0x3D2, 0x3D3, 0x3D4, 0x3D5, 0x3D6, 0x3D7, 0x3D8, 0x3D9,
+    0x3E0, 0x3E1, 0x3E2, 0x3E3, 0x3E4, 0x3E5, 0x3E6, 0x3E7, 0x3E8, 0x3E9,
+    0x3F0, 0x3F1, 0x3F2, 0x3F3, 0x3F4, 0x3F5, 0x3F6, 0x3F7, 0x3F8, 0x3F9,
+    0x38A, 0x38B, 0x3AA, 0x3AB, 0x3CA, 0x3CB, 0x3EA, 0x3EB, 0x3CE, 0x3CF,
+    0x39A, 0x39B, 0x3BA, 0x3BB, 0x3DA, 0x3DB, 0x3FA, 0x3FB, 0x3DE, 0x3DF,
+    0x00C, 0x00D, 0x10C, 0x10D, 0x20C, 0x20D, 0x30C, 0x30D, 0x02E, 0x02F,
+    0x01C, 0x01D, 0x11C, 0x11D, 0x21C, 0x21D, 0x31C, 0x31D, 0x03E, 0x03F,
+    0x02C, 0x02D, 0x12C, 0x12D, 0x22C, 0x22D, 0x32C, 0x32D, 0x12E, 0x12F,
+    0x03C, 0x03D, 0x13C, 0x13D, 0x23C, 0x23D, 0x33C, 0x33D, 0x13E, 0x13F,
+    0x04C, 0x04D, 0x14C, 0x14D, 0x24C, 0x24D, 0x34C, 0x34D, 0x22E, 0x22F,
+    0x05C, 0x05D, 0x15C, 0x15D, 0x25C, 0x25D, 0x35C, 0x35D, 0x23E, 0x23F,
+    0x06C, 0x06D, 0x16C, 0x16D, 0x26C, 0x26D, 0x36C, 0x36D, 0x32E, 0x32F,
+    0x07C, 0x07D, 0x17C, 0x17D, 0x27C, 0x27D, 0x37C, 0x37D, 0x33E, 0x33F,
+    0x00E, 0x00F, 0x10E, 0x10F, 0x20E, 0x20F, 0x30E, 0x30F, 0x06E, 0x06F,
+    0x01E, 0x01F, 0x11E, 0x11F, 0x21E, 0x21F, 0x31E, 0x31F, 0x07E, 0x07F,
+    0x08C, 0x08D, 0x18C, 0x18D, 0x28C, 0x28D, 0x38C, 0x38D, 0x0AE, 0x0AF,
+    0x09C, 0x09D, 0x19C, 0x19D, 0x29C, 0x29D, 0x39C, 0x39D, 0x0BE, 0x0BF,
+    0x0AC, 0x0AD, 0x1AC, 0x1AD, 0x2AC, 0x2AD, 0x3AC, 0x3AD, 0x1AE, 0x1AF,
+    0x0BC, 0x0BD, 0x1BC, 0x1BD, 0x2BC, 0x2BD, 0x3BC, 0x3BD, 0x1BE, 0x1BF,
+    0x0CC, 0x0CD, 0x1CC, 0x1CD, 0x2CC, 0x2CD, 0x3CC, 0x3CD, 0x2AE, 0x2AF,
+    0x0DC, 0x0DD, 0x1DC, 0x1DD, 0x2DC, 0x2DD, 0x3DC, 0x3DD, 0x2BE, 0x2BF,
+    0x0EC, 0x0ED, 0x1EC, 0x1ED, 0x2EC, 0x2ED, 0x3EC, 0x3ED, 0x3AE, 0x3AF,
+    0x0FC, 0x0FD, 0x1FC, 0x1FD, 0x2FC, 0x2FD, 0x3FC, 0x3FD, 0x3BE, 0x3BF,
+    0x08E, 0x08F, 0x18E, 0x18F, 0x28E, 0x28F, 0x38E, 0x38F, 0x0EE, 0x0EF,
+    0x09E, 0x09F, 0x19E, 0x19F, 0x29E, 0x29F, 0x39E, 0x39F, 0x0FE, 0x0FF
+};
+
+/* Powers of ten that fit in 64 bits */
+static const U64
+dfp_pow10[20] = {
+    1ULL,
+    10ULL,
+    100ULL,
+    1000ULL,
+    10000ULL,
+    100000ULL,
+    1000000ULL,
+    10000000ULL,
+    100000000ULL,
+    1000000000ULL,
+    10000000000ULL,
+    100000000000ULL,
+    1000000000000ULL,
+    10000000000000ULL,
+    100000000000000ULL,
+    1000000000000000ULL,
+    10000000000000000ULL,
+    100000000000000000ULL,
+    1000000000000000000ULL,
+    10000000000000000000ULL
+};
+
+/*-------------------------------------------------------------------*/
+/* Decode a finite decimal64 into exponent and binary coefficient    */
+/*                                                                   */
+/* Input:                                                            */
+/*      x       Long DFP value                                       */
+/*      exp     Pointer to unbiased exponent                         */
+/*      coef    Pointer to binary coefficient                        */
+/* Output:                                                           */
+/*      The return value is 0 if x is an infinity or NaN, else 1.    */
+/*-------------------------------------------------------------------*/
+static inline int
+dfp64_unpack(U64 x, int *exp, U64 *coef)
+{
+U32             cf;                     /* Combination field         */
+U64             c;                      /* Coefficient               */
+int             i;                      /* Declet shift amount       */
+
+    cf = (U32)(x >> 58) & 0x1F;
+    if (cf >= 0x1E)
+        return 0;
+
+    if (cf >= 0x18)
+    {
+        *exp = ((cf >> 1) & 0x03) << 8;
+        c = 8 + (cf & 0x01);
+    }
+    else
+    {
+        *exp = (cf >> 3) << 8;
+        c = cf & 0x07;
+    }
+    *exp = (*exp | (int)((x >> 50) & 0xFF)) - DFP64_BIAS;
+
+    for (i = 40; i >= 0; i -= 10)
+        c = c * 1000 + dfp_dpd2bin[(x >> i) & 0x3FF];
+
+    *coef = c;
+    return 1;
+
+} /* end function dfp64_unpack */
+
+/*-------------------------------------------------------------------*/
+/* Encode a decimal32 or decimal64 from exponent and coefficient     */
+/*                                                                   */
+/* The exponent must be in the range of the format and the           */
+/* coefficient less than 10**7 or 10**16 respectively.               */
+/*-------------------------------------------------------------------*/
+static inline U32
+dfp32_pack(int sign, int exp, U32 coef)
+{
+U32             be = exp + DFP32_BIAS;  /* Biased exponent           */
+U32             lmd;                    /* Leftmost digit            */
+U32             cf;                     /* Combination field         */
+U32             x;                      /* Result                    */
+
+    x = dfp_bin2dpd[coef % 1000];
+    x |= (U32)dfp_bin2dpd[(coef / 1000) % 1000] << 10;
+    lmd = coef / 1000000;
+
+    cf = (lmd < 8) ? ((be >> 6) << 3) | lmd
+                   : 0x18 | ((be >> 6) << 1) | (lmd & 0x01);
+
+    return (U32)sign << 31 | cf << 26 | (be & 0x3F) << 20 | x;
+
+} /* end function dfp32_pack */
+
+static inline U64
+dfp64_pack(int sign, int exp, U64 coef)
+{
+U32             be = exp + DFP64_BIAS;  /* Biased exponent           */
+U32             lmd;                    /* Leftmost digit            */
+U32             cf;                     /* Combination field         */
+U64             x = 0;                  /* Result                    */
+int             i;                      /* Declet shift amount       */
+
+    for (i = 0; i < 50; i += 10)
+    {
+        x |= (U64)dfp_bin2dpd[coef % 1000] << i;
+        coef /= 1000;
+    }
+    lmd = (U32)coef;
+
+    cf = (lmd < 8) ? ((be >> 8) << 3) | lmd
+                   : 0x18 | ((be >> 8) << 1) | (lmd & 0x01);
+
+    return (U64)sign << 63 | (U64)cf << 58 | (U64)(be & 0xFF) << 50 | x;
+
+} /* end function dfp64_pack */
+
+/*-------------------------------------------------------------------*/
+/* Decode a finite decimal128 into exponent and binary coefficient   */
+/*                                                                   */
+/* Input:                                                            */
+/*      hi, lo  Extended DFP value (FPR bits 0-63 and 64-127)        */
+/*      exp     Pointer to unbiased exponent                         */
+/*      chi     Pointer to leftmost 16 digits of the coefficient     */
+/*      clo     Pointer to rightmost 18 digits of the coefficient    */
+/* Output:                                                           */
+/*      The return value is 0 if the value is an infinity or NaN,    */
+/*      else 1. The coefficient is chi * 10**18 + clo.               */
+/*-------------------------------------------------------------------*/
+static inline int
+dfp128_unpack(U64 hi, U64 lo, int *exp, U64 *chi, U64 *clo)
+{
+U32             cf;                     /* Combination field         */
+U64             c;                      /* Coefficient digits        */
+int             i;                      /* Declet shift amount       */
+
+    cf = (U32)(hi >> 58) & 0x1F;
+    if (cf >= 0x1E)
+        return 0;
+
+    if (cf >= 0x18)
+    {
+        *exp = ((cf >> 1) & 0x03) << 12;
+        c = 8 + (cf & 0x01);
+    }
+    else
+    {
+        *exp = (cf >> 3) << 12;
+        c = cf & 0x07;
+    }
+    *exp = (*exp | (int)((hi >> 46) & 0xFFF)) - DFP128_BIAS;
+
+    /* Declets 10-7 are in the high doubleword, declet 6 spans both */
+    for (i = 36; i >= 6; i -= 10)
+        c = c * 1000 + dfp_dpd2bin[(hi >> i) & 0x3FF];
+    c = c * 1000 + dfp_dpd2bin[((hi & 0x3F) << 4) | (lo >> 60)];
+    *chi = c;
+
+    for (c = 0, i = 50; i >= 0; i -= 10)
+        c = c * 1000 + dfp_dpd2bin[(lo >> i) & 0x3FF];
+    *clo = c;
+
+    return 1;
+
+} /* end function dfp128_unpack */
+
+/*-------------------------------------------------------------------*/
+/* Encode a decimal128 from exponent and coefficient                 */
+/*                                                                   */
+/* The exponent must be in the range of the format, chi less than    */
+/* 10**16 and clo less than 10**18.                                  */
+/*-------------------------------------------------------------------*/
+static inline void
+dfp128_pack(int sign, int exp, U64 chi, U64 clo, U64 *hi, U64 *lo)
+{
+U32             be = exp + DFP128_BIAS; /* Biased exponent           */
+U32             lmd;                    /* Leftmost digit            */
+U32             cf;                     /* Combination field         */
+U32             d6;                     /* Declet 6                  */
+U64             x = 0;                  /* Result doubleword         */
+int             i;                      /* Declet shift amount       */
+
+    for (i = 0; i < 60; i += 10)
+    {
+        x |= (U64)dfp_bin2dpd[clo % 1000] << i;
+        clo /= 1000;
+    }
+    d6 = dfp_bin2dpd[chi % 1000];
+    chi /= 1000;
+    *lo = x | (U64)d6 << 60;
+
+    for (x = d6 >> 4, i = 6; i < 46; i += 10)
+    {
+        x |= (U64)dfp_bin2dpd[chi % 1000] << i;
+        chi /= 1000;
+    }
+    lmd = (U32)chi;
+
+    cf = (lmd < 8) ? ((be >> 12) << 3) | lmd
+                   : 0x18 | ((be >> 12) << 1) | (lmd & 0x01);
+
+    *hi = (U64)sign << 63 | (U64)cf << 58 | (U64)(be & 0xFFF) << 46 | x;
+
+} /* end function dfp128_pack */
+
+/*-------------------------------------------------------------------*/
+/* Multiply a long coefficient by a power of ten if it stays below   */
+/* 10**16. The return value is 0 if it would not.                    */
+/*-------------------------------------------------------------------*/
+static inline int
+dfp64_scale(U64 *coef, int n)
+{
+    if (*coef == 0)
+        return 1;
+    if (n >= DFP64_DIGITS || *coef >= dfp_pow10[DFP64_DIGITS - n])
+        return 0;
+    *coef *= dfp_pow10[n];
+    return 1;
+
+} /* end function dfp64_scale */
+
+/*-------------------------------------------------------------------*/
+/* Add two long DFP values whose sum is exact                        */
+/*                                                                   */
+/* Input:                                                            */
+/*      x2, x3  Long DFP operands (negate x3 to subtract)            */
+/*      rtmi    1 if the rounding mode is round toward -infinity     */
+/*      x1      Pointer to long DFP result                           */
+/*      cc      Pointer to condition code                            */
+/* Output:                                                           */
+/*      The return value is 1 if the result and condition code were  */
+/*      set, or 0 if the sum must be computed by decNumber.          */
+/*-------------------------------------------------------------------*/
+static inline int
+dfp64_add_exact(U64 x2, U64 x3, int rtmi, U64 *x1, BYTE *cc)
+{
+int             e2, e3, e;              /* Unbiased exponents        */
+U64             c2, c3, c;              /* Binary coefficients       */
+int             s2, s3, s;              /* Signs                     */
+
+    if (!dfp64_unpack(x2, &e2, &c2) || !dfp64_unpack(x3, &e3, &c3))
+        return 0;
+    s2 = (int)(x2 >> 63);
+    s3 = (int)(x3 >> 63);
+
+    /* Align to the smaller exponent, which is the ideal exponent */
+    e = e2;
+    if (e2 > e3)
+    {
+        if (!dfp64_scale(&c2, e2 - e3))
+            return 0;
+        e = e3;
+    }
+    else if (e3 > e2)
+    {
+        if (!dfp64_scale(&c3, e3 - e2))
+            return 0;
+    }
+    if (e < DFP64_EMIN)
+        return 0;
+
+    if (s2 == s3)
+    {
+        c = c2 + c3;
+        s = s2;
+        if (c >= dfp_pow10[DFP64_DIGITS])
+            return 0;
+    }
+    else if (c2 >= c3)
+    {
+        c = c2 - c3;
+        s = (c == 0) ? rtmi : s2;
+    }
+    else
+    {
+        c = c3 - c2;
+        s = s3;
+    }
+
+    *x1 = dfp64_pack(s, e, c);
+    *cc = (c == 0) ? 0 : s ? 1 : 2;
+    return 1;
+
+} /* end function dfp64_add_exact */
+
+/*-------------------------------------------------------------------*/
+/* Multiply two long DFP values whose product is exact               */
+/* The return value is 1 if the result was set in x1, else 0.        */
+/*-------------------------------------------------------------------*/
+static inline int
+dfp64_multiply_exact(U64 x2, U64 x3, U64 *x1)
+{
+int             e2, e3, e;              /* Unbiased exponents        */
+U64             c2, c3;                 /* Binary coefficients       */
+
+    if (!dfp64_unpack(x2, &e2, &c2) || !dfp64_unpack(x3, &e3, &c3))
+        return 0;
+
+    e = e2 + e3;
+    if (e < DFP64_EMIN || e > DFP64_ETOP)
+        return 0;
+    if (c3 != 0 && c2 > (dfp_pow10[DFP64_DIGITS] - 1) / c3)
+        return 0;
+
+    *x1 = dfp64_pack((int)((x2 ^ x3) >> 63), e, c2 * c3);
+    return 1;
+
+} /* end function dfp64_multiply_exact */
+
+/*-------------------------------------------------------------------*/
+/* Compare two finite long DFP values                                */
+/* The return value is 1 if the condition code was set, else 0.      */
+/*-------------------------------------------------------------------*/
+static inline int
+dfp64_compare_finite(U64 x1, U64 x2, BYTE *cc)
+{
+int             e1, e2;                 /* Unbiased exponents        */
+U64             c1, c2;                 /* Binary coefficients       */
+int             s1, s2;                 /* Signs                     */
+int             mag;                    /* Magnitude comparison      */
+
+    if (!dfp64_unpack(x1, &e1, &c1) || !dfp64_unpack(x2, &e2, &c2))
+        return 0;
+    s1 = (int)(x1 >> 63);
+    s2 = (int)(x2 >> 63);
+
+    if (c1 == 0 || c2 == 0 || s1 != s2)
+    {
+        /* Zeros are equal whatever their sign and exponent */
+        *cc = (c1 == 0 && c2 == 0) ? 0 :
+              (c1 == 0) ? (s2 ? 2 : 1) :
+              s1 ? 1 : 2;
+        return 1;
+    }
+
+    /* A nonzero coefficient that cannot be scaled to the other
+       exponent is larger than any coefficient of the format */
+    if (e1 > e2 && !dfp64_scale(&c1, e1 - e2))
+        mag = 1;
+    else if (e2 > e1 && !dfp64_scale(&c2, e2 - e1))
+        mag = -1;
+    else
+        mag = (c1 > c2) - (c1 < c2);
+
+    *cc = (mag == 0) ? 0 : ((mag > 0) != s1) ? 2 : 1;
+    return 1;
+
+} /* end function dfp64_compare_finite */
+
+/*-------------------------------------------------------------------*/
+/* Load rounded a long or extended DFP value which is exact in the   */
+/* shorter format. The return value is 1 if the result was set.      */
+/*-------------------------------------------------------------------*/
+static inline int
+dfp64_to_dfp32_exact(U64 x2, U32 *x1)
+{
+int             e;                      /* Unbiased exponent         */
+U64             c;                      /* Binary coefficient        */
+
+    if (!dfp64_unpack(x2, &e, &c)
+        || c >= dfp_pow10[DFP32_DIGITS]
+        || e < DFP32_EMIN || e > DFP32_ETOP)
+        return 0;
+
+    *x1 = dfp32_pack((int)(x2 >> 63), e, (U32)c);
+    return 1;
+
+} /* end function dfp64_to_dfp32_exact */
+
+static inline int
+dfp128_to_dfp64_exact(U64 hi, U64 lo, U64 *x1)
+{
+int             e;                      /* Unbiased exponent         */
+U64             chi, clo;               /* Coefficient digits        */
+
+    if (!dfp128_unpack(hi, lo, &e, &chi, &clo)
+        || chi != 0 || clo >= dfp_pow10[DFP64_DIGITS]
+        || e < DFP64_EMIN || e > DFP64_ETOP)
+        return 0;
+
+    *x1 = dfp64_pack((int)(hi >> 63), e, clo);
+    return 1;
+
+} /* end function dfp128_to_dfp64_exact */
+
+#if defined( __SIZEOF_INT128__ )
+/*-------------------------------------------------------------------*/
+/* Extended DFP fast paths using host 128-bit integers               */
+/*-------------------------------------------------------------------*/
+#define DFP_HOST_INT128
+
+typedef unsigned __int128 U128H;
+
+static inline U128H
+dfp_pow10_128(int n)
+{
+    return (n < 20) ? (U128H)dfp_pow10[n]
+                    : (U128H)dfp_pow10[19] * dfp_pow10[n - 19];
+
+} /* end function dfp_pow10_128 */
+
+static inline int
+dfp128_unpack_128(U64 hi, U64 lo, int *exp, U128H *coef)
+{
+U64             chi, clo;               /* Coefficient digits        */
+
+    if (!dfp128_unpack(hi, lo, exp, &chi, &clo))
+        return 0;
+    *coef = (U128H)chi * dfp_pow10[18] + clo;
+    return 1;
+
+} /* end function dfp128_unpack_128 */
+
+static inline void
+dfp128_pack_128(int sign, int exp, U128H coef, U64 *hi, U64 *lo)
+{
+    dfp128_pack(sign, exp, (U64)(coef / dfp_pow10[18]),
+                (U64)(coef % dfp_pow10[18]), hi, lo);
+
+} /* end function dfp128_pack_128 */
+
+static inline int
+dfp128_scale(U128H *coef, int n)
+{
+    if (*coef == 0)
+        return 1;
+    if (n >= DFP128_DIGITS || *coef >= dfp_pow10_128(DFP128_DIGITS - n))
+        return 0;
+    *coef *= dfp_pow10_128(n);
+    return 1;
+
+} /* end function dfp128_scale */
+
+/*-------------------------------------------------------------------*/
+/* Add two extended DFP values whose sum is exact                    */
+/* Operands and result are in FPR pairs (hi,lo); see dfp64_add_exact */
+/*-------------------------------------------------------------------*/
+static inline int
+dfp128_add_exact(U64 hi2, U64 lo2, U64 hi3, U64 lo3, int rtmi,
+                 U64 *hi1, U64 *lo1, BYTE *cc)
+{
+int             e2, e3, e;              /* Unbiased exponents        */
+U128H           c2, c3, c;              /* Binary coefficients       */
+int             s2, s3, s;              /* Signs                     */
+
+    if (!dfp128_unpack_128(hi2, lo2, &e2, &c2)
+        || !dfp128_unpack_128(hi3, lo3, &e3, &c3))
+        return 0;
+    s2 = (int)(hi2 >> 63);
+    s3 = (int)(hi3 >> 63);
+
+    e = e2;
+    if (e2 > e3)
+    {
+        if (!dfp128_scale(&c2, e2 - e3))
+            return 0;
+        e = e3;
+    }
+    else if (e3 > e2)
+    {
+        if (!dfp128_scale(&c3, e3 - e2))
+            return 0;
+    }
+    if (e < DFP128_EMIN)
+        return 0;
+
+    if (s2 == s3)
+    {
+        c = c2 + c3;
+        s = s2;
+        if (c >= dfp_pow10_128(DFP128_DIGITS))
+            return 0;
+    }
+    else if (c2 >= c3)
+    {
+        c = c2 - c3;
+        s = (c == 0) ? rtmi : s2;
+    }
+    else
+    {
+        c = c3 - c2;
+        s = s3;
+    }
+
+    dfp128_pack_128(s, e, c, hi1, lo1);
+    *cc = (c == 0) ? 0 : s ? 1 : 2;
+    return 1;
+
+} /* end function dfp128_add_exact */
+
+static inline int
+dfp128_multiply_exact(U64 hi2, U64 lo2, U64 hi3, U64 lo3,
+                      U64 *hi1, U64 *lo1)
+{
+int             e2, e3, e;              /* Unbiased exponents        */
+U128H           c2, c3, c;              /* Binary coefficients       */
+
+    if (!dfp128_unpack_128(hi2, lo2, &e2, &c2)
+        || !dfp128_unpack_128(hi3, lo3, &e3, &c3))
+        return 0;
+
+    e = e2 + e3;
+    if (e < DFP128_EMIN || e > DFP128_ETOP)
+        return 0;
+
+    /* The product of two coefficients below 2**64 cannot overflow */
+    if ((c2 >> 64) != 0 || (c3 >> 64) != 0)
+        return 0;
+    c = c2 * c3;
+    if (c >= dfp_pow10_128(DFP128_DIGITS))
+        return 0;
+
+    dfp128_pack_128((int)((hi2 ^ hi3) >> 63), e, c, hi1, lo1);
+    return 1;
+
+} /* end function dfp128_multiply_exact */
+
+static inline int
+dfp128_compare_finite(U64 hi1, U64 lo1, U64 hi2, U64 lo2, BYTE *cc)
+{
+int             e1, e2;                 /* Unbiased exponents        */
+U128H           c1, c2;                 /* Binary coefficients       */
+int             s1, s2;                 /* Signs                     */
+int             mag;                    /* Magnitude comparison      */
+
+    if (!dfp128_unpack_128(hi1, lo1, &e1, &c1)
+        || !dfp128_unpack_128(hi2, lo2, &e2, &c2))
+        return 0;
+    s1 = (int)(hi1 >> 63);
+    s2 = (int)(hi2 >> 63);
+
+    if (c1 == 0 || c2 == 0 || s1 != s2)
+    {
+        *cc = (c1 == 0 && c2 == 0) ? 0 :
+              (c1 == 0) ? (s2 ? 2 : 1) :
+              s1 ? 1 : 2;
+        return 1;
+    }
+
+    if (e1 > e2 && !dfp128_scale(&c1, e1 - e2))
+        mag = 1;
+    else if (e2 > e1 && !dfp128_scale(&c2, e2 - e1))
+        mag = -1;
+    else
+        mag = (c1 > c2) - (c1 < c2);
+
+    *cc = (mag == 0) ? 0 : ((mag > 0) != s1) ? 2 : 1;
+    return 1;
+
+} /* end function dfp128_compare_finite */
+
+#endif /* defined( __SIZEOF_INT128__ ) */
+
+
 #define _DFP_ARCH_INDEPENDENT_
 #endif /*!defined(_DFP_ARCH_INDEPENDENT_)*/
 
@@ -1948,6 +2712,16 @@ BYTE            dxc;                    /* Data exception code       */
     DFPINST_CHECK(regs);
     DFPREGPAIR3_CHECK(r1, r2, r3, regs);
 
+#if defined( DFP_HOST_INT128 )
+    /* Exact sums are done on the binary coefficients */
+    if (dfp128_add_exact(regs->FPR_L(r2), regs->FPR_L(r2+2),
+                         regs->FPR_L(r3), regs->FPR_L(r3+2),
+                         DFP_FPC_RTMI(regs),
+                         &regs->FPR_L(r1), &regs->FPR_L(r1+2),
+                         &regs->psw.cc))
+        return;
+#endif
+
     /* Initialise the context for extended DFP */
     decContextDefault(&set, DEC_INIT_DECIMAL128);
     ARCH_DEP(dfp_rounding_mode)(&set, 0, regs);
@@ -1997,6 +2771,11 @@ BYTE            dxc;                    /* Data exception code       */
     TXF_FLOAT_INSTR_CHECK( regs );
     DFPINST_CHECK(regs);
 
+    /* Exact sums are done on the binary coefficients */
+    if (dfp64_add_exact(regs->FPR_L(r2), regs->FPR_L(r3),
+                        DFP_FPC_RTMI(regs), &regs->FPR_L(r1), &regs->psw.cc))
+        return;
+
     /* Initialise the context for long DFP */
     decContextDefault(&set, DEC_INIT_DECIMAL64);
     ARCH_DEP(dfp_rounding_mode)(&set, 0, regs);
@@ -2047,6 +2826,14 @@ BYTE            dxc;                    /* Data exception code       */
     DFPINST_CHECK(regs);
     DFPREGPAIR2_CHECK(r1, r2, regs);
 
+#if defined( DFP_HOST_INT128 )
+    /* Finite operands are compared on the binary coefficients */
+    if (dfp128_compare_finite(regs->FPR_L(r1), regs->FPR_L(r1+2),
+                              regs->FPR_L(r2), regs->FPR_L(r2+2),
+                              &regs->psw.cc))
+        return;
+#endif
+
     /* Initialise the context for extended DFP */
     decContextDefault(&set, DEC_INIT_DECIMAL128);
 
@@ -2091,6 +2878,11 @@ BYTE            dxc;                    /* Data exception code       */
     TXF_FLOAT_INSTR_CHECK( regs );
     DFPINST_CHECK(regs);
 
+    /* Finite operands are compared on the binary coefficients */
+    if (dfp64_compare_finite(regs->FPR_L(r1), regs->FPR_L(r2),
+                             &regs->psw.cc))
+        return;
+
     /* Initialise the context for long DFP */
     decContextDefault(&set, DEC_INIT_DECIMAL64);
 
@@ -4637,6 +5429,12 @@ BYTE            dxc;                    /* Data exception code       */
     DFPINST_CHECK(regs);
     DFPREGPAIR_CHECK(r2, regs);
 
+    /* A finite value that is exact in the long format is
+       re-encoded directly, and needs no rounding */
+    if (dfp128_to_dfp64_exact(regs->FPR_L(r2), regs->FPR_L(r2+2),
+                              &regs->FPR_L(r1)))
+        return;
+
     /* Initialise the context for extended DFP */
     decContextDefault(&set, DEC_INIT_DECIMAL128);
     ARCH_DEP(dfp_rounding_mode)(&set, m3, regs);
@@ -4723,6 +5521,11 @@ BYTE            dxc;                    /* Data exception code       */
     TXF_FLOAT_INSTR_CHECK( regs );
     DFPINST_CHECK(regs);
 
+    /* A finite value that is exact in the short format is
+       re-encoded directly, and needs no rounding */
+    if (dfp64_to_dfp32_exact(regs->FPR_L(r2), &regs->FPR_S(r1)))
+        return;
+
     /* Initialise the context for long DFP */
     decContextDefault(&set, DEC_INIT_DECIMAL64);
     ARCH_DEP(dfp_rounding_mode)(&set, m3, regs);
@@ -4807,6 +5610,14 @@ BYTE            dxc;                    /* Data exception code       */
     DFPINST_CHECK(regs);
     DFPREGPAIR3_CHECK(r1, r2, r3, regs);
 
+#if defined( DFP_HOST_INT128 )
+    /* Exact products are done on the binary coefficients */
+    if (dfp128_multiply_exact(regs->FPR_L(r2), regs->FPR_L(r2+2),
+                              regs->FPR_L(r3), regs->FPR_L(r3+2),
+                              &regs->FPR_L(r1), &regs->FPR_L(r1+2)))
+        return;
+#endif
+
     /* Initialise the context for extended DFP */
     decContextDefault(&set, DEC_INIT_DECIMAL128);
     ARCH_DEP(dfp_rounding_mode)(&set, 0, regs);
@@ -4851,6 +5662,11 @@ BYTE            dxc;                    /* Data exception code       */
     TXF_FLOAT_INSTR_CHECK( regs );
     DFPINST_CHECK(regs);
 
+    /* Exact products are done on the binary coefficients */
+    if (dfp64_multiply_exact(regs->FPR_L(r2), regs->FPR_L(r3),
+                             &regs->FPR_L(r1)))
+        return;
+
     /* Initialise the context for long DFP */
     decContextDefault(&set, DEC_INIT_DECIMAL64);
     ARCH_DEP(dfp_rounding_mode)(&set, 0, regs);
@@ -5348,6 +6164,17 @@ BYTE            dxc;                    /* Data exception code       */
     DFPINST_CHECK(regs);
     DFPREGPAIR3_CHECK(r1, r2, r3, regs);
 
+#if defined( DFP_HOST_INT128 )
+    /* Exact differences are done on the binary coefficients */
+    if (dfp128_add_exact(regs->FPR_L(r2), regs->FPR_L(r2+2),
+                         regs->FPR_L(r3) ^ 0x8000000000000000ULL,
+                         regs->FPR_L(r3+2),
+                         DFP_FPC_RTMI(regs),
+                         &regs->FPR_L(r1), &regs->FPR_L(r1+2),
+                         &regs->psw.cc))
+        return;
+#endif
+
     /* Initialise the context for extended DFP */
     decContextDefault(&set, DEC_INIT_DECIMAL128);
     ARCH_DEP(dfp_rounding_mode)(&set, 0, regs);
@@ -5397,6 +6224,12 @@ BYTE            dxc;                    /* Data exception code       */
     TXF_FLOAT_INSTR_CHECK( regs );
     DFPINST_CHECK(regs);
 
+    /* Exact differences are done on the binary coefficients */
+    if (dfp64_add_exact(regs->FPR_L(r2),
+                        regs->FPR_L(r3) ^ 0x8000000000000000ULL,
+                        DFP_FPC_RTMI(regs), &regs->FPR_L(r1), &regs->psw.cc))
+        return;
+
     /* Initialise the context for long DFP */
     decContextDefault(&set, DEC_INIT_DECIMAL64);
     ARCH_DEP(dfp_rounding_mode)(&set, 0, regs);
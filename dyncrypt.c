@@ -33,6 +33,10 @@
 #include "sshdes.h"
 #include "hcrypto.h"            // CSRNG constants and functions
 
+#if (defined( _FEATURE_HW_AES ) || defined( _FEATURE_HW_SHA )) && defined( __aarch64__ )
+#include <arm_neon.h>           // ARMv8 Cryptography Extension intrinsics
+#endif
+
 DISABLE_GCC_UNUSED_SET_WARNING;
 
 #if defined( FEATURE_017_MSA_FACILITY )
@@ -43,6 +47,7 @@ DISABLE_GCC_UNUSED_SET_WARNING;
 #define OPTION_KIMD_DEBUG
 #define OPTION_KLMD_DEBUG
 #define OPTION_KM_DEBUG
+#define OPTION_KMA_DEBUG
 #define OPTION_KMAC_DEBUG
 #define OPTION_KMC_DEBUG
 #define OPTION_KMCTR_DEBUG
@@ -90,12 +95,20 @@ static const int kmctr_pblens[32] =
 /* lcfb : Length of cipher feedback                                           */
 /* wrap : Indication if key is wrapped                                        */
 /* tfc  : Function code without wrap indication                               */
+/* hs   : KMA hash subkey supplied                                            */
+/* lpc  : KMA last plaintext/ciphertext                                       */
+/* laad : KMA last additional authenticated data                              */
+/* sip  : KLMD-SHAKE squeeze in progress                                      */
 /*----------------------------------------------------------------------------*/
 #define GR0_fc(regs)    ((regs)->GR_L(0) & 0x0000007F)
 #define GR0_m(regs)     (((regs)->GR_L(0) & 0x00000080) ? TRUE : FALSE)
 #define GR0_lcfb(regs)  ((regs)->GR_L(0) >> 24)
 #define GR0_wrap(egs)   (((regs)->GR_L(0) & 0x08) ? TRUE : FALSE)
 #define GR0_tfc(regs)   (GR0_fc(regs) & 0x77)
+#define GR0_hs(regs)    (((regs)->GR_L(0) & 0x00000800) ? TRUE : FALSE)
+#define GR0_lpc(regs)   (((regs)->GR_L(0) & 0x00000400) ? TRUE : FALSE)
+#define GR0_laad(regs)  (((regs)->GR_L(0) & 0x00000200) ? TRUE : FALSE)
+#define GR0_sip(regs)   (((regs)->GR_L(0) & 0x00000100) ? TRUE : FALSE)
 
 /*----------------------------------------------------------------------------*/
 /* Write bytes on one line                                                    */
@@ -539,6 +552,704 @@ void des3_decrypt(des3_context *ctx, CHAR8 input, CHAR8 output)
     store_fw(output+4, out[1]);
 }
 
+/*----------------------------------------------------------------------------*/
+/* Internal AES helper functions                                              */
+/*----------------------------------------------------------------------------*/
+/* Key schedules are expanded by the crypto library and, when the host has    */
+/* AES instructions (AES-NI or the ARMv8 Cryptography Extension), converted   */
+/* into round keys for them. Each CPU keeps its most recently used schedules  */
+/* keyed by the clear key, so that a guest issuing one KM/KMC/KMCTR after the */
+/* other with the same key does not pay for the key expansion every time.     */
+/*----------------------------------------------------------------------------*/
+#define AES_CACHE_SIZE      4   /* Key schedules kept per CPU                 */
+#define AES_PARALLEL        8   /* Blocks ciphered at once (if independent)   */
+
+#if defined( _FEATURE_HW_AES )
+#if defined( __aarch64__ )
+typedef uint8x16_t AES_RK;
+#define AES_LOAD(p)         vld1q_u8((p))
+#define AES_STORE(p, b)     vst1q_u8((p), (b))
+#else
+typedef __m128i AES_RK;
+#define AES_LOAD(p)         _mm_loadu_si128((const __m128i *)(p))
+#define AES_STORE(p, b)     _mm_storeu_si128((__m128i *)(p), (b))
+#endif
+#endif /* defined( _FEATURE_HW_AES ) */
+
+typedef struct {
+  int keylen;                         /* Key length in bytes, 0 = unused      */
+  BYTE key[AES_MAXKEYBYTES];          /* Key the schedules were built from    */
+  int hw;                             /* Use host AES instructions            */
+  rijndael_ctx context;               /* Crypto library key schedules         */
+#if defined( _FEATURE_HW_AES )
+  AES_RK ek[AES_MAXROUNDS + 1];       /* Host encryption round keys           */
+  AES_RK dk[AES_MAXROUNDS + 1];       /* Host decryption round keys           */
+#endif
+} aes_context;
+
+static struct {
+  aes_context ctx[AES_CACHE_SIZE];
+  int next;                           /* Entry to be replaced next            */
+} aes_cache[MAX_CPU_ENGS];
+
+#if defined( _FEATURE_HW_AES )
+/* Cipher n blocks held in host registers */
+static INLINE void aes_hw_encrypt(aes_context *ctx, AES_RK *b, int n)
+{
+  int i;
+  int r;
+
+#if defined( __aarch64__ )
+  for(r = 0; r < ctx->context.Nr - 1; r++)
+    for(i = 0; i < n; i++)
+      b[i] = vaesmcq_u8(vaeseq_u8(b[i], ctx->ek[r]));
+  for(i = 0; i < n; i++)
+    b[i] = veorq_u8(vaeseq_u8(b[i], ctx->ek[r]), ctx->ek[r + 1]);
+#else
+  for(i = 0; i < n; i++)
+    b[i] = _mm_xor_si128(b[i], ctx->ek[0]);
+  for(r = 1; r < ctx->context.Nr; r++)
+    for(i = 0; i < n; i++)
+      b[i] = _mm_aesenc_si128(b[i], ctx->ek[r]);
+  for(i = 0; i < n; i++)
+    b[i] = _mm_aesenclast_si128(b[i], ctx->ek[r]);
+#endif
+}
+
+static INLINE void aes_hw_decrypt(aes_context *ctx, AES_RK *b, int n)
+{
+  int i;
+  int r;
+
+#if defined( __aarch64__ )
+  for(r = 0; r < ctx->context.Nr - 1; r++)
+    for(i = 0; i < n; i++)
+      b[i] = vaesimcq_u8(vaesdq_u8(b[i], ctx->dk[r]));
+  for(i = 0; i < n; i++)
+    b[i] = veorq_u8(vaesdq_u8(b[i], ctx->dk[r]), ctx->dk[r + 1]);
+#else
+  for(i = 0; i < n; i++)
+    b[i] = _mm_xor_si128(b[i], ctx->dk[0]);
+  for(r = 1; r < ctx->context.Nr; r++)
+    for(i = 0; i < n; i++)
+      b[i] = _mm_aesdec_si128(b[i], ctx->dk[r]);
+  for(i = 0; i < n; i++)
+    b[i] = _mm_aesdeclast_si128(b[i], ctx->dk[r]);
+#endif
+}
+#endif /* defined( _FEATURE_HW_AES ) */
+
+static void aes_set_key(aes_context *ctx, BYTE *key, int keylen)
+{
+#if defined( _FEATURE_HW_AES )
+  BYTE rk[16];
+  int nr;
+  int r;
+#endif
+
+  memcpy(ctx->key, key, keylen);
+  ctx->keylen = keylen;
+  rijndael_set_key(&ctx->context, key, keylen * 8);
+  ctx->hw = FALSE;
+
+#if defined( _FEATURE_HW_AES )
+  if(sysblk.have_AES)
+  {
+    /* The library round keys are big-endian words */
+    nr = ctx->context.Nr;
+    for(r = 0; r <= nr; r++)
+    {
+      store_fw(&rk[0], ctx->context.ek[4 * r]);
+      store_fw(&rk[4], ctx->context.ek[4 * r + 1]);
+      store_fw(&rk[8], ctx->context.ek[4 * r + 2]);
+      store_fw(&rk[12], ctx->context.ek[4 * r + 3]);
+      ctx->ek[r] = AES_LOAD(rk);
+    }
+
+    /* Equivalent inverse cipher round keys */
+    ctx->dk[0] = ctx->ek[nr];
+    for(r = 1; r < nr; r++)
+#if defined( __aarch64__ )
+      ctx->dk[r] = vaesimcq_u8(ctx->ek[nr - r]);
+#else
+      ctx->dk[r] = _mm_aesimc_si128(ctx->ek[nr - r]);
+#endif
+    ctx->dk[nr] = ctx->ek[0];
+    ctx->hw = TRUE;
+  }
+#endif /* defined( _FEATURE_HW_AES ) */
+}
+
+/*----------------------------------------------------------------------------*/
+/* Return the key schedules for key, from this CPU's cache when possible      */
+/*----------------------------------------------------------------------------*/
+static aes_context *aes_get_context(REGS *regs, BYTE *key, int keylen)
+{
+  aes_context *ctx;
+  int i;
+
+  for(i = 0; i < AES_CACHE_SIZE; i++)
+  {
+    ctx = &aes_cache[regs->cpuad].ctx[i];
+    if(ctx->keylen == keylen && !memcmp(ctx->key, key, keylen))
+      return(ctx);
+  }
+
+  i = aes_cache[regs->cpuad].next;
+  aes_cache[regs->cpuad].next = (i + 1) % AES_CACHE_SIZE;
+  ctx = &aes_cache[regs->cpuad].ctx[i];
+  aes_set_key(ctx, key, keylen);
+  return(ctx);
+}
+
+/*----------------------------------------------------------------------------*/
+/* Encrypt/decrypt n blocks. Up to AES_PARALLEL blocks are read before any of */
+/* them is written, see aes_batch.                                            */
+/*----------------------------------------------------------------------------*/
+static void aes_encrypt_blocks(aes_context *ctx, const BYTE *in, BYTE *out, int n)
+{
+#if defined( _FEATURE_HW_AES )
+  AES_RK b[AES_PARALLEL];
+  int i;
+
+  if(ctx->hw)
+  {
+    for(; n >= AES_PARALLEL; n -= AES_PARALLEL, in += 16 * AES_PARALLEL, out += 16 * AES_PARALLEL)
+    {
+      for(i = 0; i < AES_PARALLEL; i++)
+        b[i] = AES_LOAD(in + 16 * i);
+      aes_hw_encrypt(ctx, b, AES_PARALLEL);
+      for(i = 0; i < AES_PARALLEL; i++)
+        AES_STORE(out + 16 * i, b[i]);
+    }
+    for(; n; n--, in += 16, out += 16)
+    {
+      b[0] = AES_LOAD(in);
+      aes_hw_encrypt(ctx, b, 1);
+      AES_STORE(out, b[0]);
+    }
+    return;
+  }
+#endif /* defined( _FEATURE_HW_AES ) */
+
+  for(; n; n--, in += 16, out += 16)
+    rijndael_encrypt(&ctx->context, in, out);
+}
+
+static void aes_decrypt_blocks(aes_context *ctx, const BYTE *in, BYTE *out, int n)
+{
+#if defined( _FEATURE_HW_AES )
+  AES_RK b[AES_PARALLEL];
+  int i;
+
+  if(ctx->hw)
+  {
+    for(; n >= AES_PARALLEL; n -= AES_PARALLEL, in += 16 * AES_PARALLEL, out += 16 * AES_PARALLEL)
+    {
+      for(i = 0; i < AES_PARALLEL; i++)
+        b[i] = AES_LOAD(in + 16 * i);
+      aes_hw_decrypt(ctx, b, AES_PARALLEL);
+      for(i = 0; i < AES_PARALLEL; i++)
+        AES_STORE(out + 16 * i, b[i]);
+    }
+    for(; n; n--, in += 16, out += 16)
+    {
+      b[0] = AES_LOAD(in);
+      aes_hw_decrypt(ctx, b, 1);
+      AES_STORE(out, b[0]);
+    }
+    return;
+  }
+#endif /* defined( _FEATURE_HW_AES ) */
+
+  for(; n; n--, in += 16, out += 16)
+    rijndael_decrypt(&ctx->context, in, out);
+}
+
+#define aes_encrypt(ctx, in, out)   aes_encrypt_blocks((ctx), (in), (out), 1)
+#define aes_decrypt(ctx, in, out)   aes_decrypt_blocks((ctx), (in), (out), 1)
+
+/*----------------------------------------------------------------------------*/
+/* Number of blocks that may be read from src before the first of them is     */
+/* stored to dst with the same result as ciphering one block at a time.       */
+/*----------------------------------------------------------------------------*/
+static INLINE int aes_batch(const BYTE *dst, const BYTE *src)
+{
+  return(dst > src && dst < src + 16 * AES_PARALLEL ? 1 : AES_PARALLEL);
+}
+
+/*----------------------------------------------------------------------------*/
+/* Internal SHA and GHASH helper functions                                    */
+/*----------------------------------------------------------------------------*/
+/* Consecutive message blocks are hashed with the host SHA instructions (the  */
+/* Intel SHA extensions or the ARMv8 Cryptography Extension) and GHASH is     */
+/* multiplied with PCLMULQDQ when the host has them, otherwise the portable   */
+/* crypto library code is used.                                               */
+/*----------------------------------------------------------------------------*/
+#if defined( _FEATURE_HW_SHA )
+static const U32 sha256_k[64] =
+{
+  0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+  0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+  0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+  0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+  0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+  0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+  0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+  0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+#if defined( __aarch64__ )
+static const U32 sha1_k[4] = { 0x5a827999, 0x6ed9eba1, 0x8f1bbcdc, 0xca62c1d6 };
+
+/* Message words k*4 to k*4+3, computed in place of words k*4-16 to k*4-13 */
+#define SHA1_SCHEDULE(k)                                                       \
+  m[(k) & 3] = vsha1su1q_u32(vsha1su0q_u32(m[(k) & 3], m[((k) + 1) & 3],       \
+                             m[((k) + 2) & 3]), m[((k) + 3) & 3])
+#define SHA256_SCHEDULE(k)                                                     \
+  m[(k) & 3] = vsha256su1q_u32(vsha256su0q_u32(m[(k) & 3], m[((k) + 1) & 3]),  \
+                               m[((k) + 2) & 3], m[((k) + 3) & 3])
+
+/* Four SHA-1 rounds with round function f */
+#define SHA1_ROUNDS4(k, f)                                                     \
+  do {                                                                         \
+    if((k) >= 4)                                                               \
+      SHA1_SCHEDULE(k);                                                        \
+    t = vaddq_u32(m[(k) & 3], vdupq_n_u32(sha1_k[(k) / 5]));                   \
+    e1 = vsha1h_u32(vgetq_lane_u32(abcd, 0));                                  \
+    abcd = f(abcd, e, t);                                                      \
+    e = e1;                                                                    \
+  } while(0)
+
+/* Four SHA-256 rounds */
+#define SHA256_ROUNDS4(k)                                                      \
+  do {                                                                         \
+    if((k) >= 4)                                                               \
+      SHA256_SCHEDULE(k);                                                      \
+    t = vaddq_u32(m[(k) & 3], vld1q_u32(&sha256_k[4 * (k)]));                  \
+    t2 = abcd;                                                                 \
+    abcd = vsha256hq_u32(abcd, efgh, t);                                       \
+    efgh = vsha256h2q_u32(efgh, t2, t);                                        \
+  } while(0)
+
+static void sha1_hw_blocks(U32 state[5], const BYTE *data, int n)
+{
+  uint32x4_t abcd, abcd_save, m[4], t;
+  uint32_t e, e1, e_save;
+  int i;
+
+  abcd = vld1q_u32(state);
+  e = state[4];
+
+  for(; n; n--, data += 64)
+  {
+    abcd_save = abcd;
+    e_save = e;
+    for(i = 0; i < 4; i++)
+      m[i] = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(data + 16 * i)));
+
+    SHA1_ROUNDS4( 0, vsha1cq_u32); SHA1_ROUNDS4( 1, vsha1cq_u32);
+    SHA1_ROUNDS4( 2, vsha1cq_u32); SHA1_ROUNDS4( 3, vsha1cq_u32);
+    SHA1_ROUNDS4( 4, vsha1cq_u32); SHA1_ROUNDS4( 5, vsha1pq_u32);
+    SHA1_ROUNDS4( 6, vsha1pq_u32); SHA1_ROUNDS4( 7, vsha1pq_u32);
+    SHA1_ROUNDS4( 8, vsha1pq_u32); SHA1_ROUNDS4( 9, vsha1pq_u32);
+    SHA1_ROUNDS4(10, vsha1mq_u32); SHA1_ROUNDS4(11, vsha1mq_u32);
+    SHA1_ROUNDS4(12, vsha1mq_u32); SHA1_ROUNDS4(13, vsha1mq_u32);
+    SHA1_ROUNDS4(14, vsha1mq_u32); SHA1_ROUNDS4(15, vsha1pq_u32);
+    SHA1_ROUNDS4(16, vsha1pq_u32); SHA1_ROUNDS4(17, vsha1pq_u32);
+    SHA1_ROUNDS4(18, vsha1pq_u32); SHA1_ROUNDS4(19, vsha1pq_u32);
+
+    abcd = vaddq_u32(abcd, abcd_save);
+    e += e_save;
+  }
+
+  vst1q_u32(state, abcd);
+  state[4] = e;
+}
+
+static void sha256_hw_blocks(U32 state[8], const BYTE *data, int n)
+{
+  uint32x4_t abcd, efgh, abcd_save, efgh_save, m[4], t, t2;
+  int i;
+
+  abcd = vld1q_u32(&state[0]);
+  efgh = vld1q_u32(&state[4]);
+
+  for(; n; n--, data += 64)
+  {
+    abcd_save = abcd;
+    efgh_save = efgh;
+    for(i = 0; i < 4; i++)
+      m[i] = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(data + 16 * i)));
+
+    SHA256_ROUNDS4( 0); SHA256_ROUNDS4( 1); SHA256_ROUNDS4( 2); SHA256_ROUNDS4( 3);
+    SHA256_ROUNDS4( 4); SHA256_ROUNDS4( 5); SHA256_ROUNDS4( 6); SHA256_ROUNDS4( 7);
+    SHA256_ROUNDS4( 8); SHA256_ROUNDS4( 9); SHA256_ROUNDS4(10); SHA256_ROUNDS4(11);
+    SHA256_ROUNDS4(12); SHA256_ROUNDS4(13); SHA256_ROUNDS4(14); SHA256_ROUNDS4(15);
+
+    abcd = vaddq_u32(abcd, abcd_save);
+    efgh = vaddq_u32(efgh, efgh_save);
+  }
+
+  vst1q_u32(&state[0], abcd);
+  vst1q_u32(&state[4], efgh);
+}
+
+#else /* Intel SHA extensions */
+
+/* Message words k*4 to k*4+3, computed in place of words k*4-16 to k*4-13 */
+#define SHA1_SCHEDULE(k)                                                       \
+  m[(k) & 3] = _mm_sha1msg2_epu32(_mm_xor_si128(_mm_sha1msg1_epu32(            \
+                 m[(k) & 3], m[((k) + 1) & 3]), m[((k) + 2) & 3]),             \
+                 m[((k) + 3) & 3])
+#define SHA256_SCHEDULE(k)                                                     \
+  m[(k) & 3] = _mm_sha256msg2_epu32(_mm_add_epi32(_mm_sha256msg1_epu32(        \
+                 m[(k) & 3], m[((k) + 1) & 3]),                                \
+                 _mm_alignr_epi8(m[((k) + 3) & 3], m[((k) + 2) & 3], 4)),      \
+                 m[((k) + 3) & 3])
+
+/* Four SHA-1 rounds; e is carried in the high doubleword */
+#define SHA1_ROUNDS4(k)                                                        \
+  do {                                                                         \
+    if((k) >= 4)                                                               \
+      SHA1_SCHEDULE(k);                                                        \
+    if(k)                                                                      \
+      t = _mm_sha1nexte_epu32(prev, m[(k) & 3]);                               \
+    else                                                                       \
+      t = _mm_add_epi32(e, m[0]);                                              \
+    prev = abcd;                                                               \
+    abcd = _mm_sha1rnds4_epu32(abcd, t, (k) / 5);                              \
+  } while(0)
+
+/* Four SHA-256 rounds */
+#define SHA256_ROUNDS4(k)                                                      \
+  do {                                                                         \
+    if((k) >= 4)                                                               \
+      SHA256_SCHEDULE(k);                                                      \
+    t = _mm_add_epi32(m[(k) & 3],                                              \
+          _mm_loadu_si128((const __m128i *) &sha256_k[4 * (k)]));              \
+    cdgh = _mm_sha256rnds2_epu32(cdgh, abef, t);                               \
+    abef = _mm_sha256rnds2_epu32(abef, cdgh, _mm_shuffle_epi32(t, 0x0e));      \
+  } while(0)
+
+static void sha1_hw_blocks(U32 state[5], const BYTE *data, int n)
+{
+  const __m128i bswap = _mm_set_epi64x(0x0001020304050607ULL, 0x08090a0b0c0d0e0fULL);
+  __m128i abcd, abcd_save, e, e_save, prev, m[4], t;
+  int i;
+
+  abcd = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *) state), 0x1b);
+  e = _mm_set_epi32((int) state[4], 0, 0, 0);
+
+  for(; n; n--, data += 64)
+  {
+    abcd_save = abcd;
+    e_save = e;
+    for(i = 0; i < 4; i++)
+      m[i] = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 16 * i)), bswap);
+
+    SHA1_ROUNDS4( 0); SHA1_ROUNDS4( 1); SHA1_ROUNDS4( 2); SHA1_ROUNDS4( 3);
+    SHA1_ROUNDS4( 4); SHA1_ROUNDS4( 5); SHA1_ROUNDS4( 6); SHA1_ROUNDS4( 7);
+    SHA1_ROUNDS4( 8); SHA1_ROUNDS4( 9); SHA1_ROUNDS4(10); SHA1_ROUNDS4(11);
+    SHA1_ROUNDS4(12); SHA1_ROUNDS4(13); SHA1_ROUNDS4(14); SHA1_ROUNDS4(15);
+    SHA1_ROUNDS4(16); SHA1_ROUNDS4(17); SHA1_ROUNDS4(18); SHA1_ROUNDS4(19);
+
+    e = _mm_sha1nexte_epu32(prev, e_save);
+    abcd = _mm_add_epi32(abcd, abcd_save);
+  }
+
+  _mm_storeu_si128((__m128i *) state, _mm_shuffle_epi32(abcd, 0x1b));
+  state[4] = (U32) _mm_extract_epi32(e, 3);
+}
+
+static void sha256_hw_blocks(U32 state[8], const BYTE *data, int n)
+{
+  const __m128i bswap = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+  __m128i abef, cdgh, abef_save, cdgh_save, m[4], t;
+  int i;
+
+  /* Rearrange the state words the way SHA256RNDS2 wants them */
+  t = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *) &state[0]), 0xb1);
+  cdgh = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *) &state[4]), 0x1b);
+  abef = _mm_alignr_epi8(t, cdgh, 8);
+  cdgh = _mm_blend_epi16(cdgh, t, 0xf0);
+
+  for(; n; n--, data += 64)
+  {
+    abef_save = abef;
+    cdgh_save = cdgh;
+    for(i = 0; i < 4; i++)
+      m[i] = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 16 * i)), bswap);
+
+    SHA256_ROUNDS4( 0); SHA256_ROUNDS4( 1); SHA256_ROUNDS4( 2); SHA256_ROUNDS4( 3);
+    SHA256_ROUNDS4( 4); SHA256_ROUNDS4( 5); SHA256_ROUNDS4( 6); SHA256_ROUNDS4( 7);
+    SHA256_ROUNDS4( 8); SHA256_ROUNDS4( 9); SHA256_ROUNDS4(10); SHA256_ROUNDS4(11);
+    SHA256_ROUNDS4(12); SHA256_ROUNDS4(13); SHA256_ROUNDS4(14); SHA256_ROUNDS4(15);
+
+    abef = _mm_add_epi32(abef, abef_save);
+    cdgh = _mm_add_epi32(cdgh, cdgh_save);
+  }
+
+  t = _mm_shuffle_epi32(abef, 0x1b);
+  cdgh = _mm_shuffle_epi32(cdgh, 0xb1);
+  _mm_storeu_si128((__m128i *) &state[0], _mm_blend_epi16(t, cdgh, 0xf0));
+  _mm_storeu_si128((__m128i *) &state[4], _mm_alignr_epi8(cdgh, t, 8));
+}
+#endif /* defined( __aarch64__ ) */
+#endif /* defined( _FEATURE_HW_SHA ) */
+
+/*----------------------------------------------------------------------------*/
+/* Hash n consecutive 64-byte (sha-1/256) or 128-byte (sha-512) blocks        */
+/*----------------------------------------------------------------------------*/
+static void sha1_blocks(U32 state[5], const BYTE *data, int n)
+{
+#if defined( _FEATURE_HW_SHA )
+  if(sysblk.have_SHA)
+  {
+    sha1_hw_blocks(state, data, n);
+    return;
+  }
+#endif /* defined( _FEATURE_HW_SHA ) */
+
+  for(; n; n--, data += 64)
+    SHA1Transform(state, data);
+}
+
+static void sha256_blocks(U32 state[8], const BYTE *data, int n)
+{
+#if defined( _FEATURE_HW_SHA )
+  if(sysblk.have_SHA)
+  {
+    sha256_hw_blocks(state, data, n);
+    return;
+  }
+#endif /* defined( _FEATURE_HW_SHA ) */
+
+  for(; n; n--, data += 64)
+    SHA256Transform(state, data);
+}
+
+static void sha512_blocks(U64 state[8], const BYTE *data, int n)
+{
+  for(; n; n--, data += 128)
+    SHA512Transform(state, data);
+}
+
+#if defined( _FEATURE_HW_CLMUL )
+/*----------------------------------------------------------------------------*/
+/* GHASH multiply of byte-reflected operands, see the Intel white paper       */
+/* "Carry-Less Multiplication and Its Usage for Computing the GCM Mode"       */
+/*----------------------------------------------------------------------------*/
+static INLINE __m128i ghash_clmul(__m128i a, __m128i b)
+{
+  __m128i lo, hi, mid, t1, t2, t3;
+
+  /* 256-bit carry-less product hi:lo */
+  lo  = _mm_clmulepi64_si128(a, b, 0x00);
+  hi  = _mm_clmulepi64_si128(a, b, 0x11);
+  mid = _mm_xor_si128(_mm_clmulepi64_si128(a, b, 0x10), _mm_clmulepi64_si128(a, b, 0x01));
+  lo  = _mm_xor_si128(lo, _mm_slli_si128(mid, 8));
+  hi  = _mm_xor_si128(hi, _mm_srli_si128(mid, 8));
+
+  /* Shift it left one bit for the reflected bit order */
+  t1 = _mm_srli_epi32(lo, 31);
+  t2 = _mm_srli_epi32(hi, 31);
+  lo = _mm_slli_epi32(lo, 1);
+  hi = _mm_slli_epi32(hi, 1);
+  t3 = _mm_srli_si128(t1, 12);
+  t2 = _mm_slli_si128(t2, 4);
+  t1 = _mm_slli_si128(t1, 4);
+  lo = _mm_or_si128(lo, t1);
+  hi = _mm_or_si128(_mm_or_si128(hi, t2), t3);
+
+  /* Reduce modulo x^128 + x^7 + x^2 + x + 1 */
+  t1 = _mm_xor_si128(_mm_xor_si128(_mm_slli_epi32(lo, 31), _mm_slli_epi32(lo, 30)), _mm_slli_epi32(lo, 25));
+  t2 = _mm_srli_si128(t1, 4);
+  lo = _mm_xor_si128(lo, _mm_slli_si128(t1, 12));
+  t3 = _mm_xor_si128(_mm_xor_si128(_mm_srli_epi32(lo, 1), _mm_srli_epi32(lo, 2)), _mm_srli_epi32(lo, 7));
+  t3 = _mm_xor_si128(t3, t2);
+  lo = _mm_xor_si128(lo, t3);
+  return(_mm_xor_si128(hi, lo));
+}
+#endif /* defined( _FEATURE_HW_CLMUL ) */
+
+/*----------------------------------------------------------------------------*/
+/* x = (x ^ block) * h for n consecutive 16-byte blocks                       */
+/*----------------------------------------------------------------------------*/
+static void ghash_blocks(BYTE x[16], const BYTE h[16], const BYTE *data, int n)
+{
+  int i;
+
+#if defined( _FEATURE_HW_CLMUL )
+  if(sysblk.have_PCLMULQDQ)
+  {
+    const __m128i bswap = _mm_set_epi64x(0x0001020304050607ULL, 0x08090a0b0c0d0e0fULL);
+    __m128i hh, xx;
+
+    hh = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *) h), bswap);
+    xx = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *) x), bswap);
+    for(; n; n--, data += 16)
+    {
+      xx = _mm_xor_si128(xx, _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *) data), bswap));
+      xx = ghash_clmul(xx, hh);
+    }
+    _mm_storeu_si128((__m128i *) x, _mm_shuffle_epi8(xx, bswap));
+    return;
+  }
+#endif /* defined( _FEATURE_HW_CLMUL ) */
+
+  for(; n; n--, data += 16)
+  {
+    for(i = 0; i < 16; i++)
+      x[i] ^= data[i];
+    gcm_gf_mult(x, h, x);
+  }
+}
+
+#if defined( _FEATURE_146_MSA_EXTENSION_FACILITY_8 )
+/*----------------------------------------------------------------------------*/
+/* Keccak-f[1600] permutation                                                 */
+/*----------------------------------------------------------------------------*/
+/* The 25 lanes are kept in 64-bit integers and each round is written out in  */
+/* full so that the compiler can hold the column parities and the rotated     */
+/* lanes in host registers; theta, rho and pi are combined in one pass and    */
+/* chi is done a row at a time.                                               */
+/*----------------------------------------------------------------------------*/
+#define ROL64(x, n)  (((x) << (n)) | ((x) >> (64 - (n))))
+
+#define KECCAK_CHI(y) \
+  a[y * 5 + 0] = b[y * 5 + 0] ^ (~b[y * 5 + 1] & b[y * 5 + 2]); \
+  a[y * 5 + 1] = b[y * 5 + 1] ^ (~b[y * 5 + 2] & b[y * 5 + 3]); \
+  a[y * 5 + 2] = b[y * 5 + 2] ^ (~b[y * 5 + 3] & b[y * 5 + 4]); \
+  a[y * 5 + 3] = b[y * 5 + 3] ^ (~b[y * 5 + 4] & b[y * 5 + 0]); \
+  a[y * 5 + 4] = b[y * 5 + 4] ^ (~b[y * 5 + 0] & b[y * 5 + 1])
+
+static const U64 keccak_rc[24] =
+{
+  0x0000000000000001ULL, 0x0000000000008082ULL, 0x800000000000808aULL, 0x8000000080008000ULL,
+  0x000000000000808bULL, 0x0000000080000001ULL, 0x8000000080008081ULL, 0x8000000000008009ULL,
+  0x000000000000008aULL, 0x0000000000000088ULL, 0x0000000080008009ULL, 0x000000008000000aULL,
+  0x000000008000808bULL, 0x800000000000008bULL, 0x8000000000008089ULL, 0x8000000000008003ULL,
+  0x8000000000008002ULL, 0x8000000000000080ULL, 0x000000000000800aULL, 0x800000008000000aULL,
+  0x8000000080008081ULL, 0x8000000000008080ULL, 0x0000000080000001ULL, 0x8000000080008008ULL
+};
+
+static void keccak_f1600(U64 a[25])
+{
+  U64 b[25];
+  U64 c0, c1, c2, c3, c4;
+  U64 d0, d1, d2, d3, d4;
+  int round;
+
+  for(round = 0; round < 24; round++)
+  {
+    /* Theta */
+    c0 = a[0] ^ a[5] ^ a[10] ^ a[15] ^ a[20];
+    c1 = a[1] ^ a[6] ^ a[11] ^ a[16] ^ a[21];
+    c2 = a[2] ^ a[7] ^ a[12] ^ a[17] ^ a[22];
+    c3 = a[3] ^ a[8] ^ a[13] ^ a[18] ^ a[23];
+    c4 = a[4] ^ a[9] ^ a[14] ^ a[19] ^ a[24];
+    d0 = c4 ^ ROL64(c1, 1);
+    d1 = c0 ^ ROL64(c2, 1);
+    d2 = c1 ^ ROL64(c3, 1);
+    d3 = c2 ^ ROL64(c4, 1);
+    d4 = c3 ^ ROL64(c0, 1);
+
+    /* Rho and pi */
+    b[ 0] = a[ 0] ^ d0;
+    b[ 1] = ROL64(a[ 6] ^ d1, 44);
+    b[ 2] = ROL64(a[12] ^ d2, 43);
+    b[ 3] = ROL64(a[18] ^ d3, 21);
+    b[ 4] = ROL64(a[24] ^ d4, 14);
+    b[ 5] = ROL64(a[ 3] ^ d3, 28);
+    b[ 6] = ROL64(a[ 9] ^ d4, 20);
+    b[ 7] = ROL64(a[10] ^ d0,  3);
+    b[ 8] = ROL64(a[16] ^ d1, 45);
+    b[ 9] = ROL64(a[22] ^ d2, 61);
+    b[10] = ROL64(a[ 1] ^ d1,  1);
+    b[11] = ROL64(a[ 7] ^ d2,  6);
+    b[12] = ROL64(a[13] ^ d3, 25);
+    b[13] = ROL64(a[19] ^ d4,  8);
+    b[14] = ROL64(a[20] ^ d0, 18);
+    b[15] = ROL64(a[ 4] ^ d4, 27);
+    b[16] = ROL64(a[ 5] ^ d0, 36);
+    b[17] = ROL64(a[11] ^ d1, 10);
+    b[18] = ROL64(a[17] ^ d2, 15);
+    b[19] = ROL64(a[23] ^ d3, 56);
+    b[20] = ROL64(a[ 2] ^ d2, 62);
+    b[21] = ROL64(a[ 8] ^ d3, 55);
+    b[22] = ROL64(a[14] ^ d4, 39);
+    b[23] = ROL64(a[15] ^ d0, 41);
+    b[24] = ROL64(a[21] ^ d1,  2);
+
+    /* Chi */
+    KECCAK_CHI(0);
+    KECCAK_CHI(1);
+    KECCAK_CHI(2);
+    KECCAK_CHI(3);
+    KECCAK_CHI(4);
+
+    /* Iota */
+    a[0] ^= keccak_rc[round];
+  }
+}
+
+#undef KECCAK_CHI
+#undef ROL64
+
+/*----------------------------------------------------------------------------*/
+/* Get the chaining vector (the state in Keccak byte order)                   */
+/*----------------------------------------------------------------------------*/
+static void sha3_getcv(U64 state[25], BYTE icv[200])
+{
+  int i, j;
+
+  for(i = 0; i < 25; i++)
+    for(j = 0; j < 8; j++)
+      icv[i * 8 + j] = (BYTE)(state[i] >> (j * 8));
+}
+
+/*----------------------------------------------------------------------------*/
+/* Set the initial chaining value                                             */
+/*----------------------------------------------------------------------------*/
+static void sha3_seticv(U64 state[25], BYTE icv[200])
+{
+  int i, j;
+
+  for(i = 0; i < 25; i++)
+  {
+    state[i] = 0;
+    for(j = 0; j < 8; j++)
+      state[i] |= ((U64)icv[i * 8 + j]) << (j * 8);
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/* Absorb n consecutive message blocks of rate bytes                          */
+/*----------------------------------------------------------------------------*/
+static void sha3_blocks(U64 state[25], const BYTE *data, int n, int rate)
+{
+  int i;
+
+  for(; n; n--, data += rate)
+  {
+    for(i = 0; i < rate / 8; i++)
+      state[i] ^= bswap_64(fetch_dw(&data[i * 8]));
+    keccak_f1600(state);
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/* Message block length (rate) of SHA-3 and SHAKE FC 32-37                    */
+/*----------------------------------------------------------------------------*/
+static int sha3_rate(int fc)
+{
+  static const int rate[6] = { 144, 136, 104, 72, 168, 136 };
+
+  return(rate[fc - 32]);
+}
+#endif /* defined( _FEATURE_146_MSA_EXTENSION_FACILITY_8 ) */
+
 #if defined( _FEATURE_076_MSA_EXTENSION_FACILITY_3 )
 /*----------------------------------------------------------------------------*/
 /* Unwrap key using aes                                                       */
@@ -834,6 +1545,40 @@ static BYTE exp_table[128][16] =
 };
 #endif /* #ifndef __STATIC_FUNCTIONS__ */
 
+#if defined( FEATURE_MSA_EXTENSION_FACILITY_1 )
+/*----------------------------------------------------------------------------*/
+/* Length of the run of whole 16-byte blocks at the addresses in r1, r2 and   */
+/* r3 that can be processed directly in main storage. The run ends at the end */
+/* of the data, the CPU-determined amount or the nearest page boundary of any */
+/* operand. Returns 0 when the next block crosses a page boundary.            */
+/*----------------------------------------------------------------------------*/
+static int ARCH_DEP(aes_run)(int r1, int r2, int r3, int crypted, REGS *regs)
+{
+  VADR len;
+
+  len = min(GR_A(r2 + 1, regs), (VADR)(PROCESS_MAX - crypted));
+  len = min(len, PAGEFRAME_PAGESIZE - (GR_A(r1, regs) & PAGEFRAME_BYTEMASK));
+  len = min(len, PAGEFRAME_PAGESIZE - (GR_A(r2, regs) & PAGEFRAME_BYTEMASK));
+  len = min(len, PAGEFRAME_PAGESIZE - (GR_A(r3, regs) & PAGEFRAME_BYTEMASK));
+  return((int)(len & ~15));
+}
+#endif /* defined( FEATURE_MSA_EXTENSION_FACILITY_1 ) */
+
+/*----------------------------------------------------------------------------*/
+/* Length of the run of whole message blocks at the address in r2 that can be */
+/* hashed directly in main storage. The run ends at the end of the data, the  */
+/* CPU-determined amount or the page boundary. Returns 0 when the next block  */
+/* crosses a page boundary.                                                   */
+/*----------------------------------------------------------------------------*/
+static int ARCH_DEP(hash_run)(int r2, int blocklen, int crypted, REGS *regs)
+{
+  VADR len;
+
+  len = min(GR_A(r2 + 1, regs), (VADR)(PROCESS_MAX - crypted));
+  len = min(len, PAGEFRAME_PAGESIZE - (GR_A(r2, regs) & PAGEFRAME_BYTEMASK));
+  return((int)(len - len % blocklen));
+}
+
 /*----------------------------------------------------------------------------*/
 /* Compute intermediate message digest (KIMD) FC 1-3                          */
 /*----------------------------------------------------------------------------*/
@@ -851,10 +1596,12 @@ static void ARCH_DEP(kimd_sha)(int r1, int r2, REGS *regs, int klmd)
 
   int crypted;
   int fc;
+  int len;
   BYTE message_block[128];
   int message_blocklen = 0;
   BYTE parameter_block[64];
   int parameter_blocklen = 0;
+  BYTE *src;
 
   UNREFERENCED(r1);
 
@@ -944,20 +1691,29 @@ static void ARCH_DEP(kimd_sha)(int r1, int r2, REGS *regs, int klmd)
   }
 
   /* Try to process the CPU-determined amount of data */
-  for(crypted = 0; crypted < PROCESS_MAX; crypted += message_blocklen)
+  for(crypted = 0; crypted < PROCESS_MAX; crypted += len)
   {
-    /* Fetch and process a block of data */
-    ARCH_DEP(vfetchc)(message_block, message_blocklen - 1, GR_A(r2, regs) & ADDRESS_MAXWRAP(regs), r2, regs);
+    /* Hash as many blocks as possible directly from main storage */
+    len = ARCH_DEP(hash_run)(r2, message_blocklen, crypted, regs);
+    if(likely(len))
+      src = MADDRL(GR_A(r2, regs) & ADDRESS_MAXWRAP(regs), len, r2, regs, ACCTYPE_READ, regs->psw.pkey);
+    else
+    {
+      /* The block crosses a page boundary */
+      len = message_blocklen;
+      ARCH_DEP(vfetchc)(message_block, message_blocklen - 1, GR_A(r2, regs) & ADDRESS_MAXWRAP(regs), r2, regs);
+      src = message_block;
+    }
 
 #ifdef OPTION_KIMD_DEBUG
-    LOGBYTE2("input :", message_block, 16, message_blocklen / 16);
+    LOGBYTE2("input :", src, 16, len / 16);
 #endif /* #ifdef OPTION_KIMD_DEBUG */
 
     switch(fc)
     {
       case 1: /* sha-1 */
       {
-        SHA1Transform(sha1_ctx.state, message_block);
+        sha1_blocks(sha1_ctx.state, src, len / message_blocklen);
         sha1_getcv(&sha1_ctx, parameter_block);
         break;
       }
@@ -965,7 +1721,7 @@ static void ARCH_DEP(kimd_sha)(int r1, int r2, REGS *regs, int klmd)
 #if defined( FEATURE_MSA_EXTENSION_FACILITY_1 )
       case 2: /* sha-256 */
       {
-        SHA256Transform(sha2_ctx.state.st32, message_block);
+        sha256_blocks(sha2_ctx.state.st32, src, len / message_blocklen);
         sha256_getcv(&sha2_ctx, parameter_block);
         break;
       }
@@ -974,7 +1730,7 @@ static void ARCH_DEP(kimd_sha)(int r1, int r2, REGS *regs, int klmd)
 #if defined( FEATURE_MSA_EXTENSION_FACILITY_2 )
       case 3: /* sha-512 */
       {
-        SHA512Transform(sha512_ctx.state.st64, message_block);
+        sha512_blocks(sha512_ctx.state.st64, src, len / message_blocklen);
         sha512_getcv(&sha512_ctx, parameter_block);
         break;
       }
@@ -997,8 +1753,8 @@ static void ARCH_DEP(kimd_sha)(int r1, int r2, REGS *regs, int klmd)
 #endif /* #ifdef OPTION_KIMD_DEBUG */
 
     /* Update the registers */
-    SET_GR_A(r2, regs, GR_A(r2, regs) + message_blocklen);
-    SET_GR_A(r2 + 1, regs, GR_A(r2 + 1, regs) - message_blocklen);
+    SET_GR_A(r2, regs, GR_A(r2, regs) + len);
+    SET_GR_A(r2 + 1, regs, GR_A(r2 + 1, regs) - len);
 
 #ifdef OPTION_KIMD_DEBUG
     WRMSG(HHC90108, "D", r2, (regs)->GR(r2));
@@ -1026,9 +1782,10 @@ static void ARCH_DEP(kimd_sha)(int r1, int r2, REGS *regs, int klmd)
 static void ARCH_DEP(kimd_ghash)(int r1, int r2, REGS *regs)
 {
   int crypted;
-  int i;
+  int len;
   BYTE message_block[16];
   BYTE parameter_block[32];
+  BYTE *src;
 
   UNREFERENCED(r1);
 
@@ -1055,19 +1812,26 @@ static void ARCH_DEP(kimd_ghash)(int r1, int r2, REGS *regs)
 #endif /* #ifdef OPTION_KIMD_DEBUG */
 
   /* Try to process the CPU-determined amount of data */
-  for(crypted = 0; crypted < PROCESS_MAX; crypted += 16)
+  for(crypted = 0; crypted < PROCESS_MAX; crypted += len)
   {
-    /* Fetch and process a block of data */
-    ARCH_DEP(vfetchc)(message_block, 15, GR_A(r2, regs) & ADDRESS_MAXWRAP(regs), r2, regs);
+    /* Hash as many blocks as possible directly from main storage */
+    len = ARCH_DEP(hash_run)(r2, 16, crypted, regs);
+    if(likely(len))
+      src = MADDRL(GR_A(r2, regs) & ADDRESS_MAXWRAP(regs), len, r2, regs, ACCTYPE_READ, regs->psw.pkey);
+    else
+    {
+      /* The block crosses a page boundary */
+      len = 16;
+      ARCH_DEP(vfetchc)(message_block, 15, GR_A(r2, regs) & ADDRESS_MAXWRAP(regs), r2, regs);
+      src = message_block;
+    }
 
 #ifdef OPTION_KIMD_DEBUG
-    LOGBYTE("input :", message_block, 16);
+    LOGBYTE2("input :", src, 16, len / 16);
 #endif /* #ifdef OPTION_KIMD_DEBUG */
 
     /* XOR and multiply */
-    for(i = 0; i < 16; i++)
-      parameter_block[i] ^= message_block[i];
-    gcm_gf_mult(parameter_block, &parameter_block[16], parameter_block);
+    ghash_blocks(parameter_block, &parameter_block[16], src, len / 16);
 
     /* Store the output chaining value */
     ARCH_DEP(vstorec)(parameter_block, 15, GR_A(1, regs) & ADDRESS_MAXWRAP(regs), 1, regs);
@@ -1077,8 +1841,8 @@ static void ARCH_DEP(kimd_ghash)(int r1, int r2, REGS *regs)
 #endif /* #ifdef OPTION_KIMD_DEBUG */
 
     /* Update the registers */
-    SET_GR_A(r2, regs, GR_A(r2, regs) + 16);
-    SET_GR_A(r2 + 1, regs, GR_A(r2 + 1, regs) - 16);
+    SET_GR_A(r2, regs, GR_A(r2, regs) + len);
+    SET_GR_A(r2 + 1, regs, GR_A(r2 + 1, regs) - len);
 
 #ifdef OPTION_KIMD_DEBUG
     WRMSG(HHC90108, "D", r2, (regs)->GR(r2));
@@ -1098,6 +1862,102 @@ static void ARCH_DEP(kimd_ghash)(int r1, int r2, REGS *regs)
 }
 #endif /* defined( FEATURE_077_MSA_EXTENSION_FACILITY_4 ) */
 
+#if defined( FEATURE_146_MSA_EXTENSION_FACILITY_8 )
+/*----------------------------------------------------------------------------*/
+/* Compute intermediate message digest (KIMD) FC 32-37                        */
+/*----------------------------------------------------------------------------*/
+static void ARCH_DEP(kimd_sha3)(int r1, int r2, REGS *regs, int klmd)
+{
+  int crypted;
+  int len;
+  BYTE message_block[168];
+  int message_blocklen;
+  BYTE parameter_block[200];
+  BYTE *src;
+  U64 state[25];
+
+  UNREFERENCED(r1);
+
+  /* Initialize values */
+  message_blocklen = sha3_rate(GR0_fc(regs));
+
+  /* Check special conditions */
+  if(unlikely(!klmd && (GR_A(r2 + 1, regs) % message_blocklen)))
+    ARCH_DEP(program_interrupt)(regs, PGM_SPECIFICATION_EXCEPTION);
+
+  /* Return with cc 0 on zero length */
+  if(unlikely(!GR_A(r2 + 1, regs)))
+  {
+    regs->psw.cc = 0;
+    return;
+  }
+
+  /* Test writeability output chaining value */
+  ARCH_DEP(validate_operand)(GR_A(1, regs) & ADDRESS_MAXWRAP(regs), 1, 199, ACCTYPE_WRITE, regs);
+
+  /* Fetch the parameter block */
+  ARCH_DEP(vfetchc)(parameter_block, 199, GR_A(1, regs) & ADDRESS_MAXWRAP(regs), 1, regs);
+
+#ifdef OPTION_KIMD_DEBUG
+  LOGBYTE2("icv   :", parameter_block, 16, 200 / 16);
+#endif /* #ifdef OPTION_KIMD_DEBUG */
+
+  /* Set initial chaining value */
+  sha3_seticv(state, parameter_block);
+
+  /* Try to process the CPU-determined amount of data */
+  for(crypted = 0; crypted < PROCESS_MAX; crypted += len)
+  {
+    /* Hash as many blocks as possible directly from main storage */
+    len = ARCH_DEP(hash_run)(r2, message_blocklen, crypted, regs);
+    if(likely(len))
+      src = MADDRL(GR_A(r2, regs) & ADDRESS_MAXWRAP(regs), len, r2, regs, ACCTYPE_READ, regs->psw.pkey);
+    else
+    {
+      /* The block crosses a page boundary */
+      len = message_blocklen;
+      ARCH_DEP(vfetchc)(message_block, message_blocklen - 1, GR_A(r2, regs) & ADDRESS_MAXWRAP(regs), r2, regs);
+      src = message_block;
+    }
+
+#ifdef OPTION_KIMD_DEBUG
+    LOGBYTE2("input :", src, 8, len / 8);
+#endif /* #ifdef OPTION_KIMD_DEBUG */
+
+    sha3_blocks(state, src, len / message_blocklen, message_blocklen);
+    sha3_getcv(state, parameter_block);
+
+    /* Store the output chaining value */
+    ARCH_DEP(vstorec)(parameter_block, 199, GR_A(1, regs) & ADDRESS_MAXWRAP(regs), 1, regs);
+
+#ifdef OPTION_KIMD_DEBUG
+    LOGBYTE2("ocv   :", parameter_block, 16, 200 / 16);
+#endif /* #ifdef OPTION_KIMD_DEBUG */
+
+    /* Update the registers */
+    SET_GR_A(r2, regs, GR_A(r2, regs) + len);
+    SET_GR_A(r2 + 1, regs, GR_A(r2 + 1, regs) - len);
+
+#ifdef OPTION_KIMD_DEBUG
+    WRMSG(HHC90108, "D", r2, (regs)->GR(r2));
+    WRMSG(HHC90108, "D", r2 + 1, (regs)->GR(r2 + 1));
+#endif /* #ifdef OPTION_KIMD_DEBUG */
+
+    /* check for end of data */
+    if(unlikely(GR_A(r2 + 1, regs) < (unsigned) message_blocklen))
+    {
+      if(unlikely(klmd))
+        return;
+      regs->psw.cc = 0;
+      return;
+    }
+  }
+
+  /* CPU-determined amount of data processed */
+  regs->psw.cc = 3;
+}
+#endif /* defined( FEATURE_146_MSA_EXTENSION_FACILITY_8 ) */
+
 /*----------------------------------------------------------------------------*/
 /* Compute last message digest (KLMD) FC 1-3                                  */
 /*----------------------------------------------------------------------------*/
@@ -1237,14 +2097,14 @@ static void ARCH_DEP(klmd_sha)(int r1, int r2, REGS *regs)
     {
       case 1: /* sha-1 */
       {
-        SHA1Transform(sha1_ctx.state, message_block);
+        sha1_blocks(sha1_ctx.state, message_block, 1);
         break;
       }
 
 #if defined( FEATURE_MSA_EXTENSION_FACILITY_1 )
       case 2: /* sha-256 */
       {
-        SHA256Transform(sha2_ctx.state.st32, message_block);
+        sha256_blocks(sha2_ctx.state.st32, message_block, 1);
         break;
       }
 #endif /* defined( FEATURE_MSA_EXTENSION_FACILITY_1 ) */
@@ -1252,7 +2112,7 @@ static void ARCH_DEP(klmd_sha)(int r1, int r2, REGS *regs)
 #if defined( FEATURE_MSA_EXTENSION_FACILITY_2 )
       case 3: /* sha-512 */
       {
-        SHA512Transform(sha512_ctx.state.st64, message_block);
+        sha512_blocks(sha512_ctx.state.st64, message_block, 1);
         break;
       }
 #endif /* defined( FEATURE_MSA_EXTENSION_FACILITY_2 ) */
@@ -1276,7 +2136,7 @@ static void ARCH_DEP(klmd_sha)(int r1, int r2, REGS *regs)
   {
     case 1: /* sha-1 */
     {
-      SHA1Transform(sha1_ctx.state, message_block);
+      sha1_blocks(sha1_ctx.state, message_block, 1);
       sha1_getcv(&sha1_ctx, parameter_block);
       break;
     }
@@ -1284,7 +2144,7 @@ static void ARCH_DEP(klmd_sha)(int r1, int r2, REGS *regs)
 #if defined( FEATURE_MSA_EXTENSION_FACILITY_1 )
     case 2: /* sha-256 */
     {
-      SHA256Transform(sha2_ctx.state.st32, message_block);
+      sha256_blocks(sha2_ctx.state.st32, message_block, 1);
       sha256_getcv(&sha2_ctx, parameter_block);
       break;
     }
@@ -1293,7 +2153,7 @@ static void ARCH_DEP(klmd_sha)(int r1, int r2, REGS *regs)
 #if defined( FEATURE_MSA_EXTENSION_FACILITY_2 )
     case 3: /* sha-512 */
     {
-      SHA512Transform(sha512_ctx.state.st64, message_block);
+      sha512_blocks(sha512_ctx.state.st64, message_block, 1);
       sha512_getcv(&sha512_ctx, parameter_block);
       break;
     }
@@ -1326,6 +2186,161 @@ static void ARCH_DEP(klmd_sha)(int r1, int r2, REGS *regs)
   regs->psw.cc = 0;
 }
 
+#if defined( FEATURE_146_MSA_EXTENSION_FACILITY_8 )
+/*----------------------------------------------------------------------------*/
+/* Compute last message digest (KLMD) FC 32-37                                */
+/*----------------------------------------------------------------------------*/
+/* SHA-3 leaves the digest in the leftmost bytes of the parameter block.      */
+/* SHAKE squeezes the first operand length of output to the first operand,    */
+/* a CPU determined amount at a time. When it stops short with cc3, the       */
+/* parameter block holds the state for the next output block and the squeeze  */
+/* in progress bit in GR0 is set, so that re-execution continues the output   */
+/* instead of padding again; the bit is reset when the output is complete.    */
+/* The output of one execution is validated before it is stored, so an access */
+/* exception leaves the registers and parameter block as they were.           */
+/*----------------------------------------------------------------------------*/
+static void ARCH_DEP(klmd_sha3)(int r1, int r2, REGS *regs)
+{
+  int fc;
+  int i;
+  int len;
+  BYTE message_block[168];
+  int message_blocklen;
+  BYTE parameter_block[200];
+  int shake;
+  U64 state[25];
+  VADR addr;
+  GREG olen;
+  GREG done;
+  int squeezing;
+
+  /* Initialize values */
+  fc = GR0_fc(regs);
+  message_blocklen = sha3_rate(fc);
+  shake = fc >= 36;
+  squeezing = shake && GR0_sip(regs);
+  olen = 0;
+
+  /* Check special conditions */
+  if(unlikely(shake && (!r1 || r1 & 0x01)))
+    ARCH_DEP(program_interrupt)(regs, PGM_SPECIFICATION_EXCEPTION);
+
+  /* Process intermediate message blocks */
+  if(unlikely(!squeezing && GR_A(r2 + 1, regs) >= (unsigned) message_blocklen))
+  {
+    ARCH_DEP(kimd_sha3)(r1, r2, regs, 1);
+    if(regs->psw.cc == 3)
+      return;
+  }
+
+  /* Test writeability output chaining value */
+  ARCH_DEP(validate_operand)(GR_A(1, regs) & ADDRESS_MAXWRAP(regs), 1, 199, ACCTYPE_WRITE, regs);
+
+  /* Test writeability of the output of this execution, a page at a   */
+  /* time, so that any access exception is recognized before anything */
+  /* is stored and the instruction can simply be executed again       */
+  if(shake)
+  {
+    olen = min(GR_A(r1 + 1, regs), (GREG)(PROCESS_MAX - PROCESS_MAX % message_blocklen));
+    for(done = 0; done < olen; done += PAGEFRAME_PAGESIZE - (addr & PAGEFRAME_BYTEMASK))
+    {
+      addr = (GR_A(r1, regs) + done) & ADDRESS_MAXWRAP(regs);
+      ARCH_DEP(validate_operand)(addr, r1, 0, ACCTYPE_WRITE, regs);
+    }
+  }
+
+  /* Fetch the parameter block */
+  ARCH_DEP(vfetchc)(parameter_block, 199, GR_A(1, regs) & ADDRESS_MAXWRAP(regs), 1, regs);
+
+#ifdef OPTION_KLMD_DEBUG
+  LOGBYTE2("icv   :", parameter_block, 16, 200 / 16);
+#endif /* #ifdef OPTION_KLMD_DEBUG */
+
+  /* Set initial chaining value */
+  sha3_seticv(state, parameter_block);
+
+  /* Absorb the last block unless the output is being continued */
+  if(likely(!squeezing))
+  {
+    /* Fetch possible last block of data */
+    i = GR_A(r2 + 1, regs);
+    if(likely(i))
+    {
+      ARCH_DEP(vfetchc)(message_block, i - 1, GR_A(r2, regs) & ADDRESS_MAXWRAP(regs), r2, regs);
+
+#ifdef OPTION_KLMD_DEBUG
+      LOGBYTE("input :", message_block, i);
+#endif /* #ifdef OPTION_KLMD_DEBUG */
+
+    }
+
+    /* Do the padding with the domain separation bits */
+    memset(&message_block[i], 0, message_blocklen - i);
+    message_block[i] = shake ? 0x1f : 0x06;
+    message_block[message_blocklen - 1] |= 0x80;
+    sha3_blocks(state, message_block, 1, message_blocklen);
+  }
+
+  /* Squeeze the output of this execution; the registers are only */
+  /* updated once all of it has been stored                         */
+  if(shake)
+  {
+    for(done = 0; done < olen; done += len)
+    {
+      sha3_getcv(state, parameter_block);
+      len = (int) min(olen - done, (GREG) message_blocklen);
+      ARCH_DEP(vstorec)(parameter_block, len - 1, (GR_A(r1, regs) + done) & ADDRESS_MAXWRAP(regs), r1, regs);
+
+#ifdef OPTION_KLMD_DEBUG
+      LOGBYTE2("output:", parameter_block, 8, len / 8);
+#endif /* #ifdef OPTION_KLMD_DEBUG */
+
+      if(done + len < GR_A(r1 + 1, regs))
+        keccak_f1600(state);
+    }
+    SET_GR_A(r1, regs, GR_A(r1, regs) + olen);
+    SET_GR_A(r1 + 1, regs, GR_A(r1 + 1, regs) - olen);
+
+#ifdef OPTION_KLMD_DEBUG
+    WRMSG(HHC90108, "D", r1, (regs)->GR(r1));
+    WRMSG(HHC90108, "D", r1 + 1, (regs)->GR(r1 + 1));
+#endif /* #ifdef OPTION_KLMD_DEBUG */
+
+  }
+
+  /* Store the message digest */
+  sha3_getcv(state, parameter_block);
+  ARCH_DEP(vstorec)(parameter_block, 199, GR_A(1, regs) & ADDRESS_MAXWRAP(regs), 1, regs);
+
+#ifdef OPTION_KLMD_DEBUG
+  LOGBYTE2("md    :", parameter_block, 16, 200 / 16);
+#endif /* #ifdef OPTION_KLMD_DEBUG */
+
+  /* Update registers */
+  if(likely(!squeezing))
+  {
+    SET_GR_A(r2, regs, GR_A(r2, regs) + GR_A(r2 + 1, regs));
+    SET_GR_A(r2 + 1, regs, 0);
+  }
+
+#ifdef OPTION_KLMD_DEBUG
+  WRMSG(HHC90108, "D", r2, (regs)->GR(r2));
+  WRMSG(HHC90108, "D", r2 + 1, (regs)->GR(r2 + 1));
+#endif /* #ifdef OPTION_KLMD_DEBUG */
+
+  /* Set condition code, continuing the output if it is not complete */
+  if(shake && GR_A(r1 + 1, regs))
+  {
+    regs->GR_L(0) |= 0x00000100;
+    regs->psw.cc = 3;
+    return;
+  }
+  if(shake)
+    regs->GR_L(0) &= ~0x00000100;
+  regs->psw.cc = 0;
+}
+#endif /* defined( FEATURE_146_MSA_EXTENSION_FACILITY_8 ) */
+
 /*----------------------------------------------------------------------------*/
 /* Cipher message (KM) FC 1-3 and 9-11                                        */
 /*----------------------------------------------------------------------------*/
@@ -1496,14 +2511,20 @@ static void ARCH_DEP(km_dea)(int r1, int r2, REGS *regs)
 /*----------------------------------------------------------------------------*/
 static void ARCH_DEP(km_aes)(int r1, int r2, REGS *regs)
 {
-  rijndael_ctx context;
+  int batch;
+  aes_context *context;
   int crypted;
+  BYTE *dst;
+  int i;
   int keylen;
+  int len;
   BYTE message_block[16];
   int modifier_bit;
   BYTE parameter_block[64];
   int parameter_blocklen;
+  int n;
   int r1_is_not_r2;
+  BYTE *src;
   int tfc;
   int wrap;
 
@@ -1549,39 +2570,61 @@ static void ARCH_DEP(km_aes)(int r1, int r2, REGS *regs)
   }
 #endif /* defined( FEATURE_076_MSA_EXTENSION_FACILITY_3 ) */
 
-  /* Set the cryptographic keys */
-  rijndael_set_key(&context, parameter_block, keylen * 8);
+  /* Get the cryptographic keys */
+  context = aes_get_context(regs, parameter_block, keylen);
 
   /* Try to process the CPU-determined amount of data */
   modifier_bit = GR0_m(regs);
   r1_is_not_r2 = r1 != r2;
-  for(crypted = 0; crypted < PROCESS_MAX; crypted += 16)
+  for(crypted = 0; crypted < PROCESS_MAX; crypted += len)
   {
-    /* Fetch a block of data */
-    ARCH_DEP(vfetchc)(message_block, 15, GR_A(r2, regs) & ADDRESS_MAXWRAP(regs), r2, regs);
+    /* Cipher as many blocks as possible directly in main storage */
+    len = ARCH_DEP(aes_run)(r1, r2, r2, crypted, regs);
+    if(likely(len))
+    {
+      src = MADDRL(GR_A(r2, regs) & ADDRESS_MAXWRAP(regs), len, r2, regs, ACCTYPE_READ, regs->psw.pkey);
+      dst = MADDRL(GR_A(r1, regs) & ADDRESS_MAXWRAP(regs), len, r1, regs, ACCTYPE_WRITE, regs->psw.pkey);
+      batch = aes_batch(dst, src);
+      for(i = 0; i < len; i += n * 16)
+      {
+        n = min(batch, (len - i) / 16);
+        if(modifier_bit)
+          aes_decrypt_blocks(context, &src[i], &dst[i], n);
+        else
+          aes_encrypt_blocks(context, &src[i], &dst[i], n);
+      }
+    }
+    else
+    {
+      /* The block crosses a page boundary */
+      len = 16;
+
+      /* Fetch a block of data */
+      ARCH_DEP(vfetchc)(message_block, 15, GR_A(r2, regs) & ADDRESS_MAXWRAP(regs), r2, regs);
 
 #ifdef OPTION_KM_DEBUG
-    LOGBYTE("input :", message_block, 16);
+      LOGBYTE("input :", message_block, 16);
 #endif /* #ifdef OPTION_KM_DEBUG */
 
-    /* Do the job */
-    if(modifier_bit)
-      rijndael_decrypt(&context, message_block, message_block);
-    else
-      rijndael_encrypt(&context, message_block, message_block);
+      /* Do the job */
+      if(modifier_bit)
+        aes_decrypt(context, message_block, message_block);
+      else
+        aes_encrypt(context, message_block, message_block);
 
-    /* Store the output */
-    ARCH_DEP(vstorec)(message_block, 15, GR_A(r1, regs) & ADDRESS_MAXWRAP(regs), r1, regs);
+      /* Store the output */
+      ARCH_DEP(vstorec)(message_block, 15, GR_A(r1, regs) & ADDRESS_MAXWRAP(regs), r1, regs);
 
 #ifdef OPTION_KM_DEBUG
-    LOGBYTE("output:", message_block, 16);
+      LOGBYTE("output:", message_block, 16);
 #endif /* #ifdef OPTION_KM_DEBUG */
+    }
 
     /* Update the registers */
-    SET_GR_A(r1, regs, GR_A(r1, regs) + 16);
+    SET_GR_A(r1, regs, GR_A(r1, regs) + len);
     if(likely(r1_is_not_r2))
-      SET_GR_A(r2, regs, GR_A(r2, regs) + 16);
-    SET_GR_A(r2 + 1, regs, GR_A(r2 + 1, regs) - 16);
+      SET_GR_A(r2, regs, GR_A(r2, regs) + len);
+    SET_GR_A(r2 + 1, regs, GR_A(r2 + 1, regs) - len);
 
 #ifdef OPTION_KM_DEBUG
     WRMSG(HHC90108, "D", r1, (regs)->GR(r1));
@@ -1608,17 +2651,25 @@ static void ARCH_DEP(km_aes)(int r1, int r2, REGS *regs)
 /*----------------------------------------------------------------------------*/
 static void ARCH_DEP(km_xts_aes)(int r1, int r2, REGS *regs)
 {
-  rijndael_ctx context;
+  int batch;
+  aes_context *context;
   int crypted;
+  BYTE *dst;
   int i;
+  int j;
   int keylen;
+  int len;
   BYTE message_block[16];
   int modifier_bit;
   BYTE parameter_block[80];
   int parameter_blocklen;
+  int n;
   int r1_is_not_r2;
+  BYTE *src;
   int tfc;
+  BYTE tweaks[16 * AES_PARALLEL];
   int wrap;
+  BYTE work[16 * AES_PARALLEL];
   BYTE *xts;
 
   /* Check special conditions */
@@ -1666,48 +2717,88 @@ static void ARCH_DEP(km_xts_aes)(int r1, int r2, REGS *regs)
     return;
   }
 
-  /* Set the cryptographic keys */
-  rijndael_set_key(&context, parameter_block, keylen * 8);
+  /* Get the cryptographic keys */
+  context = aes_get_context(regs, parameter_block, keylen);
 
   /* Try to process the CPU-determined amount of data */
   modifier_bit = GR0_m(regs);
   r1_is_not_r2 = r1 != r2;
-  for(crypted = 0; crypted < PROCESS_MAX; crypted += 16)
+  for(crypted = 0; crypted < PROCESS_MAX; crypted += len)
   {
-    /* Fetch a block of data */
-    ARCH_DEP(vfetchc)(message_block, 15, GR_A(r2, regs) & ADDRESS_MAXWRAP(regs), r2, regs);
+    /* Cipher as many blocks as possible directly in main storage */
+    len = ARCH_DEP(aes_run)(r1, r2, r2, crypted, regs);
+    if(likely(len))
+    {
+      src = MADDRL(GR_A(r2, regs) & ADDRESS_MAXWRAP(regs), len, r2, regs, ACCTYPE_READ, regs->psw.pkey);
+      dst = MADDRL(GR_A(r1, regs) & ADDRESS_MAXWRAP(regs), len, r1, regs, ACCTYPE_WRITE, regs->psw.pkey);
+      batch = aes_batch(dst, src);
+      for(i = 0; i < len; i += n * 16)
+      {
+        n = min(batch, (len - i) / 16);
+
+        /* Calculate the XTS of each block */
+        for(j = 0; j < n; j++)
+        {
+          memcpy(&tweaks[j * 16], xts, 16);
+          xts_mult_x(xts);
+        }
+
+        /* XOR, decrypt/encrypt and XOR again */
+        for(j = 0; j < n * 16; j++)
+          work[j] = src[i + j] ^ tweaks[j];
+        if(modifier_bit)
+          aes_decrypt_blocks(context, work, work, n);
+        else
+          aes_encrypt_blocks(context, work, work, n);
+        for(j = 0; j < n * 16; j++)
+          dst[i + j] = work[j] ^ tweaks[j];
+      }
+    }
+    else
+    {
+      /* The block crosses a page boundary */
+      len = 16;
+
+      /* Fetch a block of data */
+      ARCH_DEP(vfetchc)(message_block, 15, GR_A(r2, regs) & ADDRESS_MAXWRAP(regs), r2, regs);
 
 #ifdef OPTION_KM_DEBUG
-    LOGBYTE("input :", message_block, 16);
+      LOGBYTE("input :", message_block, 16);
 #endif /* #ifdef OPTION_KM_DEBUG */
 
-    /* XOR, decrypt/encrypt and XOR again*/
-    for(i = 0; i < 16; i++)
-      message_block[i] ^= parameter_block[parameter_blocklen - 16 + i];
-    if(modifier_bit)
-      rijndael_decrypt(&context, message_block, message_block);
-    else
-      rijndael_encrypt(&context, message_block, message_block);
-    for(i = 0; i < 16; i++)
-      message_block[i] ^= parameter_block[parameter_blocklen - 16 + i];
+      /* XOR, decrypt/encrypt and XOR again*/
+      for(i = 0; i < 16; i++)
+        message_block[i] ^= xts[i];
+      if(modifier_bit)
+        aes_decrypt(context, message_block, message_block);
+      else
+        aes_encrypt(context, message_block, message_block);
+      for(i = 0; i < 16; i++)
+        message_block[i] ^= xts[i];
 
-    /* Calculate output XTS */
-    xts_mult_x(xts);
+      /* Calculate output XTS */
+      xts_mult_x(xts);
 
-    /* Store the output and XTS */
-    ARCH_DEP(vstorec)(message_block, 15, GR_A(r1, regs) & ADDRESS_MAXWRAP(regs), r1, regs);
+      /* Store the output */
+      ARCH_DEP(vstorec)(message_block, 15, GR_A(r1, regs) & ADDRESS_MAXWRAP(regs), r1, regs);
+
+#ifdef OPTION_KM_DEBUG
+      LOGBYTE("output:", message_block, 16);
+#endif /* #ifdef OPTION_KM_DEBUG */
+    }
+
+    /* Store the XTS */
     ARCH_DEP(vstorec)(xts, 15, (GR_A(1, regs) + parameter_blocklen - 16) & ADDRESS_MAXWRAP(regs), 1, regs);
 
 #ifdef OPTION_KM_DEBUG
-    LOGBYTE("output:", message_block, 16);
     LOGBYTE("xts   :", xts, 16);
 #endif /* #ifdef OPTION_KM_DEBUG */
 
     /* Update the registers */
-    SET_GR_A(r1, regs, GR_A(r1, regs) + 16);
+    SET_GR_A(r1, regs, GR_A(r1, regs) + len);
     if(likely(r1_is_not_r2))
-      SET_GR_A(r2, regs, GR_A(r2, regs) + 16);
-    SET_GR_A(r2 + 1, regs, GR_A(r2 + 1, regs) - 16);
+      SET_GR_A(r2, regs, GR_A(r2, regs) + len);
+    SET_GR_A(r2 + 1, regs, GR_A(r2 + 1, regs) - len);
 
 #ifdef OPTION_KM_DEBUG
     WRMSG(HHC90108, "D", r1, (regs)->GR(r1));
@@ -1908,13 +2999,16 @@ static void ARCH_DEP(kmac_dea)(int r1, int r2, REGS *regs)
 /*----------------------------------------------------------------------------*/
 static void ARCH_DEP(kmac_aes)(int r1, int r2, REGS *regs)
 {
-  rijndael_ctx context;
+  aes_context *context;
   int crypted;
   int i;
+  int j;
   int keylen;
+  int len;
   BYTE message_block[16];
   BYTE parameter_block[80];
   int parameter_blocklen;
+  BYTE *src;
   int tfc;
   int wrap;
 
@@ -1964,25 +3058,43 @@ static void ARCH_DEP(kmac_aes)(int r1, int r2, REGS *regs)
     return;
   }
 
-  /* Set the cryptographic key */
-  rijndael_set_key(&context, &parameter_block[16], keylen * 8);
+  /* Get the cryptographic key */
+  context = aes_get_context(regs, &parameter_block[16], keylen);
 
   /* Try to process the CPU-determined amount of data */
-  for(crypted = 0; crypted < PROCESS_MAX; crypted += 16)
+  for(crypted = 0; crypted < PROCESS_MAX; crypted += len)
   {
-    /* Fetch a block of data */
-    ARCH_DEP(vfetchc)(message_block, 15, GR_A(r2, regs) & ADDRESS_MAXWRAP(regs), r2, regs);
+    /* Chain as many blocks as possible directly from main storage */
+    len = ARCH_DEP(aes_run)(r2, r2, r2, crypted, regs);
+    if(likely(len))
+    {
+      src = MADDRL(GR_A(r2, regs) & ADDRESS_MAXWRAP(regs), len, r2, regs, ACCTYPE_READ, regs->psw.pkey);
+      for(i = 0; i < len; i += 16)
+      {
+        for(j = 0; j < 16; j++)
+          message_block[j] = src[i + j] ^ parameter_block[j];
+        aes_encrypt(context, message_block, parameter_block);
+      }
+    }
+    else
+    {
+      /* The block crosses a page boundary */
+      len = 16;
+
+      /* Fetch a block of data */
+      ARCH_DEP(vfetchc)(message_block, 15, GR_A(r2, regs) & ADDRESS_MAXWRAP(regs), r2, regs);
 
 #ifdef OPTION_KMAC_DEBUG
-    LOGBYTE("input :", message_block, 16);
+      LOGBYTE("input :", message_block, 16);
 #endif /* #ifdef OPTION_KMAC_DEBUG */
 
-    /* XOR the message with chaining value */
-    for(i = 0; i < 16; i++)
-      message_block[i] ^= parameter_block[i];
+      /* XOR the message with chaining value */
+      for(i = 0; i < 16; i++)
+        message_block[i] ^= parameter_block[i];
 
-    /* Calculate the output chaining value */
-    rijndael_encrypt(&context, message_block, parameter_block);
+      /* Calculate the output chaining value */
+      aes_encrypt(context, message_block, parameter_block);
+    }
 
     /* Store the output chaining value */
     ARCH_DEP(vstorec)(parameter_block, 15, GR_A(1, regs) & ADDRESS_MAXWRAP(regs), 1, regs);
@@ -1992,8 +3104,8 @@ static void ARCH_DEP(kmac_aes)(int r1, int r2, REGS *regs)
 #endif /* #ifdef OPTION_KMAC_DEBUG */
 
     /* Update the registers */
-    SET_GR_A(r2, regs, GR_A(r2, regs) + 16);
-    SET_GR_A(r2 + 1, regs, GR_A(r2 + 1, regs) - 16);
+    SET_GR_A(r2, regs, GR_A(r2, regs) + len);
+    SET_GR_A(r2 + 1, regs, GR_A(r2 + 1, regs) - len);
 
 #ifdef OPTION_KMAC_DEBUG
     WRMSG(HHC90108, "D", r2, (regs)->GR(r2));
@@ -2254,18 +3366,26 @@ static void ARCH_DEP(kmc_dea)(int r1, int r2, REGS *regs)
 /*----------------------------------------------------------------------------*/
 static void ARCH_DEP(kmc_aes)(int r1, int r2, REGS *regs)
 {
-  rijndael_ctx context;
+  int batch;
+  BYTE cipher_blocks[16 * AES_PARALLEL];
+  aes_context *context;
   int crypted;
+  BYTE *dst;
   int i;
+  int j;
   int keylen;
+  int len;
   BYTE message_block[16];
   int modifier_bit;
   BYTE ocv[16];
   BYTE parameter_block[80];
   int parameter_blocklen;
+  int n;
   int r1_is_not_r2;
+  BYTE *src;
   int tfc;
   int wrap;
+  BYTE work[16 * AES_PARALLEL];
 
   /* Check special conditions */
   if(unlikely(GR_A(r2 + 1, regs) % 16))
@@ -2313,46 +3433,90 @@ static void ARCH_DEP(kmc_aes)(int r1, int r2, REGS *regs)
   }
 #endif /* defined( FEATURE_076_MSA_EXTENSION_FACILITY_3 ) */
 
-  /* Set the cryptographic key */
-  rijndael_set_key(&context, &parameter_block[16], keylen * 8);
+  /* Get the cryptographic key */
+  context = aes_get_context(regs, &parameter_block[16], keylen);
 
   /* Try to process the CPU-determined amount of data */
   modifier_bit = GR0_m(regs);
   r1_is_not_r2 = r1 != r2;
-  for(crypted = 0; crypted < PROCESS_MAX; crypted += 16)
+  for(crypted = 0; crypted < PROCESS_MAX; crypted += len)
   {
-    /* Fetch a block of data */
-    ARCH_DEP(vfetchc)(message_block, 15, GR_A(r2, regs) & ADDRESS_MAXWRAP(regs), r2, regs);
+    /* Cipher as many blocks as possible directly in main storage */
+    len = ARCH_DEP(aes_run)(r1, r2, r2, crypted, regs);
+    if(likely(len))
+    {
+      src = MADDRL(GR_A(r2, regs) & ADDRESS_MAXWRAP(regs), len, r2, regs, ACCTYPE_READ, regs->psw.pkey);
+      dst = MADDRL(GR_A(r1, regs) & ADDRESS_MAXWRAP(regs), len, r1, regs, ACCTYPE_WRITE, regs->psw.pkey);
+      if(modifier_bit)
+      {
+        /* Decryption does not depend on the previous output */
+        batch = aes_batch(dst, src);
+        for(i = 0; i < len; i += n * 16)
+        {
+          n = min(batch, (len - i) / 16);
+
+          /* Save, decrypt and XOR with the previous cipher block */
+          memcpy(cipher_blocks, &src[i], n * 16);
+          aes_decrypt_blocks(context, cipher_blocks, work, n);
+          for(j = 0; j < 16; j++)
+            work[j] ^= parameter_block[j];
+          for(j = 16; j < n * 16; j++)
+            work[j] ^= cipher_blocks[j - 16];
+          memcpy(&dst[i], work, n * 16);
+          memcpy(parameter_block, &cipher_blocks[(n - 1) * 16], 16);
+        }
+      }
+      else
+      {
+        for(i = 0; i < len; i += 16)
+        {
+          /* XOR, encrypt and save */
+          for(j = 0; j < 16; j++)
+            message_block[j] = src[i + j] ^ parameter_block[j];
+          aes_encrypt(context, message_block, parameter_block);
+          memcpy(&dst[i], parameter_block, 16);
+        }
+      }
+      memcpy(ocv, parameter_block, 16);
+    }
+    else
+    {
+      /* The block crosses a page boundary */
+      len = 16;
+
+      /* Fetch a block of data */
+      ARCH_DEP(vfetchc)(message_block, 15, GR_A(r2, regs) & ADDRESS_MAXWRAP(regs), r2, regs);
 
 #ifdef OPTION_KMC_DEBUG
-    LOGBYTE("input :", message_block, 16);
+      LOGBYTE("input :", message_block, 16);
 #endif /* #ifdef OPTION_KMC_DEBUG */
 
-    /* Do the job */
-    if(modifier_bit)
-    {
+      /* Do the job */
+      if(modifier_bit)
+      {
 
-      /* Save, decrypt and XOR */
-      memcpy(ocv, message_block, 16);
-      rijndael_decrypt(&context, message_block, message_block);
-      for(i = 0; i < 16; i++)
-        message_block[i] ^= parameter_block[i];
-    }
-    else
-    {
-      /* XOR, encrypt and save */
-      for(i = 0; i < 16; i++)
-        message_block[i] ^= parameter_block[i];
-      rijndael_encrypt(&context, message_block, message_block);
-      memcpy(ocv, message_block, 16);
-    }
+        /* Save, decrypt and XOR */
+        memcpy(ocv, message_block, 16);
+        aes_decrypt(context, message_block, message_block);
+        for(i = 0; i < 16; i++)
+          message_block[i] ^= parameter_block[i];
+      }
+      else
+      {
+        /* XOR, encrypt and save */
+        for(i = 0; i < 16; i++)
+          message_block[i] ^= parameter_block[i];
+        aes_encrypt(context, message_block, message_block);
+        memcpy(ocv, message_block, 16);
+      }
 
-    /* Store the output */
-    ARCH_DEP(vstorec)(message_block, 15, GR_A(r1, regs) & ADDRESS_MAXWRAP(regs), r1, regs);
+      /* Store the output */
+      ARCH_DEP(vstorec)(message_block, 15, GR_A(r1, regs) & ADDRESS_MAXWRAP(regs), r1, regs);
 
 #ifdef OPTION_KMC_DEBUG
-    LOGBYTE("output:", message_block, 16);
+      LOGBYTE("output:", message_block, 16);
 #endif /* #ifdef OPTION_KMC_DEBUG */
+    }
 
     /* Store the output chaining value */
     ARCH_DEP(vstorec)(ocv, 15, GR_A(1, regs) & ADDRESS_MAXWRAP(regs), 1, regs);
@@ -2362,10 +3526,10 @@ static void ARCH_DEP(kmc_aes)(int r1, int r2, REGS *regs)
 #endif /* #ifdef OPTION_KMC_DEBUG */
 
     /* Update the registers */
-    SET_GR_A(r1, regs, GR_A(r1, regs) + 16);
+    SET_GR_A(r1, regs, GR_A(r1, regs) + len);
     if(likely(r1_is_not_r2))
-      SET_GR_A(r2, regs, GR_A(r2, regs) + 16);
-    SET_GR_A(r2 + 1, regs, GR_A(r2 + 1, regs) - 16);
+      SET_GR_A(r2, regs, GR_A(r2, regs) + len);
+    SET_GR_A(r2 + 1, regs, GR_A(r2 + 1, regs) - len);
 
 #ifdef OPTION_KMC_DEBUG
     WRMSG(HHC90108, "D", r1, (regs)->GR(r1));
@@ -2380,7 +3544,7 @@ static void ARCH_DEP(kmc_aes)(int r1, int r2, REGS *regs)
       return;
     }
 
-    /* Set cv for next 16 bytes */
+    /* Set cv for next blocks */
     memcpy(parameter_block, ocv, 16);
   }
 
@@ -2703,20 +3867,28 @@ static void ARCH_DEP(kmctr_dea)(int r1, int r2, int r3, REGS *regs)
 /*----------------------------------------------------------------------------*/
 static void ARCH_DEP(kmctr_aes)(int r1, int r2, int r3, REGS *regs)
 {
-  rijndael_ctx context;
+  int batch;
+  aes_context *context;
   BYTE countervalue_block[16];
   int crypted;
+  BYTE *ctr;
+  BYTE *dst;
   int i;
+  int j;
   int keylen;
+  int len;
   BYTE message_block[16];
   BYTE parameter_block[64];
   int parameter_blocklen;
+  int n;
   int r1_is_not_r2;
   int r1_is_not_r3;
   int r2_is_not_r3;
   int fc;
+  BYTE *src;
   int tfc;
   int wrap;
+  BYTE work[16 * AES_PARALLEL];
 
   /* Check special conditions */
   if(unlikely(GR_A(r2 + 1, regs) % 16))
@@ -2760,44 +3932,71 @@ static void ARCH_DEP(kmctr_aes)(int r1, int r2, int r3, REGS *regs)
     return;
   }
 
-  /* Set the cryptographic key */
-  rijndael_set_key(&context, parameter_block, keylen * 8);
+  /* Get the cryptographic key */
+  context = aes_get_context(regs, parameter_block, keylen);
 
   /* Try to process the CPU-determined amount of data */
   r1_is_not_r2 = r1 != r2;
   r1_is_not_r3 = r1 != r3;
-  r2_is_not_r3 = r1 != r2;
-  for(crypted = 0; crypted < PROCESS_MAX; crypted += 16)
+  r2_is_not_r3 = r2 != r3;
+  for(crypted = 0; crypted < PROCESS_MAX; crypted += len)
   {
-    /* Fetch a block of data and counter-value */
-    ARCH_DEP(vfetchc)(message_block, 15, GR_A(r2, regs) & ADDRESS_MAXWRAP(regs), r2, regs);
-    ARCH_DEP(vfetchc)(countervalue_block, 15, GR_A(r3, regs) & ADDRESS_MAXWRAP(regs), r3, regs);
+    /* Cipher as many blocks as possible directly in main storage */
+    len = 0;
+    if(likely(r1_is_not_r3 && r2_is_not_r3))
+      len = ARCH_DEP(aes_run)(r1, r2, r3, crypted, regs);
+    if(likely(len))
+    {
+      src = MADDRL(GR_A(r2, regs) & ADDRESS_MAXWRAP(regs), len, r2, regs, ACCTYPE_READ, regs->psw.pkey);
+      ctr = MADDRL(GR_A(r3, regs) & ADDRESS_MAXWRAP(regs), len, r3, regs, ACCTYPE_READ, regs->psw.pkey);
+      dst = MADDRL(GR_A(r1, regs) & ADDRESS_MAXWRAP(regs), len, r1, regs, ACCTYPE_WRITE, regs->psw.pkey);
+      batch = min(aes_batch(dst, src), aes_batch(dst, ctr));
+      for(i = 0; i < len; i += n * 16)
+      {
+        n = min(batch, (len - i) / 16);
+
+        /* Encrypt and XOR */
+        aes_encrypt_blocks(context, &ctr[i], work, n);
+        for(j = 0; j < n * 16; j++)
+          work[j] ^= src[i + j];
+        memcpy(&dst[i], work, n * 16);
+      }
+    }
+    else
+    {
+      /* A block crosses a page boundary */
+      len = 16;
+
+      /* Fetch a block of data and counter-value */
+      ARCH_DEP(vfetchc)(message_block, 15, GR_A(r2, regs) & ADDRESS_MAXWRAP(regs), r2, regs);
+      ARCH_DEP(vfetchc)(countervalue_block, 15, GR_A(r3, regs) & ADDRESS_MAXWRAP(regs), r3, regs);
 
 #ifdef OPTION_KMCTR_DEBUG
-    LOGBYTE("input :", message_block, 16);
-    LOGBYTE("cv    :", countervalue_block, 16);
+      LOGBYTE("input :", message_block, 16);
+      LOGBYTE("cv    :", countervalue_block, 16);
 #endif /* #ifdef OPTION_KMCTR_DEBUG */
 
-    /* Do the job */
-    /* Encrypt and XOR */
-    rijndael_encrypt(&context, countervalue_block, countervalue_block);
-    for(i = 0; i < 16; i++)
-      countervalue_block[i] ^= message_block[i];
+      /* Do the job */
+      /* Encrypt and XOR */
+      aes_encrypt(context, countervalue_block, countervalue_block);
+      for(i = 0; i < 16; i++)
+        countervalue_block[i] ^= message_block[i];
 
-    /* Store the output */
-    ARCH_DEP(vstorec)(countervalue_block, 15, GR_A(r1, regs) & ADDRESS_MAXWRAP(regs), r1, regs);
+      /* Store the output */
+      ARCH_DEP(vstorec)(countervalue_block, 15, GR_A(r1, regs) & ADDRESS_MAXWRAP(regs), r1, regs);
 
 #ifdef OPTION_KMCTR_DEBUG
-    LOGBYTE("output:", countervalue_block, 16);
+      LOGBYTE("output:", countervalue_block, 16);
 #endif /* #ifdef OPTION_KMCTR_DEBUG */
+    }
 
     /* Update the registers */
-    SET_GR_A(r1, regs, GR_A(r1, regs) + 16);
+    SET_GR_A(r1, regs, GR_A(r1, regs) + len);
     if(likely(r1_is_not_r2))
-      SET_GR_A(r2, regs, GR_A(r2, regs) + 16);
-    SET_GR_A(r2 + 1, regs, GR_A(r2 + 1, regs) - 16);
+      SET_GR_A(r2, regs, GR_A(r2, regs) + len);
+    SET_GR_A(r2 + 1, regs, GR_A(r2 + 1, regs) - len);
     if(likely(r1_is_not_r3 && r2_is_not_r3))
-      SET_GR_A(r3, regs, GR_A(r3, regs) + 16);
+      SET_GR_A(r3, regs, GR_A(r3, regs) + len);
 
 #ifdef OPTION_KMCTR_DEBUG
     WRMSG(HHC90108, "D", r1, (regs)->GR(r1));
@@ -2818,6 +4017,218 @@ static void ARCH_DEP(kmctr_aes)(int r1, int r2, int r3, REGS *regs)
   regs->psw.cc = 3;
 }
 
+#if defined( FEATURE_146_MSA_EXTENSION_FACILITY_8 )
+/*----------------------------------------------------------------------------*/
+/* Cipher message with authentication (KMA) FC 18-20 and 26-28                */
+/*----------------------------------------------------------------------------*/
+/* Galois/counter mode: the additional authenticated data at r3 is hashed     */
+/* first, then the message at r2 is ciphered in counter mode to r1 while its  */
+/* ciphertext is hashed. With LPC the tag is completed from the total lengths */
+/* in the parameter block.                                                    */
+/*----------------------------------------------------------------------------*/
+static void ARCH_DEP(kma_aes)(int r1, int r2, int r3, REGS *regs)
+{
+  int batch;
+  aes_context *context;
+  int crypted;
+  U32 cv;
+  BYTE *dst;
+  int i;
+  int j;
+  int keylen;
+  int len;
+  BYTE message_block[16];
+  int modifier_bit;
+  int n;
+  BYTE output_block[16];
+  BYTE parameter_block[144];
+  int parameter_blocklen;
+  int r1_is_not_r2;
+  BYTE *src;
+  int tfc;
+  int wrap;
+  BYTE work[16 * AES_PARALLEL];
+
+  /* Check special conditions */
+  if(unlikely((!GR0_laad(regs) && GR_A(r3 + 1, regs) % 16) || (!GR0_lpc(regs) && GR_A(r2 + 1, regs) % 16)))
+    ARCH_DEP(program_interrupt)(regs, PGM_SPECIFICATION_EXCEPTION);
+
+  /* Initialize values */
+  tfc = GR0_tfc(regs);
+  wrap = GR0_wrap(regs);
+  keylen = (tfc - 17) * 8 + 8;
+  parameter_blocklen = keylen + 80;
+  if(wrap)
+    parameter_blocklen += 32;
+
+  /* Test writeability counter value, tag and hash subkey */
+  ARCH_DEP(validate_operand)((GR_A(1, regs) + 12) & ADDRESS_MAXWRAP(regs), 1, 35, ACCTYPE_WRITE, regs);
+
+  /* Fetch the parameter block */
+  ARCH_DEP(vfetchc)(parameter_block, parameter_blocklen - 1, GR_A(1, regs) & ADDRESS_MAXWRAP(regs), 1, regs);
+
+#ifdef OPTION_KMA_DEBUG
+  LOGBYTE("cv    :", &parameter_block[12], 4);
+  LOGBYTE("t     :", &parameter_block[16], 16);
+  LOGBYTE("h     :", &parameter_block[32], 16);
+  LOGBYTE("taadl :", &parameter_block[48], 8);
+  LOGBYTE("tpcl  :", &parameter_block[56], 8);
+  LOGBYTE("j0    :", &parameter_block[64], 16);
+  LOGBYTE("k     :", &parameter_block[80], keylen);
+  if(wrap)
+    LOGBYTE("wkvp  :", &parameter_block[keylen + 80], 32);
+#endif /* #ifdef OPTION_KMA_DEBUG */
+
+  /* Verify and unwrap */
+  if(wrap && unwrap_aes(&parameter_block[80], keylen))
+  {
+
+#ifdef OPTION_KMA_DEBUG
+    WRMSG(HHC90111, "D");
+#endif /* #ifdef OPTION_KMA_DEBUG */
+
+    regs->psw.cc = 1;
+    return;
+  }
+
+  /* Get the cryptographic key */
+  context = aes_get_context(regs, &parameter_block[80], keylen);
+
+  /* Compute the hash subkey unless it was supplied */
+  if(!GR0_hs(regs))
+  {
+    memset(&parameter_block[32], 0, 16);
+    aes_encrypt(context, &parameter_block[32], &parameter_block[32]);
+  }
+
+  cv = fetch_fw(&parameter_block[12]);
+  modifier_bit = GR0_m(regs);
+  r1_is_not_r2 = r1 != r2;
+  crypted = 0;
+
+  /* Hash the additional authenticated data */
+  while(GR_A(r3 + 1, regs))
+  {
+    if(unlikely(crypted >= PROCESS_MAX))
+      break;
+
+    len = ARCH_DEP(hash_run)(r3, 16, crypted, regs);
+    if(likely(len))
+    {
+      src = MADDRL(GR_A(r3, regs) & ADDRESS_MAXWRAP(regs), len, r3, regs, ACCTYPE_READ, regs->psw.pkey);
+      ghash_blocks(&parameter_block[16], &parameter_block[32], src, len / 16);
+    }
+    else
+    {
+      /* The block crosses a page boundary or is the last partial one */
+      len = (int) min(GR_A(r3 + 1, regs), 16);
+      memset(message_block, 0, 16);
+      ARCH_DEP(vfetchc)(message_block, len - 1, GR_A(r3, regs) & ADDRESS_MAXWRAP(regs), r3, regs);
+      ghash_blocks(&parameter_block[16], &parameter_block[32], message_block, 1);
+    }
+
+    /* Update the registers */
+    SET_GR_A(r3, regs, GR_A(r3, regs) + len);
+    SET_GR_A(r3 + 1, regs, GR_A(r3 + 1, regs) - len);
+    crypted += len;
+  }
+
+  /* Cipher the message and hash the ciphertext */
+  while(GR_A(r2 + 1, regs))
+  {
+    if(unlikely(crypted >= PROCESS_MAX))
+      break;
+
+    len = ARCH_DEP(aes_run)(r1, r2, r2, crypted, regs);
+    if(likely(len))
+    {
+      src = MADDRL(GR_A(r2, regs) & ADDRESS_MAXWRAP(regs), len, r2, regs, ACCTYPE_READ, regs->psw.pkey);
+      dst = MADDRL(GR_A(r1, regs) & ADDRESS_MAXWRAP(regs), len, r1, regs, ACCTYPE_WRITE, regs->psw.pkey);
+      batch = aes_batch(dst, src);
+      for(i = 0; i < len; i += n * 16)
+      {
+        n = min(batch, (len - i) / 16);
+
+        /* Encrypt the counter blocks */
+        for(j = 0; j < n; j++)
+        {
+          memcpy(&work[j * 16], &parameter_block[64], 12);
+          store_fw(&work[j * 16 + 12], ++cv);
+        }
+        aes_encrypt_blocks(context, work, work, n);
+
+        /* XOR and hash the ciphertext */
+        if(modifier_bit)
+          ghash_blocks(&parameter_block[16], &parameter_block[32], &src[i], n);
+        for(j = 0; j < n * 16; j++)
+          work[j] ^= src[i + j];
+        if(!modifier_bit)
+          ghash_blocks(&parameter_block[16], &parameter_block[32], work, n);
+        memcpy(&dst[i], work, n * 16);
+      }
+    }
+    else
+    {
+      /* The block crosses a page boundary or is the last partial one */
+      len = (int) min(GR_A(r2 + 1, regs), 16);
+      memset(message_block, 0, 16);
+      ARCH_DEP(vfetchc)(message_block, len - 1, GR_A(r2, regs) & ADDRESS_MAXWRAP(regs), r2, regs);
+
+#ifdef OPTION_KMA_DEBUG
+      LOGBYTE("input :", message_block, len);
+#endif /* #ifdef OPTION_KMA_DEBUG */
+
+      memcpy(output_block, &parameter_block[64], 12);
+      store_fw(&output_block[12], ++cv);
+      aes_encrypt(context, output_block, output_block);
+      for(i = 0; i < 16; i++)
+        output_block[i] = i < len ? output_block[i] ^ message_block[i] : 0;
+      ghash_blocks(&parameter_block[16], &parameter_block[32], modifier_bit ? message_block : output_block, 1);
+
+      /* Store the output */
+      ARCH_DEP(vstorec)(output_block, len - 1, GR_A(r1, regs) & ADDRESS_MAXWRAP(regs), r1, regs);
+
+#ifdef OPTION_KMA_DEBUG
+      LOGBYTE("output:", output_block, len);
+#endif /* #ifdef OPTION_KMA_DEBUG */
+    }
+
+    /* Update the registers */
+    SET_GR_A(r1, regs, GR_A(r1, regs) + len);
+    if(likely(r1_is_not_r2))
+      SET_GR_A(r2, regs, GR_A(r2, regs) + len);
+    SET_GR_A(r2 + 1, regs, GR_A(r2 + 1, regs) - len);
+    crypted += len;
+  }
+
+  /* Complete the tag with the lengths block and the encrypted J0 */
+  if(GR0_lpc(regs) && !GR_A(r3 + 1, regs) && !GR_A(r2 + 1, regs))
+  {
+    ghash_blocks(&parameter_block[16], &parameter_block[32], &parameter_block[48], 1);
+    aes_encrypt(context, &parameter_block[64], output_block);
+    for(i = 0; i < 16; i++)
+      parameter_block[16 + i] ^= output_block[i];
+  }
+
+  /* Store the counter value, tag and hash subkey */
+  store_fw(&parameter_block[12], cv);
+  ARCH_DEP(vstorec)(&parameter_block[12], 35, (GR_A(1, regs) + 12) & ADDRESS_MAXWRAP(regs), 1, regs);
+
+#ifdef OPTION_KMA_DEBUG
+  LOGBYTE("cv    :", &parameter_block[12], 4);
+  LOGBYTE("t     :", &parameter_block[16], 16);
+  WRMSG(HHC90108, "D", r1, (regs)->GR(r1));
+  WRMSG(HHC90108, "D", r2, (regs)->GR(r2));
+  WRMSG(HHC90108, "D", r2 + 1, (regs)->GR(r2 + 1));
+  WRMSG(HHC90108, "D", r3, (regs)->GR(r3));
+  WRMSG(HHC90108, "D", r3 + 1, (regs)->GR(r3 + 1));
+#endif /* #ifdef OPTION_KMA_DEBUG */
+
+  /* CPU-determined amount of data processed unless both are done */
+  regs->psw.cc = GR_A(r3 + 1, regs) || GR_A(r2 + 1, regs) ? 3 : 0;
+}
+#endif /* defined( FEATURE_146_MSA_EXTENSION_FACILITY_8 ) */
+
 /*----------------------------------------------------------------------------*/
 /* Cipher message with cipher feedback (KMF) FC 1-3 and 9-11                  */
 /*----------------------------------------------------------------------------*/
@@ -3023,7 +4434,7 @@ static void ARCH_DEP(kmf_dea)(int r1, int r2, REGS *regs)
 /*----------------------------------------------------------------------------*/
 static void ARCH_DEP(kmf_aes)(int r1, int r2, REGS *regs)
 {
-  rijndael_ctx context;
+  aes_context *context;
   int crypted;
   int i;
   int keylen;
@@ -3084,15 +4495,15 @@ static void ARCH_DEP(kmf_aes)(int r1, int r2, REGS *regs)
     return;
   }
 
-  /* Set the cryptographic key */
-  rijndael_set_key(&context, &parameter_block[16], keylen * 8);
+  /* Get the cryptographic key */
+  context = aes_get_context(regs, &parameter_block[16], keylen);
 
   /* Try to process the CPU-determined amount of data */
   modifier_bit = GR0_m(regs);
   r1_is_not_r2 = r1 != r2;
   for(crypted = 0; crypted < PROCESS_MAX; crypted += lcfb)
   {
-    rijndael_encrypt(&context, parameter_block, output_block);
+    aes_encrypt(context, parameter_block, output_block);
     ARCH_DEP(vfetchc)(message_block, lcfb - 1, GR_A(r2, regs) & ADDRESS_MAXWRAP(regs), r2, regs);
 
 #ifdef OPTION_KMF_DEBUG
@@ -3338,7 +4749,7 @@ static void ARCH_DEP(kmo_dea)(int r1, int r2, REGS *regs)
 /*----------------------------------------------------------------------------*/
 static void ARCH_DEP(kmo_aes)(int r1, int r2, REGS *regs)
 {
-  rijndael_ctx context;
+  aes_context *context;
   int crypted;
   int i;
   int keylen;
@@ -3393,14 +4804,14 @@ static void ARCH_DEP(kmo_aes)(int r1, int r2, REGS *regs)
     return;
   }
 
-  /* Set the cryptographic key */
-  rijndael_set_key(&context, &parameter_block[16], keylen * 8);
+  /* Get the cryptographic key */
+  context = aes_get_context(regs, &parameter_block[16], keylen);
 
   /* Try to process the CPU-determined amount of data */
   r1_is_not_r2 = r1 != r2;
   for(crypted = 0; crypted < PROCESS_MAX; crypted += 16)
   {
-    rijndael_encrypt(&context, parameter_block, parameter_block);
+    aes_encrypt(context, parameter_block, parameter_block);
     ARCH_DEP(vfetchc)(message_block, 15, GR_A(r2, regs) & ADDRESS_MAXWRAP(regs), r2, regs);
 
 #ifdef OPTION_KMO_DEBUG
@@ -3666,7 +5077,7 @@ static void ARCH_DEP(pcc_cmac_dea)(REGS *regs)
 /*----------------------------------------------------------------------------*/
 static void ARCH_DEP(pcc_cmac_aes)(REGS *regs)
 {
-  rijndael_ctx context;
+  aes_context *context;
   int i;
   BYTE k[16];
   int keylen;
@@ -3716,8 +5127,8 @@ static void ARCH_DEP(pcc_cmac_aes)(REGS *regs)
     return;
   }
 
-  /* Set the cryptographic key */
-  rijndael_set_key(&context, &parameter_block[40], keylen * 8);
+  /* Get the cryptographic key */
+  context = aes_get_context(regs, &parameter_block[40], keylen);
 
   /* Check validity ML value */
   if(parameter_block[0] > 128)
@@ -3744,7 +5155,7 @@ static void ARCH_DEP(pcc_cmac_aes)(REGS *regs)
 
   /* Calculate subkeys */
   zeromem(k, 16);
-  rijndael_encrypt(&context, k, k);
+  aes_encrypt(context, k, k);
 
   /* Calculate subkeys Kx and Ky */
   if(!(k[0] & 0x80))
@@ -3777,7 +5188,7 @@ static void ARCH_DEP(pcc_cmac_aes)(REGS *regs)
     parameter_block[i + 8] ^= k[i];
     parameter_block[i + 8] ^= parameter_block[i + 24];
   }
-  rijndael_encrypt(&context, &parameter_block[8], &parameter_block[8]);
+  aes_encrypt(context, &parameter_block[8], &parameter_block[8]);
 
 #ifdef OPTION_PCC_DEBUG
   LOGBYTE("cmac  :", &parameter_block[8], 16);
@@ -3796,7 +5207,7 @@ static void ARCH_DEP(pcc_cmac_aes)(REGS *regs)
 static void ARCH_DEP(pcc_xts_aes)(REGS *regs)
 {
   BYTE *bsn;
-  rijndael_ctx context;
+  aes_context *context;
   BYTE *ibi;
   int keylen;
   BYTE mask[8] = { 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01 };
@@ -3853,8 +5264,8 @@ static void ARCH_DEP(pcc_xts_aes)(REGS *regs)
   }
 
   /* Encrypt tweak */
-  rijndael_set_key(&context, parameter_block, keylen * 8);
-  rijndael_encrypt(&context, tweak, tweak);
+  context = aes_get_context(regs, parameter_block, keylen);
+  aes_encrypt(context, tweak, tweak);
 
   /* Check block sequential number (j) == 0 */
   if(!memcmp(bsn, zero, 16))
@@ -4029,6 +5440,12 @@ DEF_INST(dyn_compute_intermediate_message_digest)
   {
     case 0: /* Query */
     {
+#if defined( FEATURE_146_MSA_EXTENSION_FACILITY_8 )
+      /* SHA-3 and SHAKE came with extension 8 and have no facility bit */
+      if(FACILITY_ENABLED( 146_MSA_EXTENSION_8, regs ))
+        query_bits[msa][4] |= 0xfc;
+#endif /* defined( FEATURE_146_MSA_EXTENSION_FACILITY_8 ) */
+
       /* Store the parameter block */
       ARCH_DEP(vstorec)(query_bits[msa], 15, GR_A(1, regs) & ADDRESS_MAXWRAP(regs), 1, regs);
 
@@ -4079,6 +5496,22 @@ DEF_INST(dyn_compute_intermediate_message_digest)
     }
 #endif /* defined( FEATURE_077_MSA_EXTENSION_FACILITY_4 ) */
 
+#if defined( FEATURE_146_MSA_EXTENSION_FACILITY_8 )
+    case 32: /* sha3-224 */
+    case 33: /* sha3-256 */
+    case 34: /* sha3-384 */
+    case 35: /* sha3-512 */
+    case 36: /* shake-128 */
+    case 37: /* shake-256 */
+    {
+      if(FACILITY_ENABLED( 146_MSA_EXTENSION_8, regs ))
+        ARCH_DEP(kimd_sha3)(r1, r2, regs, 0);
+      else
+        ARCH_DEP(program_interrupt)(regs, PGM_SPECIFICATION_EXCEPTION);
+      break;
+    }
+#endif /* defined( FEATURE_146_MSA_EXTENSION_FACILITY_8 ) */
+
     default:
     {
       ARCH_DEP(program_interrupt)(regs, PGM_SPECIFICATION_EXCEPTION);
@@ -4141,6 +5574,12 @@ DEF_INST(dyn_compute_last_message_digest)
   {
     case 0: /* Query */
     {
+#if defined( FEATURE_146_MSA_EXTENSION_FACILITY_8 )
+      /* SHA-3 and SHAKE came with extension 8 and have no facility bit */
+      if(FACILITY_ENABLED( 146_MSA_EXTENSION_8, regs ))
+        query_bits[msa][4] |= 0xfc;
+#endif /* defined( FEATURE_146_MSA_EXTENSION_FACILITY_8 ) */
+
       /* Store the parameter block */
       ARCH_DEP(vstorec)(query_bits[msa], 15, GR_A(1, regs) & ADDRESS_MAXWRAP(regs), 1, regs);
 
@@ -4179,6 +5618,22 @@ DEF_INST(dyn_compute_last_message_digest)
     }
 #endif /* defined( FEATURE_MSA_EXTENSION_FACILITY_2 ) */
 
+#if defined( FEATURE_146_MSA_EXTENSION_FACILITY_8 )
+    case 32: /* sha3-224 */
+    case 33: /* sha3-256 */
+    case 34: /* sha3-384 */
+    case 35: /* sha3-512 */
+    case 36: /* shake-128 */
+    case 37: /* shake-256 */
+    {
+      if(FACILITY_ENABLED( 146_MSA_EXTENSION_8, regs ))
+        ARCH_DEP(klmd_sha3)(r1, r2, regs);
+      else
+        ARCH_DEP(program_interrupt)(regs, PGM_SPECIFICATION_EXCEPTION);
+      break;
+    }
+#endif /* defined( FEATURE_146_MSA_EXTENSION_FACILITY_8 ) */
+
     default:
     {
       ARCH_DEP(program_interrupt)(regs, PGM_SPECIFICATION_EXCEPTION);
@@ -5318,6 +6773,83 @@ DEF_INST(dyn_perform_random_number_operation)
 }
 #endif /* defined( FEATURE_057_MSA_EXTENSION_FACILITY_5 ) */
 
+#if defined( FEATURE_146_MSA_EXTENSION_FACILITY_8 )
+/*----------------------------------------------------------------------------*/
+/* B929 KMA   - Cipher message with authentication                    [RRF-b] */
+/*----------------------------------------------------------------------------*/
+DEF_INST(dyn_cipher_message_with_authentication)
+{
+  BYTE query_bits[16] =
+  {
+    0x80, 0x00, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  };
+  int r1;
+  int r2;
+  int r3;
+
+  RRF_M(inst, regs, r1, r2, r3);
+  PER_ZEROADDR_CHECK( regs, 1 );
+  PER_ZEROADDR_CHECK( regs, r1 );
+  PER_ZEROADDR_LCHECK2( regs, r2, r2+1, r3, r3+1 );
+
+  FACILITY_CHECK( 146_MSA_EXTENSION_8, regs );
+
+#ifdef OPTION_KMA_DEBUG
+  WRMSG(HHC90100, "D", "KMA: cipher message with authentication");
+  WRMSG(HHC90101, "D", 1, r1);
+  WRMSG(HHC90102, "D", regs->GR(r1));
+  WRMSG(HHC90101, "D", 2, r2);
+  WRMSG(HHC90102, "D", regs->GR(r2));
+  WRMSG(HHC90103, "D", regs->GR(r2 + 1));
+  WRMSG(HHC90101, "D", 3, r3);
+  WRMSG(HHC90102, "D", regs->GR(r3));
+  WRMSG(HHC90103, "D", regs->GR(r3 + 1));
+  WRMSG(HHC90104, "D", 0, regs->GR(0));
+  WRMSG(HHC90105, "D", TRUEFALSE(GR0_m(regs)));
+  WRMSG(HHC90106, "D", GR0_fc(regs));
+  WRMSG(HHC90104, "D", 1, regs->GR(1));
+#endif /* #ifdef OPTION_KMA_DEBUG */
+
+  /* Check special conditions */
+  if(unlikely(!r1 || r1 & 0x01 || !r2 || r2 & 0x01 || !r3 || r3 & 0x01 || r3 == r1 || r3 == r2))
+    ARCH_DEP(program_interrupt)(regs, PGM_SPECIFICATION_EXCEPTION);
+
+  switch(GR0_fc(regs))
+  {
+    case 0: /* Query */
+    {
+      /* Store the parameter block */
+      ARCH_DEP(vstorec)(query_bits, 15, GR_A(1, regs) & ADDRESS_MAXWRAP(regs), 1, regs);
+
+#ifdef OPTION_KMA_DEBUG
+      LOGBYTE("output:", query_bits, 16);
+#endif /* #ifdef OPTION_KMA_DEBUG */
+
+      /* Set condition code 0 */
+      regs->psw.cc = 0;
+      return;
+    }
+
+    case 18: /* gcm-aes-128 */
+    case 19: /* gcm-aes-192 */
+    case 20: /* gcm-aes-256 */
+    case 26: /* gcm-encrypted-aes-128 */
+    case 27: /* gcm-encrypted-aes-192 */
+    case 28: /* gcm-encrypted-aes-256 */
+    {
+      ARCH_DEP(kma_aes)(r1, r2, r3, regs);
+      break;
+    }
+
+    default:
+    {
+      ARCH_DEP(program_interrupt)(regs, PGM_SPECIFICATION_EXCEPTION);
+      break;
+    }
+  }
+}
+#endif /* defined( FEATURE_146_MSA_EXTENSION_FACILITY_8 ) */
+
 #endif /* defined( FEATURE_017_MSA_FACILITY ) */
 
 /*----------------------------------------------------------------------------*/
@@ -5347,6 +6879,10 @@ DEF_INST(dyn_perform_random_number_operation)
  HDL_UNDEF_INST( dyn_perform_random_number_operation )
 #endif
 
+#if !defined( FEATURE_146_MSA_EXTENSION_FACILITY_8 )
+ HDL_UNDEF_INST( dyn_cipher_message_with_authentication )
+#endif
+
 /*-------------------------------------------------------------------*/
 /*          (delineates ARCH_DEP from non-arch_dep)                  */
 /*-------------------------------------------------------------------*/
@@ -5436,6 +6972,10 @@ HDL_INSTRUCTION_SECTION;
   HDL_INST( ARCH_370_____900, OPCODE( B93C ), dyn_perform_random_number_operation );
   #endif
 #endif
+
+#if defined( _FEATURE_146_MSA_EXTENSION_FACILITY_8 )
+  HDL_INST( ARCH_________900, OPCODE( B929 ), dyn_cipher_message_with_authentication );
+#endif
 }
 END_INSTRUCTION_SECTION;
 
@@ -5451,6 +6991,9 @@ HDL_REGISTER_SECTION;
   // "Activated facility: %s"
   WRMSG( HHC00151, "I", "Message Security Assist");
 
+#if defined( _FEATURE_146_MSA_EXTENSION_FACILITY_8 )
+  WRMSG( HHC00151, "I", "Message Security Assist Extension 1, 2, 3, 4, 5, 7 and 8");
+#else
 #if defined( _FEATURE_057_MSA_EXTENSION_FACILITY_5 )
   WRMSG( HHC00151, "I", "Message Security Assist Extension 1, 2, 3, 4, 5 and 7");
 #else
@@ -5470,6 +7013,7 @@ HDL_REGISTER_SECTION;
     #endif /* defined( _FEATURE_076_MSA_EXTENSION_FACILITY_3 ) */
   #endif /* defined( _FEATURE_077_MSA_EXTENSION_FACILITY_4 ) */
 #endif /* defined( _FEATURE_057_MSA_EXTENSION_FACILITY_5 ) */
+#endif /* defined( _FEATURE_146_MSA_EXTENSION_FACILITY_8 ) */
 }
 END_REGISTER_SECTION;
 
@@ -5801,117 +5801,129 @@ BYTE    oldkey;                         /* Original Storage key      */
         SIE_INTERCEPT( regs );
 #endif
 
+#if defined( _FEATURE_SIE )
+    if (!SIE_MODE( regs ))
+#endif
+    {
+        /* Gather all 64 reference bits eight storage keys at a time,
+           then reset only those frames whose bit was actually on */
+        bitmap = _get_4K_storekey_bitmap( r2_pageaddr, STORKEY_REF );
+
+        for (i=0; RRBM && i < 64; i++)
+        {
+            if (!(bitmap & (0x8000000000000000ULL >> i)))
+                continue;
+
+            pageaddr = r2_pageaddr + ((RADR) i << SHIFT_4K);
+
+            /* Reset the reference bit in the storage key */
+            ARCH_DEP( and_storage_key )( pageaddr, STORKEY_REF );
+
+            /* Perform accelerated lookup invalidations on all CPUs
+               so that the REF bit will be set when referenced next */
+            STORKEY_INVALIDATE( regs, pageaddr );
+        }
+
+        regs->GR_G(r1) = bitmap;
+        return;
+    }
+
+#if defined( _FEATURE_SIE )
     /* For each frame... */
     for (i=0, bitmap=0; i < 64; i++, r2_pageaddr += STORAGE_KEY_4K_PAGESIZE)
     {
         pageaddr = r2_pageaddr;
 
-#if defined( _FEATURE_SIE )
-        if (SIE_MODE( regs ))
-        {
-            /* Translate guest absolute to host absolute */
-            SIE_TRANSLATE( &pageaddr, ACCTYPE_SIE, regs );
+        /* Translate guest absolute to host absolute */
+        SIE_TRANSLATE( &pageaddr, ACCTYPE_SIE, regs );
 
-            if (!regs->sie_pref)
-            {
+        if (!regs->sie_pref)
+        {
 #if defined( _FEATURE_STORAGE_KEY_ASSIST )
-                if (1
-                    && (0
-                        || SIE_STATE_BIT_ON( regs, RCPO0, ASIST )
+            if (1
+                && (0
+                    || SIE_STATE_BIT_ON( regs, RCPO0, ASIST )
 #if defined( _FEATURE_ZSIE )
-                        // SKA is always active for z/VM
-                        || ARCH_900_IDX == HOSTREGS->arch_mode
+                    // SKA is always active for z/VM
+                    || ARCH_900_IDX == HOSTREGS->arch_mode
 #endif
-                       )
-                    && SIE_STATE_BIT_ON( regs, RCPO2, RCPBY )
-                )
-                {
-                    /* When "bypass use of RCP table" is requested
-                       the guest page is assumed to be accessible.
-                    */
-                    /* Translate guest absolute to host absolute */
-                    // (already done further above)
-                    //SIE_TRANSLATE( &pageaddr, ACCTYPE_SIE, regs );
+                   )
+                && SIE_STATE_BIT_ON( regs, RCPO2, RCPBY )
+            )
+            {
+                /* When "bypass use of RCP table" is requested
+                   the guest page is assumed to be accessible.
+                */
+                /* Translate guest absolute to host absolute */
+                // (already done further above)
+                //SIE_TRANSLATE( &pageaddr, ACCTYPE_SIE, regs );
 
-                    /* Save a copy of the original storage key */
-                    oldkey = ARCH_DEP( get_storage_key )( pageaddr );
+                /* Save a copy of the original storage key */
+                oldkey = ARCH_DEP( get_storage_key )( pageaddr );
 
-                    if (RRBM)
-                    {
-                        /* Reset the reference bit in the storage key */
-                        ARCH_DEP( and_storage_key )( pageaddr, STORKEY_REF );
-                    }
+                if (RRBM)
+                {
+                    /* Reset the reference bit in the storage key */
+                    ARCH_DEP( and_storage_key )( pageaddr, STORKEY_REF );
                 }
-                else // use RCP...(and possibly PGSTE)
+            }
+            else // use RCP...(and possibly PGSTE)
 #endif /* defined( _FEATURE_STORAGE_KEY_ASSIST ) */
+            {
+                PGSTE* pgste;
+                RCPTE* rcpte;
+
+                ARCH_DEP( GetPGSTE_and_RCPTE )( regs, pageaddr, &pgste, &rcpte );
+
+                OBTAIN_KEYLOCK( pgste, rcpte, regs );
                 {
-                    PGSTE* pgste;
-                    RCPTE* rcpte;
+                    int sr;
+                    BYTE realkey;
+
+                    /* Translate guest absolute address to host real.
+                       Note that the RCP table MUST be locked BEFORE
+                       we try to access the real page!
+                    */
+                    sr = SIE_TRANSLATE_ADDR( regs->sie_mso + pageaddr,
+                                             USE_PRIMARY_SPACE,
+                                             HOSTREGS, ACCTYPE_SIE );
+                    if (sr == 0)
+                    {
+                        /* Translate host real to host absolute */
+                        pageaddr = apply_host_prefixing( HOSTREGS, HOSTREGS->dat.raddr );
+
+                        /* Save original key before modifying */
+                        realkey = ARCH_DEP( get_storage_key )( pageaddr );
+                    }
+                    else
+                        realkey = 0;
+
+                    /* Save the page's real R/C bits by OR'ing them
+                       into the host's R/C set in the RCP byte */
+                    rcpte->rcpbyte |= ((realkey << 4) & RCPHOST);
+
+                    /* Get the 'OR' of the real page's R/C bits and
+                       the guest's R/C bits from the RCP area byte */
+                    oldkey = realkey | (rcpte->rcpbyte & RCPGUEST);
 
-                    ARCH_DEP( GetPGSTE_and_RCPTE )( regs, pageaddr, &pgste, &rcpte );
+                    /* Update the guest RCP bits */
+                    rcpte->rcpbyte &= ~(         RCPGUEST);
+                    rcpte->rcpbyte |=  (oldkey & RCPGUEST);
 
-                    OBTAIN_KEYLOCK( pgste, rcpte, regs );
+                    if (RRBM)
                     {
-                        int sr;
-                        BYTE realkey;
-
-                        /* Translate guest absolute address to host real.
-                           Note that the RCP table MUST be locked BEFORE
-                           we try to access the real page!
-                        */
-                        sr = SIE_TRANSLATE_ADDR( regs->sie_mso + pageaddr,
-                                                 USE_PRIMARY_SPACE,
-                                                 HOSTREGS, ACCTYPE_SIE );
+                        /* Reset the reference bit in the guest RCP set */
+                        rcpte->rcpbyte &= ~RCPGREF;
+
+                        /* Reset the reference bit in the real page */
                         if (sr == 0)
-                        {
-                            /* Translate host real to host absolute */
-                            pageaddr = apply_host_prefixing( HOSTREGS, HOSTREGS->dat.raddr );
-
-                            /* Save original key before modifying */
-                            realkey = ARCH_DEP( get_storage_key )( pageaddr );
-                        }
-                        else
-                            realkey = 0;
-
-                        /* Save the page's real R/C bits by OR'ing them
-                           into the host's R/C set in the RCP byte */
-                        rcpte->rcpbyte |= ((realkey << 4) & RCPHOST);
-
-                        /* Get the 'OR' of the real page's R/C bits and
-                           the guest's R/C bits from the RCP area byte */
-                        oldkey = realkey | (rcpte->rcpbyte & RCPGUEST);
-
-                        /* Update the guest RCP bits */
-                        rcpte->rcpbyte &= ~(         RCPGUEST);
-                        rcpte->rcpbyte |=  (oldkey & RCPGUEST);
-
-                        if (RRBM)
-                        {
-                            /* Reset the reference bit in the guest RCP set */
-                            rcpte->rcpbyte &= ~RCPGREF;
-
-                            /* Reset the reference bit in the real page */
-                            if (sr == 0)
-                                ARCH_DEP( and_storage_key )( pageaddr, STORKEY_REF );
-                        }
+                            ARCH_DEP( and_storage_key )( pageaddr, STORKEY_REF );
                     }
-                    RELEASE_KEYLOCK( pgste, rcpte, regs );
-                }
-            }
-            else /* regs->sie_pref */
-            {
-                /* Save a copy of the original storage key */
-                oldkey = ARCH_DEP( get_storage_key )( pageaddr );
-
-                if (RRBM)
-                {
-                    /* Reset the reference bit in the storage key */
-                    ARCH_DEP( and_storage_key )( pageaddr, STORKEY_REF );
                 }
+                RELEASE_KEYLOCK( pgste, rcpte, regs );
             }
         }
-        else /* !SIE_MODE */
-#endif /* defined( _FEATURE_SIE ) */
+        else /* regs->sie_pref */
         {
             /* Save a copy of the original storage key */
             oldkey = ARCH_DEP( get_storage_key )( pageaddr );
@@ -5938,6 +5950,7 @@ BYTE    oldkey;                         /* Original Storage key      */
     } /* end for each frame... */
 
     regs->GR_G(r1) = bitmap;
+#endif /* defined( _FEATURE_SIE ) */
 }
 
 
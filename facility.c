@@ -612,7 +612,7 @@ FT( Z900, Z900, NONE, 145_INS_REF_BITS_MULT )
 #endif
 
 #if defined(  FEATURE_146_MSA_EXTENSION_FACILITY_8 )
-FT( NONE, NONE, NONE, 146_MSA_EXTENSION_8 )
+FT( Z900, Z900, NONE, 146_MSA_EXTENSION_8 )
 #endif
 
 FT( NONE, NONE, NONE, 147_IBM_RESERVED )
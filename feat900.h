@@ -127,7 +127,8 @@
 //efine FEATURE_142_ST_CPU_COUNTER_MULT_FACILITY
 //efine FEATURE_144_TEST_PEND_EXTERNAL_FACILITY
 #define FEATURE_145_INS_REF_BITS_MULT_FACILITY
-//efine FEATURE_146_MSA_EXTENSION_FACILITY_8
+#define FEATURE_146_MSA_EXTENSION_FACILITY_8
+#define DYNINST_146_MSA_EXTENSION_FACILITY_8               /*dyncrypt*/
 #define FEATURE_148_VECTOR_ENH_FACILITY_2
 //efine FEATURE_149_MOVEPAGE_SETKEY_FACILITY
 //efine FEATURE_150_ENH_SORT_FACILITY
@@ -257,6 +258,19 @@
 
     // #define FEATURE_HW_CLMUL  1
 
+    /* Compile-time Hardware Feature: AES-NI               */
+    /* --------------------------------------------------  */
+    /* Not yet performance tested with MSVC. Do not enable */
+    /* until it has been.                                  */
+
+    // #define FEATURE_HW_AES  1
+
+    /* Compile-time Hardware Feature: SHA extensions       */
+    /* --------------------------------------------------  */
+    /* Not yet performance tested with MSVC. Do not enable */
+    /* until it has been.                                  */
+
+    // #define FEATURE_HW_SHA  1
 
   /* gcc/clang on X64: intrinsics are available and should be used for optimization */
   /*                   Being conservative: require SSE 4.2 to be available to allow */
@@ -272,6 +286,16 @@
         #define FEATURE_HW_CLMUL  1
     #endif
 
+    /* Compile-time Hardware Feature: AES-NI */
+    #if defined(__AES__)
+        #define FEATURE_HW_AES  1
+    #endif
+
+    /* Compile-time Hardware Feature: SHA extensions */
+    #if defined(__SHA__)
+        #define FEATURE_HW_SHA  1
+    #endif
+
   #endif
   /* compile debug message: are we using intrinsics? */
   #if 0
@@ -282,6 +306,15 @@
     #endif
   #endif
 #endif
+/* ARMv8 processor with the Cryptography Extension? */
+#if defined( __aarch64__ ) && (defined( __ARM_FEATURE_AES ) || defined( __ARM_FEATURE_CRYPTO ))
+  /* Compile-time Hardware Feature: AESE/AESD/AESMC/AESIMC */
+  #define FEATURE_HW_AES  1
+#endif
+#if defined( __aarch64__ ) && (defined( __ARM_FEATURE_SHA2 ) || defined( __ARM_FEATURE_CRYPTO ))
+  /* Compile-time Hardware Feature: SHA1C/SHA1P/SHA1M/SHA256H/SHA256H2 */
+  #define FEATURE_HW_SHA  1
+#endif
 #define FEATURE_WAITSTATE_ASSIST
 #define FEATURE_ZVM_ESSA
 
@@ -72,10 +72,18 @@
 #define DEF_TOD_UPDATE_USECS         50 /* Def TOD updt freq (usecs) */
 #define MAX_TOD_UPDATE_USECS     999999 /* Max TOD updt freq (usecs) */
 
+#define DEF_WAIT_SPIN_USECS           0 /* Def wait spin (usecs)     */
+#define MAX_WAIT_SPIN_USECS       10000 /* Max wait spin (usecs)     */
+
+#define DEF_PSAMPLE_RATE            100 /* Def PSW samples per second*/
+#define MAX_PSAMPLE_RATE          10000 /* Max PSW samples per second*/
+#define PSAMPLE_ENTRIES           16384 /* PSW samples kept per CPU  */
+#define MAX_PSAMPLE_DEPTH            16 /* Max linkage stack frames  */
+
 #define MAX_DEVICE_THREAD_IDLE_SECS 300 /* 5 Minute thread timeout   */
 //efine OPTION_LONG_HOSTINFO            /* Detailed host & logo info */
 #undef  OPTION_FOOTPRINT_BUFFER /* 2048 ** Size must be a power of 2 */
-#undef  OPTION_INSTR_COUNT_AND_TIME     /* First use trace and count */
+#define OPTION_INSTR_COUNT_AND_TIME     /* icount instruction profiler*/
 #undef  MODEL_DEPENDENT_STCM            /* STCM, STCMH always store  */
 #define OPTION_NOP_MODEL158_DIAGNOSE    /* NOP mod 158 specific diags*/
 
@@ -273,6 +281,7 @@
 #undef  FEATURE_144_TEST_PEND_EXTERNAL_FACILITY
 #undef  FEATURE_145_INS_REF_BITS_MULT_FACILITY
 #undef  FEATURE_146_MSA_EXTENSION_FACILITY_8
+#undef  DYNINST_146_MSA_EXTENSION_FACILITY_8               /*dyncrypt*/
 #undef  FEATURE_148_VECTOR_ENH_FACILITY_2
 #undef  FEATURE_149_MOVEPAGE_SETKEY_FACILITY
 #undef  FEATURE_150_ENH_SORT_FACILITY
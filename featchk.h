@@ -664,6 +664,18 @@
  #define    _FEATURE_V128_SSE
 #endif
 
+#if defined( FEATURE_HW_CLMUL )
+ #define    _FEATURE_HW_CLMUL
+#endif
+
+#if defined( FEATURE_HW_AES )
+ #define    _FEATURE_HW_AES
+#endif
+
+#if defined( FEATURE_HW_SHA )
+ #define    _FEATURE_HW_SHA
+#endif
+
 #if defined( FEATURE_ZVM_ESSA )
  #define    _FEATURE_ZVM_ESSA
 #endif
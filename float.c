@@ -401,6 +401,111 @@ typedef struct _EXTENDED_FLOAT {
 } EXTENDED_FLOAT;
 
 
+
+
+/*-------------------------------------------------------------------*/
+/* Host 128-bit integer arithmetic                                   */
+/*                                                                   */
+/* When the compiler provides a 128-bit integer type, normalization  */
+/* uses count-leading-zeros, and long and extended multiply and      */
+/* divide work on the whole fraction at once rather than a partial   */
+/* product, hex digit or bit at a time. The results are bit-for-bit  */
+/* identical to those of the portable code, which remains the        */
+/* reference and is used if the fraction is not in its usual range.  */
+/*-------------------------------------------------------------------*/
+#if defined( __SIZEOF_INT128__ )
+#define HFP_HOST_INT128
+
+typedef unsigned __int128 U128H;
+
+/*-------------------------------------------------------------------*/
+/* Divide 192 bit integer by normalized 128 bit integer              */
+/*                                                                   */
+/* Input:                                                            */
+/*      rem     most significant 128 bit of dividend, less than the  */
+/*              divisor; replaced by the remainder                   */
+/*      lsa     least significant 64 bit of dividend                 */
+/*      d1      most significant 64 bit of divisor (high bit on)     */
+/*      d0      least significant 64 bit of divisor                  */
+/* Value:                                                            */
+/*              64 bit quotient                                      */
+/*-------------------------------------------------------------------*/
+static inline U64 div_U192_U128( U128H *rem, U64 lsa, U64 d1, U64 d0 )
+{
+U64     r1 = (U64)(*rem >> 64);
+U64     q, lo, borrow;
+U128H   rhat, p0, p1;
+
+    /* estimate quotient digit from the leading digits */
+    if (r1 >= d1) {
+        q    = ~(U64)0;
+        rhat = *rem - (U128H)q * d1;
+    } else {
+        q    = (U64)(*rem / d1);
+        rhat = *rem - (U128H)q * d1;
+    }
+    while ((rhat >> 64) == 0
+        && (U128H)q * d0 > ((rhat << 64) | lsa)) {
+        q--;
+        rhat += d1;
+    }
+
+    /* subtract quotient digit times divisor */
+    p0 = (U128H)q * d0;
+    p1 = (U128H)q * d1 + (U64)(p0 >> 64);
+    lo = lsa - (U64)p0;
+    borrow = (lsa < (U64)p0);
+
+    if (*rem < p1 + borrow) {
+        /* estimate was one too large: add back */
+        q--;
+        *rem = *rem - p1 - borrow + d1;
+        lo += d0;
+        if (lo < d0)
+            (*rem)++;
+    } else {
+        *rem = *rem - p1 - borrow;
+    }
+    *rem = (*rem << 64) | lo;
+    return(q);
+
+} /* end function div_U192_U128 */
+
+
+/*-------------------------------------------------------------------*/
+/* Divide 256 bit integer by 128 bit integer                         */
+/*                                                                   */
+/* Input:                                                            */
+/*      msa     most significant 128 bit of dividend, which must be  */
+/*              less than the divisor                                */
+/*      lsa     least significant 128 bit of dividend                */
+/*      div     divisor, at least 2**64                              */
+/* Value:                                                            */
+/*              128 bit quotient                                     */
+/*-------------------------------------------------------------------*/
+static inline U128H div_U256_U128( U128H msa, U128H lsa, U128H div )
+{
+int     s;
+U64     q1, q0;
+
+    /* normalize divisor so its high bit is on */
+    s = __builtin_clzll( (U64)(div >> 64) );
+    if (s) {
+        div <<= s;
+        msa = (msa << s) | (lsa >> (128 - s));
+        lsa <<= s;
+    }
+
+    q1 = div_U192_U128( &msa, (U64)(lsa >> 64), (U64)(div >> 64), (U64)div );
+    q0 = div_U192_U128( &msa, (U64)lsa,         (U64)(div >> 64), (U64)div );
+
+    return(((U128H)q1 << 64) | q0);
+
+} /* end function div_U256_U128 */
+
+#endif /* defined( __SIZEOF_INT128__ ) */
+
+
 #endif /*!defined(_FLOAT_C)*/
 
 
@@ -652,6 +757,16 @@ U64     value;                          /* Operand value             */
 /*-------------------------------------------------------------------*/
 static inline void normal_sf( SHORT_FLOAT *fl )
 {
+#if defined( HFP_HOST_INT128 )
+    if (fl->short_fract
+    && (fl->short_fract & 0xFF000000) == 0) {
+        int     digits = (__builtin_clz( fl->short_fract ) >> 2) - 2;
+
+        fl->short_fract <<= (digits << 2);
+        fl->expo -= digits;
+        return;
+    }
+#endif
     if (fl->short_fract) {
         if ((fl->short_fract & 0x00FFFF00) == 0) {
             fl->short_fract <<= 16;
@@ -681,6 +796,16 @@ static inline void normal_sf( SHORT_FLOAT *fl )
 /*-------------------------------------------------------------------*/
 static inline void normal_lf( LONG_FLOAT *fl )
 {
+#if defined( HFP_HOST_INT128 )
+    if (fl->long_fract
+    && (fl->long_fract & 0xFF00000000000000ULL) == 0) {
+        int     digits = (__builtin_clzll( fl->long_fract ) >> 2) - 2;
+
+        fl->long_fract <<= (digits << 2);
+        fl->expo -= digits;
+        return;
+    }
+#endif
     if (fl->long_fract) {
         if ((fl->long_fract & 0x00FFFFFFFF000000ULL) == 0) {
             fl->long_fract <<= 32;
@@ -714,6 +839,22 @@ static inline void normal_lf( LONG_FLOAT *fl )
 /*-------------------------------------------------------------------*/
 static inline void normal_ef( EXTENDED_FLOAT *fl )
 {
+#if defined( HFP_HOST_INT128 )
+    if ((fl->ms_fract
+        || fl->ls_fract)
+    && (fl->ms_fract & 0xFFFF000000000000ULL) == 0) {
+        int     digits;
+        U128H   fract;
+
+        digits = fl->ms_fract ? (__builtin_clzll( fl->ms_fract ) >> 2) - 4
+                              : (__builtin_clzll( fl->ls_fract ) >> 2) + 12;
+        fract = (((U128H)fl->ms_fract << 64) | fl->ls_fract) << (digits << 2);
+        fl->ms_fract = (U64)(fract >> 64);
+        fl->ls_fract = (U64)fract;
+        fl->expo -= digits;
+        return;
+    }
+#endif
     if (fl->ms_fract
     || fl->ls_fract) {
         if (fl->ms_fract == 0) {
@@ -2066,8 +2207,12 @@ U64     wk;
 static int mul_lf( LONG_FLOAT *fl, LONG_FLOAT *mul_fl,
     BYTE ovunf, REGS *regs )
 {
+#if defined( HFP_HOST_INT128 )
+U128H   prod;
+#else
 U64     wk;
 U32     v;
+#endif
 
     if (fl->long_fract
     && mul_fl->long_fract) {
@@ -2075,6 +2220,19 @@ U32     v;
         normal_lf( fl );
         normal_lf( mul_fl );
 
+#if defined( HFP_HOST_INT128 )
+        /* multiply fracts */
+        prod = (U128H)fl->long_fract * mul_fl->long_fract;
+
+        /* normalize result and compute expo */
+        if (prod >> 108) {
+            fl->long_fract = (U64)(prod >> 56);
+            fl->expo = fl->expo + mul_fl->expo - 64;
+        } else {
+            fl->long_fract = (U64)(prod >> 52);
+            fl->expo = fl->expo + mul_fl->expo - 65;
+        }
+#else
         /* multiply fracts by sum of partial multiplications */
         wk = ((fl->long_fract & 0x00000000FFFFFFFFULL) * (mul_fl->long_fract & 0x00000000FFFFFFFFULL)) >> 32;
 
@@ -2094,6 +2252,7 @@ U32     v;
                            | (v >> 20);
             fl->expo = fl->expo + mul_fl->expo - 65;
         }
+#endif
 
         /* determine sign */
         fl->sign = (fl->sign == mul_fl->sign) ? POS : NEG;
@@ -2129,6 +2288,10 @@ U32     v;
 static int mul_ef( EXTENDED_FLOAT *fl, EXTENDED_FLOAT *mul_fl,
     REGS *regs )
 {
+#if defined( HFP_HOST_INT128 )
+U128H   lo, mid1, mid2, wk;
+U64     w1;
+#else
 U64 wk1;
 U64 wk2;
 U64 wk3;
@@ -2136,6 +2299,7 @@ U64 wk4;
 U64 wk;
 U32 wk0;
 U32 v;
+#endif
 
     if ((fl->ms_fract
         || fl->ls_fract)
@@ -2145,6 +2309,29 @@ U32 v;
         normal_ef ( fl );
         normal_ef ( mul_fl );
 
+#if defined( HFP_HOST_INT128 )
+        /* multiply fracts: four partial products of 64 bit digits */
+        lo   = (U128H)fl->ls_fract * mul_fl->ls_fract;
+        mid1 = (U128H)fl->ms_fract * mul_fl->ls_fract;
+        mid2 = (U128H)fl->ls_fract * mul_fl->ms_fract;
+
+        wk = (lo >> 64) + (U64)mid1 + (U64)mid2;
+        w1 = (U64)wk;
+        wk = (wk >> 64) + (mid1 >> 64) + (mid2 >> 64)
+           + (U128H)fl->ms_fract * mul_fl->ms_fract;
+
+        /* the product is now wk:w1 followed by 64 bits not needed;
+           normalize result and compute expo */
+        if (wk >> 92) {
+            wk = (wk << 16) | (w1 >> 48);
+            fl->expo = fl->expo + mul_fl->expo - 64;
+        } else {
+            wk = (wk << 20) | (w1 >> 44);
+            fl->expo = fl->expo + mul_fl->expo - 65;
+        }
+        fl->ms_fract = (U64)(wk >> 64);
+        fl->ls_fract = (U64)wk;
+#else
         /* multiply fracts by sum of partial multiplications */
         wk0 = ((fl->ls_fract & 0x00000000FFFFFFFFULL) * (mul_fl->ls_fract & 0x00000000FFFFFFFFULL)) >> 32;
 
@@ -2197,6 +2384,7 @@ U32 v;
                          | (v >> 12);
             fl->expo = fl->expo + mul_fl->expo - 65;
         }
+#endif
 
         /* determine sign */
         fl->sign = (fl->sign == mul_fl->sign) ? POS : NEG;
@@ -2281,9 +2469,11 @@ U64     wk;
 /*-------------------------------------------------------------------*/
 static int div_lf( LONG_FLOAT *fl, LONG_FLOAT *div_fl, REGS *regs )
 {
+#if !defined( HFP_HOST_INT128 )
 U64     wk;
 U64     wk2;
 int     i;
+#endif
 
     if (div_fl->long_fract) {
         if (fl->long_fract) {
@@ -2299,6 +2489,11 @@ int     i;
                 div_fl->long_fract <<= 4;
             }
 
+#if defined( HFP_HOST_INT128 )
+            /* divide fractions, all 14 hex digits at once */
+            fl->long_fract = (U64)(((U128H)fl->long_fract << 56)
+                                   / div_fl->long_fract);
+#else
             /* partial divide first hex digit */
             wk2 = fl->long_fract / div_fl->long_fract;
             wk = (fl->long_fract % div_fl->long_fract) << 4;
@@ -2314,6 +2509,7 @@ int     i;
             /* partial divide last hex digit */
             fl->long_fract = (wk2 << 4)
                            | (wk / div_fl->long_fract);
+#endif
 
             /* determine sign */
             fl->sign = (fl->sign == div_fl->sign) ? POS : NEG;
@@ -2350,9 +2546,15 @@ int     i;
 static int div_ef( EXTENDED_FLOAT *fl, EXTENDED_FLOAT *div_fl,
     REGS *regs )
 {
+#if defined( HFP_HOST_INT128 )
+U128H   dvnd;
+U128H   dvsr;
+U128H   quot;
+#else
 U64     wkm;
 U64     wkl;
 int     i;
+#endif
 
     if (div_fl->ms_fract
     || div_fl->ls_fract) {
@@ -2374,6 +2576,14 @@ int     i;
                 div_fl->ls_fract <<= 4;
             }
 
+#if defined( HFP_HOST_INT128 )
+            /* divide fractions: 112 bit dividend shifted left 112 bits */
+            dvnd = ((U128H)fl->ms_fract << 64) | fl->ls_fract;
+            dvsr = ((U128H)div_fl->ms_fract << 64) | div_fl->ls_fract;
+            quot = div_U256_U128( dvnd >> 16, dvnd << 112, dvsr );
+            fl->ms_fract = (U64)(quot >> 64);
+            fl->ls_fract = (U64)quot;
+#else
             /* divide fractions */
 
             /* the first binary digit */
@@ -2417,6 +2627,7 @@ int     i;
             if (((S64)wkm) >= 0) {
                 fl->ls_fract |= 1;
             }
+#endif
 
             /* determine sign */
             fl->sign = (fl->sign == div_fl->sign) ? POS : NEG;
@@ -2043,22 +2043,13 @@ BYTE    *main2;                         /* Operand-2 mainstor addr   */
         i = cpu_length / 4;
         cpu_length = i * 4;
 
-        for (j=0; j < i; j++)
-        {
-            /* Fetch fullword from second operand */
-            n = fetch_fw( main2 );
-            main2 += 4;
-
-            /* Accumulate the fullword into the checksum */
-            dreg += n;
+        /* Accumulate all of the fullwords into the checksum at once
+           and then carry the 32 bit overflow back into bit 31, which
+           yields the same result as doing so after every fullword */
+        dreg += mem_sum_fw( main2, i );
 
-            /* Carry 32 bit overflow into bit 31 */
-            if (dreg > 0xFFFFFFFFULL)
-            {
-                dreg &= 0xFFFFFFFFULL;
-                dreg++;
-            }
-        } /* end for(j) */
+        while (dreg > 0xFFFFFFFFULL)
+            dreg = (dreg & 0xFFFFFFFFULL) + (dreg >> 32);
 
         /* Adjust the operand address and remaining length for the
            number of bytes processed */
@@ -3409,11 +3400,21 @@ BYTE    *m1, *m2;                       /* Mainstor addresses        */
 /* 0F   CLCL  - Compare Logical Long                            [RR] */
 /*-------------------------------------------------------------------*/
 
+/*-------------------------------------------------------------------*/
+/* The CPU-determined amount processed by one execution of CLCL,     */
+/* CLCLE and MVCLE. Each page is translated once and then handled    */
+/* with a single memcmp/memset/concpy, so larger values mean fewer   */
+/* re-executions at the cost of slightly later interrupt response.   */
+/*-------------------------------------------------------------------*/
+#ifndef  LONG_INST_MAX_PAGES
+#define  LONG_INST_MAX_PAGES    16      // (pages per execution)
+#endif
+
 #undef   CHUNK_AMT
 #define  CHUNK_AMT          (PAGEFRAME_PAGESIZE - 256)
 
 #undef   MAX_CPU_AMT
-#define  MAX_CPU_AMT        (32 * 1024) // (purely arbitrary)
+#define  MAX_CPU_AMT        (LONG_INST_MAX_PAGES * PAGEFRAME_PAGESIZE)
 
 #ifndef CLCL_ONETIME
 #define CLCL_ONETIME
@@ -3477,7 +3478,9 @@ DEF_INST(compare_logical_character_long)
         rc = ARCH_DEP( mem_cmp )( regs, addr1, r1, addr2, r2, in_amt,
                                                             &out_amt );
         addr1 += out_amt;
+        addr1 &= ADDRESS_MAXWRAP( regs );
         addr2 += out_amt;
+        addr2 &= ADDRESS_MAXWRAP( regs );
         total += out_amt;
         rem   -= out_amt;
 
@@ -3519,6 +3522,7 @@ DEF_INST(compare_logical_character_long)
             rc = ARCH_DEP( mem_pad_cmp )( regs, addr, r, padding, in_amt,
                                                                 &out_amt );
             addr  += out_amt;
+            addr  &= ADDRESS_MAXWRAP( regs );
             total += out_amt;
             rem   -= out_amt;
 
@@ -3559,10 +3563,6 @@ DEF_INST(compare_logical_character_long)
 /*-------------------------------------------------------------------*/
 /* A9   CLCLE - Compare Logical Long Extended                 [RS-a] */
 /*-------------------------------------------------------------------*/
-
-#undef   MAX_CPU_AMT
-#define  MAX_CPU_AMT    (PAGEFRAME_PAGESIZE - 256)  // for (CC=3) and 0 <  MAX_CPU_AMT < pagesize)
-
 DEF_INST(compare_logical_long_extended)
 {
     int     r1, r3;                         /* Register numbers          */
@@ -3574,6 +3574,7 @@ DEF_INST(compare_logical_long_extended)
 
     U64   unpadded_len;         // work (lesser of the two lengths)
     U64   padded_len;           // work (greater length minus lesser)
+    U64   rem;                  // Work (amount remaining)
     U32   in_amt;               // Work (amount to be compared)
     U32   out_amt;              // Work (amount that was found equal)
     U64   total = 0;            // TOTAL amount compared so far
@@ -3620,37 +3621,45 @@ DEF_INST(compare_logical_long_extended)
         padded_len   = len1 - len2;
     }
 
-    // Compare the unpadded part first (up to Max_CPU_AMT)
-    in_amt = unpadded_len <  MAX_CPU_AMT
-            ? unpadded_len :  MAX_CPU_AMT;
+    // Compare the unpadded part first (up to MAX_CPU_AMT)
 
-    rc = ARCH_DEP( mem_cmp )( regs, addr1, r1, addr2, r3, in_amt,
-                                                        &out_amt );
-    addr1 += out_amt;
-    addr1 &= ADDRESS_MAXWRAP( regs );
-    addr2 += out_amt;
-    addr2 &= ADDRESS_MAXWRAP( regs );
-    total += out_amt;
+    rem = unpadded_len;
 
-    // Update register values
+    while (rc == 0 && rem && total < MAX_CPU_AMT)
+    {
+        in_amt = rem < CHUNK_AMT
+               ? (U32) rem : CHUNK_AMT;
 
-    SET_GR_A( r1, regs, addr1 );
-    wlen1 = GR_A( r1+1, regs );
-    if ( wlen1 >= out_amt)
-            SET_GR_A( r1+1, regs, wlen1 - out_amt);
-    else SET_GR_A( r1+1, regs, 0);
+        rc = ARCH_DEP( mem_cmp )( regs, addr1, r1, addr2, r3, in_amt,
+                                                            &out_amt );
+        addr1 += out_amt;
+        addr1 &= ADDRESS_MAXWRAP( regs );
+        addr2 += out_amt;
+        addr2 &= ADDRESS_MAXWRAP( regs );
+        total += out_amt;
+        rem   -= out_amt;
+
+        // Must update register values as we go in case
+        // the next compare causes an access interrupt
 
-    SET_GR_A( r3, regs, addr2 );
-    wlen3 = GR_A( r3+1, regs );
-    if ( wlen3 >= out_amt)
-            SET_GR_A( r3+1, regs, wlen3 - out_amt);
-    else SET_GR_A( r3+1, regs, 0);
+        SET_GR_A( r1, regs, addr1 );
+        wlen1 = GR_A( r1+1, regs );
+        if ( wlen1 >= out_amt)
+                SET_GR_A( r1+1, regs, wlen1 - out_amt);
+        else SET_GR_A( r1+1, regs, 0);
+
+        SET_GR_A( r3, regs, addr2 );
+        wlen3 = GR_A( r3+1, regs );
+        if ( wlen3 >= out_amt)
+                SET_GR_A( r3+1, regs, wlen3 - out_amt);
+        else SET_GR_A( r3+1, regs, 0);
+    }
 
     // Now compare the padded part, if needed
 
     if (rc == 0 && padded_len && total < MAX_CPU_AMT)
     {
-        BYTE  padding[ MAX_CPU_AMT ];
+        BYTE  padding[ CHUNK_AMT ];
         VADR  addr     =  (len1 > len2) ? addr1 : addr2;
         int   r        =  (len1 > len2) ? r1    : r3;
         bool  swap_rc  =  (len1 > len2) ? false : true;
@@ -3658,30 +3667,36 @@ DEF_INST(compare_logical_long_extended)
 
         memset( padding, pad, MIN( padded_len, sizeof( padding )));
 
-        // Compare the padded part (up to Max_CPU_AMT - total (padded part))
-        in_amt = padded_len < MAX_CPU_AMT - total
-                ? padded_len : MAX_CPU_AMT - total;
+        rem = padded_len;
 
-        rc = ARCH_DEP( mem_pad_cmp )( regs, addr, r, padding, in_amt,
-                                                            &out_amt );
-        addr  += out_amt;
-        addr  &= ADDRESS_MAXWRAP( regs );
-        total += out_amt;
+        while (rc == 0 && rem && total < MAX_CPU_AMT)
+        {
+            in_amt = rem < CHUNK_AMT
+                   ? (U32) rem : CHUNK_AMT;
 
-        // Update register values
+            rc = ARCH_DEP( mem_pad_cmp )( regs, addr, r, padding, in_amt,
+                                                                &out_amt );
+            addr  += out_amt;
+            addr  &= ADDRESS_MAXWRAP( regs );
+            total += out_amt;
+            rem   -= out_amt;
 
-        SET_GR_A( r, regs, addr );
-        wlen = GR_A( r+1, regs );
-        if ( wlen >= out_amt)
-            SET_GR_A( r+1, regs, wlen - out_amt);
-        else SET_GR_A( r+1, regs, 0);
+            // Must update register values as we go in case
+            // the next compare causes an access interrupt
+
+            SET_GR_A( r, regs, addr );
+            wlen = GR_A( r+1, regs );
+            if ( wlen >= out_amt)
+                SET_GR_A( r+1, regs, wlen - out_amt);
+            else SET_GR_A( r+1, regs, 0);
+        }
 
         if (swap_rc)
             rc = -rc;
     }
 
     // Set the condition code and return
-    if (rc == 0 && total >= MAX_CPU_AMT )
+    if (rc == 0 && total < (unpadded_len + padded_len))
         regs->psw.cc = 3;
     else
         regs->psw.cc = (!rc ? 0 : (rc < 0 ? 1 : 2));
@@ -3698,12 +3713,12 @@ DEF_INST(compare_logical_long_extended)
 DEF_INST(compare_logical_string)
 {
 int     r1, r2;                         /* Values of R fields        */
-int     i;                              /* Loop counter              */
-int     dist1, dist2;                   /* length working distances  */
-int     usable;                         /* usable length to page end */
-int     cpu_length;                     /* CPU determined length     */
+U32     i;                              /* Index of deciding byte    */
+U32     usable;                         /* usable length to page end */
+U32     compared = 0;                   /* Total bytes compared      */
 VADR    addr1, addr2;                   /* End/start addresses       */
 BYTE    *main1, *main2;                 /* ptrs to compare bytes     */
+BYTE    byte1, byte2;                   /* Deciding operand bytes    */
 BYTE    termchar;                       /* Terminating character     */
 
     RRE( inst, regs, r1, r2 );
@@ -3722,171 +3737,74 @@ BYTE    termchar;                       /* Terminating character     */
     addr1 = regs->GR( r1 ) & ADDRESS_MAXWRAP( regs );
     addr2 = regs->GR( r2 ) & ADDRESS_MAXWRAP( regs );
 
-    /* Establish minimum CPU determined length per the specification */
-    cpu_length = 256;
-
-    /* Should either operand cross a page boundary, we need to
-       break up the search into two parts (one part in each page)
-       to meet the minimum requirement of 256 CPU determined bytes.
+    /* The CPU determined length extends out to the nearest end of
+       page of either operand. Should that be less than the minimum
+       of 256 bytes required by the specification, we continue on
+       across the page boundary (one part in each page) until 256
+       bytes have been compared.
     */
-    if (unlikely( CROSSPAGEL( addr1, cpu_length ) ||
-                  CROSSPAGEL( addr2, cpu_length )))
+    do
     {
-        /* Compute distance to the end of the page for each operand */
-        dist1 = PAGEFRAME_PAGESIZE - (addr1 & PAGEFRAME_BYTEMASK);
-        dist2 = PAGEFRAME_PAGESIZE - (addr2 & PAGEFRAME_BYTEMASK);
+        usable = min( PAGEFRAME_PAGESIZE - (addr1 & PAGEFRAME_BYTEMASK),
+                      PAGEFRAME_PAGESIZE - (addr2 & PAGEFRAME_BYTEMASK) );
+        if (compared)
+            usable = min( usable, 256 - compared );
 
-        while (cpu_length)
-        {
-            usable = min( dist1, dist2 );
-            usable = min( usable, cpu_length );
+        main1 = MADDRL(addr1, usable, r1, regs, ACCTYPE_READ, regs->psw.pkey );
+        main2 = MADDRL(addr2, usable, r2, regs, ACCTYPE_READ, regs->psw.pkey );
 
-            main1 = MADDRL(addr1, usable, r1, regs, ACCTYPE_READ, regs->psw.pkey );
-            main2 = MADDRL(addr2, usable, r2, regs, ACCTYPE_READ, regs->psw.pkey );
+        /* Skip over all leading bytes which are equal in both operands
+           and not the terminating character. Whatever byte we stop at
+           (if any) decides the condition code.
+        */
+        if ((i = mem_find_neq_or_byte( main1, main2, usable, termchar )) < usable)
+        {
+            byte1 = main1[i];
+            byte2 = main2[i];
 
-            for (i=0; i < usable; i++)
+            /* If both bytes are the terminating character, then
+               the strings are equal, so return CC=0 and leave
+               the R1 and R2 registers unchanged.
+            */
+            if (byte1 == termchar && byte2 == termchar)
             {
-                /* If both bytes are the terminating character, then
-                   the strings are equal, so return CC=0 and leave
-                   the R1 and R2 registers unchanged.
-                */
-                if (*main1 == termchar && *main2 == termchar)
-                {
-                    regs->psw.cc = 0;
-                    return;
-                }
-
-                /* If FIRST operand byte is the terminating character,
-                   -OR- if the first operand byte is LOWER than the
-                   second operand byte, then return condition code 1
-                */
-                if (0
-                    || *main1 == termchar
-                    || (1
-                        && (*main1 < *main2)
-                        && (*main2 != termchar)
-                       )
-                )
-                {
-                    regs->psw.cc = 1;
-                    SET_GR_A( r1, regs,addr1 );
-                    SET_GR_A( r2, regs,addr2 );
-                    return;
-                }
-
-                /* If SECOND operand byte is the terminating character,
-                   -OR- if the first operand byte is HIGHER than the
-                   second operand byte, then return condition code 2.
-                */
-                if (*main2 == termchar || *main1 > *main2)
-                {
-                    regs->psw.cc = 2;
-                    SET_GR_A( r1, regs,addr1 );
-                    SET_GR_A( r2, regs,addr2 );
-                    return;
-                }
-
-                /* Bump both operands to the next byte */
-                main1++;
-                main2++;
-
-                addr1++;
-                addr1 &= ADDRESS_MAXWRAP( regs );
-
-                addr2++;
-                addr2 &= ADDRESS_MAXWRAP( regs );
-
-            } /* end for(i) */
-
-            /* Adjust all counts by number of bytes scanned */
-            cpu_length -= usable;
-            dist1      -= usable;
-            dist2      -= usable;
+                regs->psw.cc = 0;
+                return;
+            }
 
-            /* If either operand dist value is 0, then we're at a page
-               boundary. Adjust the remaining distance to the remaining
-               CPU determined length.
+            /* If FIRST operand byte is the terminating character,
+               -OR- if the first operand byte is LOWER than the
+               second operand byte, then return CC=1. Otherwise the
+               SECOND operand byte is the terminating character or
+               the first operand byte is HIGHER than the second
+               operand byte, so return CC=2.
             */
-            if (!dist1) dist1 = cpu_length;
-            if (!dist2) dist2 = cpu_length;
-
-        } /* end while */
-
-        /* CPU determine number of bytes reached without finding any
-           inequality. Set CC=3 and exit with the current position
-           updated in the operand registers.
-        */
-        regs->psw.cc = 3;
-        SET_GR_A( r1, regs,addr1 );
-        SET_GR_A( r2, regs,addr2 );
-        return;
-
-    } /* end if */
-
-    /* Neither operand crosses a page boundary using the minimum
-       length, so extend the CPU determined length out to the
-       nearest end of page of either operand.
-    */
-    dist1 = PAGEFRAME_PAGESIZE - (addr1 & PAGEFRAME_BYTEMASK);
-    dist2 = PAGEFRAME_PAGESIZE - (addr2 & PAGEFRAME_BYTEMASK);
-
-    cpu_length = min( dist1, dist2 ); /* (nearest end of page) */
-    main1 = MADDRL(addr1, cpu_length, r1, regs, ACCTYPE_READ, regs->psw.pkey );
-    main2 = MADDRL(addr2, cpu_length, r2, regs, ACCTYPE_READ, regs->psw.pkey );
-
-    for (i=0; i < cpu_length; i++)
-    {
-        /* If both bytes are the terminating character, then
-           the strings are equal, so return CC=0 and leave
-           the R1 and R2 registers unchanged.
-        */
-        if (*main1 == termchar && *main2 == termchar)
-        {
-            regs->psw.cc = 0;
-            return;
-        }
-
-        /* If FIRST operand byte is the terminating character,
-           -OR- if the first operand byte is LOWER than the
-           second operand byte, then return CC=1
-        */
-        if (0
-            || *main1 == termchar
-            || (1
-                && (*main1 < *main2)
-                && (*main2 != termchar)
-               )
-        )
-        {
-            regs->psw.cc = 1;
-            SET_GR_A( r1, regs,addr1 );
-            SET_GR_A( r2, regs,addr2 );
-            return;
-        }
+            if (0
+                || byte1 == termchar
+                || (1
+                    && (byte1 < byte2)
+                    && (byte2 != termchar)
+                   )
+            )
+                regs->psw.cc = 1;
+            else
+                regs->psw.cc = 2;
 
-        /* If SECOND operand byte is the terminating character,
-           -OR- if the first operand byte is HIGHER than the
-           second operand byte, then return CC=2.
-        */
-        if (*main2 == termchar || *main1 > *main2)
-        {
-            regs->psw.cc = 2;
-            SET_GR_A( r1, regs,addr1 );
-            SET_GR_A( r2, regs,addr2 );
+            SET_GR_A( r1, regs, (addr1 + i) & ADDRESS_MAXWRAP( regs ));
+            SET_GR_A( r2, regs, (addr2 + i) & ADDRESS_MAXWRAP( regs ));
             return;
         }
 
-        /* Bump both operands to the next byte */
-        main1++;
-        main2++;
-
-        addr1++;
+        /* Bump both operands past the bytes just compared */
+        addr1 += usable;
         addr1 &= ADDRESS_MAXWRAP( regs );
 
-        addr2++;
+        addr2 += usable;
         addr2 &= ADDRESS_MAXWRAP( regs );
 
-    } /* end for(i) */
+        compared += usable;
+    }
+    while (compared < 256);
 
     /* CPU determine number of bytes reached without finding any
        inequality. Set CC=3 and exit with the current position
@@ -3938,40 +3856,26 @@ int ARCH_DEP( mem_cmp_first_equ )
 )
 {
     BYTE   *m1,   *m2;          // operand mainstor addresses
-    BYTE   *m1pg, *m2pg;        // operand page
-    U32    i;                   // loop index
+    U32    i;                   // bytes compared so far
+    U32    n;                   // bytes to compare this pass
+    U32    j;                   // index of equ byte
 
-    /* fast exit */
-    if (len == 0) return MEM_CMP_NPOS;
-
-    // Translate left most byte of each operand
-    m1 = MADDRL(ea1 & ADDRESS_MAXWRAP( regs ), PAGEBYTES( ea1 ), b1, regs, ACCTYPE_READ, regs->psw.pkey );
-    m2 = MADDRL(ea2 & ADDRESS_MAXWRAP( regs ), PAGEBYTES( ea2 ), b2, regs, ACCTYPE_READ, regs->psw.pkey );
+    ea1 &= ADDRESS_MAXWRAP( regs );
+    ea2 &= ADDRESS_MAXWRAP( regs );
 
-    m1pg = MAINSTOR_PAGEBASE ( m1 );
-    m2pg = MAINSTOR_PAGEBASE ( m2 );
-
-    for (i = 0; i < len ; i++)
+    /* Compare up to the nearest page end of either operand per pass */
+    for (i = 0; i < len; i += n)
     {
-        /* compare bytes */
-        if (*m1 == *m2)
-            return i;
+        n = min( len - i, min( PAGEBYTES( ea1 ), PAGEBYTES( ea2 )));
 
-        /* update mainstore addresses */
-        m1++;
-        m2++;
+        m1 = MADDRL( ea1, n, b1, regs, ACCTYPE_READ, regs->psw.pkey );
+        m2 = MADDRL( ea2, n, b2, regs, ACCTYPE_READ, regs->psw.pkey );
 
-        /* check for page cross */
-        if (MAINSTOR_PAGEBASE ( m1 ) != m1pg)
-        {
-            m1 = MADDRL((ea1 + (i+1)) & ADDRESS_MAXWRAP( regs ), PAGEFRAME_PAGESIZE, b1, regs, ACCTYPE_READ, regs->psw.pkey );
-            m1pg = MAINSTOR_PAGEBASE ( m1 );
-        }
-        if (MAINSTOR_PAGEBASE ( m2 ) != m2pg)
-        {
-            m2 = MADDRL((ea2 + (i+1)) & ADDRESS_MAXWRAP( regs ), PAGEFRAME_PAGESIZE, b2, regs, ACCTYPE_READ, regs->psw.pkey );
-            m2pg = MAINSTOR_PAGEBASE ( m2 );
-        }
+        if ((j = mem_find_equ( m1, m2, n )) < n)
+            return i + j;
+
+        ea1 = (ea1 + n) & ADDRESS_MAXWRAP( regs );
+        ea2 = (ea2 + n) & ADDRESS_MAXWRAP( regs );
     }
 
     /* no equ byte in memory */
@@ -4793,7 +4697,9 @@ U16     uvwxy;                          /* Unicode work area         */
 U16     unicode1;                       /* Unicode character         */
 U16     unicode2;                       /* Unicode low surrogate     */
 GREG    n;                              /* Number of UTF-8 bytes - 1 */
+GREG    run;                            /* Characters in ASCII run   */
 BYTE    utf[4];                         /* UTF-8 bytes               */
+BYTE    *main1, *main2;                 /* Operand mainstor addresses*/
 #if defined( FEATURE_030_ETF3_ENHANCEMENT_FACILITY )
 bool    wfc;                            /* Well-Formedness-Checking  */
 #endif
@@ -4836,6 +4742,32 @@ bool    wfc;                            /* Well-Formedness-Checking  */
 
         /* Fetch two bytes from source operand */
         unicode1 = ARCH_DEP(vfetch2) ( addr2, r2, regs );
+
+        /* Convert all but the last character of a run of Unicode
+           0000-007F within the current source and destination pages
+           at once, leaving the last one to be converted below */
+        if (unicode1 < 0x0080)
+        {
+            run = min( len2 / 2, len1 );
+            run = min( run, (GREG)(4096 - i) );
+            run = min( run, (GREG)(PAGEFRAME_PAGESIZE - (addr2 & PAGEFRAME_BYTEMASK)) / 2 );
+            run = min( run, (GREG)(PAGEFRAME_PAGESIZE - (addr1 & PAGEFRAME_BYTEMASK)) );
+
+            if (run > 1)
+            {
+                main2 = MADDRL( addr2, run * 2, r2, regs, ACCTYPE_READ,  regs->psw.pkey );
+                main1 = MADDRL( addr1, run,     r1, regs, ACCTYPE_WRITE, regs->psw.pkey );
+                run = utf16_ascii_to_utf8( main1, main2, (U32) run ) - 1;
+
+                addr1 += run;
+                len1  -= run;
+                addr2 += run * 2;
+                len2  -= run * 2;
+                i     += (int) run;
+                unicode1 = fetch_hw( main2 + run * 2 );
+            }
+        }
+
         naddr2 = addr2 + 2;
         naddr2 &= ADDRESS_MAXWRAP(regs);
         nlen2 = len2 - 2;
@@ -4956,6 +4888,7 @@ DEF_INST(convert_utf8_to_utf16)
     BYTE*   d1;                    // Destination mainstor address (ie. addr1)
     BYTE*   d1pg;                  // Destination base page
     int     d1len;                 // Destination bytes written
+    GREG    run;                   // Characters in ASCII run
 
     RRF_M(inst, regs, r1, r2, m3);
     PER_ZEROADDR_LCHECK2( regs, r1, r1+1, r2, r2+1 );
@@ -5006,6 +4939,28 @@ DEF_INST(convert_utf8_to_utf16)
         /* Convert UTF-8 to Unicode */
         if (utf[0] < (BYTE)0x80)
         {
+            /* Convert all but the last character of a run of ASCII
+               within the current source and destination pages at
+               once, leaving the last one to be converted below */
+            run = min( len2, len1 / 2 );
+            run = min( run, (GREG)(4096 - i) );
+            run = min( run, (GREG)(PAGEFRAME_PAGESIZE - (addr2 & PAGEFRAME_BYTEMASK)) );
+            run = min( run, (GREG)(PAGEFRAME_PAGESIZE - (addr1 & PAGEFRAME_BYTEMASK)) / 2 );
+
+            if (run > 1)
+            {
+                run = utf8_ascii_to_utf16( d1, s2, (U32) run ) - 1;
+
+                addr1 += run * 2;
+                len1  -= run * 2;
+                addr2 += run;
+                len2  -= run;
+                i     += (int) run;
+                s2    += run;
+                d1    += run * 2;
+                utf[0] = *s2;
+            }
+
             /* Convert 00-7F to Unicode 0000-007F */
             n = 0;
             unicode1 = utf[0];
@@ -5659,15 +5614,24 @@ int     cc = 0;                         /* Condition code            */
             if (len2 == len3)
             {
                 /* (4a) - Both operands cross at the same time */
-                for (i=0; i < len2; i++)
-                    if (*dest1++ ^= *source1++)
-                        cc = 1;
+                if (dest1 == source1 && dest2 == source2)
+                {
+                    /* Dest and source are the same, set dest to zeroes */
+                    memset( dest1, 0, len2 );
+                    memset( dest2, 0, len + 1 - len2 );
+                }
+                else
+                {
+                    for (i=0; i < len2; i++)
+                        if (*dest1++ ^= *source1++)
+                            cc = 1;
 
-                len2 = len - len2;
+                    len2 = len - len2;
 
-                for (i=0; i <= len2; i++)
-                    if (*dest2++ ^= *source2++)
-                        cc = 1;
+                    for (i=0; i <= len2; i++)
+                        if (*dest2++ ^= *source2++)
+                            cc = 1;
+                }
             }
             else if (len2 < len3)
             {
@@ -6699,16 +6663,24 @@ BYTE    len;                            /* Amount to move minus 1    */
     op2end = (effective_addr2 - len) & ADDRESS_MAXWRAP( regs );
     ARCH_DEP( vfetchc )( wrk, len, op2end, b2, regs );
 
-    /* Reverse the string in place in our work area */
+    /* Reverse the string in place in our work area, a doubleword
+       from each end at a time while at least 16 bytes remain */
     p1 = &wrk[0];
     p2 = p1 + len;
+    while (p2 - p1 >= 15)
+    {
+        U64 lo = fetch_dw_noswap( p1 );
+        U64 hi = fetch_dw_noswap( p2 - 7 );
+        store_dw_noswap( p1,     bswap_64( hi ));
+        store_dw_noswap( p2 - 7, bswap_64( lo ));
+        p1 += 8;
+        p2 -= 8;
+    }
     while (p1 < p2)
     {
-        *p1 ^= *p2;
-        *p2 ^= *p1;
-        *p1 ^= *p2;
-        p1++;
-        p2--;
+        BYTE b = *p1;
+        *p1++ = *p2;
+        *p2-- = b;
     }
 
     /* Copy results back to operand-1 destination */
@@ -6905,6 +6877,10 @@ int     orglen1;                        /* Original dest length      */
 /*-------------------------------------------------------------------*/
 /* A8   MVCLE - Move Long Extended                            [RS-a] */
 /*-------------------------------------------------------------------*/
+
+#undef   MAX_CPU_AMT
+#define  MAX_CPU_AMT        (LONG_INST_MAX_PAGES * PAGEFRAME_PAGESIZE)
+
 DEF_INST(move_long_extended)
 {
 int     r1, r3;                         /* Register numbers          */
@@ -6914,10 +6890,10 @@ int     cc;                             /* Condition code            */
 VADR    addr1, addr2;                   /* Operand addresses         */
 GREG    len1, len2;                     /* Operand lengths           */
 BYTE    pad;                            /* Padding byte              */
-size_t  cpu_length;                     /* cpu determined length     */
+size_t  total = 0;                      /* Amount moved so far       */
 size_t  copylen;                        /* Length to copy            */
-BYTE    *dest;                          /* Maint storage pointers    */
-size_t  dstlen,srclen;                  /* Page wide src/dst lengths */
+size_t  dstlen, srclen;                 /* Page wide src/dst lengths */
+BYTE    *dest, *source;                 /* Mainstor pointers         */
 
     RS(inst, regs, r1, r3, b2, effective_addr2);
     PER_ZEROADDR_LCHECK2( regs, r1, r1+1, r3, r3+1 );
@@ -6936,64 +6912,57 @@ size_t  dstlen,srclen;                  /* Page wide src/dst lengths */
     len1 = GR_A(r1+1, regs);
     len2 = GR_A(r3+1, regs);
 
-    /* set cpu_length as shortest distance to new page */
-    if ((addr1 & 0xFFF) > (addr2 & 0xFFF))
-        cpu_length = 0x1000 - (addr1 & 0xFFF);
-    else
-        cpu_length = 0x1000 - (addr2 & 0xFFF);
-
-    dstlen=MIN(cpu_length,len1);
-    srclen=MIN(cpu_length,len2);
-    copylen=MIN(dstlen,srclen);
-
     /* Set the condition code according to the lengths */
     cc = (len1 < len2) ? 1 : (len1 > len2) ? 2 : 0;
 
-    /* Obtain destination pointer */
-    if(len1==0)
+    /* Move up to the CPU-determined amount, one translation per
+       destination page, breaking each page at the source's page
+       boundary too. Registers are updated after every piece so an
+       access exception on a later page leaves them consistent. */
+    while (len1 && len2 && total < MAX_CPU_AMT)
     {
-        /* bail out if nothing to do */
-        regs->psw.cc = cc;
-        return;
-    }
+        dstlen  = PAGEFRAME_PAGESIZE - (addr1 & PAGEFRAME_BYTEMASK);
+        srclen  = PAGEFRAME_PAGESIZE - (addr2 & PAGEFRAME_BYTEMASK);
+        copylen = MIN( MIN( dstlen, srclen ), MIN( len1, len2 ));
+
+        source = MADDRL( addr2, copylen, r3, regs, ACCTYPE_READ,  regs->psw.pkey );
+        dest   = MADDRL( addr1, copylen, r1, regs, ACCTYPE_WRITE, regs->psw.pkey );
+
+        /* Use concpy to ensure Concurrent block update consistency */
+        concpy( regs, dest, source, (int)copylen );
 
-    dest = MADDRL (addr1, len1, r1, regs, ACCTYPE_WRITE, regs->psw.pkey);
-    if(copylen!=0)
-    {
-        /* here if we need to copy data */
-        BYTE *source;
-        /* get source frame and copy concurrently */
-        source = MADDRL(addr2, copylen, r3, regs, ACCTYPE_READ, regs->psw.pkey);
-        concpy(regs,dest,source,(int)copylen);
-        /* Adjust operands */
-        addr2+=(int)copylen;
-        len2-=(int)copylen;
-        addr1+=(int)copylen;
-        len1-=(int)copylen;
-
-        /* Adjust length & pointers for this cycle */
-        dest+=copylen;
-        dstlen-=copylen;
-        srclen-=copylen;
+        addr1 = (addr1 + copylen) & ADDRESS_MAXWRAP( regs );
+        addr2 = (addr2 + copylen) & ADDRESS_MAXWRAP( regs );
+        len1 -= copylen;
+        len2 -= copylen;
+        total += copylen;
+
+        SET_GR_A( r1,   regs, addr1 );
+        SET_GR_A( r1+1, regs, len1  );
+        SET_GR_A( r3,   regs, addr2 );
+        SET_GR_A( r3+1, regs, len2  );
     }
-    if(srclen==0 && dstlen!=0)
+
+    /* Pad (or clear) the rest of the destination a page at a time */
+    while (len1 && total < MAX_CPU_AMT)
     {
-        /* here if we need to pad the destination */
-        memset(dest,pad,dstlen);
+        dstlen = PAGEFRAME_PAGESIZE - (addr1 & PAGEFRAME_BYTEMASK);
+        dstlen = MIN( dstlen, len1 );
+
+        dest = MADDRL( addr1, dstlen, r1, regs, ACCTYPE_WRITE, regs->psw.pkey );
+        memset( dest, pad, dstlen );
 
-        /* Adjust destination operands */
-        addr1+=(int)dstlen;
-        len1-=(int)dstlen;
+        addr1 = (addr1 + dstlen) & ADDRESS_MAXWRAP( regs );
+        len1 -= dstlen;
+        total += dstlen;
+
+        SET_GR_A( r1,   regs, addr1 );
+        SET_GR_A( r1+1, regs, len1  );
     }
 
-    /* Update the registers */
-    SET_GR_A(r1, regs,addr1);
-    SET_GR_A(r1+1, regs,len1);
-    SET_GR_A(r3, regs,addr2);
-    SET_GR_A(r3+1, regs,len2);
     /* if len1 != 0 then set CC to 3 to indicate
        we have reached end of CPU dependent length */
-    if(len1>0) cc=3;
+    if (len1 > 0) cc = 3;
 
     regs->psw.cc = cc;
 
@@ -542,9 +542,10 @@ VADR    effective_addr2,
 DEF_INST(search_string)
 {
 int     r1, r2;                         /* Values of R fields        */
-int     i;                              /* Loop counter              */
-int     dist;                           /* length working distance   */
-int     cpu_length;                     /* CPU determined length     */
+U32     i;                              /* Index of found character  */
+U32     dist;                           /* Bytes to search this page */
+U32     searched = 0;                   /* Total bytes searched      */
+bool    atend;                          /* Operand end within page   */
 VADR    addr1, addr2;                   /* End/start addresses       */
 BYTE    *main2;                         /* Operand-2 mainstor addr   */
 BYTE    termchar;                       /* Terminating character     */
@@ -565,107 +566,17 @@ BYTE    termchar;                       /* Terminating character     */
     addr1 = regs->GR( r1 ) & ADDRESS_MAXWRAP( regs );
     addr2 = regs->GR( r2 ) & ADDRESS_MAXWRAP( regs );
 
-    /* Set the minimum CPU determined length per the specification  */
-    cpu_length = 256;
-
-    /* Should the second operand cross a page boundary, we need to
-       break up the search into two parts (one part in each page)
-       to meet the minimum requirement of 256 CPU determined bytes. */
-    if (unlikely( CROSSPAGEL( addr2, cpu_length )))
-    {
-        /* Compute the distance to the end of operand-2's page */
-        dist = PAGEFRAME_PAGESIZE - (addr2 & PAGEFRAME_BYTEMASK);
-
-        while (cpu_length)
-        {
-            /* We need to check the boundary condition
-               BEFORE attempting to access storage,
-               because if the boundary condition is met,
-               there is no further need to access storage.
-            */
-            /* NOTE: "When the address in general register R1 is less
-               than the address in general register R2, condition code
-               2 can be set only if the operand wraps around from the
-               top of storage to location 0."  The below comparison
-               for == is thus correct.
-            */
-            if (addr2 == addr1)
-            {
-                regs->psw.cc = 2;
-                return;
-            }
-            main2 = MADDRL(addr2, cpu_length, r2, regs, ACCTYPE_READ, regs->psw.pkey );
-            for (i=0; i < dist; i++)
-            {
-                /* If operand end address has been reached, return
-                   CC=2 and leave the R1 and R2 registers unchanged
-                */
-                /* NOTE: "When the address in general register R1 is
-                   less than the address in general register R2, then
-                   condition code 2 can be set only when the operand
-                   wraps around from the top of storage to location 0."
-                   Thus the below == comparison is correct.
-                */
-                if (addr2 == addr1)
-                {
-                    regs->psw.cc = 2;
-                    return;
-                }
-
-                /* Set CC=1 if the terminating character was found,
-                   and load the address of that character into R1 */
-                if (*main2 == termchar)
-                {
-                    SET_GR_A( r1, regs, addr2 );
-                    regs->psw.cc = 1;
-                    return;
-                }
-
-                /* Bump operand-2 */
-                main2++;
-                addr2++;
-                addr2 &= ADDRESS_MAXWRAP( regs );
-
-            } /* end for(i) */
-
-            cpu_length -= dist;
-            dist = cpu_length;
-
-        } /* end while */
-
-        /* The CPU determine number of bytes has been reached. Set R2
-           to point to next character of operand, set CC=3 and exit */
-        SET_GR_A( r2, regs, addr2 );
-        regs->psw.cc = 3;
-        return;
-    } /* end if unlikely() */
-
-    /* We don't cross a page boundary with the minimum length, so
-       extend the CPU determined length out to the end of the page */
-    cpu_length = PAGEFRAME_PAGESIZE - (addr2 & PAGEFRAME_BYTEMASK);
-
-    /* We need to check the boundary condition
-       BEFORE attempting to access storage,
-       because if the boundary condition is met,
-       there is no further need to access storage.
+    /* The CPU determined length is the rest of operand-2's page. If
+       that is less than the architected minimum of 256 bytes, we go
+       on into the following page for the remainder of the 256 bytes.
+       Each page is searched in a single pass rather than byte by byte.
     */
-    /* NOTE: "When the address in general register R1 is less
-       than the address in general register R2, condition code
-       2 can be set only if the operand wraps around from the
-       top of storage to location 0."  The below comparison
-       for == is thus correct.
-    */
-    if (addr2 == addr1)
-    {
-        regs->psw.cc = 2;
-        return;
-    }
-
-    main2 = MADDRL(addr2, cpu_length, r2, regs, ACCTYPE_READ, regs->psw.pkey );
-    for (i=0; i < cpu_length; i++)
+    do
     {
-        /* If operand end address has been reached, return
-           CC=2 and leave the R1 and R2 registers unchanged
+        /* We need to check the boundary condition
+           BEFORE attempting to access storage,
+           because if the boundary condition is met,
+           there is no further need to access storage.
         */
         /* NOTE: "When the address in general register R1 is less
            than the address in general register R2, condition code
@@ -679,21 +590,43 @@ BYTE    termchar;                       /* Terminating character     */
             return;
         }
 
+        /* Search no further than the end of this page or the end
+           of the operand, whichever comes first. (A page never
+           spans the wrap from the top of storage to location 0.)
+        */
+        dist  = PAGEFRAME_PAGESIZE - (addr2 & PAGEFRAME_BYTEMASK);
+        if (searched)
+            dist = min( dist, 256 - searched );
+        atend = (addr1 > addr2 && (addr1 - addr2) < dist);
+        if (atend)
+            dist = (U32)(addr1 - addr2);
+
+        main2 = MADDRL(addr2, dist, r2, regs, ACCTYPE_READ, regs->psw.pkey );
+
         /* If the terminating character was found, return
            CC=1 and load the address of the character in R1 */
-        if (*main2 == termchar)
+        if ((i = mem_find_byte( main2, dist, termchar )) < dist)
         {
-            SET_GR_A( r1, regs, addr2 );
+            SET_GR_A( r1, regs, (addr2 + i) & ADDRESS_MAXWRAP( regs ));
             regs->psw.cc = 1;
             return;
         }
 
-        /* Bump operand-2 */
-        main2++;
-        addr2++;
+        /* Bump operand-2 past the bytes just searched */
+        addr2 += dist;
         addr2 &= ADDRESS_MAXWRAP( regs );
+        searched += dist;
 
-    } /* end for(i) */
+        /* If operand end address has been reached, return
+           CC=2 and leave the R1 and R2 registers unchanged
+        */
+        if (atend)
+        {
+            regs->psw.cc = 2;
+            return;
+        }
+    }
+    while (searched < 256);
 
     /* The CPU determine number of bytes has been reached.
        Set R2 to point to next character of operand-2 and
@@ -2025,14 +1958,15 @@ BYTE   *dest, *dest2 = NULL, *tab, *tab2; /* Mainstor pointers       */
 /*-------------------------------------------------------------------*/
 DEF_INST(translate_and_test)
 {
-CACHE_ALIGN BYTE op1[256], op2[256];    /* Operand work areas        */
 VADR    effective_addr1;                /* Effective address         */
 VADR    effective_addr2;                /* Effective address         */
 int     b1, b2;                         /* Base registers            */
 int     len;                            /* Length - 1                */
 int     i;                              /* work variable             */
 int     cc = 0;                         /* Condition code            */
+U32     n, k;                           /* Operand-1 piece lengths   */
 BYTE    dbyte, sbyte = 0;               /* Byte work areas           */
+BYTE    *m1 = NULL, *fct = NULL;        /* Operand mainstor addrs    */
 bool    op1crosses, op2crosses;         /* Operand crosses Page Bdy  */
 
     SS_L( inst, regs, len, b1, effective_addr1, b2, effective_addr2 );
@@ -2040,13 +1974,13 @@ bool    op1crosses, op2crosses;         /* Operand crosses Page Bdy  */
 
     TXFC_INSTR_CHECK( regs );
 
-    /* Copy operand-1 data to work area if within same page */
+    /* Address operand-1 data directly if within same page */
     if (!(op1crosses = CROSSPAGE( effective_addr1, len )))
-        ARCH_DEP( vfetchc )( op1, len, effective_addr1, b1, regs );
+        m1 = MADDRL( effective_addr1, len+1, b1, regs, ACCTYPE_READ, regs->psw.pkey );
 
-    /* Copy operand-2 data to work area if within same page */
+    /* Address operand-2 data directly if within same page */
     if (!(op2crosses = CROSSPAGE( effective_addr2, 256-1 )))
-        ARCH_DEP( vfetchc )( op2, 256-1, effective_addr2, b2, regs );
+        fct = MADDRL( effective_addr2, 256, b2, regs, ACCTYPE_READ, regs->psw.pkey );
 
     /* Process first operand from left to right */
     if (unlikely( op1crosses ))
@@ -2064,9 +1998,23 @@ bool    op1crosses, op2crosses;         /* Operand crosses Page Bdy  */
         }
         else /* Only operand-1 crosses a page boundary */
         {
-            for (i=0; i <= len; i++)
-                if ((sbyte = op2[ ARCH_DEP( vfetchb )( effective_addr1+i, b1, regs ) ]))
-                    break;
+            /* Scan the part in the first page, and only if nothing
+               was found there, the remainder in the second page */
+            n  = PAGEFRAME_PAGESIZE - (effective_addr1 & PAGEFRAME_BYTEMASK);
+            m1 = MADDRL( effective_addr1, n, b1, regs, ACCTYPE_READ, regs->psw.pkey );
+
+            if ((i = mem_find_fc( m1, n, fct )) < (int) n)
+                sbyte = fct[ m1[i] ];
+            else
+            {
+                m1 = MADDRL( (effective_addr1 + n) & ADDRESS_MAXWRAP( regs ),
+                             len+1-n, b1, regs, ACCTYPE_READ, regs->psw.pkey );
+
+                if ((k = mem_find_fc( m1, len+1-n, fct )) < len+1-n)
+                    sbyte = fct[ m1[k] ];
+
+                i = n + k;
+            }
         }
     }
     else /* Operand-1 does NOT cross a page boundary */
@@ -2075,14 +2023,13 @@ bool    op1crosses, op2crosses;         /* Operand crosses Page Bdy  */
        {
             /* But operand-2 DOES cross a page boundary */
             for (i=0; i <= len; i++)
-                if ((sbyte = ARCH_DEP( vfetchb )( effective_addr2+op1[i], b2, regs )))
+                if ((sbyte = ARCH_DEP( vfetchb )( effective_addr2+m1[i], b2, regs )))
                     break;
        }
        else /* BEST case: NEITHER operand crosses a page boundary */
        {
-            for (i=0; i <= len; i++)
-                if ((sbyte = op2[ op1[i] ]))
-                    break;
+            if ((i = mem_find_fc( m1, len+1, fct )) <= len)
+                sbyte = fct[ m1[i] ];
        }
     }
 
@@ -2137,7 +2084,7 @@ GREG    len1;                       /* Operand length                */
 BYTE    tbyte;                      /* Test byte                     */
 CACHE_ALIGN BYTE  trtab[256];       /* Translate table               */
 GREG    len;                        /* on page translate length      */
-int     translen = 0;               /* translated length             */
+U32     translen;                   /* translated length             */
 BYTE   *main1;                      /* Mainstor addresses            */
 
     RRE(inst, regs, r1, r2);
@@ -2195,22 +2142,14 @@ BYTE   *main1;                      /* Mainstor addresses            */
     /* Get operand 1 on page address */
     main1 = MADDRL( addr1, len, r1, regs, ACCTYPE_WRITE, regs->psw.pkey );
 
-    /* translate on page data */
-    for (i = 0; i < len; i++)
-    {
-        /* If equal to test byte, exit with condition code 1 */
-        if (*main1 == tbyte)
-        {
-            cc = 1;
-            break;
-        }
-
-        /* Load indicated byte from translate table */
-        *main1 = trtab[ *main1 ];
+    /* Find the test byte first, then translate everything before it.
+       If equal to test byte, exit with condition code 1 */
+    if ((translen = mem_find_byte( main1, (U32) len, tbyte )) < len)
+        cc = 1;
 
-        main1++;
-        translen++;
-    } /* end for(i) */
+    /* translate on page data */
+    for (i = 0; i < translen; i++)
+        main1[i] = trtab[ main1[i] ];
 
     /* Update the registers */
     addr1 += translen;
@@ -2495,6 +2434,7 @@ DEF_INST(convert_utf8_to_utf32)
     BYTE*   s1pg;                  // Source base page
     BYTE*   d1;                    // Destination mainstor addresses
     BYTE*   d1pg;                  // Destination base page
+    GREG    run;                   // Characters in ASCII run
 
     RRF_M(inst, regs, r1, r2, m3);
     PER_ZEROADDR_LCHECK2( regs, r1, r1+1, r2, r2+1 );
@@ -2546,6 +2486,28 @@ DEF_INST(convert_utf8_to_utf32)
 
         if(utf8[0] < 0x80)
         {
+            /* Convert all but the last character of a run of ASCII
+               within the current source and destination pages at
+               once, leaving the last one to be converted below */
+            run = min( srcelen, destlen / 4 );
+            run = min( run, (GREG)(4096 - xlated) );
+            run = min( run, (GREG)(PAGEFRAME_PAGESIZE - (srce & PAGEFRAME_BYTEMASK)) );
+            run = min( run, (GREG)(PAGEFRAME_PAGESIZE - (dest & PAGEFRAME_BYTEMASK)) / 4 );
+
+            if (run > 1)
+            {
+                run = utf8_ascii_to_utf32( d1, s1, (U32) run ) - 1;
+
+                dest    += run * 4;
+                destlen -= run * 4;
+                srce    += run;
+                srcelen -= run;
+                xlated  += (int) run;
+                s1      += run;
+                d1      += run * 4;
+                utf8[0] = *s1;
+            }
+
             /* xlate range 00-7f */
             /* 0jklmnop -> 00000000 00000000 00000000 0jklmnop */
             utf32[1] = 0x00;
@@ -2831,6 +2793,8 @@ DEF_INST(convert_utf16_to_utf32)
     bool wfc;                      /* Well-Formedness-Checking (W)   */
 #endif
     int xlated;                    /* characters translated          */
+    GREG run;                      /* Characters in run              */
+    BYTE *main1, *main2;           /* Operand mainstor addresses     */
 
     RRF_M(inst, regs, r1, r2, m3);
     PER_ZEROADDR_LCHECK2( regs, r1, r1+1, r2, r2+1 );
@@ -2871,6 +2835,29 @@ DEF_INST(convert_utf16_to_utf32)
         ARCH_DEP(vfetchc)(utf16, 1, srce, r2, regs);
         if(utf16[0] <= 0xd7 || utf16[0] >= 0xdc)
         {
+            /* Convert all but the last character of a run of these
+               within the current source and destination pages at
+               once, leaving the last one to be converted below */
+            run = min( srcelen / 2, destlen / 4 );
+            run = min( run, (GREG)(4096 - xlated) / 2 );
+            run = min( run, (GREG)(PAGEFRAME_PAGESIZE - (srce & PAGEFRAME_BYTEMASK)) / 2 );
+            run = min( run, (GREG)(PAGEFRAME_PAGESIZE - (dest & PAGEFRAME_BYTEMASK)) / 4 );
+
+            if (run > 1)
+            {
+                main2 = MADDRL( srce & ADDRESS_MAXWRAP(regs), run * 2, r2, regs, ACCTYPE_READ,  regs->psw.pkey );
+                main1 = MADDRL( dest & ADDRESS_MAXWRAP(regs), run * 4, r1, regs, ACCTYPE_WRITE, regs->psw.pkey );
+                run = utf16_bmp_to_utf32( main1, main2, (U32) run ) - 1;
+
+                dest    += run * 4;
+                destlen -= run * 4;
+                srce    += run * 2;
+                srcelen -= run * 2;
+                xlated  += (int)(run * 2);
+                utf16[0] = main2[ run * 2 ];
+                utf16[1] = main2[ run * 2 + 1 ];
+            }
+
             /* xlate range 0000-d7fff and dc00-ffff */
             /* abcdefgh ijklmnop -> 00000000 00000000 abcdefgh ijklmnop */
             utf32[1] = 0x00;
@@ -2888,7 +2875,7 @@ DEF_INST(convert_utf16_to_utf32)
             }
 
             /* Fetch another 2 bytes */
-            ARCH_DEP(vfetchc)(&utf16[2], 1, srce, r2, regs);
+            ARCH_DEP(vfetchc)(&utf16[2], 1, (srce + 2) & ADDRESS_MAXWRAP(regs), r2, regs);
 
 #if defined( FEATURE_030_ETF3_ENHANCEMENT_FACILITY )
             /* WellFormednessChecking */
@@ -2940,6 +2927,8 @@ DEF_INST(convert_utf32_to_utf8)
     BYTE utf8[4];                  /* utf8 character(s)              */
     int write;                     /* Bytes written                  */
     int xlated;                    /* characters translated          */
+    GREG run;                      /* Characters in ASCII run        */
+    BYTE *main1, *main2;           /* Operand mainstor addresses     */
 
     RRE(inst, regs, r1, r2);
     PER_ZEROADDR_LCHECK2( regs, r1, r1+1, r2, r2+1 );
@@ -2978,15 +2967,34 @@ DEF_INST(convert_utf32_to_utf8)
         }
         else if(utf32[1] == 0x00)
         {
-            if(utf32[2] == 0x00)
+            if(utf32[2] == 0x00 && utf32[3] <= 0x7f)
             {
-                if(utf32[3] <= 0x7f)
+                /* Convert all but the last character of a run of ASCII
+                   within the current source and destination pages at
+                   once, leaving the last one to be converted below */
+                run = min( srcelen / 4, destlen );
+                run = min( run, (GREG)(4096 - xlated) / 4 );
+                run = min( run, (GREG)(PAGEFRAME_PAGESIZE - (srce & PAGEFRAME_BYTEMASK)) / 4 );
+                run = min( run, (GREG)(PAGEFRAME_PAGESIZE - (dest & PAGEFRAME_BYTEMASK)) );
+
+                if (run > 1)
                 {
-                    /* xlate range 00000000-0000007f */
-                    /* 00000000 00000000 00000000 0jklmnop -> 0jklmnop */
-                    utf8[0] = utf32[3];
-                    write = 1;
+                    main2 = MADDRL( srce & ADDRESS_MAXWRAP(regs), run * 4, r2, regs, ACCTYPE_READ,  regs->psw.pkey );
+                    main1 = MADDRL( dest & ADDRESS_MAXWRAP(regs), run,     r1, regs, ACCTYPE_WRITE, regs->psw.pkey );
+                    run = utf32_ascii_to_utf8( main1, main2, (U32) run ) - 1;
+
+                    dest    += run;
+                    destlen -= run;
+                    srce    += run * 4;
+                    srcelen -= run * 4;
+                    xlated  += (int)(run * 4);
+                    utf32[3] = main2[ run * 4 + 3 ];
                 }
+
+                /* xlate range 00000000-0000007f */
+                /* 00000000 00000000 00000000 0jklmnop -> 0jklmnop */
+                utf8[0] = utf32[3];
+                write = 1;
             }
             else if(utf32[2] <= 0x07)
             {
@@ -2999,8 +3007,8 @@ DEF_INST(convert_utf32_to_utf8)
 
                 /* xlate range 00000080-000007ff */
                 /* 00000000 00000000 00000fgh ijklmnop -> 110fghij 10klmnop */
-                utf8[0] = 0xc0 | (utf32[2] << 2) | (utf32[2] >> 6);
-                utf8[1] = 0x80 | (utf32[2] & 0x3f);
+                utf8[0] = 0xc0 | (utf32[2] << 2) | (utf32[3] >> 6);
+                utf8[1] = 0x80 | (utf32[3] & 0x3f);
                 write = 2;
             }
             else if(utf32[2] <= 0xd7 || utf32[2] > 0xdc)
@@ -3078,6 +3086,8 @@ DEF_INST(convert_utf32_to_utf16)
     int write;                     /* Bytes written                  */
     int xlated;                    /* characters translated          */
     BYTE zabcd;                    /* Work value                     */
+    GREG run;                      /* Characters in run              */
+    BYTE *main1, *main2;           /* Operand mainstor addresses     */
 
     RRE(inst, regs, r1, r2);
     PER_ZEROADDR_LCHECK2( regs, r1, r1+1, r2, r2+1 );
@@ -3115,6 +3125,29 @@ DEF_INST(convert_utf32_to_utf16)
         }
         else if(utf32[1] == 0x00 && (utf32[2] <= 0xd7 || utf32[2] >= 0xdc))
         {
+            /* Convert all but the last character of a run of these
+               within the current source and destination pages at
+               once, leaving the last one to be converted below */
+            run = min( srcelen / 4, destlen / 2 );
+            run = min( run, (GREG)(4096 - xlated) / 4 );
+            run = min( run, (GREG)(PAGEFRAME_PAGESIZE - (srce & PAGEFRAME_BYTEMASK)) / 4 );
+            run = min( run, (GREG)(PAGEFRAME_PAGESIZE - (dest & PAGEFRAME_BYTEMASK)) / 2 );
+
+            if (run > 1)
+            {
+                main2 = MADDRL( srce & ADDRESS_MAXWRAP(regs), run * 4, r2, regs, ACCTYPE_READ,  regs->psw.pkey );
+                main1 = MADDRL( dest & ADDRESS_MAXWRAP(regs), run * 2, r1, regs, ACCTYPE_WRITE, regs->psw.pkey );
+                run = utf32_bmp_to_utf16( main1, main2, (U32) run ) - 1;
+
+                dest    += run * 2;
+                destlen -= run * 2;
+                srce    += run * 4;
+                srcelen -= run * 4;
+                xlated  += (int)(run * 4);
+                utf32[2] = main2[ run * 4 + 2 ];
+                utf32[3] = main2[ run * 4 + 3 ];
+            }
+
             /* xlate range 00000000-0000d7ff and 0000dc00-0000ffff */
             /* 00000000 00000000 abcdefgh ijklmnop -> abcdefgh ijklmnop */
             utf16[0] = utf32[2];
@@ -3166,10 +3199,14 @@ DEF_INST(convert_utf32_to_utf16)
 DEF_INST( search_string_unicode )
 {
     VADR addr1, addr2;                  /* End/start addresses       */
-    int i;                              /* Loop counter              */
-    int r1, r2;                         /* Values of R fields        */
-    U16 sbyte;                          /* String character          */
-    U16 termchar;                       /* Terminating character     */
+    U32  i;                             /* Index of found character  */
+    U32  dist;                          /* Bytes to search this page */
+    U32  searched;                      /* Total bytes searched      */
+    bool atend;                         /* Operand end within page   */
+    int  r1, r2;                        /* Values of R fields        */
+    BYTE *main2;                        /* Operand-2 mainstor addr   */
+    U16  sbyte;                         /* String character          */
+    U16  termchar;                      /* Terminating character     */
 
     RRE( inst, regs, r1, r2 );
     PER_ZEROADDR_CHECK2( regs, r1, r2 );
@@ -3201,8 +3238,11 @@ DEF_INST( search_string_unicode )
 #undef  SRSTU_MAX
 #define SRSTU_MAX   _4K     /* (Sheesh! 256 bytes is WAY too small!) */
 
-    /* Search up to CPU-determined bytes or until end of operand */
-    for (i=0; i < SRSTU_MAX; i++)
+    /* Search at least SRSTU_MAX bytes or until end of operand, one
+       page at a time. Since both addresses now have the same parity
+       the operand end address is always at a character boundary.
+    */
+    for (searched = 0; searched < SRSTU_MAX; searched += dist)
     {
         /* If operand end address has been reached, return condition
            code 2 and leave the R1 and R2 registers unchanged
@@ -3218,23 +3258,57 @@ DEF_INST( search_string_unicode )
             return;
         }
 
-        /* Fetch 2 bytes from the operand */
-        sbyte = ARCH_DEP( vfetch2 )( addr2, r2, regs );
+        /* Number of bytes of whole characters left in this page */
+        dist = (PAGEFRAME_PAGESIZE - (addr2 & PAGEFRAME_BYTEMASK)) & ~1;
+
+        /* A character straddling the page boundary is fetched by
+           itself (possibly raising an access exception on the
+           second page, just as the byte-by-byte search would)
+        */
+        if (!dist)
+        {
+            sbyte = ARCH_DEP( vfetch2 )( addr2, r2, regs );
+
+            if (sbyte == termchar)
+            {
+                SET_GR_A( r1, regs, addr2 );
+                regs->psw.cc = 1;
+                return;
+            }
+
+            dist = 2;
+            addr2 += 2;
+            addr2 &= ADDRESS_MAXWRAP( regs );
+            continue;
+        }
+
+        /* Search no further than the end of the operand */
+        atend = (addr1 > addr2 && (addr1 - addr2) < dist);
+        if (atend)
+            dist = (U32)(addr1 - addr2);
+
+        main2 = MADDRL( addr2, dist, r2, regs, ACCTYPE_READ, regs->psw.pkey );
 
         /* If the terminating character was found, return condition
            code 1 and load the address of the character into R1 */
-        if (sbyte == termchar)
+        if ((i = mem_find_hw( main2, dist, termchar )) < dist)
         {
-            SET_GR_A( r1, regs, addr2 );
+            SET_GR_A( r1, regs, (addr2 + i) & ADDRESS_MAXWRAP( regs ));
             regs->psw.cc = 1;
             return;
         }
 
         /* Increment operand address */
-        addr2 += 2;
+        addr2 += dist;
         addr2 &= ADDRESS_MAXWRAP( regs );
 
-    } /* end for(i) */
+        if (atend)
+        {
+            regs->psw.cc = 2;
+            return;
+        }
+
+    } /* end for(searched) */
 
     /* Set R2 to point to next character of operand */
     SET_GR_A( r2, regs, addr2 );
@@ -3244,9 +3318,6 @@ DEF_INST( search_string_unicode )
 }
 
 
-#undef  MAINSTOR_PAGEBASE
-#define MAINSTOR_PAGEBASE( _ma )  ((BYTE*) ((uintptr_t) ( _ma ) & PAGEFRAME_PAGEMASK))
-
 /*-------------------------------------------------------------------*/
 /* D0   TRTR  - Translate and Test Reverse                    [SS-a] */
 /*-------------------------------------------------------------------*/
@@ -3256,14 +3327,14 @@ DEF_INST(translate_and_test_reverse)
     int cc = 0;                        // Condition code
     VADR effective_addr1;
     VADR effective_addr2;              // Effective addresses
-    int i;                             // Integer work areas
+    U32 done;                          // Bytes processed so far
+    U32 n, k;                          // Piece length, hit offset
     int len;                           // Length byte
-    BYTE sbyte;                        // Byte work areas
+    BYTE sbyte = 0;                    // Byte work areas
 
     CACHE_ALIGN BYTE  trtab[256];      // Translate table - copy
     BYTE*   p_fct;                     // ptr to FC Table
     BYTE*   m1;                        // operand mainstor addresses
-    BYTE   *m1pg;                      // operand page
 
     SS_L(inst, regs, len, b1, effective_addr1, b2, effective_addr2);
     PER_ZEROADDR_XCHECK2( regs, b1, b2 );
@@ -3281,24 +3352,24 @@ DEF_INST(translate_and_test_reverse)
         p_fct = MADDRL( effective_addr2, 256, b2, regs, ACCTYPE_READ, regs->psw.pkey );
     }
 
-    /* Get mainstor address to test byte */
-    m1 = MADDRL( effective_addr1, 1, b1, regs, ACCTYPE_READ, regs->psw.pkey );
-    m1pg = MAINSTOR_PAGEBASE ( m1 );
-
-    /* Process first operand from right to left*/
-    for(i = 0; i <= len; i++)
+    /* Process first operand from right to left, scanning the part
+       of it within each page (from its rightmost byte downward)
+       in a single pass */
+    for (done = 0; done <= (U32) len; done += n)
     {
-        /* Fetch argument byte from first operand */
-        // dbyte = ARCH_DEP(vfetchb)(effective_addr1, b1, regs);
+        /* Get mainstor address of rightmost byte of this piece */
+        m1 = MADDRL( effective_addr1, 1, b1, regs, ACCTYPE_READ, regs->psw.pkey );
 
-        /* Fetch function byte from second operand */
-        // sbyte = ARCH_DEP(vfetchb)((effective_addr2 + dbyte) & ADDRESS_MAXWRAP(regs), b2, regs);
-
-        sbyte = p_fct[ *m1 ];
+        n = min( (U32) len + 1 - done, (effective_addr1 & PAGEFRAME_BYTEMASK) + 1 );
 
         /* Test for non-zero function byte */
-        if(sbyte != 0)
+        if ((k = mem_find_fc_rev( m1 - (n - 1), n, p_fct )) < n)
         {
+            effective_addr1 -= k; /* Another difference with TRT */
+            effective_addr1 &= ADDRESS_MAXWRAP(regs);
+
+            sbyte = p_fct[ *(m1 - k) ];
+
             /* Store address of argument byte in register 1 */
 #if defined( FEATURE_001_ZARCH_INSTALLED_FACILITY )
             if(regs->psw.amode64)
@@ -3320,28 +3391,18 @@ DEF_INST(translate_and_test_reverse)
 
             /* Set condition code 2 if argument byte was last byte
              of first operand, otherwise set condition code 1 */
-            cc = (i == len) ? 2 : 1;
+            cc = (done + k == (U32) len) ? 2 : 1;
 
             /* Terminate the operation at this point */
             break;
 
         } /* end if(sbyte) */
 
-        /* Decrement first operand address */
-        effective_addr1--; /* Another difference with TRT */
+        /* Decrement first operand address past this piece */
+        effective_addr1 -= n;
         effective_addr1 &= ADDRESS_MAXWRAP(regs);
 
-        /* update mainstor address */
-        m1--;
-
-        /* check for page cross */
-        if ( MAINSTOR_PAGEBASE ( m1 ) != m1pg )
-        {
-            m1 = MADDRL(effective_addr1, 1, b1, regs, ACCTYPE_READ, regs->psw.pkey );
-            m1pg = MAINSTOR_PAGEBASE ( m1 );
-        }
-
-    } /* end for(i) */
+    } /* end for(done) */
 
     /* Update the condition code */
     regs->psw.cc = cc;
@@ -3399,6 +3460,10 @@ DEF_INST( translate_and_test_xxx_extended )
     VADR  fct_work_page_addr;   /* Work                              */
     VADR  fct_work_end_addr;    /* Work                              */
 
+    BYTE* fct_main;             /* Fast path: FC table mainstor addr */
+    U32   scan_len;             /* Fast path: bytes to scan          */
+    U32   skipped;              /* Fast path: bytes with zero FC     */
+
     CACHE_ALIGN                 /* FC Table - direct mainstor addrs  */
     BYTE* fct_main_page_addr[ FCT_REAL_MAX_PAGES ];
 
@@ -3487,6 +3552,44 @@ DEF_INST( translate_and_test_xxx_extended )
 
     fc = 0;
     processed = 0;
+
+    /* Fast path: with one-byte arguments and one-byte function codes
+       from a function code table which doesn't cross a page boundary
+       the on-page part of the first operand is scanned in one pass.
+       The below loop then has nothing left to do but is still used
+       for all other argument and function code formats.
+    */
+    if (1
+        && !a_bit
+        && !f_bit
+        && NOCROSSPAGE( fct_addr, 256-1 )
+    )
+    {
+        fct_main = fct_main_page_addr[0] + (fct_addr & PAGEFRAME_BYTEMASK);
+        scan_len = (U32) min( buf_len, (GREG) max_process );
+
+        if (isReverse)
+        {
+            if ((skipped = mem_find_fc_rev( buf_main_addr - (scan_len - 1), scan_len, fct_main )) < scan_len)
+                fc = fct_main[ *(buf_main_addr - skipped) ];
+
+            buf_main_addr  -=  skipped;
+            buf_addr       -=  skipped;
+        }
+        else
+        {
+            if ((skipped = mem_find_fc( buf_main_addr, scan_len, fct_main )) < scan_len)
+                fc = fct_main[ *(buf_main_addr + skipped) ];
+
+            buf_main_addr  +=  skipped;
+            buf_addr       +=  skipped;
+        }
+
+        processed  = skipped;
+        buf_len   -= skipped;
+        buf_addr  &= ADDRESS_MAXWRAP( regs );
+    }
+
     while (buf_len && !fc && processed < max_process)
     {
         if (a_bit)
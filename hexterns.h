@@ -250,6 +250,8 @@ IMPL_DLL_IMPORT void registerLogCallback(LOGCALLBACK);
 IMPL_DLL_IMPORT COMMANDHANDLER getCommandHandler(void);
 
 /* Functions in module timer.c */
+TOD   update_cpu_timer( void );
+void  arm_timer_deadline( TOD deadline );
 void* timer_thread( void* argp );
 #if defined( _FEATURE_073_TRANSACT_EXEC_FACILITY )
 void* rubato_thread( void* argp );
@@ -7818,16 +7818,7 @@ REGS *regs;
     if (argc < 3 || '*' == *(loadaddr = argv[2]))
     {
         /* Locate the first modified (changed) page */
-        for
-        (
-            aaddr = 0;
-            aaddr < sysblk.mainsize
-                && !(ARCH_DEP( get_4K_storage_key )( aaddr ) & STORKEY_CHANGE);
-            aaddr += STORAGE_KEY_4K_PAGESIZE
-        )
-        {
-            ;   /* (nop) */
-        }
+        aaddr = _find_next_storekey( 0, sysblk.mainsize, STORKEY_CHANGE );
 
         if (aaddr >= sysblk.mainsize)
             aaddr = 0;
@@ -7848,17 +7839,9 @@ REGS *regs;
     if (argc < 4 || '*' == *(loadaddr = argv[3]))
     {
         /* Locate the last modified (changed) page */
-        for
-        (
-            aaddr2 = sysblk.mainsize - STORAGE_KEY_4K_PAGESIZE;
-            aaddr2 > 0
-              && !(ARCH_DEP( get_4K_storage_key )( aaddr2 ) & STORKEY_CHANGE);
-            aaddr2 -= STORAGE_KEY_4K_PAGESIZE)
-        {
-            ;   /* (nop) */
-        }
+        aaddr2 = _find_prev_storekey( 0, sysblk.mainsize, STORKEY_CHANGE );
 
-        if (ARCH_DEP( get_4K_storage_key )( aaddr2 ) & STORKEY_CHANGE)
+        if (aaddr2 < sysblk.mainsize)
             aaddr2 |= 0xFFF;
         else
         {
@@ -2763,11 +2763,11 @@ int i_cmd( int argc, char* argv[], char* cmdline )
 /* Definition of opcode execution count entries                      */
 /*-------------------------------------------------------------------*/
 typedef struct {
-    unsigned char opcode1; // Operation code, first byte
-    unsigned char opcode2; // Operation code, second byte
-    U8 opc2pos;            // Opcode2 position in Instr
-    U64 count;             // Execution count from sysblk.imaps.imap??
-    U64 time;              // Execution time
+    BYTE inst[6];          // Fake instruction (opcode bytes only)
+    char opcode[5];        // Opcode as printable hex ('A7A', 'E304')
+    U64 count;             // Execution count summed over all CPUs
+    U64 samples;           // Number of timed executions
+    U64 time;              // Total sampled execution time (TOD units)
 } ICOUNT_INSTR;
 
 /*-------------------------------------------------------------------*/
@@ -2778,7 +2778,188 @@ static int icount_cmd_sort(const void *x, const void *y)
     const ICOUNT_INSTR *X = (const ICOUNT_INSTR *) x;
     const ICOUNT_INSTR *Y = (const ICOUNT_INSTR *) y;
 
-    return (X->count < Y->count) ? +1 : -1;
+    return (X->count < Y->count) ? +1 : (X->count > Y->count) ? -1 : 0;
+}
+
+/*-------------------------------------------------------------------*/
+/* Average sampled nanoseconds per execution of an instruction       */
+/*-------------------------------------------------------------------*/
+static U64 icount_avg_nsecs( const ICOUNT_INSTR* icount )
+{
+    /* (TOD clock bit 59 = 1 microsecond, i.e. 16 units = 1000 ns) */
+    return icount->samples ? (icount->time * 125 / 2) / icount->samples : 0;
+}
+
+/*-------------------------------------------------------------------*/
+/* Build fake instruction and printable opcode for a counter slot    */
+/*-------------------------------------------------------------------*/
+static void icount_slot_opcode( int arch_mode, int slot, ICOUNT_INSTR* icount )
+{
+    BYTE  xop  = slot & 0xFF;
+
+    memset( icount->inst, 0, sizeof( icount->inst ));
+
+    switch (slot >> 8)
+    {
+#define ICOUNT_EXT( _name, _opcode, _pos, _mask )                   \
+                                                                    \
+        case ICOUNT_PAGE_ ## _name:                                 \
+                                                                    \
+            icount->inst[0]      = _opcode;                         \
+            icount->inst[ _pos ] = xop;                             \
+                                                                    \
+            if (_mask == 0x0F)                                      \
+                MSGBUF( icount->opcode, "%2.2X%1.1X", _opcode, xop );\
+            else                                                    \
+                MSGBUF( icount->opcode, "%2.2X%2.2X", _opcode, xop );\
+            break;
+
+        ICOUNT_EXT_OPCODES
+#undef  ICOUNT_EXT
+
+        case ICOUNT_PAGE_E6:
+
+            icount->inst[0] = 0xE6;
+            icount->inst[ ICOUNT_E6_POS( arch_mode )] = xop;
+            MSGBUF( icount->opcode, "E6%2.2X", xop );
+            break;
+
+        default: // ICOUNT_PAGE_xx
+
+            icount->inst[0] = xop;
+            MSGBUF( icount->opcode, "%2.2X", xop );
+            break;
+    }
+}
+
+/*-------------------------------------------------------------------*/
+/* Sum all CPU's counters into a sorted list of executed opcodes     */
+/*-------------------------------------------------------------------*/
+static int icount_collect( int arch_mode, ICOUNT_INSTR* icount, U64* total )
+{
+    ICOUNT_MAP*  map;
+    int  cpu, slot, i = 0;
+
+    *total = 0;
+
+    for (slot=0; slot < ICOUNT_SLOTS; slot++)
+    {
+        memset( &icount[i], 0, sizeof( ICOUNT_INSTR ));
+
+        for (cpu=0; cpu < sysblk.maxcpu; cpu++)
+        {
+            if (!(map = sysblk.icount_map[ cpu ]))
+                continue;
+
+            icount[i].count   += map->count  [ slot ];
+            icount[i].samples += map->samples[ slot ];
+            icount[i].time    += map->time   [ slot ];
+        }
+
+        if (icount[i].count)
+        {
+            icount_slot_opcode( arch_mode, slot, &icount[i] );
+            *total += icount[i++].count;
+        }
+    }
+
+    qsort( icount, i, sizeof( ICOUNT_INSTR ), icount_cmd_sort );
+    return i;
+}
+
+/*-------------------------------------------------------------------*/
+/* Split printed instruction into its mnemonic and function name     */
+/*-------------------------------------------------------------------*/
+static void icount_names( int arch_mode, ICOUNT_INSTR* icount,
+                          char* mnemonic, size_t mnemsize,
+                          char* name,     size_t namesize )
+{
+    char  buf[ 128 ];
+    char* p;
+
+    PRINT_INST( arch_mode, icount->inst, buf );
+
+    /* "Mnemonic operands    instruction_function_name" */
+    strlcpy( mnemonic, buf, mnemsize );
+    if ((p = strchr( mnemonic, ' ' )))
+        *p = 0;
+
+    rtrim( buf, " " );
+    p = strrchr( buf, ' ' );
+    strlcpy( name, p ? p+1 : "", namesize );
+}
+
+/*-------------------------------------------------------------------*/
+/* Export instruction counts to a CSV or JSON file                   */
+/*-------------------------------------------------------------------*/
+static int icount_export( int arch_mode, const char* filename, bool json )
+{
+    ICOUNT_INSTR*  icount;
+    FILE*  fp;
+    U64    total;
+    int    i, n;
+    char   mnemonic[ 16 ];
+    char   name[ 80 ];
+    char   pathname[ MAX_PATH ];
+    char   msgbuf[ 64 + MAX_PATH ];
+
+    if (!(icount = calloc( ICOUNT_SLOTS, sizeof( ICOUNT_INSTR ))))
+    {
+        // "Error in function %s: %s"
+        WRMSG( HHC01430, "E", "calloc()", strerror( errno ));
+        return -1;
+    }
+
+    hostpath( pathname, filename, sizeof( pathname ));
+
+    if (!(fp = fopen( pathname, "w" )))
+    {
+        // "Error in function %s: %s"
+        WRMSG( HHC01430, "E", "fopen()", strerror( errno ));
+        free( icount );
+        return -1;
+    }
+
+    n = icount_collect( arch_mode, icount, &total );
+
+    if (json)
+        fprintf( fp, "{\n  \"arch\": \"%s\",\n  \"total\": %"PRIu64",\n"
+                     "  \"rate\": %"PRIu32",\n  \"instructions\": [\n",
+                     get_arch_name_by_arch( arch_mode ), total,
+                     sysblk.icount_rate );
+    else
+        fprintf( fp, "opcode,mnemonic,name,count,percent,samples,avg_nsecs\n" );
+
+    for (i=0; i < n; i++)
+    {
+        icount_names( arch_mode, &icount[i], mnemonic, sizeof( mnemonic ),
+                                             name,     sizeof( name     ));
+        if (json)
+            fprintf( fp, "    { \"opcode\": \"%s\", \"mnemonic\": \"%s\","
+                         " \"name\": \"%s\", \"count\": %"PRIu64","
+                         " \"percent\": %.4f, \"samples\": %"PRIu64","
+                         " \"avg_nsecs\": %"PRIu64" }%s\n",
+                         icount[i].opcode, mnemonic, name, icount[i].count,
+                         (double) icount[i].count * 100 / total,
+                         icount[i].samples, icount_avg_nsecs( &icount[i] ),
+                         i < (n-1) ? "," : "" );
+        else
+            fprintf( fp, "%s,%s,%s,%"PRIu64",%.4f,%"PRIu64",%"PRIu64"\n",
+                         icount[i].opcode, mnemonic, name, icount[i].count,
+                         (double) icount[i].count * 100 / total,
+                         icount[i].samples, icount_avg_nsecs( &icount[i] ));
+    }
+
+    if (json)
+        fprintf( fp, "  ]\n}\n" );
+
+    VERIFY( 0 == fclose( fp ));
+    free( icount );
+
+    MSGBUF( msgbuf, "%d opcodes exported to %s", n, pathname );
+    // "%s"
+    WRMSG( HHC02292, "I", msgbuf );
+    return 0;
 }
 
 /*-------------------------------------------------------------------*/
@@ -2786,20 +2967,14 @@ static int icount_cmd_sort(const void *x, const void *y)
 /*-------------------------------------------------------------------*/
 int icount_cmd( int argc, char* argv[], char* cmdline )
 {
-    int i, i1, i2;
-    REGS *regs;
-    BYTE fakeinst[6];
-
-#define  MAX_ICOUNT_INSTR   1000    /* Maximum number of instructions
-                                     in architecture instruction set */
+    int i, n, cpu;
     U64  total;
 
-    ICOUNT_INSTR icount[MAX_ICOUNT_INSTR];
+    ICOUNT_INSTR*  icount;
 
-    char buf[ 192 ];
-    char instText[ 7 ];
-
-    regs = sysblk.regs[sysblk.pcpu];
+    char buf[ 256 ];
+    char mnemonic[ 16 ];
+    char name[ 80 ];
 
     UNREFERENCED( cmdline );
 
@@ -2807,19 +2982,21 @@ int icount_cmd( int argc, char* argv[], char* cmdline )
 
     if (argc > 1)
     {
-        if (argc > 2)
-        {
-            // "Invalid argument(s). Type 'help %s' for assistance."
-            WRMSG( HHC02211, "E", argv[0] );
-            return -1;
-        }
         if (0
             || CMD( argv[1], CLEAR, 1 )
             || CMD( argv[1], RESET, 1 )
             || CMD( argv[1], ZERO,  1 )
         )
         {
-            memset( &sysblk.imaps, 0, sizeof sysblk.imaps );
+            if (argc > 2)
+            {
+                // "Invalid argument(s). Type 'help %s' for assistance."
+                WRMSG( HHC02211, "E", argv[0] );
+                return -1;
+            }
+            for (cpu=0; cpu < MAX_CPU_ENGS; cpu++)
+                if (sysblk.icount_map[ cpu ])
+                    memset( sysblk.icount_map[ cpu ], 0, sizeof( ICOUNT_MAP ));
             // "%-14s set to %s"
             WRMSG( HHC02204, "I", argv[0], "ZERO" );
             return 0;
@@ -2829,6 +3006,29 @@ int icount_cmd( int argc, char* argv[], char* cmdline )
             || CMD( argv[1], START,  3 )
         )
         {
+            if (argc > 2)
+            {
+                // "Invalid argument(s). Type 'help %s' for assistance."
+                WRMSG( HHC02211, "E", argv[0] );
+                return -1;
+            }
+
+            /* Each CPU gets its own set of counters which, once
+               allocated, remain allocated for the life of Hercules
+               so CPUs never need to synchronize with this command. */
+            for (cpu=0; cpu < sysblk.maxcpu; cpu++)
+            {
+                if (sysblk.icount_map[ cpu ])
+                    continue;
+
+                if (!(sysblk.icount_map[ cpu ] =
+                    calloc_aligned( sizeof( ICOUNT_MAP ), _4K )))
+                {
+                    // "Error in function %s: %s"
+                    WRMSG( HHC01430, "E", "calloc_aligned()", strerror( errno ));
+                    return -1;
+                }
+            }
             sysblk.icount = true;
             // "%-14s set to %s"
             WRMSG( HHC02204, "I", argv[0], "ENABLE" );
@@ -2839,170 +3039,426 @@ int icount_cmd( int argc, char* argv[], char* cmdline )
             || CMD( argv[1], STOP,    3 )
         )
         {
+            if (argc > 2)
+            {
+                // "Invalid argument(s). Type 'help %s' for assistance."
+                WRMSG( HHC02211, "E", argv[0] );
+                return -1;
+            }
             sysblk.icount = false;
             // "%-14s set to %s"
             WRMSG( HHC02204, "I", argv[0], "DISABLE" );
             return 0;
         }
+        if (CMD( argv[1], RATE, 2 ))
+        {
+            U32  rate;
+            BYTE c;
+
+            if (argc == 2)
+            {
+                MSGBUF( buf, "%"PRIu32, sysblk.icount_rate );
+                // "%-14s: %s"
+                WRMSG( HHC02203, "I", "icount rate", buf );
+                return 0;
+            }
+            if (0
+                || argc > 3
+                || sscanf( argv[2], "%"SCNu32"%c", &rate, &c ) != 1
+                || !rate
+            )
+            {
+                // "Invalid argument %s%s"
+                WRMSG( HHC02205, "E", argv[2], "" );
+                return -1;
+            }
+            sysblk.icount_rate = rate;
+            // "%-14s set to %s"
+            WRMSG( HHC02204, "I", "icount rate", argv[2] );
+            return 0;
+        }
+        if (CMD( argv[1], EXPORT, 3 ))
+        {
+            bool json;
+            const char* ext;
+
+            if (argc < 3 || argc > 4)
+            {
+                // "Invalid argument(s). Type 'help %s' for assistance."
+                WRMSG( HHC02211, "E", argv[0] );
+                return -1;
+            }
+
+            /* Format is either specified or implied by file extension */
+            if (argc > 3)
+            {
+                if (CMD( argv[3], JSON, 1 ))
+                    json = true;
+                else if (CMD( argv[3], CSV, 1 ))
+                    json = false;
+                else
+                {
+                    // "Invalid argument %s%s"
+                    WRMSG( HHC02205, "E", argv[3], "" );
+                    return -1;
+                }
+            }
+            else
+                json = ((ext = strrchr( argv[2], '.' )) && strcasecmp( ext, ".json" ) == 0);
+
+            return icount_export( sysblk.arch_mode, argv[2], json );
+        }
         // "Invalid argument %s%s"
         WRMSG( HHC02205, "E", argv[1], "" );
         return -1;
     }
 
-    /* (collect...) */
+    /* (collect and sort...) */
 
-    i = 0;
-    total = 0;
+    if (!(icount = calloc( ICOUNT_SLOTS, sizeof( ICOUNT_INSTR ))))
+    {
+        // "Error in function %s: %s"
+        WRMSG( HHC01430, "E", "calloc()", strerror( errno ));
+        return -1;
+    }
+
+    n = icount_collect( sysblk.arch_mode, icount, &total );
+
+#define  ICOUNT_WIDTH  "12"     /* Print field width */
 
-    for (i1 = 0; i1 < 256; i1++)
+    /* (print...) */
+
+    // "%s"
+    WRMSG( HHC02292, "I", "Sorted icount display:" );
+
+    for (i=0; i < n; i++)
     {
-        switch (i1)
-        {
-#define ICOUNT_COLLECT_CASE( _case, _map, _mapT, _nn, _pos )        \
-                                                                    \
-            case _case:                                             \
-            {                                                       \
-                for (i2=0; i2 < _nn; i2++)                          \
-                {                                                   \
-                    if (sysblk.imaps._map[ i2 ])                    \
-                    {                                               \
-                        icount[i].opcode1 = i1;                     \
-                        icount[i].opcode2 = i2;                     \
-                        icount[i].opc2pos = _pos;                   \
-                        icount[i].time = sysblk.imaps._mapT[ i2 ];  \
-                        icount[i++].count = sysblk.imaps._map[ i2 ];\
-                        total += sysblk.imaps._map[ i2 ];           \
-                                                                    \
-                        if (i == (MAX_ICOUNT_INSTR - 1))            \
-                        {                                           \
-                            /* "Too many instructions! (Sorry!)" */ \
-                            WRMSG( HHC02252, "E" );                 \
-                            return -1;                              \
-                        }                                           \
-                    }                                               \
-                }                                                   \
-                break;                                              \
-            }
+        icount_names( sysblk.arch_mode, &icount[i], mnemonic, sizeof( mnemonic ),
+                                                     name,     sizeof( name     ));
+        MSGBUF
+        (
+            buf,
+            "Inst %-6s count %" ICOUNT_WIDTH PRIu64 " (%2d%%) avg %8" PRIu64 " ns  %-8s %s",
+            icount[i].opcode,
+            icount[i].count,
+            (int)(icount[i].count * 100 / total),
+            icount_avg_nsecs( &icount[i] ),
+            mnemonic,
+            name
+        );
+        WRMSG( HHC02292, "I", buf );
+    }
+    /* end for() */
 
-            ICOUNT_COLLECT_CASE( 0x01, imap01, imap01T, 256, 1 )
-            ICOUNT_COLLECT_CASE( 0xA4, imapa4, imapa4T, 256, 1 )
-            ICOUNT_COLLECT_CASE( 0xA5, imapa5, imapa5T,  16, 1 )
-            ICOUNT_COLLECT_CASE( 0xA6, imapa6, imapa6T, 256, 1 )
-            ICOUNT_COLLECT_CASE( 0xA7, imapa7, imapa7T,  16, 1 )
-            ICOUNT_COLLECT_CASE( 0xB2, imapb2, imapb2T, 256, 1 )
-            ICOUNT_COLLECT_CASE( 0xB3, imapb3, imapb3T, 256, 1 )
-            ICOUNT_COLLECT_CASE( 0xB9, imapb9, imapb9T, 256, 1 )
-            ICOUNT_COLLECT_CASE( 0xC0, imapc0, imapc0T,  16, 1 )
-            ICOUNT_COLLECT_CASE( 0xC2, imapc2, imapc2T,  16, 1 )
-            ICOUNT_COLLECT_CASE( 0xC4, imapc4, imapc4T,  16, 1 )
-            ICOUNT_COLLECT_CASE( 0xC6, imapc6, imapc6T,  16, 1 )
-            ICOUNT_COLLECT_CASE( 0xC8, imapc8, imapc8T,  16, 1 )
-            ICOUNT_COLLECT_CASE( 0xE3, imape3, imape3T, 256, 5 )
-            ICOUNT_COLLECT_CASE( 0xE4, imape4, imape4T, 256, 1 )
-            ICOUNT_COLLECT_CASE( 0xE5, imape5, imape5T, 256, 1 )
-            ICOUNT_COLLECT_CASE( 0xE6, imape6, imape6T, 256, 5 )
-            ICOUNT_COLLECT_CASE( 0xE7, imape7, imape7T, 256, 5 )
-            ICOUNT_COLLECT_CASE( 0xEB, imapeb, imapebT, 256, 5 )
-            ICOUNT_COLLECT_CASE( 0xEC, imapec, imapecT, 256, 5 )
-            ICOUNT_COLLECT_CASE( 0xED, imaped, imapedT, 256, 5 )
-
-            default:
-            {
+    free( icount );
+    return 0;
+}
+#endif /* defined( OPTION_INSTR_COUNT_AND_TIME ) */
 
-                if (sysblk.imaps.imapxx[ i1 ])
-                {
-                    icount[i].opcode1 = i1;
-                    icount[i].opcode2 = 0;
-                    icount[i].opc2pos = 0;
-                    icount[i].time = sysblk.imaps.imapxxT[ i1 ];
-                    icount[i++].count = sysblk.imaps.imapxx[i1];
 
-                    total += sysblk.imaps.imapxx[ i1 ];
+/*-------------------------------------------------------------------*/
+/* psample sort callback (groups identical stacks together)          */
+/*-------------------------------------------------------------------*/
+static int psample_sort( const void* x, const void* y )
+{
+    const PSAMPLE* X = (const PSAMPLE*) x;
+    const PSAMPLE* Y = (const PSAMPLE*) y;
+    int  rc;
+
+    if (X->flags     != Y->flags)     return X->flags     < Y->flags     ? -1 : +1;
+    if (X->asid      != Y->asid)      return X->asid      < Y->asid      ? -1 : +1;
+    if (X->asce      != Y->asce)      return X->asce      < Y->asce      ? -1 : +1;
+    if (X->depth     != Y->depth)     return X->depth     < Y->depth     ? -1 : +1;
+    if ((rc = memcmp( X->frame, Y->frame, X->depth * sizeof( U64 ))))   return rc;
+    if (X->ia        != Y->ia)        return X->ia        < Y->ia        ? -1 : +1;
+    return 0;
+}
 
-                    if (i == (MAX_ICOUNT_INSTR - 1))
-                    {
-                        // "Too many instructions! (Sorry!)"
-                        WRMSG( HHC02252, "E" );
-                        return -1;
-                    }
-                }
-                break;
-            }
+/*-------------------------------------------------------------------*/
+/* Format one address for a folded stack frame                       */
+/*-------------------------------------------------------------------*/
+static const char* psample_addr( const PSAMPLE* ent, U64 addr, char* buf, size_t bufsz )
+{
+    if (ent->arch_mode == ARCH_900_IDX)
+        snprintf( buf, bufsz, "%16.16"PRIX64, addr );
+    else
+        snprintf( buf, bufsz, "%8.8"PRIX32, (U32) addr );
+    return buf;
+}
+
+/*-------------------------------------------------------------------*/
+/* Write all CPU's samples to a file as folded stacks                */
+/*-------------------------------------------------------------------*/
+static int psample_dump( const char* filename, U64 gran )
+{
+    PSAMPLE_RING*  ring;
+    PSAMPLE*  samples;
+    PSAMPLE*  ent;
+    FILE*  fp;
+    U64    count, total;
+    int    cpu, i, k, n = 0, stacks = 0;
+    char   addr[ 32 ];
+    char   pathname[ MAX_PATH ];
+    char   msgbuf[ 64 + MAX_PATH ];
+
+    for (total=0, cpu=0; cpu < sysblk.maxcpu; cpu++)
+        if ((ring = sysblk.psample_ring[ cpu ]))
+            total += MIN( ring->count, ring->size );
+
+    if (!(samples = malloc( (size_t) (total ? total : 1) * sizeof( PSAMPLE ))))
+    {
+        // "Error in function %s: %s"
+        WRMSG( HHC01430, "E", "malloc()", strerror( errno ));
+        return -1;
+    }
+
+    hostpath( pathname, filename, sizeof( pathname ));
+
+    if (!(fp = fopen( pathname, "w" )))
+    {
+        // "Error in function %s: %s"
+        WRMSG( HHC01430, "E", "fopen()", strerror( errno ));
+        free( samples );
+        return -1;
+    }
+
+    /* Snapshot each CPU's ring (CPUs keep sampling meanwhile) */
+    for (cpu=0; cpu < sysblk.maxcpu; cpu++)
+    {
+        if (!(ring = sysblk.psample_ring[ cpu ]))
+            continue;
+
+        count = MIN( ring->count, ring->size );
+
+        /* (don't overrun if a CPU's ring filled up since counting) */
+        count = MIN( count, (U64) (total - n) );
+        memcpy( &samples[n], ring->ent, (size_t) count * sizeof( PSAMPLE ));
+
+        /* Normalize what isn't part of the folded stack */
+        for (i=0; i < (int) count; i++)
+        {
+            samples[n+i].flags &= PSAMPLE_SIE;
+            samples[n+i].ia    &= ~(gran - 1);
+            samples[n+i].depth  = MIN( samples[n+i].depth, MAX_PSAMPLE_DEPTH );
         }
-        /* end switch() */
+        n += (int) count;
     }
-    /* end for() */
 
-    /* (sort...) */
-    qsort(icount, i, sizeof(ICOUNT_INSTR), icount_cmd_sort);
+    qsort( samples, n, sizeof( PSAMPLE ), psample_sort );
 
-#define  ICOUNT_WIDTH  "12"     /* Print field width */
+    /* "[SIE;]ASID;ASCE;outermost;...;innermost;IA count" */
+    for (i=0; i < n; i += (int) count)
+    {
+        ent = &samples[i];
 
-    /* (print...) */
+        count = 1;
+        while (i + count < (U64) n && psample_sort( ent, &samples[ i + count ]) == 0)
+            count++;
+
+        if (ent->flags & PSAMPLE_SIE)
+            fprintf( fp, "SIE;" );
+
+        fprintf( fp, "ASID_%4.4X;", ent->asid );
+        fprintf( fp, "ASCE_%s;", psample_addr( ent, ent->asce, addr, sizeof( addr )));
+
+        for (k = ent->depth - 1; k >= 0; k--)
+            fprintf( fp, "R_%s;", psample_addr( ent, ent->frame[k], addr, sizeof( addr )));
+
+        fprintf( fp, "IA_%s %"PRIu64"\n", psample_addr( ent, ent->ia, addr, sizeof( addr )), count );
+        stacks++;
+    }
+
+    VERIFY( 0 == fclose( fp ));
+    free( samples );
 
+    MSGBUF( msgbuf, "%d samples in %d stacks written to %s", n, stacks, pathname );
     // "%s"
-    WRMSG( HHC02292, "I", "Sorted icount display:" );
+    WRMSG( HHC02292, "I", msgbuf );
+    return 0;
+}
+
+/*-------------------------------------------------------------------*/
+/* Parse a decimal psample operand within a range                    */
+/*-------------------------------------------------------------------*/
+static int psample_value( const char* arg, U32 lo, U32 hi, U32* value )
+{
+    BYTE c;
+
+    if (0
+        || sscanf( arg, "%"SCNu32"%c", value, &c ) != 1
+        || *value < lo
+        || *value > hi
+    )
+    {
+        // "Invalid argument %s%s"
+        WRMSG( HHC02205, "E", arg, "" );
+        return -1;
+    }
+    return 0;
+}
+
+/*-------------------------------------------------------------------*/
+/* psample command - sample guest PSWs for flame graphs              */
+/*-------------------------------------------------------------------*/
+int psample_cmd( int argc, char* argv[], char* cmdline )
+{
+    int   cpu;
+    U32   value;
+    U64   total = 0;
+    char  buf[ 128 ];
+
+    UNREFERENCED( cmdline );
+
+    UPPER_ARGV_0( argv );
+
+    if (argc > 1)
+    {
+        if (CMD( argv[1], CLEAR, 1 ))
+        {
+            if (argc > 2)
+            {
+                // "Invalid argument(s). Type 'help %s' for assistance."
+                WRMSG( HHC02211, "E", argv[0] );
+                return -1;
+            }
+            for (cpu=0; cpu < MAX_CPU_ENGS; cpu++)
+                if (sysblk.psample_ring[ cpu ])
+                    sysblk.psample_ring[ cpu ]->count = 0;
+            // "%-14s set to %s"
+            WRMSG( HHC02204, "I", argv[0], "CLEAR" );
+            return 0;
+        }
+        if (0
+            || CMD( argv[1], ENABLE, 1 )
+            || CMD( argv[1], START,  3 )
+        )
+        {
+            if (argc > 3)
+            {
+                // "Invalid argument(s). Type 'help %s' for assistance."
+                WRMSG( HHC02211, "E", argv[0] );
+                return -1;
+            }
+            if (argc > 2)
+            {
+                if (psample_value( argv[2], 1, MAX_PSAMPLE_RATE, &value ) != 0)
+                    return -1;
+                sysblk.psample_rate = value;
+            }
 
-    for (i1 = 0; i1 < i; i1++)
-    {
-        memset(fakeinst, 0, sizeof(fakeinst));
-        int bufl = 0;
-
-        switch (icount[i1].opcode1)
-        {
-            case 0x01:
-            case 0xA4:
-            case 0xA5:
-            case 0xA6:
-            case 0xA7:
-            case 0xB2:
-            case 0xB3:
-            case 0xB9:
-            case 0xC0:
-            case 0xC2:
-            case 0xC4:
-            case 0xC6:
-            case 0xC8:
-            case 0xE3:
-            case 0xE4:
-            case 0xE5:
-            case 0xE6:
-            case 0xE7:
-            case 0xEB:
-            case 0xEC:
-            case 0xED:
+            /* Like icount, each CPU's ring once allocated remains so
+               for the life of Hercules so that CPUs never need to
+               synchronize with this command. */
+            for (cpu=0; cpu < sysblk.maxcpu; cpu++)
             {
-                MSGBUF( instText, "'%2.2X%2.2X'", icount[i1].opcode1, icount[i1].opcode2 );
-                fakeinst[icount[i1].opc2pos] = icount[i1].opcode2;
-                break;
+                if (sysblk.psample_ring[ cpu ])
+                    continue;
+
+                if (!(sysblk.psample_ring[ cpu ] = calloc_aligned(
+                    sizeof( PSAMPLE_RING ) + (PSAMPLE_ENTRIES - 1) * sizeof( PSAMPLE ), _4K )))
+                {
+                    // "Error in function %s: %s"
+                    WRMSG( HHC01430, "E", "calloc_aligned()", strerror( errno ));
+                    return -1;
+                }
+                sysblk.psample_ring[ cpu ]->size = PSAMPLE_ENTRIES;
             }
-            default:
+            sysblk.psample_next = 0;
+            sysblk.psample = true;
+            // "%-14s set to %s"
+            WRMSG( HHC02204, "I", argv[0], "ENABLE" );
+            return 0;
+        }
+        if (0
+            || CMD( argv[1], DISABLE, 1 )
+            || CMD( argv[1], STOP,    3 )
+        )
+        {
+            if (argc > 2)
             {
-                MSGBUF( instText, "'%2.2X'  ", icount[i1].opcode1 );
-                break;
+                // "Invalid argument(s). Type 'help %s' for assistance."
+                WRMSG( HHC02211, "E", argv[0] );
+                return -1;
             }
+            sysblk.psample = false;
+            // "%-14s set to %s"
+            WRMSG( HHC02204, "I", argv[0], "DISABLE" );
+            return 0;
         }
+        if (CMD( argv[1], RATE, 2 ) || CMD( argv[1], DEPTH, 3 ))
+        {
+            bool rate = CMD( argv[1], RATE, 2 );
 
-        bufl = MSGBUF
-        (
-            buf,
-            "Inst %s count %" ICOUNT_WIDTH PRIu64 " (%2d%%) time %" ICOUNT_WIDTH PRIu64 " (%10f) ",
-            instText,
-            icount[i1].count,
-            (int)(icount[i1].count * 100 / total),
-            icount[i1].time,
-            ((float)icount[i1].time / icount[i1].count)
-        );
+            if (argc == 2)
+            {
+                MSGBUF( buf, "%"PRIu32, rate ? sysblk.psample_rate
+                                             : sysblk.psample_depth );
+                // "%-14s: %s"
+                WRMSG( HHC02203, "I", rate ? "psample rate" : "psample depth", buf );
+                return 0;
+            }
+            if (argc > 3)
+            {
+                // "Invalid argument(s). Type 'help %s' for assistance."
+                WRMSG( HHC02211, "E", argv[0] );
+                return -1;
+            }
+            if (rate)
+            {
+                if (psample_value( argv[2], 1, MAX_PSAMPLE_RATE, &value ) != 0)
+                    return -1;
+                sysblk.psample_rate = value;
+            }
+            else
+            {
+                if (psample_value( argv[2], 0, MAX_PSAMPLE_DEPTH, &value ) != 0)
+                    return -1;
+                sysblk.psample_depth = value;
+            }
+            // "%-14s set to %s"
+            WRMSG( HHC02204, "I", rate ? "psample rate" : "psample depth", argv[2] );
+            return 0;
+        }
+        if (CMD( argv[1], DUMP, 4 ))
+        {
+            U64  gran = 1;
 
-        fakeinst[0] = icount[i1].opcode1;
-        bufl += PRINT_INST(regs->arch_mode, fakeinst, buf + bufl);
-        WRMSG( HHC02292, "I", buf );
+            if (argc < 3 || argc > 4)
+            {
+                // "Invalid argument(s). Type 'help %s' for assistance."
+                WRMSG( HHC02211, "E", argv[0] );
+                return -1;
+            }
+            if (argc > 3)
+            {
+                if (psample_value( argv[3], 1, 0x80000000, &value ) != 0)
+                    return -1;
+                if (value & (value - 1))
+                {
+                    // "Invalid argument %s%s"
+                    WRMSG( HHC02205, "E", argv[3], "; must be a power of 2" );
+                    return -1;
+                }
+                gran = value;
+            }
+            return psample_dump( argv[2], gran );
+        }
+        // "Invalid argument %s%s"
+        WRMSG( HHC02205, "E", argv[1], "" );
+        return -1;
     }
-    /* end for() */
 
+    for (cpu=0; cpu < MAX_CPU_ENGS; cpu++)
+        if (sysblk.psample_ring[ cpu ])
+            total += MIN( sysblk.psample_ring[ cpu ]->count, PSAMPLE_ENTRIES );
+
+    MSGBUF( buf, "PSW sampling %s, rate %"PRIu32"/sec, depth %"PRIu32", %"PRIu64" samples",
+        sysblk.psample ? "ENABLED" : "DISABLED",
+        sysblk.psample_rate, sysblk.psample_depth, total );
+    // "%s"
+    WRMSG( HHC02292, "I", buf );
     return 0;
 }
-#endif /* defined( OPTION_INSTR_COUNT_AND_TIME ) */
 
 
 /*-------------------------------------------------------------------*/
@@ -782,6 +782,75 @@ int timerint_cmd( int argc, char *argv[], char *cmdline )
     return rc;
 }
 
+/*-------------------------------------------------------------------*/
+/* waitspin - display or set the enabled wait spin limit             */
+/*-------------------------------------------------------------------*/
+int waitspin_cmd( int argc, char *argv[], char *cmdline )
+{
+    int rc = 0;
+    UNREFERENCED( cmdline );
+
+    UPPER_ARGV_0( argv );
+
+    if (argc == 2)  /* Define a new value? */
+    {
+        if (CMD( argv[1], DEFAULT, 7 ) || CMD( argv[1], RESET, 5 ))
+        {
+            sysblk.waitspin = DEF_WAIT_SPIN_USECS;
+
+            if (MLVL( VERBOSE ))
+            {
+                // "%-14s set to %s"
+                WRMSG( HHC02204, "I", argv[0], argv[1] );
+            }
+        }
+        else
+        {
+            int waitspin = 0; BYTE c;
+
+            if (1
+                && sscanf( argv[1], "%d%c", &waitspin, &c ) == 1
+                && waitspin >= 0
+                && waitspin <= MAX_WAIT_SPIN_USECS
+            )
+            {
+                sysblk.waitspin = waitspin;
+
+                if (MLVL( VERBOSE ))
+                {
+                    char buf[25];
+                    MSGBUF( buf, "%d", sysblk.waitspin );
+                    // "%-14s set to %s"
+                    WRMSG( HHC02204, "I", argv[0], buf );
+                }
+            }
+            else
+            {
+                // "Invalid argument '%s'%s"
+                WRMSG( HHC02205, "E", argv[1], ": must be 'default' or n where "
+                    "0 <= n <= " QSTR( MAX_WAIT_SPIN_USECS ) );
+                rc = -1;
+            }
+        }
+    }
+    else if (argc == 1)
+    {
+        /* Display the current value */
+        char buf[25];
+        MSGBUF( buf, "%d", sysblk.waitspin );
+        // "%-14s: %s"
+        WRMSG( HHC02203, "I", argv[0], buf );
+    }
+    else
+    {
+        // "Invalid command usage. Type 'help %s' for assistance."
+        WRMSG( HHC02299, "E", argv[0] );
+        rc = -1;
+    }
+
+    return rc;
+}
+
 
 /* format_tod - generate displayable date from TOD value */
 /* always uses epoch of 1900 */
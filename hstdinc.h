@@ -125,6 +125,7 @@
 #define O_NONBLOCK 0
 #endif
 #include <limits.h>
+#include <float.h>
 #include <time.h>
 #include <sys/stat.h>
 #if !defined(_MSVC_)
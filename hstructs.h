@@ -178,6 +178,7 @@ struct REGS {                           /* Processor registers       */
         DW      aiv;                    /* Virtual page address      */
 #define AIV_G   aiv.D
 #define AIV_L   aiv.F.L.F
+        RADR    aipte;                  /* Page table entry of AIA   */
 
         U64     bear;                   /* Breaking event address reg*/
         U64     bear_ex;                /* (same, but for EX/EXRL)   */
@@ -302,6 +303,7 @@ struct REGS {                           /* Processor registers       */
         U64     waittod;                /* Time of day last wait     */
         U64     waittime;               /* Wait time in interval     */
         U64     waittime_accumulated;   /* Wait time accumulated     */
+        U64     waitavg;                /* Recent average wait time  */
 
         CACHE_ALIGN
         DAT     dat;                    /* Fields for DAT use        */
@@ -392,6 +394,7 @@ struct REGS {                           /* Processor registers       */
       */
         ALIGN_8
         bool    intwait;                /* true = Waiting on intlock */
+        bool    psample_req;            /* true = PSW sample wanted  */
         BYTE    inst[8];                /* Fetched instruction when
                                            instruction crosses a page
                                            boundary                  */
@@ -496,6 +499,8 @@ struct REGS {                           /* Processor registers       */
 
         TPAGEMAP  txf_pagesmap[ MAX_TXF_PAGES ]; /* Page addresses   */
         int       txf_pgcnt;            /* Entries in TPAGEMAP table */
+        U16       txf_pagehash[ TXF_PAGEHASH_SIZE ]; /* TPAGEMAP hash:
+                                           first entry+1 or 0        */
 
         BYTE    txf_gprmask;            /* GPR register restore mask */
         DW      txf_savedgr[16];        /* Saved gpr register values */
@@ -635,6 +640,40 @@ struct GSYSINFO {
 };
 
 
+#if defined( OPTION_INSTR_COUNT_AND_TIME )
+/*-------------------------------------------------------------------*/
+/* Per-CPU instruction counts  (see BEG_COUNT_INSTR in opcode.h)     */
+/*-------------------------------------------------------------------*/
+struct ICOUNT_MAP {
+        U64     count  [ ICOUNT_SLOTS ];/* Execution counts          */
+        U64     time   [ ICOUNT_SLOTS ];/* Sampled host time (TOD)   */
+        U64     samples[ ICOUNT_SLOTS ];/* Number of timed samples   */
+        U32     tick;                   /* Instrs until next sample  */
+};
+#endif
+
+/*-------------------------------------------------------------------*/
+/* Per-CPU guest PSW samples  (see psample_record in cpu.c)          */
+/*-------------------------------------------------------------------*/
+struct PSAMPLE {
+        U64     ia;                     /* PSW instruction address   */
+        U64     asce;                   /* Primary ASCE (CR1)        */
+        U16     asid;                   /* Primary ASN (PASN)        */
+        BYTE    arch_mode;              /* Architecture of sample    */
+        BYTE    flags;                  /* Sample flags...           */
+#define PSAMPLE_SIE     0x80            /* ...SIE guest was running  */
+#define PSAMPLE_PROB    0x40            /* ...problem state          */
+        BYTE    depth;                  /* Number of frames below    */
+        U64     frame[ MAX_PSAMPLE_DEPTH ]; /* Linkage stack return
+                                           addresses, innermost first*/
+};
+
+struct PSAMPLE_RING {
+        U64     count;                  /* Samples taken since clear */
+        U32     size;                   /* Number of ring entries    */
+        PSAMPLE ent[ 1 ];               /* Ring entries (variable)   */
+};
+
 /*-------------------------------------------------------------------*/
 /* Operation Modes                                                   */
 /*-------------------------------------------------------------------*/
@@ -738,6 +777,8 @@ struct SYSBLK {
         U8      cpcai;                  /* Dynamic CP capacity adj.  */
         U8      hhc_111_112;            /* HHC00111/HHC00112 issued  */
         U8      have_PCLMULQDQ:1;       /* Host PCLMULQDQ available  */
+        U8      have_AES:1;             /* Host AES instrs available */
+        U8      have_SHA:1;             /* Host SHA instrs available */
 
         COND    cpucond;                /* CPU config/deconfig cond  */
         LOCK    cpulock[ MAX_CPU_ENGS ];/* CPU lock               */
@@ -808,6 +849,9 @@ atomic_update64( &sysblk.txf_stats[ contran ? 1 : 0 ].txf_ ## ctr, +1 )
         BYTE    ptyp[ MAX_CPU_ENGS ];   /* SCCB ptyp for each engine */
         LOCK    todlock;                /* TOD clock update lock     */
         TID     todtid;                 /* Thread-id for TOD update  */
+        COND    todcond;                /* TOD thread wakeup cond    */
+        TOD     todwake;                /* hw_clock when TOD thread  */
+                                        /* next wakes (under todlock)*/
         REGS   *regs[ MAX_CPU_ENGS + 1];/* Registers for each CPU    */
 
         /* Active Facility List */
@@ -940,6 +984,7 @@ atomic_update64( &sysblk.txf_stats[ contran ? 1 : 0 ].txf_ ## ctr, +1 )
 
         int     timerint;               /* microsecs timer interval  */
         int     cfg_timerint;           /* (value defined in config) */
+        int     waitspin;               /* microsecs wait spin limit */
         char   *pantitle;               /* Alt console panel title   */
 #if defined( OPTION_SCSI_TAPE )
         /* Access to all SCSI fields controlled by sysblk.stape_lock */
@@ -1121,60 +1166,20 @@ atomic_update64( &sysblk.txf_stats[ contran ? 1 : 0 ].txf_ ## ctr, +1 )
 #endif /*!defined(NO_SETUID)*/
 
 #if defined( OPTION_INSTR_COUNT_AND_TIME )
-
         bool    icount;                 /* true = enabled, else not. */
-        struct timeval start_time;      /* OPCODE start time         */
-
-        struct IMAPS {
-            U64 imap01[256];
-            U64 imapa4[256];
-            U64 imapa5[16];
-            U64 imapa6[256];
-            U64 imapa7[16];
-            U64 imapb2[256];
-            U64 imapb3[256];
-            U64 imapb9[256];
-            U64 imapc0[16];
-            U64 imapc2[16];
-            U64 imapc4[16];
-            U64 imapc6[16];
-            U64 imapc8[16];
-            U64 imape3[256];
-            U64 imape4[256];
-            U64 imape5[256];
-            U64 imape6[256];
-            U64 imape7[256];
-            U64 imapeb[256];
-            U64 imapec[256];
-            U64 imaped[256];
-            U64 imapxx[256];
-
-            U64 imap01T[256];
-            U64 imapa4T[256];
-            U64 imapa5T[16];
-            U64 imapa6T[256];
-            U64 imapa7T[16];
-            U64 imapb2T[256];
-            U64 imapb3T[256];
-            U64 imapb9T[256];
-            U64 imapc0T[16];
-            U64 imapc2T[16];
-            U64 imapc4T[16];
-            U64 imapc6T[16];
-            U64 imapc8T[16];
-            U64 imape3T[256];
-            U64 imape4T[256];
-            U64 imape5T[256];
-            U64 imape6T[256];
-            U64 imape7T[256];
-            U64 imapebT[256];
-            U64 imapecT[256];
-            U64 imapedT[256];
-            U64 imapxxT[256];
-        } imaps;
-
+        U32     icount_rate;            /* Time every n'th instr.    */
+        ICOUNT_MAP* icount_map[ MAX_CPU_ENGS ]; /* Per-CPU counts    */
 #endif // defined( OPTION_INSTR_COUNT_AND_TIME )
 
+        bool    psample;                /* true = PSW sampling active*/
+        U32     psample_rate;           /* PSW samples per second    */
+        U32     psample_depth;          /* Linkage stack frames      */
+        U64     psample_next;           /* TOD of next sample request*/
+        PSAMPLE_RING* psample_ring[ MAX_CPU_ENGS ]; /* Per-CPU rings */
+
+        CMPSCCACHE* cmpsc_cache[ MAX_CPU_ENGS ]; /* Per-CPU CMPSC    */
+                                        /* dictionary caches         */
+
         char    *cnslport;              /* console port string       */
         char    *sysgport;              /* SYSG console port string  */
         char    **herclogo;             /* Constructed logo screen   */
@@ -191,6 +191,10 @@ typedef struct CHPBLK    CHPBLK;    // Channel Path config block
 typedef struct IOINT     IOINT;     // I/O interrupt queue
 
 typedef struct GSYSINFO  GSYSINFO;  // Ebcdic machine information
+typedef struct ICOUNT_MAP ICOUNT_MAP; // Per-CPU instruction counts
+typedef struct PSAMPLE   PSAMPLE;   // Guest PSW sample
+typedef struct PSAMPLE_RING PSAMPLE_RING; // Per-CPU PSW sample ring
+typedef struct CMPSCCACHE CMPSCCACHE; // Per-CPU CMPSC dictionary cache
 
 typedef struct DEVDATA   DEVDATA;   // xxxxxxxxx
 typedef struct DEVGRP    DEVGRP;    // xxxxxxxxx
@@ -536,6 +536,116 @@ static INLINE U32 ieee_exception_test_oux( REGS* regs )
     return ieee_trap_conds;
 }
 
+/*****************************************************************************/
+/*                Host FPU fast path for BFP arithmetic                      */
+/*****************************************************************************/
+/* When the guest is using the default round-to-nearest-even BFP rounding    */
+/* mode, the inexact exception is masked and its flag is already on (which  */
+/* is nearly always the case once a program has done any real arithmetic)   */
+/* then the result of a short or long BFP add, subtract, multiply or divide */
+/* of two normal operands is simply the host's own IEEE result, PROVIDED    */
+/* that result is itself a normal number. Nothing else could possibly need  */
+/* reporting: invalid and divide-by-zero require NaN, infinity or zero     */
+/* operands, and overflow and underflow (tininess being detected BEFORE     */
+/* rounding on z/Architecture) cannot produce a result whose exponent is    */
+/* neither the maximum nor less than 2. Anything else falls back to the     */
+/* SoftFloat path, which remains the reference implementation.              */
+/*                                                                           */
+/* This requires the host to evaluate double and float expressions in      */
+/* their own precision (i.e. no x87 excess precision) and to be running in  */
+/* the (default) round-to-nearest mode with no flush-to-zero.               */
+/*****************************************************************************/
+/* gcc's default FLT_EVAL_METHOD is 16 (ISO/IEC TS 18661-3), which only     */
+/* widens _Float16 and so is the same as 0 for float and double.            */
+#if defined( FLT_EVAL_METHOD ) && (FLT_EVAL_METHOD == 0 || FLT_EVAL_METHOD == 16)
+  #define BFP_HOST_FASTPATH
+#endif
+
+#define BFP_HOST_FPC_OK( _regs )                                              \
+                                                                              \
+    (((_regs)->fpc & (FPC_BRM_3BIT | FPC_MASK_IMX | FPC_FLAG_SFX)) == FPC_FLAG_SFX)
+
+#define F64_EXP( _op )      ((U32)((_op).v >> 52) & 0x7FF)
+#define F32_EXP( _op )      ((U32)((_op).v >> 23) & 0xFF)
+
+#define F64_HOST_NORMAL_OPS( _op1, _op2 )                                     \
+                                                                              \
+    (1                                                                        \
+     && F64_EXP( _op1 ) && F64_EXP( _op1 ) != 0x7FF                           \
+     && F64_EXP( _op2 ) && F64_EXP( _op2 ) != 0x7FF                           \
+    )
+
+#define F32_HOST_NORMAL_OPS( _op1, _op2 )                                     \
+                                                                              \
+    (1                                                                        \
+     && F32_EXP( _op1 ) && F32_EXP( _op1 ) != 0xFF                            \
+     && F32_EXP( _op2 ) && F32_EXP( _op2 ) != 0xFF                            \
+    )
+
+/* Define f64_host_add, f64_host_sub, etc. Each returns true and the      */
+/* result in 'ans' when the host computed it, or false if the operation   */
+/* must be done by SoftFloat.                                             */
+
+#define DEF_F64_HOST_OP( _name, _oper )                                       \
+                                                                              \
+static INLINE bool f64_host_ ## _name( REGS* regs, float64_t op1,             \
+                                       float64_t op2, float64_t* ans )        \
+{                                                                             \
+    double  d1, d2, dr;                                                       \
+    U32     exp;                                                              \
+                                                                              \
+    if (!BFP_HOST_FPC_OK( regs ) || !F64_HOST_NORMAL_OPS( op1, op2 ))         \
+        return false;                                                         \
+                                                                              \
+    memcpy( &d1, &op1.v, sizeof( d1 ));                                       \
+    memcpy( &d2, &op2.v, sizeof( d2 ));                                       \
+    dr = d1 _oper d2;                                                         \
+    memcpy( &ans->v, &dr, sizeof( dr ));                                      \
+                                                                              \
+    exp = F64_EXP( *ans );                                                    \
+    return (exp >= 2 && exp != 0x7FF);                                        \
+}
+
+#define DEF_F32_HOST_OP( _name, _oper )                                       \
+                                                                              \
+static INLINE bool f32_host_ ## _name( REGS* regs, float32_t op1,             \
+                                       float32_t op2, float32_t* ans )        \
+{                                                                             \
+    float   f1, f2, fr;                                                       \
+    U32     exp;                                                              \
+                                                                              \
+    if (!BFP_HOST_FPC_OK( regs ) || !F32_HOST_NORMAL_OPS( op1, op2 ))         \
+        return false;                                                         \
+                                                                              \
+    memcpy( &f1, &op1.v, sizeof( f1 ));                                       \
+    memcpy( &f2, &op2.v, sizeof( f2 ));                                       \
+    fr = f1 _oper f2;                                                         \
+    memcpy( &ans->v, &fr, sizeof( fr ));                                      \
+                                                                              \
+    exp = F32_EXP( *ans );                                                    \
+    return (exp >= 2 && exp != 0xFF);                                         \
+}
+
+#if defined( BFP_HOST_FASTPATH )
+DEF_F64_HOST_OP( add, + )
+DEF_F64_HOST_OP( sub, - )
+DEF_F64_HOST_OP( mul, * )
+DEF_F64_HOST_OP( div, / )
+DEF_F32_HOST_OP( add, + )
+DEF_F32_HOST_OP( sub, - )
+DEF_F32_HOST_OP( mul, * )
+DEF_F32_HOST_OP( div, / )
+#else
+  #define f64_host_add( _regs, _op1, _op2, _ans )    (false)
+  #define f64_host_sub( _regs, _op1, _op2, _ans )    (false)
+  #define f64_host_mul( _regs, _op1, _op2, _ans )    (false)
+  #define f64_host_div( _regs, _op1, _op2, _ans )    (false)
+  #define f32_host_add( _regs, _op1, _op2, _ans )    (false)
+  #define f32_host_sub( _regs, _op1, _op2, _ans )    (false)
+  #define f32_host_mul( _regs, _op1, _op2, _ans )    (false)
+  #define f32_host_div( _regs, _op1, _op2, _ans )    (false)
+#endif
+
 /*                          ---  E N D  ---                                  */
 /*                                                                           */
 /*           'SoftFloat' IEEE Binary Floating Point package                  */
@@ -2834,20 +2944,23 @@ DEF_INST( add_bfp_long_reg )
 
     GET_FLOAT64_OPS( op1, r1, op2, r2, regs );
 
-    softfloat_exceptionFlags = 0;
-    SET_SF_RM_FROM_FPC;
+    if (!f64_host_add( regs, op1, op2, &ans ))
+    {
+        softfloat_exceptionFlags = 0;
+        SET_SF_RM_FROM_FPC;
 
-    ans = f64_add( op1, op2 );
+        ans = f64_add( op1, op2 );
 
-    if (softfloat_exceptionFlags)
-    {
-        IEEE_EXCEPTION_TRAP_XI( regs );
-        ieee_trap_conds = ieee_exception_test_oux( regs );
+        if (softfloat_exceptionFlags)
+        {
+            IEEE_EXCEPTION_TRAP_XI( regs );
+            ieee_trap_conds = ieee_exception_test_oux( regs );
 
-        if (ieee_trap_conds & (FPC_MASK_IMO | FPC_MASK_IMU))
-            ans = f64_scaledResult( ieee_trap_conds & FPC_MASK_IMO ?
-                SCALE_FACTOR_ARITH_OFLOW_LONG :
-                SCALE_FACTOR_ARITH_UFLOW_LONG );
+            if (ieee_trap_conds & (FPC_MASK_IMO | FPC_MASK_IMU))
+                ans = f64_scaledResult( ieee_trap_conds & FPC_MASK_IMO ?
+                    SCALE_FACTOR_ARITH_OFLOW_LONG :
+                    SCALE_FACTOR_ARITH_UFLOW_LONG );
+        }
     }
 
     PUT_FLOAT64_CC( ans, r1, regs );
@@ -2874,20 +2987,23 @@ DEF_INST( add_bfp_long )
     GET_FLOAT64_OP( op1, r1, regs );
     VFETCH_FLOAT64_OP( op2, effective_addr2, b2, regs );
 
-    softfloat_exceptionFlags = 0;
-    SET_SF_RM_FROM_FPC;
+    if (!f64_host_add( regs, op1, op2, &ans ))
+    {
+        softfloat_exceptionFlags = 0;
+        SET_SF_RM_FROM_FPC;
 
-    ans = f64_add( op1, op2 );
+        ans = f64_add( op1, op2 );
 
-    if (softfloat_exceptionFlags)
-    {
-        IEEE_EXCEPTION_TRAP_XI( regs );
-        ieee_trap_conds = ieee_exception_test_oux( regs );
+        if (softfloat_exceptionFlags)
+        {
+            IEEE_EXCEPTION_TRAP_XI( regs );
+            ieee_trap_conds = ieee_exception_test_oux( regs );
 
-        if (ieee_trap_conds & (FPC_MASK_IMO | FPC_MASK_IMU))
-            ans = f64_scaledResult( ieee_trap_conds & FPC_MASK_IMO ?
-                SCALE_FACTOR_ARITH_OFLOW_LONG :
-                SCALE_FACTOR_ARITH_UFLOW_LONG );
+            if (ieee_trap_conds & (FPC_MASK_IMO | FPC_MASK_IMU))
+                ans = f64_scaledResult( ieee_trap_conds & FPC_MASK_IMO ?
+                    SCALE_FACTOR_ARITH_OFLOW_LONG :
+                    SCALE_FACTOR_ARITH_UFLOW_LONG );
+        }
     }
 
     PUT_FLOAT64_CC( ans, r1, regs );
@@ -2911,20 +3027,23 @@ DEF_INST( add_bfp_short_reg )
 
     GET_FLOAT32_OPS( op1, r1, op2, r2, regs );
 
-    softfloat_exceptionFlags = 0;
-    SET_SF_RM_FROM_FPC;
+    if (!f32_host_add( regs, op1, op2, &ans ))
+    {
+        softfloat_exceptionFlags = 0;
+        SET_SF_RM_FROM_FPC;
 
-    ans = f32_add( op1, op2 );
+        ans = f32_add( op1, op2 );
 
-    if (softfloat_exceptionFlags)
-    {
-        IEEE_EXCEPTION_TRAP_XI( regs );
-        ieee_trap_conds = ieee_exception_test_oux( regs );
+        if (softfloat_exceptionFlags)
+        {
+            IEEE_EXCEPTION_TRAP_XI( regs );
+            ieee_trap_conds = ieee_exception_test_oux( regs );
 
-        if (ieee_trap_conds & (FPC_MASK_IMO | FPC_MASK_IMU))
-            ans = f32_scaledResult( ieee_trap_conds & FPC_MASK_IMO ?
-                SCALE_FACTOR_ARITH_OFLOW_SHORT :
-                SCALE_FACTOR_ARITH_UFLOW_SHORT );
+            if (ieee_trap_conds & (FPC_MASK_IMO | FPC_MASK_IMU))
+                ans = f32_scaledResult( ieee_trap_conds & FPC_MASK_IMO ?
+                    SCALE_FACTOR_ARITH_OFLOW_SHORT :
+                    SCALE_FACTOR_ARITH_UFLOW_SHORT );
+        }
     }
 
     PUT_FLOAT32_CC( ans, r1, regs );
@@ -2951,20 +3070,23 @@ DEF_INST( add_bfp_short )
     GET_FLOAT32_OP( op1, r1, regs );
     VFETCH_FLOAT32_OP( op2, effective_addr2, b2, regs );
 
-    softfloat_exceptionFlags = 0;
-    SET_SF_RM_FROM_FPC;
+    if (!f32_host_add( regs, op1, op2, &ans ))
+    {
+        softfloat_exceptionFlags = 0;
+        SET_SF_RM_FROM_FPC;
 
-    ans = f32_add( op1, op2 );
+        ans = f32_add( op1, op2 );
 
-    if (softfloat_exceptionFlags)
-    {
-        IEEE_EXCEPTION_TRAP_XI( regs );
-        ieee_trap_conds = ieee_exception_test_oux( regs );
+        if (softfloat_exceptionFlags)
+        {
+            IEEE_EXCEPTION_TRAP_XI( regs );
+            ieee_trap_conds = ieee_exception_test_oux( regs );
 
-        if (ieee_trap_conds & (FPC_MASK_IMO | FPC_MASK_IMU))
-            ans = f32_scaledResult( ieee_trap_conds & FPC_MASK_IMO ?
-                SCALE_FACTOR_ARITH_OFLOW_SHORT :
-                SCALE_FACTOR_ARITH_UFLOW_SHORT );
+            if (ieee_trap_conds & (FPC_MASK_IMO | FPC_MASK_IMU))
+                ans = f32_scaledResult( ieee_trap_conds & FPC_MASK_IMO ?
+                    SCALE_FACTOR_ARITH_OFLOW_SHORT :
+                    SCALE_FACTOR_ARITH_UFLOW_SHORT );
+        }
     }
 
     PUT_FLOAT32_CC( ans, r1, regs );
@@ -4562,22 +4684,25 @@ DEF_INST( divide_bfp_long_reg )
 
     GET_FLOAT64_OPS( op1, r1, op2, r2, regs );
 
-    softfloat_exceptionFlags = 0;
-    SET_SF_RM_FROM_FPC;
+    if (!f64_host_div( regs, op1, op2, &ans ))
+    {
+        softfloat_exceptionFlags = 0;
+        SET_SF_RM_FROM_FPC;
 
-    ans = f64_div( op1, op2 );
+        ans = f64_div( op1, op2 );
 
-    if (softfloat_exceptionFlags)
-    {
-        IEEE_EXCEPTION_TRAP_XI( regs );
-        IEEE_EXCEPTION_TRAP_XZ( regs );
+        if (softfloat_exceptionFlags)
+        {
+            IEEE_EXCEPTION_TRAP_XI( regs );
+            IEEE_EXCEPTION_TRAP_XZ( regs );
 
-        ieee_trap_conds = ieee_exception_test_oux( regs );
+            ieee_trap_conds = ieee_exception_test_oux( regs );
 
-        if (ieee_trap_conds & (FPC_MASK_IMO | FPC_MASK_IMU))
-            ans = f64_scaledResult( ieee_trap_conds & FPC_MASK_IMO ?
-                SCALE_FACTOR_ARITH_OFLOW_LONG :
-                SCALE_FACTOR_ARITH_UFLOW_LONG );
+            if (ieee_trap_conds & (FPC_MASK_IMO | FPC_MASK_IMU))
+                ans = f64_scaledResult( ieee_trap_conds & FPC_MASK_IMO ?
+                    SCALE_FACTOR_ARITH_OFLOW_LONG :
+                    SCALE_FACTOR_ARITH_UFLOW_LONG );
+        }
     }
 
     PUT_FLOAT64_NOCC( ans, r1, regs );
@@ -4604,22 +4729,25 @@ DEF_INST( divide_bfp_long )
     GET_FLOAT64_OP( op1, r1, regs );
     VFETCH_FLOAT64_OP( op2, effective_addr2, b2, regs );
 
-    softfloat_exceptionFlags = 0;
-    SET_SF_RM_FROM_FPC;
+    if (!f64_host_div( regs, op1, op2, &ans ))
+    {
+        softfloat_exceptionFlags = 0;
+        SET_SF_RM_FROM_FPC;
 
-    ans = f64_div( op1, op2 );
+        ans = f64_div( op1, op2 );
 
-    if (softfloat_exceptionFlags)
-    {
-        IEEE_EXCEPTION_TRAP_XI( regs );
-        IEEE_EXCEPTION_TRAP_XZ( regs );
+        if (softfloat_exceptionFlags)
+        {
+            IEEE_EXCEPTION_TRAP_XI( regs );
+            IEEE_EXCEPTION_TRAP_XZ( regs );
 
-        ieee_trap_conds = ieee_exception_test_oux( regs );
+            ieee_trap_conds = ieee_exception_test_oux( regs );
 
-        if (ieee_trap_conds & (FPC_MASK_IMO | FPC_MASK_IMU))
-            ans = f64_scaledResult( ieee_trap_conds & FPC_MASK_IMO ?
-                SCALE_FACTOR_ARITH_OFLOW_LONG :
-                SCALE_FACTOR_ARITH_UFLOW_LONG );
+            if (ieee_trap_conds & (FPC_MASK_IMO | FPC_MASK_IMU))
+                ans = f64_scaledResult( ieee_trap_conds & FPC_MASK_IMO ?
+                    SCALE_FACTOR_ARITH_OFLOW_LONG :
+                    SCALE_FACTOR_ARITH_UFLOW_LONG );
+        }
     }
 
     PUT_FLOAT64_NOCC( ans, r1, regs );
@@ -4644,22 +4772,25 @@ DEF_INST( divide_bfp_short_reg )
 
     GET_FLOAT32_OPS( op1, r1, op2, r2, regs );
 
-    softfloat_exceptionFlags = 0;
-    SET_SF_RM_FROM_FPC;
+    if (!f32_host_div( regs, op1, op2, &ans ))
+    {
+        softfloat_exceptionFlags = 0;
+        SET_SF_RM_FROM_FPC;
 
-    ans = f32_div( op1, op2 );
+        ans = f32_div( op1, op2 );
 
-    if (softfloat_exceptionFlags)
-    {
-        IEEE_EXCEPTION_TRAP_XI( regs );
-        IEEE_EXCEPTION_TRAP_XZ( regs );
+        if (softfloat_exceptionFlags)
+        {
+            IEEE_EXCEPTION_TRAP_XI( regs );
+            IEEE_EXCEPTION_TRAP_XZ( regs );
 
-        ieee_trap_conds = ieee_exception_test_oux( regs );
+            ieee_trap_conds = ieee_exception_test_oux( regs );
 
-        if (ieee_trap_conds & (FPC_MASK_IMO | FPC_MASK_IMU))
-            ans = f32_scaledResult( ieee_trap_conds & FPC_MASK_IMO ?
-                SCALE_FACTOR_ARITH_OFLOW_SHORT :
-                SCALE_FACTOR_ARITH_UFLOW_SHORT );
+            if (ieee_trap_conds & (FPC_MASK_IMO | FPC_MASK_IMU))
+                ans = f32_scaledResult( ieee_trap_conds & FPC_MASK_IMO ?
+                    SCALE_FACTOR_ARITH_OFLOW_SHORT :
+                    SCALE_FACTOR_ARITH_UFLOW_SHORT );
+        }
     }
 
     PUT_FLOAT32_NOCC( ans, r1, regs );
@@ -4686,22 +4817,25 @@ DEF_INST( divide_bfp_short )
     GET_FLOAT32_OP( op1, r1, regs );
     VFETCH_FLOAT32_OP( op2, effective_addr2, b2, regs );
 
-    softfloat_exceptionFlags = 0;
-    SET_SF_RM_FROM_FPC;
+    if (!f32_host_div( regs, op1, op2, &ans ))
+    {
+        softfloat_exceptionFlags = 0;
+        SET_SF_RM_FROM_FPC;
 
-    ans = f32_div( op1, op2 );
+        ans = f32_div( op1, op2 );
 
-    if (softfloat_exceptionFlags)
-    {
-        IEEE_EXCEPTION_TRAP_XI( regs );
-        IEEE_EXCEPTION_TRAP_XZ( regs );
+        if (softfloat_exceptionFlags)
+        {
+            IEEE_EXCEPTION_TRAP_XI( regs );
+            IEEE_EXCEPTION_TRAP_XZ( regs );
 
-        ieee_trap_conds = ieee_exception_test_oux( regs );
+            ieee_trap_conds = ieee_exception_test_oux( regs );
 
-        if (ieee_trap_conds & (FPC_MASK_IMO | FPC_MASK_IMU))
-            ans = f32_scaledResult( ieee_trap_conds & FPC_MASK_IMO ?
-                SCALE_FACTOR_ARITH_OFLOW_SHORT :
-                SCALE_FACTOR_ARITH_UFLOW_SHORT );
+            if (ieee_trap_conds & (FPC_MASK_IMO | FPC_MASK_IMU))
+                ans = f32_scaledResult( ieee_trap_conds & FPC_MASK_IMO ?
+                    SCALE_FACTOR_ARITH_OFLOW_SHORT :
+                    SCALE_FACTOR_ARITH_UFLOW_SHORT );
+        }
     }
 
     PUT_FLOAT32_NOCC( ans, r1, regs );
@@ -5681,20 +5815,23 @@ DEF_INST( multiply_bfp_long_reg )
 
     GET_FLOAT64_OPS( op1, r1, op2, r2, regs );
 
-    softfloat_exceptionFlags = 0;
-    SET_SF_RM_FROM_FPC;
+    if (!f64_host_mul( regs, op1, op2, &ans ))
+    {
+        softfloat_exceptionFlags = 0;
+        SET_SF_RM_FROM_FPC;
 
-    ans = f64_mul( op1, op2 );
+        ans = f64_mul( op1, op2 );
 
-    if (softfloat_exceptionFlags)
-    {
-        IEEE_EXCEPTION_TRAP_XI( regs );
-        ieee_trap_conds = ieee_exception_test_oux( regs );
+        if (softfloat_exceptionFlags)
+        {
+            IEEE_EXCEPTION_TRAP_XI( regs );
+            ieee_trap_conds = ieee_exception_test_oux( regs );
 
-        if (ieee_trap_conds & (FPC_MASK_IMO | FPC_MASK_IMU))
-            ans = f64_scaledResult( ieee_trap_conds & FPC_MASK_IMO ?
-                SCALE_FACTOR_ARITH_OFLOW_LONG :
-                SCALE_FACTOR_ARITH_UFLOW_LONG );
+            if (ieee_trap_conds & (FPC_MASK_IMO | FPC_MASK_IMU))
+                ans = f64_scaledResult( ieee_trap_conds & FPC_MASK_IMO ?
+                    SCALE_FACTOR_ARITH_OFLOW_LONG :
+                    SCALE_FACTOR_ARITH_UFLOW_LONG );
+        }
     }
 
     PUT_FLOAT64_NOCC( ans, r1, regs );
@@ -5721,20 +5858,23 @@ DEF_INST( multiply_bfp_long )
     GET_FLOAT64_OP( op1, r1, regs );
     VFETCH_FLOAT64_OP( op2, effective_addr2, b2, regs );
 
-    softfloat_exceptionFlags = 0;
-    SET_SF_RM_FROM_FPC;
+    if (!f64_host_mul( regs, op1, op2, &ans ))
+    {
+        softfloat_exceptionFlags = 0;
+        SET_SF_RM_FROM_FPC;
 
-    ans = f64_mul( op1, op2 );
+        ans = f64_mul( op1, op2 );
 
-    if (softfloat_exceptionFlags)
-    {
-        IEEE_EXCEPTION_TRAP_XI( regs );
-        ieee_trap_conds = ieee_exception_test_oux( regs );
+        if (softfloat_exceptionFlags)
+        {
+            IEEE_EXCEPTION_TRAP_XI( regs );
+            ieee_trap_conds = ieee_exception_test_oux( regs );
 
-        if (ieee_trap_conds & (FPC_MASK_IMO | FPC_MASK_IMU))
-            ans = f64_scaledResult( ieee_trap_conds & FPC_MASK_IMO ?
-                SCALE_FACTOR_ARITH_OFLOW_LONG :
-                SCALE_FACTOR_ARITH_UFLOW_LONG );
+            if (ieee_trap_conds & (FPC_MASK_IMO | FPC_MASK_IMU))
+                ans = f64_scaledResult( ieee_trap_conds & FPC_MASK_IMO ?
+                    SCALE_FACTOR_ARITH_OFLOW_LONG :
+                    SCALE_FACTOR_ARITH_UFLOW_LONG );
+        }
     }
 
     PUT_FLOAT64_NOCC( ans, r1, regs );
@@ -5867,20 +6007,23 @@ DEF_INST( multiply_bfp_short_reg )
 
     GET_FLOAT32_OPS( op1, r1, op2, r2, regs );
 
-    softfloat_exceptionFlags = 0;
-    SET_SF_RM_FROM_FPC;
+    if (!f32_host_mul( regs, op1, op2, &ans ))
+    {
+        softfloat_exceptionFlags = 0;
+        SET_SF_RM_FROM_FPC;
 
-    ans = f32_mul( op1, op2 );
+        ans = f32_mul( op1, op2 );
 
-    if (softfloat_exceptionFlags)
-    {
-        IEEE_EXCEPTION_TRAP_XI( regs );
-        ieee_trap_conds = ieee_exception_test_oux( regs );
+        if (softfloat_exceptionFlags)
+        {
+            IEEE_EXCEPTION_TRAP_XI( regs );
+            ieee_trap_conds = ieee_exception_test_oux( regs );
 
-        if (ieee_trap_conds & (FPC_MASK_IMO | FPC_MASK_IMU))
-            ans = f32_scaledResult( ieee_trap_conds & FPC_MASK_IMO ?
-                SCALE_FACTOR_ARITH_OFLOW_SHORT :
-                SCALE_FACTOR_ARITH_UFLOW_SHORT );
+            if (ieee_trap_conds & (FPC_MASK_IMO | FPC_MASK_IMU))
+                ans = f32_scaledResult( ieee_trap_conds & FPC_MASK_IMO ?
+                    SCALE_FACTOR_ARITH_OFLOW_SHORT :
+                    SCALE_FACTOR_ARITH_UFLOW_SHORT );
+        }
     }
 
     PUT_FLOAT32_NOCC( ans, r1, regs );
@@ -5907,20 +6050,23 @@ DEF_INST( multiply_bfp_short )
     GET_FLOAT32_OP( op1, r1, regs );
     VFETCH_FLOAT32_OP( op2, effective_addr2, b2, regs );
 
-    softfloat_exceptionFlags = 0;
-    SET_SF_RM_FROM_FPC;
+    if (!f32_host_mul( regs, op1, op2, &ans ))
+    {
+        softfloat_exceptionFlags = 0;
+        SET_SF_RM_FROM_FPC;
 
-    ans = f32_mul( op1, op2 );
+        ans = f32_mul( op1, op2 );
 
-    if (softfloat_exceptionFlags)
-    {
-        IEEE_EXCEPTION_TRAP_XI( regs );
-        ieee_trap_conds = ieee_exception_test_oux( regs );
+        if (softfloat_exceptionFlags)
+        {
+            IEEE_EXCEPTION_TRAP_XI( regs );
+            ieee_trap_conds = ieee_exception_test_oux( regs );
 
-        if (ieee_trap_conds & (FPC_MASK_IMO | FPC_MASK_IMU))
-            ans = f32_scaledResult( ieee_trap_conds & FPC_MASK_IMO ?
-                SCALE_FACTOR_ARITH_OFLOW_SHORT :
-                SCALE_FACTOR_ARITH_UFLOW_SHORT );
+            if (ieee_trap_conds & (FPC_MASK_IMO | FPC_MASK_IMU))
+                ans = f32_scaledResult( ieee_trap_conds & FPC_MASK_IMO ?
+                    SCALE_FACTOR_ARITH_OFLOW_SHORT :
+                    SCALE_FACTOR_ARITH_UFLOW_SHORT );
+        }
     }
 
     PUT_FLOAT32_NOCC( ans, r1, regs );
@@ -6489,20 +6635,23 @@ DEF_INST( subtract_bfp_long_reg )
 
     GET_FLOAT64_OPS( op1, r1, op2, r2, regs );
 
-    softfloat_exceptionFlags = 0;
-    SET_SF_RM_FROM_FPC;
+    if (!f64_host_sub( regs, op1, op2, &ans ))
+    {
+        softfloat_exceptionFlags = 0;
+        SET_SF_RM_FROM_FPC;
 
-    ans = f64_sub( op1, op2 );
+        ans = f64_sub( op1, op2 );
 
-    if (softfloat_exceptionFlags)
-    {
-        IEEE_EXCEPTION_TRAP_XI( regs );
-        ieee_trap_conds = ieee_exception_test_oux( regs );
+        if (softfloat_exceptionFlags)
+        {
+            IEEE_EXCEPTION_TRAP_XI( regs );
+            ieee_trap_conds = ieee_exception_test_oux( regs );
 
-        if (ieee_trap_conds & (FPC_MASK_IMO | FPC_MASK_IMU))
-            ans = f64_scaledResult( ieee_trap_conds & FPC_MASK_IMO ?
-                SCALE_FACTOR_ARITH_OFLOW_LONG :
-                SCALE_FACTOR_ARITH_UFLOW_LONG );
+            if (ieee_trap_conds & (FPC_MASK_IMO | FPC_MASK_IMU))
+                ans = f64_scaledResult( ieee_trap_conds & FPC_MASK_IMO ?
+                    SCALE_FACTOR_ARITH_OFLOW_LONG :
+                    SCALE_FACTOR_ARITH_UFLOW_LONG );
+        }
     }
 
     PUT_FLOAT64_CC( ans, r1, regs );
@@ -6529,20 +6678,23 @@ DEF_INST( subtract_bfp_long )
     GET_FLOAT64_OP( op1, r1, regs );
     VFETCH_FLOAT64_OP( op2, effective_addr2, b2, regs );
 
-    softfloat_exceptionFlags = 0;
-    SET_SF_RM_FROM_FPC;
+    if (!f64_host_sub( regs, op1, op2, &ans ))
+    {
+        softfloat_exceptionFlags = 0;
+        SET_SF_RM_FROM_FPC;
 
-    ans = f64_sub( op1, op2 );
+        ans = f64_sub( op1, op2 );
 
-    if (softfloat_exceptionFlags)
-    {
-        IEEE_EXCEPTION_TRAP_XI( regs );
-        ieee_trap_conds = ieee_exception_test_oux( regs );
+        if (softfloat_exceptionFlags)
+        {
+            IEEE_EXCEPTION_TRAP_XI( regs );
+            ieee_trap_conds = ieee_exception_test_oux( regs );
 
-        if (ieee_trap_conds & (FPC_MASK_IMO | FPC_MASK_IMU))
-            ans = f64_scaledResult( ieee_trap_conds & FPC_MASK_IMO ?
-                SCALE_FACTOR_ARITH_OFLOW_LONG :
-                SCALE_FACTOR_ARITH_UFLOW_LONG );
+            if (ieee_trap_conds & (FPC_MASK_IMO | FPC_MASK_IMU))
+                ans = f64_scaledResult( ieee_trap_conds & FPC_MASK_IMO ?
+                    SCALE_FACTOR_ARITH_OFLOW_LONG :
+                    SCALE_FACTOR_ARITH_UFLOW_LONG );
+        }
     }
 
     PUT_FLOAT64_CC( ans, r1, regs );
@@ -6566,20 +6718,23 @@ DEF_INST( subtract_bfp_short_reg )
 
     GET_FLOAT32_OPS( op1, r1, op2, r2, regs );
 
-    softfloat_exceptionFlags = 0;
-    SET_SF_RM_FROM_FPC;
+    if (!f32_host_sub( regs, op1, op2, &ans ))
+    {
+        softfloat_exceptionFlags = 0;
+        SET_SF_RM_FROM_FPC;
 
-    ans = f32_sub( op1, op2 );
+        ans = f32_sub( op1, op2 );
 
-    if (softfloat_exceptionFlags)
-    {
-        IEEE_EXCEPTION_TRAP_XI( regs );
-        ieee_trap_conds = ieee_exception_test_oux( regs );
+        if (softfloat_exceptionFlags)
+        {
+            IEEE_EXCEPTION_TRAP_XI( regs );
+            ieee_trap_conds = ieee_exception_test_oux( regs );
 
-        if (ieee_trap_conds & (FPC_MASK_IMO | FPC_MASK_IMU))
-            ans = f32_scaledResult( ieee_trap_conds & FPC_MASK_IMO ?
-                SCALE_FACTOR_ARITH_OFLOW_SHORT :
-                SCALE_FACTOR_ARITH_UFLOW_SHORT );
+            if (ieee_trap_conds & (FPC_MASK_IMO | FPC_MASK_IMU))
+                ans = f32_scaledResult( ieee_trap_conds & FPC_MASK_IMO ?
+                    SCALE_FACTOR_ARITH_OFLOW_SHORT :
+                    SCALE_FACTOR_ARITH_UFLOW_SHORT );
+        }
     }
 
     PUT_FLOAT32_CC( ans, r1, regs );
@@ -6606,20 +6761,23 @@ DEF_INST( subtract_bfp_short )
     GET_FLOAT32_OP( op1, r1, regs );
     VFETCH_FLOAT32_OP( op2, effective_addr2, b2, regs );
 
-    softfloat_exceptionFlags = 0;
-    SET_SF_RM_FROM_FPC;
+    if (!f32_host_sub( regs, op1, op2, &ans ))
+    {
+        softfloat_exceptionFlags = 0;
+        SET_SF_RM_FROM_FPC;
 
-    ans = f32_sub( op1, op2 );
+        ans = f32_sub( op1, op2 );
 
-    if (softfloat_exceptionFlags)
-    {
-        IEEE_EXCEPTION_TRAP_XI( regs );
-        ieee_trap_conds = ieee_exception_test_oux( regs );
+        if (softfloat_exceptionFlags)
+        {
+            IEEE_EXCEPTION_TRAP_XI( regs );
+            ieee_trap_conds = ieee_exception_test_oux( regs );
 
-        if (ieee_trap_conds & (FPC_MASK_IMO | FPC_MASK_IMU))
-            ans = f32_scaledResult( ieee_trap_conds & FPC_MASK_IMO ?
-                SCALE_FACTOR_ARITH_OFLOW_SHORT :
-                SCALE_FACTOR_ARITH_UFLOW_SHORT );
+            if (ieee_trap_conds & (FPC_MASK_IMO | FPC_MASK_IMU))
+                ans = f32_scaledResult( ieee_trap_conds & FPC_MASK_IMO ?
+                    SCALE_FACTOR_ARITH_OFLOW_SHORT :
+                    SCALE_FACTOR_ARITH_UFLOW_SHORT );
+        }
     }
 
     PUT_FLOAT32_CC( ans, r1, regs );
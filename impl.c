@@ -955,16 +955,220 @@ static void is_PCLMULQDQ_available()
 #endif // defined( _GCC_SSE2_ ) && defined( HAVE_SIGNAL_HANDLING )
 #endif /* Windows or Linux */
 
+/*-------------------------------------------------------------------*/
+/* Check if host AES instructions (AES-NI/ARMv8-CE) are available    */
+/*-------------------------------------------------------------------*/
+#if defined( FEATURE_HW_AES ) && defined( __aarch64__ )
+
+/* The Cryptography Extension was required at compile time */
+static void is_AES_available()
+{
+    sysblk.have_AES = true;
+}
+
+#elif defined( FEATURE_HW_AES ) && defined( _MSVC_ )
+
+static void is_AES_available()
+{
+    QW  mm1, mm2, acc;
+
+    mm1.v = _mm_setzero_si128();
+    mm2.v = _mm_setzero_si128();
+
+    __try
+    {
+        acc.v = _mm_aesenc_si128( mm1.v, mm2.v );
+        sysblk.have_AES = true;
+    }
+    __except( EXCEPTION_EXECUTE_HANDLER )
+    {
+        sysblk.have_AES = false;
+    }
+}
+
+#elif defined( FEATURE_HW_AES ) && defined( _GCC_SSE2_ ) && defined( HAVE_SIGNAL_HANDLING )
+
+static struct sigaction  aes_sa_CRASH   = {0};
+static struct sigaction  aes_sa_SIGILL  = {0};
+static jmp_buf aes_jmpbuff;
+
+static void aes_crash_signal_handler( int signo )
+{
+    UNREFERENCED( signo );
+    sysblk.have_AES = false;
+    longjmp( aes_jmpbuff, 4 );
+}
+
+/* Disable optimization */
+#if defined( __clang__ )
+  #pragma clang optimize off
+#else
+  #pragma GCC push_options
+  #pragma GCC diagnostic push
+  #pragma GCC optimize ("-O0")
+  #pragma GCC diagnostic ignored "-Wunused-but-set-variable"
+#endif
+
+static void is_AES_available()
+{
+    /* Install Illegal-Instruction (SIGILL) crash handler */
+    aes_sa_CRASH.sa_handler = &aes_crash_signal_handler;
+    sigaction( SIGILL, &aes_sa_CRASH, &aes_sa_SIGILL );
+
+    /* Try the problematic code... (optimization MUST be disabled;
+       see the PROGRAMMING NOTE in is_PCLMULQDQ_available above) */
+    if (setjmp( aes_jmpbuff ) == 0)
+    {
+        QW  mm1, mm2, acc;
+
+        mm1.v = _mm_setzero_si128();
+        mm2.v = _mm_setzero_si128();
+
+        acc.v = _mm_aesenc_si128( mm1.v, mm2.v );
+        sysblk.have_AES = true;
+    }
+    else // (only executed if we crashed)
+    {
+        sysblk.have_AES = false;
+    }
+
+    /* Restore original Illegal-Instruction (SIGILL) crash handler */
+    sigaction( SIGILL, &aes_sa_SIGILL, 0 );
+}
+
+/* Re-enable optimization */
+#if defined( __clang__ )
+  #pragma clang optimize on
+#else
+  #pragma GCC diagnostic pop
+  #pragma GCC pop_options
+#endif
+
+#else // !defined( FEATURE_HW_AES ), or no way to test for it
+
+static void is_AES_available()
+{
+    sysblk.have_AES = false;  /* (use the portable crypto library) */
+}
+
+#endif // defined( FEATURE_HW_AES )
+
+/*-------------------------------------------------------------------*/
+/* Check if host SHA instructions (SHA-NI/ARMv8-CE) are available    */
+/*-------------------------------------------------------------------*/
+#if defined( FEATURE_HW_SHA ) && defined( __aarch64__ )
+
+/* The SHA-1/SHA-256 instructions were required at compile time */
+static void is_SHA_available()
+{
+    sysblk.have_SHA = true;
+}
+
+#elif defined( FEATURE_HW_SHA ) && defined( _MSVC_ )
+
+static void is_SHA_available()
+{
+    QW  mm1, mm2, acc;
+
+    mm1.v = _mm_setzero_si128();
+    mm2.v = _mm_setzero_si128();
+
+    __try
+    {
+        acc.v = _mm_sha256msg1_epu32( mm1.v, mm2.v );
+        sysblk.have_SHA = true;
+    }
+    __except( EXCEPTION_EXECUTE_HANDLER )
+    {
+        sysblk.have_SHA = false;
+    }
+}
+
+#elif defined( FEATURE_HW_SHA ) && defined( _GCC_SSE2_ ) && defined( HAVE_SIGNAL_HANDLING )
+
+static struct sigaction  sha_sa_CRASH   = {0};
+static struct sigaction  sha_sa_SIGILL  = {0};
+static jmp_buf sha_jmpbuff;
+
+static void sha_crash_signal_handler( int signo )
+{
+    UNREFERENCED( signo );
+    sysblk.have_SHA = false;
+    longjmp( sha_jmpbuff, 4 );
+}
+
+/* Disable optimization */
+#if defined( __clang__ )
+  #pragma clang optimize off
+#else
+  #pragma GCC push_options
+  #pragma GCC diagnostic push
+  #pragma GCC optimize ("-O0")
+  #pragma GCC diagnostic ignored "-Wunused-but-set-variable"
+#endif
+
+static void is_SHA_available()
+{
+    /* Install Illegal-Instruction (SIGILL) crash handler */
+    sha_sa_CRASH.sa_handler = &sha_crash_signal_handler;
+    sigaction( SIGILL, &sha_sa_CRASH, &sha_sa_SIGILL );
+
+    /* Try the problematic code... (optimization MUST be disabled;
+       see the PROGRAMMING NOTE in is_PCLMULQDQ_available above) */
+    if (setjmp( sha_jmpbuff ) == 0)
+    {
+        QW  mm1, mm2, acc;
+
+        mm1.v = _mm_setzero_si128();
+        mm2.v = _mm_setzero_si128();
+
+        acc.v = _mm_sha256msg1_epu32( mm1.v, mm2.v );
+        sysblk.have_SHA = true;
+    }
+    else // (only executed if we crashed)
+    {
+        sysblk.have_SHA = false;
+    }
+
+    /* Restore original Illegal-Instruction (SIGILL) crash handler */
+    sigaction( SIGILL, &sha_sa_SIGILL, 0 );
+}
+
+/* Re-enable optimization */
+#if defined( __clang__ )
+  #pragma clang optimize on
+#else
+  #pragma GCC diagnostic pop
+  #pragma GCC pop_options
+#endif
+
+#else // !defined( FEATURE_HW_SHA ), or no way to test for it
+
+static void is_SHA_available()
+{
+    sysblk.have_SHA = false;  /* (use the portable crypto library) */
+}
+
+#endif // defined( FEATURE_HW_SHA )
+
 /* Check if various host instructions are available or not */
 static void check_host_instruction_availability()
 {
     /* Check availability of each individual host instruction first */
     is_PCLMULQDQ_available();
+    is_AES_available();
+    is_SHA_available();
 //  is_XXXXXXXXX_available();
 
     /* Then report all of the ones that aren't available */
     // "WARNING: Host does not support the '%s' instruction"
     if (!sysblk.have_PCLMULQDQ) WRMSG( HHC00026, "W", "PCLMULQDQ" );
+#if defined( FEATURE_HW_AES )
+    if (!sysblk.have_AES)       WRMSG( HHC00026, "W", "AESENC" );
+#endif
+#if defined( FEATURE_HW_SHA )
+    if (!sysblk.have_SHA)       WRMSG( HHC00026, "W", "SHA256MSG1" );
+#endif
 //  if (!sysblk.have_XXXXXXXXX) WRMSG( HHC00026, "W", "XXXXXXXXX" );
 }
 
@@ -1160,6 +1364,7 @@ int     rc, maxprio, minprio;
     sysblk.ostailor = OSTAILOR_DEFAULT;
 
     sysblk.timerint = DEF_TOD_UPDATE_USECS;
+    sysblk.waitspin = DEF_WAIT_SPIN_USECS;
 
 #if defined( _FEATURE_073_TRANSACT_EXEC_FACILITY )
     sysblk.txf_timerint = sysblk.timerint;
@@ -1197,6 +1402,12 @@ int     rc, maxprio, minprio;
     sysblk.zpbits  = DEF_CMPSC_ZP_BITS;
 #endif
 
+#if defined( OPTION_INSTR_COUNT_AND_TIME )
+    sysblk.icount_rate = DEF_ICOUNT_RATE;
+#endif
+
+    sysblk.psample_rate = DEF_PSAMPLE_RATE;
+
     /* Initialize Trace File helper function pointers */
     sysblk.s370_gsk = &s370_get_storage_key;
     sysblk.s390_gsk = &s390_get_storage_key;
@@ -1263,6 +1474,7 @@ int     rc, maxprio, minprio;
     }
     initialize_condition( &sysblk.all_synced_cond );
     initialize_condition( &sysblk.sync_done_cond );
+    initialize_condition( &sysblk.todcond );
 
     /* Copy length for regs */
     sysblk.regs_copy_len = (int)((uintptr_t)&sysblk.dummyregs.regs_copy_end
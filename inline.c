@@ -135,4 +135,39 @@ extern inline int   div_signed        ( U32* rem, U32* quot, U32 high, U32 lo, U
 extern inline int   div_logical_long  ( U64* rem, U64* quot, U64 high, U64 lo, U64 d );
 extern inline QW    bswap_128         ( QW input );
 
+/*-------------------------------------------------------------------*/
+/*                    String scanning functions                      */
+/*-------------------------------------------------------------------*/
+
+extern inline U32   lowest_set_bit       ( U32 mask );
+extern inline U32   highest_set_bit      ( U32 mask );
+extern inline U32   mem_find_byte        ( const BYTE* p, U32 len, BYTE c );
+extern inline U32   mem_find_hw          ( const BYTE* p, U32 len, U16 c );
+extern inline U32   mem_find_equ         ( const BYTE* p1, const BYTE* p2, U32 len );
+extern inline U32   mem_find_neq_or_byte ( const BYTE* p1, const BYTE* p2, U32 len, BYTE c );
+
+#if defined(_M_X64) || defined( __SSSE3__ )
+extern inline void  fct_nonzero_map      ( const BYTE* fct, __m128i* map_lo, __m128i* map_hi );
+extern inline U32   fct_nonzero_mask     ( __m128i v, __m128i map_lo, __m128i map_hi );
+#endif
+extern inline U32   mem_find_fc          ( const BYTE* p, U32 len, const BYTE* fct );
+extern inline U32   mem_find_fc_rev      ( const BYTE* p, U32 len, const BYTE* fct );
+
+/*-------------------------------------------------------------------*/
+/*                    Checksum functions                             */
+/*-------------------------------------------------------------------*/
+
+extern inline U64   mem_sum_fw           ( const BYTE* p, U32 count );
+
+/*-------------------------------------------------------------------*/
+/*                    Unicode conversion functions                   */
+/*-------------------------------------------------------------------*/
+
+extern inline U32   utf8_ascii_to_utf16  ( BYTE* d, const BYTE* s, U32 n );
+extern inline U32   utf8_ascii_to_utf32  ( BYTE* d, const BYTE* s, U32 n );
+extern inline U32   utf16_ascii_to_utf8  ( BYTE* d, const BYTE* s, U32 n );
+extern inline U32   utf32_ascii_to_utf8  ( BYTE* d, const BYTE* s, U32 n );
+extern inline U32   utf16_bmp_to_utf32   ( BYTE* d, const BYTE* s, U32 n );
+extern inline U32   utf32_bmp_to_utf16   ( BYTE* d, const BYTE* s, U32 n );
+
 #endif /*!defined( _GEN_ARCH )*/
@@ -312,6 +312,484 @@ inline QW bswap_128( QW input )
     return swapped;
 }
 
+/*-------------------------------------------------------------------*/
+/*                    String scanning functions                      */
+/*-------------------------------------------------------------------*/
+/* The below functions scan a run of contiguous mainstor bytes which */
+/* the caller guarantees does not cross a page boundary. They return */
+/* the byte index of the first match, or 'len' if nothing matched.   */
+/* Byte searches use the CRT's memchr (which every CRT we support    */
+/* already vectorizes). Searches the CRT doesn't provide are done    */
+/* 16 bytes at a time using SSE2 when available.                     */
+/*-------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------*/
+/* Return the bit number of the lowest one bit of a non-zero mask    */
+/*-------------------------------------------------------------------*/
+inline U32 lowest_set_bit( U32 mask )
+{
+#if defined( _MSC_VER )
+    unsigned long idx;
+    _BitScanForward( &idx, mask );
+    return (U32) idx;
+#else
+    return (U32) __builtin_ctz( mask );
+#endif
+}
+
+/*-------------------------------------------------------------------*/
+/* Return the bit number of the highest one bit of a non-zero mask   */
+/*-------------------------------------------------------------------*/
+inline U32 highest_set_bit( U32 mask )
+{
+#if defined( _MSC_VER )
+    unsigned long idx;
+    _BitScanReverse( &idx, mask );
+    return (U32) idx;
+#else
+    return 31 - (U32) __builtin_clz( mask );
+#endif
+}
+
+/*-------------------------------------------------------------------*/
+/* Find first byte equal to 'c'                         (SRST)       */
+/*-------------------------------------------------------------------*/
+inline U32 mem_find_byte( const BYTE* p, U32 len, BYTE c )
+{
+    const BYTE* found = memchr( p, c, len );
+    return found ? (U32)(found - p) : len;
+}
+
+/*-------------------------------------------------------------------*/
+/* Find first big-endian halfword equal to 'c'          (SRSTU)      */
+/* ('len' must be even; returned index is always even)               */
+/*-------------------------------------------------------------------*/
+inline U32 mem_find_hw( const BYTE* p, U32 len, U16 c )
+{
+    U32 i = 0;
+#if defined(_M_X64) || defined( __SSE2__ )
+    __m128i vc = _mm_set1_epi16( (short) CSWAP16( c ));
+    U32 mask;
+
+    for (; i + 16 <= len; i += 16)
+    {
+        mask = _mm_movemask_epi8( _mm_cmpeq_epi16(
+            _mm_loadu_si128( (const __m128i*)(p + i) ), vc ));
+        if (mask)
+            return i + lowest_set_bit( mask );
+    }
+#endif
+    for (; i < len; i += 2)
+        if (fetch_hw( p + i ) == c)
+            return i;
+    return len;
+}
+
+/*-------------------------------------------------------------------*/
+/* Find first position where both operands are equal   (CUSE)       */
+/*-------------------------------------------------------------------*/
+inline U32 mem_find_equ( const BYTE* p1, const BYTE* p2, U32 len )
+{
+    U32 i = 0;
+#if defined(_M_X64) || defined( __SSE2__ )
+    U32 mask;
+
+    for (; i + 16 <= len; i += 16)
+    {
+        mask = _mm_movemask_epi8( _mm_cmpeq_epi8(
+            _mm_loadu_si128( (const __m128i*)(p1 + i) ),
+            _mm_loadu_si128( (const __m128i*)(p2 + i) )));
+        if (mask)
+            return i + lowest_set_bit( mask );
+    }
+#endif
+    for (; i < len; i++)
+        if (p1[i] == p2[i])
+            return i;
+    return len;
+}
+
+/*-------------------------------------------------------------------*/
+/* Find first position where the operands differ or where operand-1  */
+/* holds the terminating character 'c'                  (CLST)       */
+/*-------------------------------------------------------------------*/
+inline U32 mem_find_neq_or_byte( const BYTE* p1, const BYTE* p2, U32 len, BYTE c )
+{
+    U32 i = 0;
+#if defined(_M_X64) || defined( __SSE2__ )
+    __m128i vc = _mm_set1_epi8( (char) c );
+    __m128i v1;
+    U32 mask;
+
+    for (; i + 16 <= len; i += 16)
+    {
+        v1   = _mm_loadu_si128( (const __m128i*)(p1 + i) );
+        mask = ~_mm_movemask_epi8( _mm_cmpeq_epi8( v1,
+                  _mm_loadu_si128( (const __m128i*)(p2 + i) )))
+             |  _mm_movemask_epi8( _mm_cmpeq_epi8( v1, vc ));
+        mask &= 0xFFFF;
+        if (mask)
+            return i + lowest_set_bit( mask );
+    }
+#endif
+    for (; i < len; i++)
+        if (p1[i] != p2[i] || p1[i] == c)
+            return i;
+    return len;
+}
+
+/*-------------------------------------------------------------------*/
+/*                 Translate-and-test scanning functions             */
+/*-------------------------------------------------------------------*/
+/* Scan a run of argument bytes (not crossing a page boundary) for   */
+/* the first one whose entry in the 256-byte function code table is  */
+/* non-zero. With SSSE3 the table is first reduced to a 256-bit map  */
+/* of its non-zero entries which is then looked up 16 argument bytes */
+/* at a time using a pair of nibble-indexed PSHUFB table lookups.    */
+/*-------------------------------------------------------------------*/
+
+#if defined(_M_X64) || defined( __SSSE3__ )
+/*-------------------------------------------------------------------*/
+/* Build the nibble bitmaps of non-zero function codes. Byte 'lo' of */
+/* 'map_lo' has bit 'hi' set when fct[hi*16+lo] != 0 for hi = 0..7,  */
+/* and 'map_hi' likewise for hi = 8..15.                             */
+/*-------------------------------------------------------------------*/
+inline void fct_nonzero_map( const BYTE* fct, __m128i* map_lo, __m128i* map_hi )
+{
+    __m128i zero = _mm_setzero_si128();
+    __m128i lo   = zero;
+    __m128i hi   = zero;
+    __m128i nz;
+    int     k;
+
+    for (k=0; k < 8; k++)
+    {
+        nz = _mm_cmpeq_epi8( _mm_loadu_si128( (const __m128i*)(fct + k*16) ), zero );
+        lo = _mm_or_si128( lo, _mm_andnot_si128( nz, _mm_set1_epi8( (char)(1 << k) )));
+
+        nz = _mm_cmpeq_epi8( _mm_loadu_si128( (const __m128i*)(fct + (k+8)*16) ), zero );
+        hi = _mm_or_si128( hi, _mm_andnot_si128( nz, _mm_set1_epi8( (char)(1 << k) )));
+    }
+
+    *map_lo = lo;
+    *map_hi = hi;
+}
+
+/*-------------------------------------------------------------------*/
+/* Return movemask of the argument bytes with a non-zero FC          */
+/*-------------------------------------------------------------------*/
+inline U32 fct_nonzero_mask( __m128i v, __m128i map_lo, __m128i map_hi )
+{
+    const __m128i nib  = _mm_set1_epi8( 0x0F );
+    const __m128i bits = _mm_setr_epi8( 1, 2, 4, 8, 16, 32, 64, -128,
+                                        1, 2, 4, 8, 16, 32, 64, -128 );
+    __m128i lo  = _mm_and_si128( v, nib );
+    __m128i hi  = _mm_and_si128( _mm_srli_epi16( v, 4 ), nib );
+    __m128i upr = _mm_cmpgt_epi8( hi, _mm_set1_epi8( 7 ));
+    __m128i row = _mm_or_si128( _mm_and_si128(    upr, _mm_shuffle_epi8( map_hi, lo )),
+                                _mm_andnot_si128( upr, _mm_shuffle_epi8( map_lo, lo )));
+    __m128i bit = _mm_shuffle_epi8( bits, hi );
+
+    return (U32) _mm_movemask_epi8( _mm_cmpeq_epi8( _mm_and_si128( row, bit ), bit ));
+}
+#endif
+
+/*-------------------------------------------------------------------*/
+/* Find first argument byte having a non-zero function code (TRT)    */
+/* Returns its index or 'len' if there is none.                      */
+/*-------------------------------------------------------------------*/
+inline U32 mem_find_fc( const BYTE* p, U32 len, const BYTE* fct )
+{
+    U32 i = 0;
+#if defined(_M_X64) || defined( __SSSE3__ )
+    if (len >= 16)
+    {
+        __m128i map_lo, map_hi;
+        U32 mask;
+
+        fct_nonzero_map( fct, &map_lo, &map_hi );
+
+        for (; i + 16 <= len; i += 16)
+        {
+            mask = fct_nonzero_mask( _mm_loadu_si128( (const __m128i*)(p + i) ), map_lo, map_hi );
+            if (mask)
+                return i + lowest_set_bit( mask );
+        }
+    }
+#endif
+    for (; i + 4 <= len; i += 4)
+        if (fct[ p[i] ] | fct[ p[i+1] ] | fct[ p[i+2] ] | fct[ p[i+3] ])
+            break;
+    for (; i < len; i++)
+        if (fct[ p[i] ])
+            return i;
+    return len;
+}
+
+/*-------------------------------------------------------------------*/
+/* Find last argument byte having a non-zero function code (TRTR)    */
+/* Returns its distance from the END of the run (0 == p[len-1]) or   */
+/* 'len' if there is none.                                           */
+/*-------------------------------------------------------------------*/
+inline U32 mem_find_fc_rev( const BYTE* p, U32 len, const BYTE* fct )
+{
+    U32 i = 0;
+#if defined(_M_X64) || defined( __SSSE3__ )
+    if (len >= 16)
+    {
+        __m128i map_lo, map_hi;
+        U32 mask;
+
+        fct_nonzero_map( fct, &map_lo, &map_hi );
+
+        for (; i + 16 <= len; i += 16)
+        {
+            mask = fct_nonzero_mask( _mm_loadu_si128( (const __m128i*)(p + len - i - 16) ), map_lo, map_hi );
+            if (mask)
+                return i + 15 - highest_set_bit( mask );
+        }
+    }
+#endif
+    for (; i < len; i++)
+        if (fct[ p[ len - 1 - i ] ])
+            return i;
+    return len;
+}
+
+/*-------------------------------------------------------------------*/
+/*                    Checksum functions                             */
+/*-------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------*/
+/* Return the 64-bit sum of 'count' big-endian fullwords     (CKSM)  */
+/* The caller folds the carries back into the 32-bit checksum.       */
+/*-------------------------------------------------------------------*/
+inline U64 mem_sum_fw( const BYTE* p, U32 count )
+{
+    U64 sum = 0;
+    U32 i = 0;
+#if defined(_M_X64) || defined( __SSE2__ )
+    if (count >= 8)
+    {
+        __m128i zero = _mm_setzero_si128();
+        __m128i acc  = zero;
+        __m128i v;
+        U64     lanes[2];
+
+        for (; i + 4 <= count; i += 4)
+        {
+            /* Byte-swap each fullword, then widen to doublewords */
+            v = _mm_loadu_si128( (const __m128i*)(p + i*4) );
+            v = _mm_or_si128( _mm_slli_epi16( v, 8 ), _mm_srli_epi16( v, 8 ));
+            v = _mm_shufflelo_epi16( v, _MM_SHUFFLE( 2, 3, 0, 1 ));
+            v = _mm_shufflehi_epi16( v, _MM_SHUFFLE( 2, 3, 0, 1 ));
+            acc = _mm_add_epi64( acc, _mm_unpacklo_epi32( v, zero ));
+            acc = _mm_add_epi64( acc, _mm_unpackhi_epi32( v, zero ));
+        }
+        _mm_storeu_si128( (__m128i*) lanes, acc );
+        sum = lanes[0] + lanes[1];
+    }
+#endif
+    for (; i < count; i++)
+        sum += fetch_fw( p + i*4 );
+    return sum;
+}
+
+/*-------------------------------------------------------------------*/
+/*                    Unicode conversion functions                   */
+/*-------------------------------------------------------------------*/
+/* The below functions convert the leading run of up to 'n' source   */
+/* characters which need no more than a change of width: ASCII for   */
+/* conversions to or from UTF-8, and non-surrogates between UTF-16   */
+/* and UTF-32. They stop at the first other character and return the */
+/* number of characters converted; nothing beyond it is stored. The  */
+/* caller guarantees neither run crosses a page boundary.            */
+/*-------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------*/
+/* UTF-8 ASCII to UTF-16                                (CU12)       */
+/*-------------------------------------------------------------------*/
+inline U32 utf8_ascii_to_utf16( BYTE* d, const BYTE* s, U32 n )
+{
+    U32 i = 0;
+#if defined(_M_X64) || defined( __SSE2__ )
+    __m128i zero = _mm_setzero_si128();
+    __m128i v;
+
+    for (; i + 16 <= n; i += 16)
+    {
+        v = _mm_loadu_si128( (const __m128i*)(s + i) );
+        if (_mm_movemask_epi8( v ))
+            break;
+        _mm_storeu_si128( (__m128i*)(d + i*2),      _mm_unpacklo_epi8( zero, v ));
+        _mm_storeu_si128( (__m128i*)(d + i*2 + 16), _mm_unpackhi_epi8( zero, v ));
+    }
+#endif
+    for (; i < n && s[i] < 0x80; i++)
+    {
+        d[i*2]   = 0;
+        d[i*2+1] = s[i];
+    }
+    return i;
+}
+
+/*-------------------------------------------------------------------*/
+/* UTF-8 ASCII to UTF-32                                (CU14)       */
+/*-------------------------------------------------------------------*/
+inline U32 utf8_ascii_to_utf32( BYTE* d, const BYTE* s, U32 n )
+{
+    U32 i = 0;
+#if defined(_M_X64) || defined( __SSE2__ )
+    __m128i zero = _mm_setzero_si128();
+    __m128i v, lo, hi;
+
+    for (; i + 16 <= n; i += 16)
+    {
+        v = _mm_loadu_si128( (const __m128i*)(s + i) );
+        if (_mm_movemask_epi8( v ))
+            break;
+        lo = _mm_unpacklo_epi8( zero, v );
+        hi = _mm_unpackhi_epi8( zero, v );
+        _mm_storeu_si128( (__m128i*)(d + i*4),      _mm_unpacklo_epi16( zero, lo ));
+        _mm_storeu_si128( (__m128i*)(d + i*4 + 16), _mm_unpackhi_epi16( zero, lo ));
+        _mm_storeu_si128( (__m128i*)(d + i*4 + 32), _mm_unpacklo_epi16( zero, hi ));
+        _mm_storeu_si128( (__m128i*)(d + i*4 + 48), _mm_unpackhi_epi16( zero, hi ));
+    }
+#endif
+    for (; i < n && s[i] < 0x80; i++)
+    {
+        d[i*4]   = 0;
+        d[i*4+1] = 0;
+        d[i*4+2] = 0;
+        d[i*4+3] = s[i];
+    }
+    return i;
+}
+
+/*-------------------------------------------------------------------*/
+/* UTF-16 0000-007F to UTF-8                            (CU21)       */
+/*-------------------------------------------------------------------*/
+inline U32 utf16_ascii_to_utf8( BYTE* d, const BYTE* s, U32 n )
+{
+    U32 i = 0;
+#if defined(_M_X64) || defined( __SSE2__ )
+    __m128i zero = _mm_setzero_si128();
+    __m128i mask = _mm_set1_epi16( (short) 0x80FF );  /* bytes FF 80 */
+    __m128i a, b;
+
+    for (; i + 16 <= n; i += 16)
+    {
+        a = _mm_loadu_si128( (const __m128i*)(s + i*2) );
+        b = _mm_loadu_si128( (const __m128i*)(s + i*2 + 16) );
+        if (_mm_movemask_epi8( _mm_cmpeq_epi8( _mm_and_si128(
+            _mm_or_si128( a, b ), mask ), zero )) != 0xFFFF)
+            break;
+        _mm_storeu_si128( (__m128i*)(d + i), _mm_packus_epi16(
+            _mm_srli_epi16( a, 8 ), _mm_srli_epi16( b, 8 )));
+    }
+#endif
+    for (; i < n && s[i*2] == 0 && s[i*2+1] < 0x80; i++)
+        d[i] = s[i*2+1];
+    return i;
+}
+
+/*-------------------------------------------------------------------*/
+/* UTF-32 00000000-0000007F to UTF-8                    (CU41)       */
+/*-------------------------------------------------------------------*/
+inline U32 utf32_ascii_to_utf8( BYTE* d, const BYTE* s, U32 n )
+{
+    U32 i = 0;
+#if defined(_M_X64) || defined( __SSE2__ )
+    __m128i zero = _mm_setzero_si128();
+    __m128i mask = _mm_set1_epi32( (int) 0x80FFFFFF );  /* FF FF FF 80 */
+    __m128i a, b, c, e;
+
+    for (; i + 16 <= n; i += 16)
+    {
+        a = _mm_loadu_si128( (const __m128i*)(s + i*4) );
+        b = _mm_loadu_si128( (const __m128i*)(s + i*4 + 16) );
+        c = _mm_loadu_si128( (const __m128i*)(s + i*4 + 32) );
+        e = _mm_loadu_si128( (const __m128i*)(s + i*4 + 48) );
+        if (_mm_movemask_epi8( _mm_cmpeq_epi8( _mm_and_si128( _mm_or_si128(
+            _mm_or_si128( a, b ), _mm_or_si128( c, e )), mask ), zero )) != 0xFFFF)
+            break;
+        _mm_storeu_si128( (__m128i*)(d + i), _mm_packus_epi16(
+            _mm_packs_epi32( _mm_srli_epi32( a, 24 ), _mm_srli_epi32( b, 24 )),
+            _mm_packs_epi32( _mm_srli_epi32( c, 24 ), _mm_srli_epi32( e, 24 ))));
+    }
+#endif
+    for (; i < n && !s[i*4] && !s[i*4+1] && !s[i*4+2] && s[i*4+3] < 0x80; i++)
+        d[i] = s[i*4+3];
+    return i;
+}
+
+/*-------------------------------------------------------------------*/
+/* UTF-16 other than D800-DBFF to UTF-32                (CU24)       */
+/*-------------------------------------------------------------------*/
+inline U32 utf16_bmp_to_utf32( BYTE* d, const BYTE* s, U32 n )
+{
+    U32 i = 0;
+#if defined(_M_X64) || defined( __SSE2__ )
+    __m128i zero = _mm_setzero_si128();
+    __m128i v;
+
+    for (; i + 8 <= n; i += 8)
+    {
+        v = _mm_loadu_si128( (const __m128i*)(s + i*2) );
+        if (_mm_movemask_epi8( _mm_cmpeq_epi16( _mm_and_si128( v,
+            _mm_set1_epi16( 0x00FC )), _mm_set1_epi16( 0x00D8 ))))
+            break;
+        _mm_storeu_si128( (__m128i*)(d + i*4),      _mm_unpacklo_epi16( zero, v ));
+        _mm_storeu_si128( (__m128i*)(d + i*4 + 16), _mm_unpackhi_epi16( zero, v ));
+    }
+#endif
+    for (; i < n && (s[i*2] & 0xFC) != 0xD8; i++)
+    {
+        d[i*4]   = 0;
+        d[i*4+1] = 0;
+        d[i*4+2] = s[i*2];
+        d[i*4+3] = s[i*2+1];
+    }
+    return i;
+}
+
+/*-------------------------------------------------------------------*/
+/* UTF-32 0000xxxx other than 0000D800-0000DBFF to UTF-16  (CU42)    */
+/*-------------------------------------------------------------------*/
+inline U32 utf32_bmp_to_utf16( BYTE* d, const BYTE* s, U32 n )
+{
+    U32 i = 0;
+#if defined(_M_X64) || defined( __SSE2__ )
+    __m128i zero = _mm_setzero_si128();
+    __m128i hi16 = _mm_set1_epi32( 0x0000FFFF );
+    __m128i surr = _mm_set1_epi32( 0x00FC0000 );
+    __m128i lead = _mm_set1_epi32( 0x00D80000 );
+    __m128i a, b;
+
+    for (; i + 8 <= n; i += 8)
+    {
+        a = _mm_loadu_si128( (const __m128i*)(s + i*4) );
+        b = _mm_loadu_si128( (const __m128i*)(s + i*4 + 16) );
+        if (0
+            || _mm_movemask_epi8( _mm_cmpeq_epi8( _mm_and_si128(
+                   _mm_or_si128( a, b ), hi16 ), zero )) != 0xFFFF
+            || _mm_movemask_epi8( _mm_or_si128(
+                   _mm_cmpeq_epi32( _mm_and_si128( a, surr ), lead ),
+                   _mm_cmpeq_epi32( _mm_and_si128( b, surr ), lead )))
+        )
+            break;
+        _mm_storeu_si128( (__m128i*)(d + i*2), _mm_packs_epi32(
+            _mm_srai_epi32( a, 16 ), _mm_srai_epi32( b, 16 )));
+    }
+#endif
+    for (; i < n && !s[i*4] && !s[i*4+1] && (s[i*4+2] & 0xFC) != 0xD8; i++)
+    {
+        d[i*2]   = s[i*4+2];
+        d[i*2+1] = s[i*4+3];
+    }
+    return i;
+}
+
 #endif // defined( _INLINE_H )
 
 /*-------------------------------------------------------------------*/
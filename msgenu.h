@@ -1441,7 +1441,7 @@ LOGM_DLL_IMPORT int  panel_command_capture( char* cmd, char** resp, bool quiet )
 #define HHC02249 "Operation complete"
 #define HHC02250 "Loading file %s to location %s"
 #define HHC02251 "Address exceeds main storage size"
-#define HHC02252 "Too many instructions! (Sorry!)"
+//efine HHC02252 (available)
 #define HHC02253 "All CPU's must be stopped %s"
 #define HHC02254 "CPU %02X is not online"
 //efine HHC02255 (available)
@@ -603,6 +603,165 @@ static inline floatn1_t f32_to_fn1( const float32_t sbf)
     return n1f;
 }
 
+#if defined( FEATURE_V128_SSE )
+/*-------------------------------------------------------------------*/
+/* Vectorized N1 Float conversions                                   */
+/*                                                                   */
+/* Each routine converts all elements of a vector at once when no    */
+/* element can raise a softfloat exception: every element is zero    */
+/* or a normal whose result is also a normal. The result then        */
+/* matches the scalar routine above bit for bit. Otherwise false is  */
+/* returned, the result is not stored, and the caller converts each  */
+/* element with the scalar routine so an exception is reported with  */
+/* the index of the element that caused it.                          */
+/*-------------------------------------------------------------------*/
+
+/*-------------------------------------------------------------------*/
+/* Unsigned 16-bit compare: a < b                                    */
+/*-------------------------------------------------------------------*/
+static inline __m128i vec_cmplt_epu16( __m128i a, __m128i b )
+{
+    const __m128i bias = _mm_set1_epi16( (short) 0x8000 );
+
+    return _mm_cmplt_epi16( _mm_xor_si128( a, bias ), _mm_xor_si128( b, bias ) );
+}
+
+/*-------------------------------------------------------------------*/
+/* Convert eight F16 Floats to N1 Floats                             */
+/*                                                                   */
+/* Input:                                                            */
+/*      x       eight f16 floats                                     */
+/*      r       pointer to the eight converted n1 floats             */
+/*                                                                   */
+/* Returns true if converted; false if an element is subnormal,      */
+/* nan or infinity.                                                  */
+/*-------------------------------------------------------------------*/
+static inline bool vec_f16_to_fn1( __m128i x, __m128i* r )
+{
+    __m128i     sign;                 /* sign bits                   */
+    __m128i     mag;                  /* exponent and fraction       */
+    __m128i     zero;                 /* zero elements               */
+    __m128i     normal;               /* normal elements             */
+
+    sign   = _mm_and_si128( x, _mm_set1_epi16( (short) 0x8000 ) );
+    mag    = _mm_and_si128( x, _mm_set1_epi16( 0x7FFF ) );
+    zero   = _mm_cmpeq_epi16( mag, _mm_setzero_si128() );
+    normal = vec_cmplt_epu16( _mm_sub_epi16( mag, _mm_set1_epi16( 0x0400 ) ),
+                              _mm_set1_epi16( 0x7800 ) );
+
+    if ( _mm_movemask_epi8( _mm_or_si128( zero, normal ) ) != 0xFFFF )
+        return false;
+
+    /* change bias (+16), then round the 10 bit fraction up to 9     */
+    /* bits; a carry out of the fraction increments the exponent     */
+    mag = _mm_srli_epi16( _mm_add_epi16( mag, _mm_set1_epi16( 0x4001 ) ), 1 );
+
+    *r = _mm_or_si128( sign, _mm_andnot_si128( zero, mag ) );
+    return true;
+}
+
+/*-------------------------------------------------------------------*/
+/* Convert eight N1 Floats to F16 Floats                             */
+/*                                                                   */
+/* Input:                                                            */
+/*      x       eight n1 floats                                      */
+/*      r       pointer to the eight converted f16 floats            */
+/*                                                                   */
+/* Returns true if converted; false if an element is nan-infinity    */
+/* or outside the f16 normal range.                                  */
+/*-------------------------------------------------------------------*/
+static inline bool vec_fn1_to_f16( __m128i x, __m128i* r )
+{
+    __m128i     sign;                 /* sign bits                   */
+    __m128i     mag;                  /* exponent and fraction       */
+    __m128i     zero;                 /* zero elements               */
+    __m128i     normal;               /* exponents 17-46             */
+
+    sign   = _mm_and_si128( x, _mm_set1_epi16( (short) 0x8000 ) );
+    mag    = _mm_and_si128( x, _mm_set1_epi16( 0x7FFF ) );
+    zero   = _mm_cmpeq_epi16( mag, _mm_setzero_si128() );
+    normal = vec_cmplt_epu16( _mm_sub_epi16( mag, _mm_set1_epi16( 17 << 9 ) ),
+                              _mm_set1_epi16( 30 << 9 ) );
+
+    if ( _mm_movemask_epi8( _mm_or_si128( zero, normal ) ) != 0xFFFF )
+        return false;
+
+    /* change bias (-16) and widen the fraction to 10 bits (exact)   */
+    mag = _mm_slli_epi16( _mm_sub_epi16( mag, _mm_set1_epi16( 16 << 9 ) ), 1 );
+
+    *r = _mm_or_si128( sign, _mm_andnot_si128( zero, mag ) );
+    return true;
+}
+
+/*-------------------------------------------------------------------*/
+/* Convert four N1 Floats to F32 Floats                              */
+/*                                                                   */
+/* Input:                                                            */
+/*      x       four n1 floats, zero extended to 32 bits             */
+/*      r       pointer to the four converted f32 floats             */
+/*                                                                   */
+/* Returns true if converted; false if an element is nan-infinity.   */
+/*-------------------------------------------------------------------*/
+static inline bool vec_fn1_to_f32( __m128i x, __m128i* r )
+{
+    __m128i     sign;                 /* sign bits                   */
+    __m128i     mag;                  /* exponent and fraction       */
+    __m128i     zero;                 /* zero elements               */
+
+    mag  = _mm_and_si128( x, _mm_set1_epi32( 0x7FFF ) );
+
+    if ( _mm_movemask_epi8( _mm_cmpeq_epi32( mag, _mm_set1_epi32( 0x7FFF ) ) ) )
+        return false;
+
+    sign = _mm_slli_epi32( _mm_and_si128( x, _mm_set1_epi32( 0x8000 ) ), 16 );
+    zero = _mm_cmpeq_epi32( mag, _mm_setzero_si128() );
+
+    /* widen the fraction to 23 bits and change bias (+96)           */
+    mag = _mm_add_epi32( _mm_slli_epi32( mag, 23-9 ), _mm_set1_epi32( 96 << 23 ) );
+
+    *r = _mm_or_si128( sign, _mm_andnot_si128( zero, mag ) );
+    return true;
+}
+
+/*-------------------------------------------------------------------*/
+/* Convert four F32 Floats to N1 Floats                              */
+/*                                                                   */
+/* Input:                                                            */
+/*      x       four f32 floats                                      */
+/*      r       pointer to the four converted n1 floats, zero        */
+/*              extended to 32 bits                                  */
+/*                                                                   */
+/* Returns true if converted; false if an element is subnormal,      */
+/* nan or infinity, or underflows or overflows the n1 exponent.      */
+/*-------------------------------------------------------------------*/
+static inline bool vec_f32_to_fn1( __m128i x, __m128i* r )
+{
+    __m128i     sign;                 /* sign bits                   */
+    __m128i     mag;                  /* exponent and fraction       */
+    __m128i     zero;                 /* zero elements               */
+    __m128i     inrange;              /* n1 exponents 0-63           */
+
+    sign = _mm_srli_epi32( _mm_and_si128( x, _mm_set1_epi32( 0x80000000 ) ), 16 );
+    mag  = _mm_and_si128( x, _mm_set1_epi32( 0x7FFFFFFF ) );
+    zero = _mm_cmpeq_epi32( mag, _mm_setzero_si128() );
+
+    /* shorten the fraction to 10 bits, round it up to 9 bits (a     */
+    /* carry increments the exponent), then change bias (-96)        */
+    mag = _mm_srli_epi32( _mm_add_epi32( _mm_srli_epi32( mag, 23-10 ),
+                                         _mm_set1_epi32( 1 ) ), 1 );
+    mag = _mm_sub_epi32( mag, _mm_set1_epi32( 96 << 9 ) );
+
+    inrange = _mm_cmpeq_epi32( _mm_and_si128( mag, _mm_set1_epi32( ~0x7FFF ) ),
+                               _mm_setzero_si128() );
+
+    if ( _mm_movemask_epi8( _mm_or_si128( zero, inrange ) ) != 0xFFFF )
+        return false;
+
+    *r = _mm_or_si128( sign, _mm_andnot_si128( zero, mag ) );
+    return true;
+}
+#endif /* defined( FEATURE_V128_SSE ) */
+
 #endif /*!defined(_NNPA_ARCH_INDEPENDENT_)*/
 
 
@@ -695,6 +854,15 @@ DEF_INST( vector_fp_convert_to_nnp )
           return;
     }
 
+#if defined( FEATURE_V128_SSE )
+    /* no element can raise an exception: convert all eight at once */
+    if ( vec_f16_to_fn1( regs->VR_Q( v2 ).v, &regs->VR_Q( v1 ).v ) )
+    {
+        ZVECTOR_END( regs );
+        return;
+    }
+#endif
+
     /* save v2 */
     VR_SAVE_LOCAL( LV2, v2 );
 
@@ -751,6 +919,17 @@ DEF_INST( vector_fp_convert_and_lengthen_from_nnp_high )
           return;
     }
 
+#if defined( FEATURE_V128_SSE )
+    /* no element can raise an exception: convert all four at once  */
+    /* (z elements 0-3 are the high host halfwords)                 */
+    if ( vec_fn1_to_f32( _mm_unpackhi_epi16( regs->VR_Q( v2 ).v, _mm_setzero_si128() ),
+                         &regs->VR_Q( v1 ).v ) )
+    {
+        ZVECTOR_END( regs );
+        return;
+    }
+#endif
+
     /* save v2 */
     VR_SAVE_LOCAL( LV2, v2 );
 
@@ -807,6 +986,15 @@ DEF_INST( vector_fp_convert_from_nnp )
           return;
     }
 
+#if defined( FEATURE_V128_SSE )
+    /* no element can raise an exception: convert all eight at once */
+    if ( vec_fn1_to_f16( regs->VR_Q( v2 ).v, &regs->VR_Q( v1 ).v ) )
+    {
+        ZVECTOR_END( regs );
+        return;
+    }
+#endif
+
     /* save v2 */
     VR_SAVE_LOCAL( LV2, v2 );
 
@@ -864,6 +1052,17 @@ DEF_INST( vector_fp_convert_and_lengthen_from_nnp_low )
           return;
     }
 
+#if defined( FEATURE_V128_SSE )
+    /* no element can raise an exception: convert all four at once  */
+    /* (z elements 4-7 are the low host halfwords)                  */
+    if ( vec_fn1_to_f32( _mm_unpacklo_epi16( regs->VR_Q( v2 ).v, _mm_setzero_si128() ),
+                         &regs->VR_Q( v1 ).v ) )
+    {
+        ZVECTOR_END( regs );
+        return;
+    }
+#endif
+
     /* save v2 */
     VR_SAVE_LOCAL( LV2, v2 );
 
@@ -921,6 +1120,22 @@ DEF_INST( vector_fp_convert_and_round_to_nnp )
           return;
     }
 
+#if defined( FEATURE_V128_SSE )
+    {
+        __m128i     n2, n3;           /* n1 floats from v2, v3       */
+
+        /* no element can raise an exception: convert all at once;  */
+        /* v2 supplies z elements 0-3, the high host halfwords      */
+        if ( vec_f32_to_fn1( regs->VR_Q( v2 ).v, &n2 )
+          && vec_f32_to_fn1( regs->VR_Q( v3 ).v, &n3 ) )
+        {
+            regs->VR_Q( v1 ).v = _mm_packus_epi32( n3, n2 );
+            ZVECTOR_END( regs );
+            return;
+        }
+    }
+#endif
+
     /* save v2 */
     VR_SAVE_LOCAL( LV2, v2 );
     VR_SAVE_LOCAL( LV3, v3 );
@@ -671,6 +671,10 @@ DISABLE_GCC_UNUSED_FUNCTION_WARNING;
  UNDEF_INST( perform_cryptographic_computation )
 #endif
 
+#if !defined( FEATURE_146_MSA_EXTENSION_FACILITY_8 ) || defined( DYNINST_146_MSA_EXTENSION_FACILITY_8 )
+ UNDEF_INST( cipher_message_with_authentication )
+#endif
+
 #if !defined( FEATURE_080_DFP_PACK_CONV_FACILITY )
  UNDEF_INST(convert_packed_to_dfp_long)
  UNDEF_INST(convert_packed_to_dfp_ext)
@@ -4511,7 +4515,7 @@ static INSTR_FUNC gen_opcode_b9xx[256][NUM_INSTR_TAB_PTRS] =
  /*B926*/ GENx37Xx390x900 ( "LBR"       , RRE  , ASMFMT_RRE      , load_byte_register                                  ),
  /*B927*/ GENx37Xx390x900 ( "LHR"       , RRE  , ASMFMT_RRE      , load_halfword_register                              ),
  /*B928*/ GENx37Xx390x900 ( "PCKMO"     , RRE  , ASMFMT_RRE      , perform_cryptographic_key_management_operation      ),
- /*B929*/ GENx___x___x___ ,
+ /*B929*/ GENx___x___x900 ( "KMA"       , RRF_b, ASMFMT_RRF_M    , cipher_message_with_authentication                  ),
  /*B92A*/ GENx37Xx390x900 ( "KMF"       , RRE  , ASMFMT_RRE      , cipher_message_with_cipher_feedback                 ),
  /*B92B*/ GENx37Xx390x900 ( "KMO"       , RRE  , ASMFMT_RRE      , cipher_message_with_output_feedback                 ),
  /*B92C*/ GENx37Xx390x900 ( "PCC"       , RRE  , ASMFMT_none     , perform_cryptographic_computation                   ),
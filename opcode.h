@@ -224,190 +224,120 @@ OPCD_DLL_IMPORT int iprint_router_func( int arch_mode, BYTE inst[], char mnemoni
 /*-------------------------------------------------------------------*/
 /*               Individual instruction counting                     */
 /*-------------------------------------------------------------------*/
+/* Each CPU counts the instructions it executes in its own private   */
+/* ICOUNT_MAP (see hstructs.h) so no locks or interlocked updates    */
+/* are needed and no cache lines are ever shared between CPUs. Only  */
+/* every 'sysblk.icount_rate'th instruction is timed, which keeps    */
+/* the overhead low enough to leave counting enabled in production.  */
+/*-------------------------------------------------------------------*/
 
 #if defined( OPTION_INSTR_COUNT_AND_TIME )
 
-#define BEG_COUNT_INSTR( _inst, _regs )                             \
-    do                                                              \
-    {                                                               \
-        if (sysblk.icount)                                          \
-        {                                                           \
-            U64 used;                                               \
-            gettimeofday(&sysblk.start_time, NULL);                 \
-            switch ((_inst)[0]) {                                   \
-            case 0x01:                                              \
-                used = sysblk.imaps.imap01[(_inst)[1]]++;           \
-                break;                                              \
-            case 0xA4:                                              \
-                used = sysblk.imaps.imapa4[(_inst)[1]]++;           \
-                break;                                              \
-            case 0xA5:                                              \
-                used = sysblk.imaps.imapa5[(_inst)[1] & 0x0F]++;    \
-                break;                                              \
-            case 0xA6:                                              \
-                used = sysblk.imaps.imapa6[(_inst)[1]]++;           \
-                break;                                              \
-            case 0xA7:                                              \
-                used = sysblk.imaps.imapa7[(_inst)[1] & 0x0F]++;    \
-                break;                                              \
-            case 0xB2:                                              \
-                used = sysblk.imaps.imapb2[(_inst)[1]]++;           \
-                break;                                              \
-            case 0xB3:                                              \
-                used = sysblk.imaps.imapb3[(_inst)[1]]++;           \
-                break;                                              \
-            case 0xB9:                                              \
-                used = sysblk.imaps.imapb9[(_inst)[1]]++;           \
-                break;                                              \
-            case 0xC0:                                              \
-                used = sysblk.imaps.imapc0[(_inst)[1] & 0x0F]++;    \
-                break;                                              \
-            case 0xC2:                                              \
-                used = sysblk.imaps.imapc2[(_inst)[1] & 0x0F]++;    \
-                break;                                              \
-            case 0xC4:                                              \
-                used = sysblk.imaps.imapc4[(_inst)[1] & 0x0F]++;    \
-                break;                                              \
-            case 0xC6:                                              \
-                used = sysblk.imaps.imapc6[(_inst)[1] & 0x0F]++;    \
-                break;                                              \
-            case 0xC8:                                              \
-                used = sysblk.imaps.imapc8[(_inst)[1] & 0x0F]++;    \
-                break;                                              \
-            case 0xE3:                                              \
-                used = sysblk.imaps.imape3[(_inst)[5]]++;           \
-                break;                                              \
-            case 0xE4:                                              \
-                used = sysblk.imaps.imape4[(_inst)[1]]++;           \
-                break;                                              \
-            case 0xE5:                                              \
-                used = sysblk.imaps.imape5[(_inst)[1]]++;           \
-                break;                                              \
-            case 0xE6:                                              \
-                if (sysblk.arch_mode == ARCH_900_IDX)               \
-                    used = sysblk.imaps.imape6[(_inst)[5]]++;       \
-                else                                                \
-                    used = sysblk.imaps.imape6[(_inst)[1]]++;       \
-                break;                                              \
-            case 0xE7:                                              \
-                used = sysblk.imaps.imape7[(_inst)[5]]++;           \
-                break;                                              \
-            case 0xEB:                                              \
-                used = sysblk.imaps.imapeb[(_inst)[5]]++;           \
-                break;                                              \
-            case 0xEC:                                              \
-                used = sysblk.imaps.imapec[(_inst)[5]]++;           \
-                break;                                              \
-            case 0xED:                                              \
-                used = sysblk.imaps.imaped[(_inst)[5]]++;           \
-                break;                                              \
-            default:                                                \
-                used = sysblk.imaps.imapxx[(_inst)[0]]++;           \
-            }                                                       \
-                                                                    \
-            if (!used)                                              \
-            {                                                       \
-                /* "%s" */                                          \
-                WRMSG( HHC02292, "I", "First use" );                \
-                ARCH_DEP( display_inst )( (_regs), (_inst) );       \
-            }                                                       \
-        }                                                           \
-    } while (0)
-
-#else // !defined( OPTION_INSTR_COUNT_AND_TIME )
+/* Extended opcode tables: name, opcode, extended opcode position
+   within the instruction and mask to apply to the extended opcode.
+   Opcode E6 is special: its extended opcode is in byte 5 for z/Arch
+   but in byte 1 for S/370 (ECPS:VM) and is handled individually.  */
+#define ICOUNT_EXT_OPCODES                                          \
+    ICOUNT_EXT( 01, 0x01, 1, 0xFF )                                 \
+    ICOUNT_EXT( A4, 0xA4, 1, 0xFF )                                 \
+    ICOUNT_EXT( A5, 0xA5, 1, 0x0F )                                 \
+    ICOUNT_EXT( A6, 0xA6, 1, 0xFF )                                 \
+    ICOUNT_EXT( A7, 0xA7, 1, 0x0F )                                 \
+    ICOUNT_EXT( B2, 0xB2, 1, 0xFF )                                 \
+    ICOUNT_EXT( B3, 0xB3, 1, 0xFF )                                 \
+    ICOUNT_EXT( B9, 0xB9, 1, 0xFF )                                 \
+    ICOUNT_EXT( C0, 0xC0, 1, 0x0F )                                 \
+    ICOUNT_EXT( C2, 0xC2, 1, 0x0F )                                 \
+    ICOUNT_EXT( C4, 0xC4, 1, 0x0F )                                 \
+    ICOUNT_EXT( C6, 0xC6, 1, 0x0F )                                 \
+    ICOUNT_EXT( C8, 0xC8, 1, 0x0F )                                 \
+    ICOUNT_EXT( CC, 0xCC, 1, 0x0F )                                 \
+    ICOUNT_EXT( E3, 0xE3, 5, 0xFF )                                 \
+    ICOUNT_EXT( E4, 0xE4, 1, 0xFF )                                 \
+    ICOUNT_EXT( E5, 0xE5, 1, 0xFF )                                 \
+    ICOUNT_EXT( E7, 0xE7, 5, 0xFF )                                 \
+    ICOUNT_EXT( EB, 0xEB, 5, 0xFF )                                 \
+    ICOUNT_EXT( EC, 0xEC, 5, 0xFF )                                 \
+    ICOUNT_EXT( ED, 0xED, 5, 0xFF )
+
+#define ICOUNT_E6_POS( _arch_mode )   ((_arch_mode) == ARCH_900_IDX ? 5 : 1)
+
+/* Each table occupies its own 256-entry page of counter slots. Page
+   0 is used for all instructions having a one byte opcode.         */
+enum
+{
+    ICOUNT_PAGE_xx = 0,
+#define ICOUNT_EXT( _name, _opcode, _pos, _mask )  ICOUNT_PAGE_ ## _name,
+    ICOUNT_EXT_OPCODES
+#undef  ICOUNT_EXT
+    ICOUNT_PAGE_E6,
+    ICOUNT_PAGES                        /* (number of slot pages)    */
+};
+
+#define ICOUNT_SLOTS        (ICOUNT_PAGES * 256)
+#define DEF_ICOUNT_RATE     1024        /* Default timing sample rate*/
 
-#define BEG_COUNT_INSTR(_inst, _regs)
+/*-------------------------------------------------------------------*/
+/*       Return the counter slot number for an instruction           */
+/*-------------------------------------------------------------------*/
+static INLINE int icount_slot( int arch_mode, const BYTE* inst )
+{
+    switch (inst[0])
+    {
+#define ICOUNT_EXT( _name, _opcode, _pos, _mask )                   \
+    case _opcode:                                                   \
+        return (ICOUNT_PAGE_ ## _name << 8) | (inst[ _pos ] & _mask);
+    ICOUNT_EXT_OPCODES
+#undef  ICOUNT_EXT
+
+    case 0xE6:
+        return (ICOUNT_PAGE_E6 << 8) | inst[ ICOUNT_E6_POS( arch_mode )];
+
+    default:
+        return inst[0];
+    }
+}
 
-#endif // defined( OPTION_INSTR_COUNT_AND_TIME )
+/* PROGRAMMING NOTE: BEG_COUNT_INSTR declares variables that are used
+   by END_COUNT_INSTR, so the two must always be used together within
+   the same block. If the instruction does not complete normally (e.g.
+   a program check longjmp) its count is kept but its timing sample is
+   simply discarded.                                                */
 
-#if defined( OPTION_INSTR_COUNT_AND_TIME )
-
-#define END_COUNT_INSTR(_inst, _regs)                               \
-    do                                                              \
+#define BEG_COUNT_INSTR( _inst, _regs )                             \
+                                                                    \
+    ICOUNT_MAP*  _icmap  = NULL;                                    \
+    int          _icslot = 0;                                       \
+    TOD          _icbeg  = 0;                                       \
+                                                                    \
+    if (unlikely( sysblk.icount ))                                  \
     {                                                               \
-        if (sysblk.icount)                                          \
+        if ((_icmap = sysblk.icount_map[ HOST( _regs )->cpuad ]))   \
         {                                                           \
-            struct timeval end_time;                                \
-            struct timeval dur;                                     \
-            U64 elapsed_usecs;                                      \
+            _icslot = icount_slot( (_regs)->arch_mode, (_inst) );   \
+            _icmap->count[ _icslot ]++;                             \
                                                                     \
-            gettimeofday(&end_time, NULL);                          \
-            timeval_subtract(&sysblk.start_time, &end_time, &dur);  \
-            elapsed_usecs = (dur.tv_sec * 1000000) + dur.tv_usec;   \
-                                                                    \
-            switch ((_inst)[0]) {                                   \
-            case 0x01:                                              \
-                sysblk.imaps.imap01T[(_inst)[1]]+=elapsed_usecs;    \
-                break;                                              \
-            case 0xA4:                                              \
-                sysblk.imaps.imapa4T[(_inst)[1]]+=elapsed_usecs;    \
-                break;                                              \
-            case 0xA5:                                              \
-                sysblk.imaps.imapa5T[(_inst)[1] & 0x0F]+=elapsed_usecs;   \
-                break;                                              \
-            case 0xA6:                                              \
-                sysblk.imaps.imapa6T[(_inst)[1]]+=elapsed_usecs;    \
-                break;                                              \
-            case 0xA7:                                              \
-                sysblk.imaps.imapa7T[(_inst)[1] & 0x0F]+=elapsed_usecs;   \
-                break;                                              \
-            case 0xB2:                                              \
-                sysblk.imaps.imapb2T[(_inst)[1]]+=elapsed_usecs;    \
-                break;                                              \
-            case 0xB3:                                              \
-                sysblk.imaps.imapb3T[(_inst)[1]]+=elapsed_usecs;    \
-                break;                                              \
-            case 0xB9:                                              \
-                sysblk.imaps.imapb9T[(_inst)[1]]+=elapsed_usecs;    \
-                break;                                              \
-            case 0xC0:                                              \
-                sysblk.imaps.imapc0T[(_inst)[1] & 0x0F]+=elapsed_usecs;   \
-                break;                                              \
-            case 0xC2:                                              \
-                sysblk.imaps.imapc2T[(_inst)[1] & 0x0F]+=elapsed_usecs;   \
-                break;                                              \
-            case 0xC4:                                              \
-                sysblk.imaps.imapc4T[(_inst)[1] & 0x0F]+=elapsed_usecs;   \
-                break;                                              \
-            case 0xC6:                                              \
-                sysblk.imaps.imapc6T[(_inst)[1] & 0x0F]+=elapsed_usecs;   \
-                break;                                              \
-            case 0xC8:                                              \
-                sysblk.imaps.imapc8T[(_inst)[1] & 0x0F]+=elapsed_usecs;   \
-                break;                                              \
-            case 0xE3:                                              \
-                sysblk.imaps.imape3T[(_inst)[5]]+=elapsed_usecs;    \
-                break;                                              \
-            case 0xE4:                                              \
-                sysblk.imaps.imape4T[(_inst)[1]]+=elapsed_usecs;    \
-                break;                                              \
-            case 0xE5:                                              \
-                sysblk.imaps.imape5T[(_inst)[1]]+=elapsed_usecs;    \
-                break;                                              \
-            case 0xE6:                                              \
-                sysblk.imaps.imape6T[(_inst)[5]]+=elapsed_usecs;    \
-                break;                                              \
-            case 0xE7:                                              \
-                sysblk.imaps.imape7T[(_inst)[5]]+=elapsed_usecs;    \
-                break;                                              \
-            case 0xEB:                                              \
-                sysblk.imaps.imapebT[(_inst)[5]]+=elapsed_usecs;    \
-                break;                                              \
-            case 0xEC:                                              \
-                sysblk.imaps.imapecT[(_inst)[5]]+=elapsed_usecs;    \
-                break;                                              \
-            case 0xED:                                              \
-                sysblk.imaps.imapedT[(_inst)[5]]+=elapsed_usecs;    \
-                break;                                              \
-            default:                                                \
-                sysblk.imaps.imapxxT[(_inst)[0]]+=elapsed_usecs;    \
+            if (unlikely( !_icmap->tick-- ))                        \
+            {                                                       \
+                _icmap->tick = sysblk.icount_rate - 1;              \
+                _icbeg = host_tod();                                \
             }                                                       \
         }                                                           \
-    } while (0)
+    }
 
+#define END_COUNT_INSTR( _inst, _regs )                             \
+                                                                    \
+    if (unlikely( _icbeg ))                                         \
+    {                                                               \
+        _icmap->time[ _icslot ] += host_tod() - _icbeg;             \
+        _icmap->samples[ _icslot ]++;                               \
+    }
 
 #else // !defined( OPTION_INSTR_COUNT_AND_TIME )
-#define END_COUNT_INSTR(_inst, _regs)
+
+#define BEG_COUNT_INSTR( _inst, _regs )
+#define END_COUNT_INSTR( _inst, _regs )
+
 #endif // defined( OPTION_INSTR_COUNT_AND_TIME )
 
 
@@ -2677,18 +2607,21 @@ void channelset_reset(REGS *regs);
 void s370_store_psw (REGS *regs, BYTE *addr);
 int  s370_load_psw (REGS *regs, BYTE *addr);
 void s370_process_trace( REGS* regs, BYTE* dest );
+void s370_psample_fill( REGS* regs, PSAMPLE* ent );
 #endif
 
 #if defined( _390 )
 int  s390_load_psw (REGS *regs, BYTE *addr);
 void s390_store_psw (REGS *regs, BYTE *addr);
 void s390_process_trace( REGS* regs, BYTE* dest );
+void s390_psample_fill( REGS* regs, PSAMPLE* ent );
 #endif
 
 #if defined( _900 )
 int  z900_load_psw (REGS *regs, BYTE *addr);
 void z900_store_psw (REGS *regs, BYTE *addr);
 void z900_process_trace( REGS* regs, BYTE* dest );
+void z900_psample_fill( REGS* regs, PSAMPLE* ent );
 #endif
 
 int cpu_init (int cpu, REGS *regs, REGS *hostregs);
@@ -2718,6 +2651,9 @@ char* str_arch_psw( int arch_mode, REGS* regs, char* buf, int buflen );
 #define DO_AUTOMATIC_TRACING() if (sysblk.auto_trace_amt) do_automatic_tracing();
 void do_automatic_tracing();
 
+#define DO_PSW_SAMPLING()      if (regs->psample_req) psample_record( regs );
+void psample_record( REGS* regs );
+
 
 /* Functions in module vm.c */
 int  ARCH_DEP( diag_devtype )      (     int r1, int r2, REGS *regs);
@@ -2846,6 +2782,7 @@ void ARCH_DEP( stack_extract ) (VADR lsea, int r1, int code, REGS *regs);
 void ARCH_DEP( unstack_registers ) (int gtype, VADR lsea, int r1,
     int r2, REGS *regs);
 int  ARCH_DEP( program_return_unstack ) (REGS *regs, RADR *lsedap, int *rc);
+int  ARCH_DEP( stack_backtrace ) (REGS *regs, U64 *frame, int maxdepth);
 
 
 /* Functions in module trace.c */
@@ -3568,6 +3505,10 @@ DEF_INST( cipher_message_with_output_feedback );
 DEF_INST( cipher_message_with_counter );
 #endif
 
+#if defined( FEATURE_146_MSA_EXTENSION_FACILITY_8 )
+DEF_INST( cipher_message_with_authentication );
+#endif
+
 #if defined( FEATURE_080_DFP_PACK_CONV_FACILITY )
 DEF_INST(convert_packed_to_dfp_ext);
 DEF_INST(convert_packed_to_dfp_long);
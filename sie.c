@@ -1226,6 +1226,9 @@ sie_fetch_instruction:
 
                 /* Perform automatic instruction tracing if it's enabled */
                 DO_AUTOMATIC_TRACING();
+
+                /* Take a PSW sample if the timer thread asked for one */
+                DO_PSW_SAMPLING();
                 goto endloop;
 
 #if defined( FEATURE_073_TRANSACT_EXEC_FACILITY )
@@ -1260,6 +1263,9 @@ txf_facility_loop:
 
                 /* Perform automatic instruction tracing if it's enabled */
                 DO_AUTOMATIC_TRACING();
+
+                /* Take a PSW sample if the timer thread asked for one */
+                DO_PSW_SAMPLING();
                 goto endloop;
 
 txf_slower_loop:
@@ -1287,6 +1293,9 @@ txf_slower_loop:
 
                 /* Perform automatic instruction tracing if it's enabled */
                 DO_AUTOMATIC_TRACING();
+
+                /* Take a PSW sample if the timer thread asked for one */
+                DO_PSW_SAMPLING();
                 goto endloop;
 
 #endif /* defined( FEATURE_073_TRANSACT_EXEC_FACILITY ) */
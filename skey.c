@@ -131,5 +131,8 @@ extern inline BYTE ARCH_DEP(  _get_dev_storage_key  )( DEVBLK* dev, U64 abs,
   extern inline BYTE* _get_storekey2_ptr( U64 abs );
   extern inline BYTE* _get_dev_storekey1_ptr( DEVBLK* dev, U64 abs );
   extern inline BYTE* _get_dev_storekey2_ptr( DEVBLK* dev, U64 abs );
+  extern inline U64   _find_next_storekey( U64 abs, U64 end, BYTE bits );
+  extern inline U64   _find_prev_storekey( U64 abs, U64 end, BYTE bits );
+  extern inline U64   _get_4K_storekey_bitmap( U64 abs, BYTE bits );
 
 #endif /*!defined( _GEN_ARCH )*/
@@ -74,6 +74,92 @@ inline BYTE* _get_dev_storekey2_ptr( DEVBLK* dev, U64 abs )
     return &STOREKEY2( abs, dev );
 }
 
+/*-------------------------------------------------------------------*/
+/*  Word-at-a-time storage key scanning helpers. The storkeys array  */
+/*  remains the ONLY copy of the reference and change bits; these    */
+/*  helpers merely examine eight key bytes per load so that scans    */
+/*  for changed or referenced pages skip clean storage quickly,      */
+/*  while the per-store paths that set R/C bits stay untouched.      */
+/*-------------------------------------------------------------------*/
+
+#define SKEY_BYTES( bits )    ((U64)(BYTE)(bits) * 0x0101010101010101ULL)
+
+/*  Return the absolute address of the first storkeys unit within    */
+/*  [abs, end) having any of the requested key bits on, else 'end'.  */
+
+inline U64 _find_next_storekey( U64 abs, U64 end, BYTE bits )
+{
+    U64   i    = abs >> _STORKEY_ARRAY_SHIFTAMT;
+    U64   n    = end >> _STORKEY_ARRAY_SHIFTAMT;
+    U64   mask = SKEY_BYTES( bits );
+    BYTE* skey = sysblk.storkeys;
+
+    for (; i < n && (i & 7); i++)
+        if (skey[i] & bits)
+            return i << _STORKEY_ARRAY_SHIFTAMT;
+
+    for (; i + 8 <= n; i += 8)
+        if (fetch_dw_noswap( skey + i ) & mask)
+            break;
+
+    for (; i < n; i++)
+        if (skey[i] & bits)
+            return i << _STORKEY_ARRAY_SHIFTAMT;
+
+    return end;
+}
+
+/*  Return the absolute address of the last storkeys unit within     */
+/*  [abs, end) having any of the requested key bits on, else 'end'.  */
+
+inline U64 _find_prev_storekey( U64 abs, U64 end, BYTE bits )
+{
+    U64   i    = abs >> _STORKEY_ARRAY_SHIFTAMT;
+    U64   n    = end >> _STORKEY_ARRAY_SHIFTAMT;
+    U64   mask = SKEY_BYTES( bits );
+    BYTE* skey = sysblk.storkeys;
+
+    for (; n > i && (n & 7); n--)
+        if (skey[n-1] & bits)
+            return (n-1) << _STORKEY_ARRAY_SHIFTAMT;
+
+    for (; n >= i + 8; n -= 8)
+        if (fetch_dw_noswap( skey + n - 8 ) & mask)
+            break;
+
+    for (; n > i; n--)
+        if (skey[n-1] & bits)
+            return (n-1) << _STORKEY_ARRAY_SHIFTAMT;
+
+    return end;
+}
+
+/*  Return a bitmap of which of the 64 consecutive 4K frames at      */
+/*  'abs' have any of the requested key bits on. The first frame is  */
+/*  reported in the leftmost (most significant) bit, as RRBM/IRBM    */
+/*  require. Eight clear key bytes are skipped with a single test.   */
+
+inline U64 _get_4K_storekey_bitmap( U64 abs, BYTE bits )
+{
+    const U64  per  = STORAGE_KEY_4K_PAGESIZE >> _STORKEY_ARRAY_SHIFTAMT;
+    U64   mask   = SKEY_BYTES( bits );
+    U64   bitmap = 0;
+    BYTE* skey   = sysblk.storkeys + (abs >> _STORKEY_ARRAY_SHIFTAMT);
+    U64   i, j;
+
+    for (i=0; i < 64 * per; i += 8)
+    {
+        if (!(fetch_dw_noswap( skey + i ) & mask))
+            continue;
+
+        for (j=i; j < i + 8; j++)
+            if (skey[j] & bits)
+                bitmap |= 0x8000000000000000ULL >> (j / per);
+    }
+
+    return bitmap;
+}
+
 #endif // defined( _SKEY_H )
 
 /*-------------------------------------------------------------------*/
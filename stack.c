@@ -1375,6 +1375,116 @@ VADR    lsep;                           /* Virtual addr of entry desc.
 } /* end function ARCH_DEP(program_return_unstack) */
 
 
+/*-------------------------------------------------------------------*/
+/* Linkage stack backtrace  (for the 'psample' PSW sampler)          */
+/*                                                                   */
+/* Input:                                                            */
+/*      iregs   Pointer to the CPU register context                  */
+/*      frame   Pointer to an array of at least maxdepth entries     */
+/*      maxdepth Maximum number of state entries to be examined     */
+/* Output:                                                           */
+/*      The return address from each BAKR or PC state entry, most    */
+/*      recent entry first, is stored into the frame array.          */
+/*      The number of return addresses stored is returned as the     */
+/*      function return value.                                       */
+/*                                                                   */
+/*      The walk is done using a temporary copy of the registers,    */
+/*      the same way virt_to_real does, so a translation exception   */
+/*      or a malformed stack simply ends the backtrace instead of    */
+/*      generating a program check on the CPU being sampled.         */
+/*-------------------------------------------------------------------*/
+int ARCH_DEP( stack_backtrace )( REGS* iregs, U64* frame, int maxdepth )
+{
+REGS   *regs;                           /* Temporary working copy    */
+volatile int depth = 0;                 /* Number of frames stored   */
+int     n;                              /* Entries examined          */
+VADR    lsea;                           /* Linkage stack entry addr  */
+RADR    abs;                            /* Absolute address          */
+VADR    bsea;                           /* Backward stack entry addr */
+LSED    lsed;                           /* Linkage stack entry desc. */
+#if !defined(FEATURE_001_ZARCH_INSTALLED_FACILITY)
+U32     retna;                          /* ESA/390 return address    */
+#endif
+
+    /* No linkage stack if ASF is not enabled or if DAT is off */
+    if (maxdepth <= 0
+        || !ASF_ENABLED(iregs)
+        || REAL_MODE(&iregs->psw))
+        return 0;
+
+    if (!(regs = copy_regs( iregs )))
+        return 0;
+
+    if (!setjmp( regs->progjmp ))
+    {
+        if (SIE_MODE( regs ))
+            memcpy( HOSTREGS->progjmp, regs->progjmp, sizeof( jmp_buf ));
+
+        /* Start with the current entry designated by CR15 */
+        lsea = regs->CR(15) & CR15_LSEA;
+
+        /* (a header may precede each state entry, hence the 2x) */
+        for (n=0; depth < maxdepth && n < 2 * maxdepth; n++)
+        {
+            abs = ARCH_DEP(abs_stack_addr) (lsea, regs, ACCTYPE_READ);
+            memcpy (&lsed, regs->mainstor+abs, sizeof(LSED));
+
+            /* Follow a header entry back to the previous section */
+            if ((lsed.uet & LSED_UET_ET) == LSED_UET_HDR)
+            {
+                lsea -= 8;
+                LSEA_WRAP(lsea);
+                abs = ARCH_DEP(abs_stack_addr) (lsea, regs, ACCTYPE_READ);
+                FETCH_BSEA(bsea,regs->mainstor + abs);
+
+                /* Stop at the bottom of the stack */
+                if ((bsea & LSHE_BVALID) == 0)
+                    break;
+
+                lsea = bsea & LSHE_BSEA;
+                continue;
+            }
+
+            /* Stop at anything other than a state entry */
+            if ((lsed.uet & LSED_UET_ET) != LSED_UET_BAKR
+                && (lsed.uet & LSED_UET_ET) != LSED_UET_PC)
+                break;
+
+            /* Point to the instruction address of the stacked PSW */
+            lsea -= LSSE_SIZE - sizeof(LSED);
+#if defined(FEATURE_001_ZARCH_INSTALLED_FACILITY)
+            lsea += 168;
+#else
+            lsea += 140;
+#endif
+            LSEA_WRAP(lsea);
+            abs = ARCH_DEP(abs_stack_addr) (lsea, regs, ACCTYPE_READ);
+
+#if defined(FEATURE_001_ZARCH_INSTALLED_FACILITY)
+            FETCH_DW(frame[depth], regs->mainstor + abs);
+#else
+            FETCH_FW(retna, regs->mainstor + abs);
+            frame[depth] = retna & 0x7FFFFFFF;
+#endif
+            depth++;
+
+            /* Point back to the entry descriptor of previous entry */
+#if defined(FEATURE_001_ZARCH_INSTALLED_FACILITY)
+            lsea -= 168 + sizeof(LSED);
+#else
+            lsea -= 140 + sizeof(LSED);
+#endif
+            LSEA_WRAP(lsea);
+        }
+    }
+
+    free_aligned( regs );   /* (discard temporary REGS working copy) */
+
+    return depth;
+
+} /* end function ARCH_DEP(stack_backtrace) */
+
+
 #endif /*defined(FEATURE_LINKAGE_STACK)*/
 
 
@@ -7,5 +7,26 @@ loadcore  "$(testpath)/CMPSC.core"
 runtest   1
 *Done
 
+*Testcase CMPSC dictionary changed between executions
+*
+*  Alter one expansion character of an index symbol used by the
+*  compressed data and expand again: the new dictionary contents
+*  must be used, not whatever was seen by the prior execution.
+*  (BE GOODEOJ is made unconditional as the data no longer matches)
+*
+r 278=47F0
+r 32833=31
+runtest   1
+*Compare
+r 3000.10
+*Want "Changed ECE"  02C5E2C4 40404040 40400031 40400001
+*
+r 32833=30
+runtest   1
+*Compare
+r 3000.10
+*Want "Restored ECE" 02C5E2C4 40404040 40400030 40400001
+*Done
+
 ## r 1000.140   # Original data
 ## r 3000.140   # Expanded data
@@ -0,0 +1,324 @@
+*Testcase bfp-host: BFP arithmetic on and off the host FPU fast path
+
+* Short and long BFP add, subtract, multiply and divide are done by the
+* host FPU when the FPC selects round to nearest, the IEEE-inexact mask
+* is off and the inexact flag is already on, the operands are normal
+* and the host result is normal. Everything else must be done exactly
+* as SoftFloat does it. Each case loads the FPC, runs one instruction
+* on F0 and F2 and stores the result, the FPC and the program
+* interruption code, if any, at X'2000' + 16 * case. The cases include
+* inexact results with the inexact flag off, non-default rounding
+* modes, inexact and underflow traps, tiny, smallest normal and
+* overflowing results.
+* The expected values were taken from a build without the fast path.
+
+sysclear
+archlvl z/Arch
+
+r 1a0=00000001800000000000000000000200  # z/Arch restart PSW
+r 1d0=00000001800000000000000000000700  # z/Arch pgm new PSW
+
+r 200=B70007F0                          # LCTL  R0,R0,X'7F0'
+r 204=C09100001000                      # LGFI  R9,X'1000'    operands
+r 20A=C0B100002000                      # LGFI  R11,X'2000'   results
+r 210=41A0B00C                          # LA    R10,X'C'(R11)
+r 214=B29D9800                          # LFPC  X'800'(R9)
+r 218=68009000                          # LD    F0,X'0'(R9)
+r 21C=68209008                          # LD    F2,X'8'(R9)
+r 220=B31A0002                          # ADBR  F0,F2     ADBR inexact
+r 224=6000B000                          # STD   F0,X'0'(R11)
+r 228=B29CB008                          # STFPC X'8'(R11)
+r 22C=41A0B01C                          # LA    R10,X'1C'(R11)
+r 230=B29D9804                          # LFPC  X'804'(R9)
+r 234=68009010                          # LD    F0,X'10'(R9)
+r 238=68209018                          # LD    F2,X'18'(R9)
+r 23C=B31A0002                          # ADBR  F0,F2     ADBR exact
+r 240=6000B010                          # STD   F0,X'10'(R11)
+r 244=B29CB018                          # STFPC X'18'(R11)
+r 248=41A0B02C                          # LA    R10,X'2C'(R11)
+r 24C=B29D9808                          # LFPC  X'808'(R9)
+r 250=68009020                          # LD    F0,X'20'(R9)
+r 254=68209028                          # LD    F2,X'28'(R9)
+r 258=B31A0002                          # ADBR  F0,F2     ADBR inexact, X flag off
+r 25C=6000B020                          # STD   F0,X'20'(R11)
+r 260=B29CB028                          # STFPC X'28'(R11)
+r 264=41A0B03C                          # LA    R10,X'3C'(R11)
+r 268=B29D980C                          # LFPC  X'80C'(R9)
+r 26C=68009030                          # LD    F0,X'30'(R9)
+r 270=68209038                          # LD    F2,X'38'(R9)
+r 274=B31A0002                          # ADBR  F0,F2     ADBR toward zero
+r 278=6000B030                          # STD   F0,X'30'(R11)
+r 27C=B29CB038                          # STFPC X'38'(R11)
+r 280=41A0B04C                          # LA    R10,X'4C'(R11)
+r 284=B29D9810                          # LFPC  X'810'(R9)
+r 288=68009040                          # LD    F0,X'40'(R9)
+r 28C=68209048                          # LD    F2,X'48'(R9)
+r 290=B31A0002                          # ADBR  F0,F2     ADBR toward +infinity
+r 294=6000B040                          # STD   F0,X'40'(R11)
+r 298=B29CB048                          # STFPC X'48'(R11)
+r 29C=41A0B05C                          # LA    R10,X'5C'(R11)
+r 2A0=B29D9814                          # LFPC  X'814'(R9)
+r 2A4=68009050                          # LD    F0,X'50'(R9)
+r 2A8=68209058                          # LD    F2,X'58'(R9)
+r 2AC=B31A0002                          # ADBR  F0,F2     ADBR toward -infinity
+r 2B0=6000B050                          # STD   F0,X'50'(R11)
+r 2B4=B29CB058                          # STFPC X'58'(R11)
+r 2B8=41A0B06C                          # LA    R10,X'6C'(R11)
+r 2BC=B29D9818                          # LFPC  X'818'(R9)
+r 2C0=68009060                          # LD    F0,X'60'(R9)
+r 2C4=68209068                          # LD    F2,X'68'(R9)
+r 2C8=B31B0002                          # SDBR  F0,F2     SDBR tie to even
+r 2CC=6000B060                          # STD   F0,X'60'(R11)
+r 2D0=B29CB068                          # STFPC X'68'(R11)
+r 2D4=41A0B07C                          # LA    R10,X'7C'(R11)
+r 2D8=B29D981C                          # LFPC  X'81C'(R9)
+r 2DC=68009070                          # LD    F0,X'70'(R9)
+r 2E0=68209078                          # LD    F2,X'78'(R9)
+r 2E4=B31B0002                          # SDBR  F0,F2     SDBR toward zero
+r 2E8=6000B070                          # STD   F0,X'70'(R11)
+r 2EC=B29CB078                          # STFPC X'78'(R11)
+r 2F0=41A0B08C                          # LA    R10,X'8C'(R11)
+r 2F4=B29D9820                          # LFPC  X'820'(R9)
+r 2F8=68009080                          # LD    F0,X'80'(R9)
+r 2FC=68209088                          # LD    F2,X'88'(R9)
+r 300=B31C0002                          # MDBR  F0,F2     MDBR inexact, IMX trap
+r 304=6000B080                          # STD   F0,X'80'(R11)
+r 308=B29CB088                          # STFPC X'88'(R11)
+r 30C=41A0B09C                          # LA    R10,X'9C'(R11)
+r 310=B29D9824                          # LFPC  X'824'(R9)
+r 314=68009090                          # LD    F0,X'90'(R9)
+r 318=68209098                          # LD    F2,X'98'(R9)
+r 31C=B31C0002                          # MDBR  F0,F2     MDBR exact, IMX enabled
+r 320=6000B090                          # STD   F0,X'90'(R11)
+r 324=B29CB098                          # STFPC X'98'(R11)
+r 328=41A0B0AC                          # LA    R10,X'AC'(R11)
+r 32C=B29D9828                          # LFPC  X'828'(R9)
+r 330=680090A0                          # LD    F0,X'A0'(R9)
+r 334=682090A8                          # LD    F2,X'A8'(R9)
+r 338=B31C0002                          # MDBR  F0,F2     MDBR tiny exact
+r 33C=6000B0A0                          # STD   F0,X'A0'(R11)
+r 340=B29CB0A8                          # STFPC X'A8'(R11)
+r 344=41A0B0BC                          # LA    R10,X'BC'(R11)
+r 348=B29D982C                          # LFPC  X'82C'(R9)
+r 34C=680090B0                          # LD    F0,X'B0'(R9)
+r 350=682090B8                          # LD    F2,X'B8'(R9)
+r 354=B31C0002                          # MDBR  F0,F2     MDBR tiny inexact
+r 358=6000B0B0                          # STD   F0,X'B0'(R11)
+r 35C=B29CB0B8                          # STFPC X'B8'(R11)
+r 360=41A0B0CC                          # LA    R10,X'CC'(R11)
+r 364=B29D9830                          # LFPC  X'830'(R9)
+r 368=680090C0                          # LD    F0,X'C0'(R9)
+r 36C=682090C8                          # LD    F2,X'C8'(R9)
+r 370=B31C0002                          # MDBR  F0,F2     MDBR smallest normal
+r 374=6000B0C0                          # STD   F0,X'C0'(R11)
+r 378=B29CB0C8                          # STFPC X'C8'(R11)
+r 37C=41A0B0DC                          # LA    R10,X'DC'(R11)
+r 380=B29D9834                          # LFPC  X'834'(R9)
+r 384=680090D0                          # LD    F0,X'D0'(R9)
+r 388=682090D8                          # LD    F2,X'D8'(R9)
+r 38C=B31C0002                          # MDBR  F0,F2     MDBR tiny rounds to normal
+r 390=6000B0D0                          # STD   F0,X'D0'(R11)
+r 394=B29CB0D8                          # STFPC X'D8'(R11)
+r 398=41A0B0EC                          # LA    R10,X'EC'(R11)
+r 39C=B29D9838                          # LFPC  X'838'(R9)
+r 3A0=680090E0                          # LD    F0,X'E0'(R9)
+r 3A4=682090E8                          # LD    F2,X'E8'(R9)
+r 3A8=B31C0002                          # MDBR  F0,F2     MDBR largest normal
+r 3AC=6000B0E0                          # STD   F0,X'E0'(R11)
+r 3B0=B29CB0E8                          # STFPC X'E8'(R11)
+r 3B4=41A0B0FC                          # LA    R10,X'FC'(R11)
+r 3B8=B29D983C                          # LFPC  X'83C'(R9)
+r 3BC=680090F0                          # LD    F0,X'F0'(R9)
+r 3C0=682090F8                          # LD    F2,X'F8'(R9)
+r 3C4=B31D0002                          # DDBR  F0,F2     DDBR overflow
+r 3C8=6000B0F0                          # STD   F0,X'F0'(R11)
+r 3CC=B29CB0F8                          # STFPC X'F8'(R11)
+r 3D0=41A0B10C                          # LA    R10,X'10C'(R11)
+r 3D4=B29D9840                          # LFPC  X'840'(R9)
+r 3D8=68009100                          # LD    F0,X'100'(R9)
+r 3DC=68209108                          # LD    F2,X'108'(R9)
+r 3E0=B31D0002                          # DDBR  F0,F2     DDBR inexact
+r 3E4=6000B100                          # STD   F0,X'100'(R11)
+r 3E8=B29CB108                          # STFPC X'108'(R11)
+r 3EC=41A0B11C                          # LA    R10,X'11C'(R11)
+r 3F0=B29D9844                          # LFPC  X'844'(R9)
+r 3F4=68009110                          # LD    F0,X'110'(R9)
+r 3F8=68209118                          # LD    F2,X'118'(R9)
+r 3FC=B31D0002                          # DDBR  F0,F2     DDBR tiny exact, IMU trap
+r 400=6000B110                          # STD   F0,X'110'(R11)
+r 404=B29CB118                          # STFPC X'118'(R11)
+r 408=41A0B12C                          # LA    R10,X'12C'(R11)
+r 40C=B29D9848                          # LFPC  X'848'(R9)
+r 410=78009120                          # LE    F0,X'120'(R9)
+r 414=78209124                          # LE    F2,X'124'(R9)
+r 418=B30A0002                          # AEBR  F0,F2     AEBR inexact
+r 41C=7000B120                          # STE   F0,X'120'(R11)
+r 420=B29CB128                          # STFPC X'128'(R11)
+r 424=41A0B13C                          # LA    R10,X'13C'(R11)
+r 428=B29D984C                          # LFPC  X'84C'(R9)
+r 42C=78009130                          # LE    F0,X'130'(R9)
+r 430=78209134                          # LE    F2,X'134'(R9)
+r 434=B30A0002                          # AEBR  F0,F2     AEBR toward zero
+r 438=7000B130                          # STE   F0,X'130'(R11)
+r 43C=B29CB138                          # STFPC X'138'(R11)
+r 440=41A0B14C                          # LA    R10,X'14C'(R11)
+r 444=B29D9850                          # LFPC  X'850'(R9)
+r 448=78009140                          # LE    F0,X'140'(R9)
+r 44C=78209144                          # LE    F2,X'144'(R9)
+r 450=B30A0002                          # AEBR  F0,F2     AEBR inexact, X flag off
+r 454=7000B140                          # STE   F0,X'140'(R11)
+r 458=B29CB148                          # STFPC X'148'(R11)
+r 45C=41A0B15C                          # LA    R10,X'15C'(R11)
+r 460=B29D9854                          # LFPC  X'854'(R9)
+r 464=78009150                          # LE    F0,X'150'(R9)
+r 468=78209154                          # LE    F2,X'154'(R9)
+r 46C=B30B0002                          # SEBR  F0,F2     SEBR tie to even
+r 470=7000B150                          # STE   F0,X'150'(R11)
+r 474=B29CB158                          # STFPC X'158'(R11)
+r 478=41A0B16C                          # LA    R10,X'16C'(R11)
+r 47C=B29D9858                          # LFPC  X'858'(R9)
+r 480=78009160                          # LE    F0,X'160'(R9)
+r 484=78209164                          # LE    F2,X'164'(R9)
+r 488=B3170002                          # MEEBR F0,F2     MEEBR tiny exact
+r 48C=7000B160                          # STE   F0,X'160'(R11)
+r 490=B29CB168                          # STFPC X'168'(R11)
+r 494=41A0B17C                          # LA    R10,X'17C'(R11)
+r 498=B29D985C                          # LFPC  X'85C'(R9)
+r 49C=78009170                          # LE    F0,X'170'(R9)
+r 4A0=78209174                          # LE    F2,X'174'(R9)
+r 4A4=B3170002                          # MEEBR F0,F2     MEEBR tiny inexact
+r 4A8=7000B170                          # STE   F0,X'170'(R11)
+r 4AC=B29CB178                          # STFPC X'178'(R11)
+r 4B0=41A0B18C                          # LA    R10,X'18C'(R11)
+r 4B4=B29D9860                          # LFPC  X'860'(R9)
+r 4B8=78009180                          # LE    F0,X'180'(R9)
+r 4BC=78209184                          # LE    F2,X'184'(R9)
+r 4C0=B3170002                          # MEEBR F0,F2     MEEBR toward -infinity
+r 4C4=7000B180                          # STE   F0,X'180'(R11)
+r 4C8=B29CB188                          # STFPC X'188'(R11)
+r 4CC=41A0B19C                          # LA    R10,X'19C'(R11)
+r 4D0=B29D9864                          # LFPC  X'864'(R9)
+r 4D4=78009190                          # LE    F0,X'190'(R9)
+r 4D8=78209194                          # LE    F2,X'194'(R9)
+r 4DC=B30D0002                          # DEBR  F0,F2     DEBR inexact, IMX trap
+r 4E0=7000B190                          # STE   F0,X'190'(R11)
+r 4E4=B29CB198                          # STFPC X'198'(R11)
+r 4E8=41A0B1AC                          # LA    R10,X'1AC'(R11)
+r 4EC=B29D9868                          # LFPC  X'868'(R9)
+r 4F0=780091A0                          # LE    F0,X'1A0'(R9)
+r 4F4=782091A4                          # LE    F2,X'1A4'(R9)
+r 4F8=B30D0002                          # DEBR  F0,F2     DEBR overflow
+r 4FC=7000B1A0                          # STE   F0,X'1A0'(R11)
+r 500=B29CB1A8                          # STFPC X'1A8'(R11)
+r 504=41A0B1BC                          # LA    R10,X'1BC'(R11)
+r 508=B29D986C                          # LFPC  X'86C'(R9)
+r 50C=780091B0                          # LE    F0,X'1B0'(R9)
+r 510=782091B4                          # LE    F2,X'1B4'(R9)
+r 514=B30D0002                          # DEBR  F0,F2     DEBR inexact
+r 518=7000B1B0                          # STE   F0,X'1B0'(R11)
+r 51C=B29CB1B8                          # STFPC X'1B8'(R11)
+r 520=B2B207E0                          # LPSWE X'7E0'
+r 700=D203A000008C                      # MVC   0(4,R10),X'8C' interruption code
+r 706=B2B20150                          # LPSWE X'150'         resume
+
+r 7E0=00020001800000000000000000000000  # z/Arch disabled wait PSW
+r 7F0=00040000                          # CR0 AFP enable
+
+r 1000=3FF00000000000003CA8000000000000 # ADBR inexact
+r 1010=3FF00000000000004000000000000000 # ADBR exact
+r 1020=3FF00000000000003CA8000000000000 # ADBR inexact, X flag off
+r 1030=3FF00000000000003CA8000000000000 # ADBR toward zero
+r 1040=3FF00000000000003CA8000000000000 # ADBR toward +infinity
+r 1050=3FF00000000000003CA8000000000000 # ADBR toward -infinity
+r 1060=3FF00000000000003CA8000000000000 # SDBR tie to even
+r 1070=3FF00000000000003CA8000000000000 # SDBR toward zero
+r 1080=3FD55555555555554008000000000000 # MDBR inexact, IMX trap
+r 1090=3FF80000000000004000000000000000 # MDBR exact, IMX enabled
+r 10A0=01700000000000003E10000000000000 # MDBR tiny exact
+r 10B0=01700000000000003E10000000000001 # MDBR tiny inexact
+r 10C0=01700000000000003E90000000000000 # MDBR smallest normal
+r 10D0=00100000000000003FEFFFFFFFFFFFFF # MDBR tiny rounds to normal
+r 10E0=7FDFFFFFFFFFFFFF4000000000000000 # MDBR largest normal
+r 10F0=7FE00000000000003FE0000000000000 # DDBR overflow
+r 1100=3FF00000000000004008000000000000 # DDBR inexact
+r 1110=017000000000000041D0000000000000 # DDBR tiny exact, IMU trap
+r 1120=3F80000033C00000                 # AEBR inexact
+r 1130=3F80000033C00000                 # AEBR toward zero
+r 1140=3F80000033C00000                 # AEBR inexact, X flag off
+r 1150=3F80000033C00000                 # SEBR tie to even
+r 1160=0D80000030800000                 # MEEBR tiny exact
+r 1170=0D80000030800001                 # MEEBR tiny inexact
+r 1180=3FAAAAAB40400000                 # MEEBR toward -infinity
+r 1190=3F80000040400000                 # DEBR inexact, IMX trap
+r 11A0=7F0000003F000000                 # DEBR overflow
+r 11B0=3F80000040400000                 # DEBR inexact
+
+r 1800=00080000000800000000000000080001 # FPC inputs
+r 1810=00080002000800030008000000080001 # FPC inputs
+r 1820=08080000080800000008000000080000 # FPC inputs
+r 1830=00080000000800000008000000080000 # FPC inputs
+r 1840=00080000100800000008000000080001 # FPC inputs
+r 1850=00000000000800000008000000080000 # FPC inputs
+r 1860=00080003080800000008000000080000 # FPC inputs
+
+runtest 1
+
+*Compare
+r 2000.10
+*Want "ADBR inexact" 3FF00000 00000001 00080000 00000000
+r 2010.10
+*Want "ADBR exact" 40080000 00000000 00080000 00000000
+r 2020.10
+*Want "ADBR inexact, X flag off" 3FF00000 00000001 00080000 00000000
+r 2030.10
+*Want "ADBR toward zero" 3FF00000 00000000 00080001 00000000
+r 2040.10
+*Want "ADBR toward +infinity" 3FF00000 00000001 00080002 00000000
+r 2050.10
+*Want "ADBR toward -infinity" 3FF00000 00000000 00080003 00000000
+r 2060.10
+*Want "SDBR tie to even" 3FEFFFFF FFFFFFFE 00080000 00000000
+r 2070.10
+*Want "SDBR toward zero" 3FEFFFFF FFFFFFFE 00080001 00000000
+r 2080.10
+*Want "MDBR inexact, IMX trap" 3FF00000 00000000 08080C00 00040007
+r 2090.10
+*Want "MDBR exact, IMX enabled" 40080000 00000000 08080000 00000000
+r 20A0.10
+*Want "MDBR tiny exact" 00001000 00000000 00080000 00000000
+r 20B0.10
+*Want "MDBR tiny inexact" 00001000 00000000 00180000 00000000
+r 20C0.10
+*Want "MDBR smallest normal" 00100000 00000000 00080000 00000000
+r 20D0.10
+*Want "MDBR tiny rounds to normal" 00100000 00000000 00180000 00000000
+r 20E0.10
+*Want "MDBR largest normal" 7FEFFFFF FFFFFFFF 00080000 00000000
+r 20F0.10
+*Want "DDBR overflow" 7FF00000 00000000 00280000 00000000
+r 2100.10
+*Want "DDBR inexact" 3FD55555 55555555 00080000 00000000
+r 2110.10
+*Want "DDBR tiny exact, IMU trap" 5F900000 00000000 10001000 00040007
+r 2120.10
+*Want "AEBR inexact" 3F800001 00000000 00080000 00000000
+r 2130.10
+*Want "AEBR toward zero" 3F800000 00000000 00080001 00000000
+r 2140.10
+*Want "AEBR inexact, X flag off" 3F800001 00000000 00080000 00000000
+r 2150.10
+*Want "SEBR tie to even" 3F7FFFFE 00000000 00080000 00000000
+r 2160.10
+*Want "MEEBR tiny exact" 00080000 00000000 00080000 00000000
+r 2170.10
+*Want "MEEBR tiny inexact" 00080000 00000000 00180000 00000000
+r 2180.10
+*Want "MEEBR toward -infinity" 40800000 00000000 00080003 00000000
+r 2190.10
+*Want "DEBR inexact, IMX trap" 3EAAAAAB 00000000 08080C00 00040007
+r 21A0.10
+*Want "DEBR overflow" 7F800000 00000000 00280000 00000000
+r 21B0.10
+*Want "DEBR inexact" 3EAAAAAB 00000000 00080000 00000000
+
+*Done
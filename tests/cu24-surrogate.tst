@@ -0,0 +1,52 @@
+*Testcase cu24-surrogate: CU24 surrogate pairs
+
+* CU24 converts UTF-16 surrogate pairs to UTF-32. The low surrogate
+* must be fetched from the two bytes following the high surrogate,
+* also when they are on the next page.
+
+sysclear
+archlvl z/Arch
+mainsize 1
+
+r 1a0=00000001800000000000000000000200  # z/Arch restart PSW
+r 1d0=0002000180000000000000000000DEAD  # z/Arch pgm new PSW
+r 300=00020001800000000000000000000000  # z/Arch disabled wait PSW
+
+r 200=C02100003000                      # LGFI  R2,X'3000'     destination
+r 206=41300010                          # LA    R3,16
+r 20A=C04100001000                      # LGFI  R4,X'1000'     source
+r 210=41500008                          # LA    R5,8
+r 214=B9B10024                          # CU24  R2,R4
+r 218=B2220080                          # IPM   R8
+r 21C=90250900                          # STM   R2,R5,X'900'
+r 220=50800910                          # ST    R8,X'910'
+r 224=C02100003010                      # LGFI  R2,X'3010'     destination
+r 22A=41300010                          # LA    R3,16
+r 22E=C04100001FFC                      # LGFI  R4,X'1FFC'     source
+r 234=41500008                          # LA    R5,8
+r 238=B9B10024                          # CU24  R2,R4
+r 23C=B2220080                          # IPM   R8
+r 240=90250920                          # STM   R2,R5,X'920'
+r 244=50800930                          # ST    R8,X'930'
+r 248=B2B20300                          # LPSWE X'300'
+
+r 1000=D83DDE00D801DC37                 # U+1F600 U+10437
+r 1FFC=0041D83D                         # U+0041 and high surrogate
+r 2000=DE000042                         # low surrogate and U+0042
+
+runtest .1
+
+r 900.10
+*Want "Pairs registers"           00003008 00000008 00001008 00000000
+r 910.4
+*Want "Pairs cc0"                 00000000
+r 3000.10
+*Want "Pairs output"              0001F600 00010437 00000000 00000000
+r 920.10
+*Want "Page cross registers"      0000301C 00000004 00002004 00000000
+r 930.4
+*Want "Page cross cc0"            00000000
+r 3010.10
+*Want "Page cross output"         00000041 0001F600 00000042 00000000
+
+*Done
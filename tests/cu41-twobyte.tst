@@ -0,0 +1,37 @@
+*Testcase cu41-twobyte: CU41 two-byte characters
+
+* CU41 converts UTF-32 characters 00000080-000007FF to two UTF-8 bytes
+* 110fghij 10klmnop. Both the characters below 00000100 and those above
+* it must be converted, between one and three byte characters.
+
+sysclear
+archlvl z/Arch
+mainsize 1
+
+r 1a0=00000001800000000000000000000200  # z/Arch restart PSW
+r 1d0=0002000180000000000000000000DEAD  # z/Arch pgm new PSW
+r 300=00020001800000000000000000000000  # z/Arch disabled wait PSW
+
+r 200=C02100003000                      # LGFI  R2,X'3000'     destination
+r 206=41300010                          # LA    R3,16
+r 20A=C04100001000                      # LGFI  R4,X'1000'     source
+r 210=41500014                          # LA    R5,20
+r 214=B9B20024                          # CU41  R2,R4
+r 218=B2220080                          # IPM   R8
+r 21C=90250900                          # STM   R2,R5,X'900'
+r 220=50800910                          # ST    R8,X'910'
+r 224=B2B20300                          # LPSWE X'300'
+
+r 1000=00000041000000E9000007FF00000080 # U+0041 U+00E9 U+07FF U+0080
+r 1010=000020AC                         # U+20AC
+
+runtest .1
+
+r 900.10
+*Want "Registers"                 0000300A 00000006 00001014 00000000
+r 910.4
+*Want "cc0"                       00000000
+r 3000.10
+*Want "Output"                    41C3A9DF BFC280E2 82AC0000 00000000
+
+*Done
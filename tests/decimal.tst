@@ -0,0 +1,153 @@
+*Testcase decimal: packed decimal AP, SP, ZAP, CP, MP and DP
+sysclear
+archlvl z/Arch
+
+r 1a0=00000001800000000000000000000200  # z/Arch restart PSW
+r 1d0=0002000180000000000000000000DEAD  # z/Arch pgm new PSW
+
+r 200=C05F00001000                      # LLILF R5,X'1000'  --> first test case
+r 206=FA7750005010                      # AP    0(8,R5),16(8,R5)
+r 20C=B2220060                          # IPM   R6
+r 210=50605020                          # ST    R6,32(,R5)
+r 214=41550030                          # LA    R5,48(,R5)
+r 218=FA3250005010                      # AP    0(4,R5),16(3,R5)
+r 21E=B2220060                          # IPM   R6
+r 222=50605020                          # ST    R6,32(,R5)
+r 226=41550030                          # LA    R5,48(,R5)
+r 22A=FA2150005010                      # AP    0(3,R5),16(2,R5)
+r 230=B2220060                          # IPM   R6
+r 234=50605020                          # ST    R6,32(,R5)
+r 238=41550030                          # LA    R5,48(,R5)
+r 23C=FB2250005010                      # SP    0(3,R5),16(3,R5)
+r 242=B2220060                          # IPM   R6
+r 246=50605020                          # ST    R6,32(,R5)
+r 24A=41550030                          # LA    R5,48(,R5)
+r 24E=FB9350005010                      # SP    0(10,R5),16(4,R5)
+r 254=B2220060                          # IPM   R6
+r 258=50605020                          # ST    R6,32(,R5)
+r 25C=41550030                          # LA    R5,48(,R5)
+r 260=F83150005010                      # ZAP   0(4,R5),16(2,R5)
+r 266=B2220060                          # IPM   R6
+r 26A=50605020                          # ST    R6,32(,R5)
+r 26E=41550030                          # LA    R5,48(,R5)
+r 272=F8F750005010                      # ZAP   0(16,R5),16(8,R5)
+r 278=B2220060                          # IPM   R6
+r 27C=50605020                          # ST    R6,32(,R5)
+r 280=41550030                          # LA    R5,48(,R5)
+r 284=F91150005010                      # CP    0(2,R5),16(2,R5)
+r 28A=B2220060                          # IPM   R6
+r 28E=50605020                          # ST    R6,32(,R5)
+r 292=41550030                          # LA    R5,48(,R5)
+r 296=F93350005010                      # CP    0(4,R5),16(4,R5)
+r 29C=B2220060                          # IPM   R6
+r 2A0=50605020                          # ST    R6,32(,R5)
+r 2A4=41550030                          # LA    R5,48(,R5)
+r 2A8=FC5150005010                      # MP    0(6,R5),16(2,R5)
+r 2AE=B2220060                          # IPM   R6
+r 2B2=50605020                          # ST    R6,32(,R5)
+r 2B6=41550030                          # LA    R5,48(,R5)
+r 2BA=FC7250005010                      # MP    0(8,R5),16(3,R5)
+r 2C0=B2220060                          # IPM   R6
+r 2C4=50605020                          # ST    R6,32(,R5)
+r 2C8=41550030                          # LA    R5,48(,R5)
+r 2CC=FD7250005010                      # DP    0(8,R5),16(3,R5)
+r 2D2=B2220060                          # IPM   R6
+r 2D6=50605020                          # ST    R6,32(,R5)
+r 2DA=41550030                          # LA    R5,48(,R5)
+r 2DE=B2B202E8                          # LPSWE GOODPSW
+r 2E8=00020001800000000000000000000000  # GOODPSW
+
+r 1000=999999999999999C                 # AP  15-digit sum overflows
+r 1010=000000000000001C                 # 
+r 1030=0012345C                         # AP  opposite signs
+r 1040=12346D                           # 
+r 1060=12345C                           # AP  result fits
+r 1070=999C                             # 
+r 1090=12345D                           # SP  equal values
+r 10A0=12345D                           # 
+r 10C0=0000000000000000001C             # SP  into long operand
+r 10D0=9999999D                         # 
+r 10F0=1234567C                         # ZAP negative zero
+r 1100=000D                             # 
+r 1120=11111111111111111111111111111111 # ZAP into 16 bytes
+r 1130=123456789012345D                 # 
+r 1150=000D                             # CP  minus zero, plus zero
+r 1160=000C                             # 
+r 1180=0000123D                         # CP  negative values
+r 1190=0000124D                         # 
+r 11B0=00000000000C                     # MP  negative zero product
+r 11C0=123D                             # 
+r 11E0=000000009999999C                 # MP  15-digit product
+r 11F0=99999C                           # 
+r 1210=000012345678901C                 # DP  quotient and remainder
+r 1220=00345D                           # 
+
+runtest .1
+
+*Compare
+* AP  15-digit sum overflows
+r 1000.8
+*Want 00000000 0000000C
+r 1020.4
+*Want 30000000
+*Compare
+* AP  opposite signs
+r 1030.4
+*Want 0000001D
+r 1050.4
+*Want 10000000
+*Compare
+* AP  result fits
+r 1060.3
+*Want 13344C
+r 1080.4
+*Want 20000000
+*Compare
+* SP  equal values
+r 1090.3
+*Want 00000C
+r 10B0.4
+*Want 00000000
+*Compare
+* SP  into long operand
+r 10C0.A
+*Want 00000000 00010000 000C
+r 10E0.4
+*Want 20000000
+*Compare
+* ZAP negative zero
+r 10F0.4
+*Want 0000000C
+r 1110.4
+*Want 00000000
+*Compare
+* ZAP into 16 bytes
+r 1120.10
+*Want 00000000 00000000 12345678 9012345D
+r 1140.4
+*Want 10000000
+*Compare
+* CP  minus zero, plus zero
+r 1150.2
+*Want 000D
+r 1170.4
+*Want 00000000
+*Compare
+* CP  negative values
+r 1180.4
+*Want 0000123D
+r 11A0.4
+*Want 20000000
+*Compare
+* MP  negative zero product
+r 11B0.6
+*Want 00000000 000D
+*Compare
+* MP  15-digit product
+r 11E0.8
+*Want 00099998 9900001C
+*Compare
+* DP  quotient and remainder
+r 1210.8
+*Want 03578457 6D00181C
+*Done
@@ -0,0 +1,682 @@
+*Testcase dfp-arith: DFP add, subtract, multiply, compare and load rounded
+
+* Long operand pairs at 1000 are added, subtracted, multiplied and
+* compared with the results, condition codes and FPC stored at 2000;
+* extended pairs at 1800 likewise with results at 3000. The values at
+* 1C00 are load-rounded from long to short and extended to long with
+* results at 3800. The operands mix exact results, which take the
+* integer coefficient path, with ones that need rounding, overflow,
+* underflow, clamping or NaN handling. The last two results check the
+* sign of an exact zero sum when rounding toward minus infinity. The
+* expected values were produced by the decNumber code.
+
+sysclear
+archlvl z/Arch
+
+r 1a0=00000001800000000000000000000200  # z/Arch restart PSW
+r 1d0=0002000180000000000000000000DEAD  # z/Arch pgm new PSW
+
+r 200=B7000390                          # LCTL  R0,R0,CTLR0    AFP-register control
+r 204=C05100001000                      # LGFI  R5,X'1000'     long operands
+r 20A=C06100002000                      # LGFI  R6,X'2000'     long results
+r 210=A7780028                          # LHI   R7,40
+r 214=1799                              # XR    R9,R9
+r 216=B3840090                          # SFPC  R9
+r 21A=68005000                          # LD    F0,0(R5)
+r 21E=68205008                          # LD    F2,8(R5)
+r 222=B3D22040                          # ADTR  F4,F0,F2
+r 226=B2220080                          # IPM   R8
+r 22A=50806018                          # ST    R8,24(R6)
+r 22E=60406000                          # STD   F4,0(R6)
+r 232=B3D32040                          # SDTR  F4,F0,F2
+r 236=B2220080                          # IPM   R8
+r 23A=5080601C                          # ST    R8,28(R6)
+r 23E=60406008                          # STD   F4,8(R6)
+r 242=B3D02040                          # MDTR  F4,F0,F2
+r 246=60406010                          # STD   F4,16(R6)
+r 24A=B3E40002                          # CDTR  F0,F2
+r 24E=B2220080                          # IPM   R8
+r 252=50806020                          # ST    R8,32(R6)
+r 256=B38C0080                          # EFPC  R8
+r 25A=50806024                          # ST    R8,36(R6)
+r 25E=41550010                          # LA    R5,16(R5)
+r 262=41660030                          # LA    R6,48(R6)
+r 266=A776FFD8                          # BRCT  R7,*-80
+r 26A=C05100001800                      # LGFI  R5,X'1800'     extended operands
+r 270=C06100003000                      # LGFI  R6,X'3000'     extended results
+r 276=A7780019                          # LHI   R7,25
+r 27A=B3840090                          # SFPC  R9
+r 27E=68005000                          # LD    F0,0(R5)
+r 282=68205008                          # LD    F2,8(R5)
+r 286=68405010                          # LD    F4,16(R5)
+r 28A=68605018                          # LD    F6,24(R5)
+r 28E=B3DA4080                          # AXTR  F8,F0,F4
+r 292=B2220080                          # IPM   R8
+r 296=50806030                          # ST    R8,48(R6)
+r 29A=60806000                          # STD   F8,0(R6)
+r 29E=60A06008                          # STD   F10,8(R6)
+r 2A2=B3DB4080                          # SXTR  F8,F0,F4
+r 2A6=B2220080                          # IPM   R8
+r 2AA=50806034                          # ST    R8,52(R6)
+r 2AE=60806010                          # STD   F8,16(R6)
+r 2B2=60A06018                          # STD   F10,24(R6)
+r 2B6=B3D84080                          # MXTR  F8,F0,F4
+r 2BA=60806020                          # STD   F8,32(R6)
+r 2BE=60A06028                          # STD   F10,40(R6)
+r 2C2=B3EC0004                          # CXTR  F0,F4
+r 2C6=B2220080                          # IPM   R8
+r 2CA=50806038                          # ST    R8,56(R6)
+r 2CE=B38C0080                          # EFPC  R8
+r 2D2=5080603C                          # ST    R8,60(R6)
+r 2D6=41550020                          # LA    R5,32(R5)
+r 2DA=41660040                          # LA    R6,64(R6)
+r 2DE=A776FFCE                          # BRCT  R7,*-100
+r 2E2=C05100001C00                      # LGFI  R5,X'1C00'     load rounded operands
+r 2E8=C06100003800                      # LGFI  R6,X'3800'     load rounded results
+r 2EE=A778000A                          # LHI   R7,10
+r 2F2=B3840090                          # SFPC  R9
+r 2F6=68005000                          # LD    F0,0(R5)
+r 2FA=68405010                          # LD    F4,16(R5)
+r 2FE=68605018                          # LD    F6,24(R5)
+r 302=B3D50010                          # LEDTR F1,0,F0,0
+r 306=70106000                          # STE   F1,0(R6)
+r 30A=B3DD0024                          # LDXTR F2,0,F4,0
+r 30E=60206008                          # STD   F2,8(R6)
+r 312=B38C0080                          # EFPC  R8
+r 316=50806004                          # ST    R8,4(R6)
+r 31A=41550020                          # LA    R5,32(R5)
+r 31E=41660020                          # LA    R6,32(R6)
+r 322=A776FFE8                          # BRCT  R7,*-48
+r 326=B3840090                          # SFPC  R9
+r 32A=A7390003                          # LGHI  R3,3
+r 32E=B2B93000                          # SRNMT 0(R3)          round toward -infinity
+r 332=68000F00                          # LD    F0,X'F00'
+r 336=68200F08                          # LD    F2,X'F08'
+r 33A=B3D22040                          # ADTR  F4,F0,F2
+r 33E=60400F10                          # STD   F4,X'F10'
+r 342=B3D30040                          # SDTR  F4,F0,F0
+r 346=60400F18                          # STD   F4,X'F18'
+r 34A=B2B20380                          # LPSWE WAITPSW
+
+r 380=00020001800000000000000000000000  # WAITPSW
+r 390=00040000                          # CTLR0
+
+r F00=2238000000000005A238000000000005  # DD'5', DD'-5'
+r 1000=22300000000049C52230000000000378
+r 1010=22300000000049C5A238000000000067
+r 1020=A22C0000000000052234000000000005
+r 1030=2238000000000000A238000000000000
+r 1040=A244000000000000A230000000000000
+r 1050=224C000000000000222800000014D2E7
+r 1060=6E38FF3FCFF3FCFF2238000000000001
+r 1070=6E38FF3FCFF3FCFFA238000000000001
+r 1080=2240A395BCF049C52210000000000007
+r 1090=2238000005F3FCFF2238000005F3FCFF
+r 10A0=223800000FF3FCFF2238000005F3FCFF
+r 10B0=83180000000000030340000000000007
+r 10C0=43FC00000000000143FC000000000002
+r 10D0=41580000000000044108000000000005
+r 10E0=003C000000000001003C000000000002
+r 10F0=00000000000000018000000000000001
+r 1100=6A3800000000000022388C0000000000
+r 1110=EE277CB0D10E3F54A1E8000000000001
+r 1120=223C0000000000052238000000000050
+r 1130=A23C000000000005A238000000000049
+r 1140=78000000000000052238000000000001
+r 1150=7C000000000000052238000000000001
+r 1160=2238000000000001FE00000000000005
+r 1170=22380000000003FF22340000000002FE
+r 1180=221C0389E5B643AA2260000000000004
+r 1190=A1F00000000000042250000000000001
+r 11A0=A2487251DA61BCB2A220000000000271
+r 11B0=A2180000A280ED0B39F96CD818A9D81E
+r 11C0=A228063D371C7A69A1DC245D658A34F4
+r 11D0=A228000003A4FE142662CE0AEC0D3C46
+r 11E0=A1A800000000000622CC0249F8B09C6D
+r 11F0=21D5285611CC99A2221000000001C447
+r 1200=6ED0F06D382B2577A2040000009E680F
+r 1210=21F000000007E5B9A228000000010700
+r 1220=220400000000021F21B000000000047E
+r 1230=228201264C238AC4A200000000010686
+r 1240=222C00000000025C228400000000017A
+r 1250=22A8000000000C57225800000001AEAD
+r 1260=A1D800083F3B5E1422780000005A27AB
+r 1270=A2BD0E8BD87C63B8228C0000061ABBF3
+r 1800=220780000000000000000000000049C5
+r 1810=22078000000000000000000000000378
+r 1820=220780000000000000000000000049C5
+r 1830=A2080000000000000000000000000067
+r 1840=22080000000000000000000000000000
+r 1850=A2094000000000000000000000000000
+r 1860=6E080FF3FCFF3FCFF3FCFF3FCFF3FCFF
+r 1870=22080000000000000000000000000001
+r 1880=6E080FF3FCFF3FCFF3FCFF3FCFF3FCFF
+r 1890=A2080000000000000000000000000001
+r 18A0=22080000000000000200000000000003
+r 18B0=22080000000000000040000000000007
+r 18C0=22080000000000000200000000000003
+r 18D0=22080000000000000200000000000007
+r 18E0=22080000000000080000000000000003
+r 18F0=22080000000000000000000000000005
+r 1900=C3FFC000000000000000000000000001
+r 1910=43FD0000000000000000000000000001
+r 1920=00084000000000000000000000000001
+r 1930=00000000000000000000000000000003
+r 1940=22084000000000000000000000000005
+r 1950=22080000000000000000000000000050
+r 1960=F8000000000000000000000000000005
+r 1970=22080000000000000000000000000001
+r 1980=22080000000000000000000000000001
+r 1990=7E000000000000000000000000000005
+r 19A0=A1F9800000018A85BEE73CD97A548DCA
+r 19B0=A2134000000000000000007A854F6E28
+r 19C0=A213C000000000000000000000000047
+r 19D0=A20040000000000000000000000A69AE
+r 19E0=A20C80000000000000000000000008DA
+r 19F0=220D000000000000069094140421A8F4
+r 1A00=22070000000000000000000000000835
+r 1A10=220DC00000000011B776725E5963FBDB
+r 1A20=A2034000000000000000000000510065
+r 1A30=A209408829663B0315DC43EA06EE05ED
+r 1A40=220400000000000000000975CA8091CD
+r 1A50=2215C0000000000000000014B83E40AD
+r 1A60=22094000000000000000000000000002
+r 1A70=A20DC01D1D9020E21FF716CDA3D7C7B6
+r 1A80=A214800000000000000000001C498BC5
+r 1A90=A1FF800159E4DDDA4D7867633C4A302D
+r 1AA0=A20B00000000000001A04503F5F81014
+r 1AB0=A214C0001085212F4B827291325A983E
+r 1AC0=A20B800027FC18D83EFC63A9A79EBF31
+r 1AD0=220B00000000CA98B14AB3B310B3BDC0
+r 1AE0=2207C00000001EEE0884BE3911721EFB
+r 1AF0=21FBC000000000000000000DADE1C666
+r 1B00=22080000000000000021367103D077A7
+r 1B10=21FD80000001B8DBDD04C2EF628BA281
+r 1C00=223000000014D2E7
+r 1C10=2207800000000000000534B9C1E28E56
+r 1C20=A230000001271778
+r 1C30=A2078000000000000049C5DE08D4D2E7
+r 1C40=23A0000000000007
+r 1C50=22644000000000000000000000000007
+r 1C60=23A4000000000007
+r 1C70=22648000000000000000000000000007
+r 1C80=20BC000000000007
+r 1C90=21A84000000000000000000000000007
+r 1CA0=20A4000000000007
+r 1CB0=21A48000000000000000000000000007
+r 1CC0=A238000000000000
+r 1CD0=A2080000000000000000000000000000
+r 1CE0=4158000000000000
+r 1CF0=42EA0000000000000000000000000000
+r 1D00=FC00000000000005
+r 1D10=7E000000000000000000000000000005
+r 1D20=2244000000900000
+r 1D30=2208C000000000000024000000000000
+
+runtest .1
+
+*Compare
+r 2000.10
+*Want "ADTR/SDTR 1"               22300000 00004C23 22300000 00004767
+r 2010.10
+*Want "MDTR/cc 1"                 22280000 0087A49C 20000000 20000000
+r 2020.8
+*Want "CDTR/FPC 1"                20000000 00000000
+r 2030.10
+*Want "ADTR/SDTR 2"               22300000 00001745 22300000 00006445
+r 2040.10
+*Want "MDTR/cc 2"                 A2300000 000CB495 20000000 20000000
+r 2050.8
+*Want "CDTR/FPC 2"                20000000 00000000
+r 2060.10
+*Want "ADTR/SDTR 3"               222C0000 0000025B A22C0000 00000285
+r 2070.10
+*Want "MDTR/cc 3"                 A2280000 00000025 20000000 10000000
+r 2080.8
+*Want "CDTR/FPC 3"                10000000 00000000
+r 2090.10
+*Want "ADTR/SDTR 4"               22380000 00000000 22380000 00000000
+r 20A0.10
+*Want "MDTR/cc 4"                 A2380000 00000000 00000000 00000000
+r 20B0.8
+*Want "CDTR/FPC 4"                00000000 00000000
+r 20C0.10
+*Want "ADTR/SDTR 5"               A2300000 00000000 22300000 00000000
+r 20D0.10
+*Want "MDTR/cc 5"                 223C0000 00000000 00000000 00000000
+r 20E0.8
+*Want "CDTR/FPC 5"                00000000 00000000
+r 20F0.10
+*Want "ADTR/SDTR 6"               22280000 0014D2E7 A2280000 0014D2E7
+r 2100.10
+*Want "MDTR/cc 6"                 223C0000 00000000 20000000 10000000
+r 2110.8
+*Want "CDTR/FPC 6"                10000000 00000000
+r 2120.10
+*Want "ADTR/SDTR 7"               263C0000 00000000 6E38FF3F CFF3FCFE
+r 2130.10
+*Want "MDTR/cc 7"                 6E38FF3F CFF3FCFF 20000000 20000000
+r 2140.8
+*Want "CDTR/FPC 7"                20000000 00000000
+r 2150.10
+*Want "ADTR/SDTR 8"               6E38FF3F CFF3FCFE 263C0000 00000000
+r 2160.10
+*Want "MDTR/cc 8"                 EE38FF3F CFF3FCFF 20000000 20000000
+r 2170.8
+*Want "CDTR/FPC 8"                20000000 00000000
+r 2180.10
+*Want "ADTR/SDTR 9"               263D34B9 C1E28E50 263D34B9 C1E28E50
+r 2190.10
+*Want "MDTR/cc 9"                 221A6C3E EA31AA15 20000000 20000000
+r 21A0.8
+*Want "CDTR/FPC 9"                20000000 00080000
+r 21B0.10
+*Want "ADTR/SDTR 10"              22380000 0DF3FCFE 22380000 00000000
+r 21C0.10
+*Want "MDTR/cc 10"                6E38FF3F C0C00001 20080000 00080000
+r 21D0.8
+*Want "CDTR/FPC 10"               00080000 00000000
+r 21E0.10
+*Want "ADTR/SDTR 11"              22380000 45F3FCFE 22380000 08C00000
+r 21F0.10
+*Want "MDTR/cc 11"                6E3CFF3F C1E00000 20000000 20000000
+r 2200.8
+*Want "CDTR/FPC 11"               20000000 00080000
+r 2210.10
+*Want "ADTR/SDTR 12"              0318001A 4FF3FF9F 8318001C 00000003
+r 2220.10
+*Want "MDTR/cc 12"                80200000 00000021 20080000 10080000
+r 2230.8
+*Want "CDTR/FPC 12"               10080000 00000000
+r 2240.10
+*Want "ADTR/SDTR 13"              43FC0000 00000003 C3FC0000 00000001
+r 2250.10
+*Want "MDTR/cc 13"                78000000 00000000 20000000 10000000
+r 2260.8
+*Want "CDTR/FPC 13"               10000000 00200000
+r 2270.10
+*Want "ADTR/SDTR 14"              511C0000 00000000 511C0000 00000000
+r 2280.10
+*Want "MDTR/cc 14"                43FC0200 00000000 20200000 20200000
+r 2290.8
+*Want "CDTR/FPC 14"               20200000 00080000
+r 22A0.10
+*Want "ADTR/SDTR 15"              003C0000 00000003 803C0000 00000001
+r 22B0.10
+*Want "MDTR/cc 15"                00000000 00000000 20080000 10080000
+r 22C0.8
+*Want "CDTR/FPC 15"               10080000 00180000
+r 22D0.10
+*Want "ADTR/SDTR 16"              00000000 00000000 00000000 00000002
+r 22E0.10
+*Want "MDTR/cc 16"                80000000 00000000 00180000 20180000
+r 22F0.8
+*Want "CDTR/FPC 16"               20180000 00180000
+r 2300.10
+*Want "ADTR/SDTR 17"              6A388C00 00000000 3E388000 00000000
+r 2310.10
+*Want "MDTR/cc 17"                3E750000 00000000 20180000 20180000
+r 2320.8
+*Want "CDTR/FPC 17"               20180000 00000000
+r 2330.10
+*Want "ADTR/SDTR 18"              EE277CB0 D10E3F54 EE277CB0 D10E3F54
+r 2340.10
+*Want "MDTR/cc 18"                6DD77CB0 D10E3F54 10000000 10000000
+r 2350.8
+*Want "CDTR/FPC 18"               10000000 00080000
+r 2360.10
+*Want "ADTR/SDTR 19"              22380000 00000080 22380000 00000000
+r 2370.10
+*Want "MDTR/cc 19"                223C0000 00000150 20080000 00080000
+r 2380.8
+*Want "CDTR/FPC 19"               00080000 00000000
+r 2390.10
+*Want "ADTR/SDTR 20"              A2380000 0000005F A2380000 00000001
+r 23A0.10
+*Want "MDTR/cc 20"                223C0000 00000145 10000000 10000000
+r 23B0.8
+*Want "CDTR/FPC 20"               10000000 00000000
+r 23C0.10
+*Want "ADTR/SDTR 21"              78000000 00000000 78000000 00000000
+r 23D0.10
+*Want "MDTR/cc 21"                78000000 00000000 20000000 20000000
+r 23E0.8
+*Want "CDTR/FPC 21"               20000000 00000000
+r 23F0.10
+*Want "ADTR/SDTR 22"              7C000000 00000005 7C000000 00000005
+r 2400.10
+*Want "MDTR/cc 22"                7C000000 00000005 30000000 30000000
+r 2410.8
+*Want "CDTR/FPC 22"               30000000 00000000
+r 2420.10
+*Want "ADTR/SDTR 23"              FC000000 00000005 FC000000 00000005
+r 2430.10
+*Want "MDTR/cc 23"                FC000000 00000005 30000000 30000000
+r 2440.8
+*Want "CDTR/FPC 23"               30000000 00800000
+r 2450.10
+*Want "ADTR/SDTR 24"              22340000 000040EE 22340000 0000219E
+r 2460.10
+*Want "MDTR/cc 24"                22340000 000E7C02 20800000 20800000
+r 2470.8
+*Want "CDTR/FPC 24"               20800000 00000000
+r 2480.10
+*Want "ADTR/SDTR 25"              3224000D 17477488 AE24FFBB 7A51191E
+r 2490.10
+*Want "MDTR/cc 25"                224413E2 48F50CA8 20000000 10000000
+r 24A0.8
+*Want "CDTR/FPC 25"               10000000 00080000
+r 24B0.10
+*Want "ADTR/SDTR 26"              26140000 00000000 A6140000 00000000
+r 24C0.10
+*Want "MDTR/cc 26"                A2080000 00000004 20080000 10080000
+r 24D0.8
+*Want "CDTR/FPC 26"               10080000 00080000
+r 24E0.10
+*Want "ADTR/SDTR 27"              BE4124EC B4E67500 BE4124EC B4E67500
+r 24F0.10
+*Want "MDTR/cc 27"                2E36028B C7A9E097 10080000 10080000
+r 2500.8
+*Want "CDTR/FPC 27"               10080000 00080000
+r 2510.10
+*Want "ADTR/SDTR 28"              AA01D999 B7736D31 AA027AE6 60E833E9
+r 2520.10
+*Want "MDTR/cc 28"                A6036665 EDD7B04A 10080000 10080000
+r 2530.8
+*Want "CDTR/FPC 28"               10080000 00080000
+r 2540.10
+*Want "ADTR/SDTR 29"              BA1CF4DC 71E9A400 BA1CF4DC 71E9A400
+r 2550.10
+*Want "MDTR/cc 29"                25FA5E6B DBEF5B60 10080000 10080000
+r 2560.8
+*Want "CDTR/FPC 29"               10080000 00080000
+r 2570.10
+*Want "ADTR/SDTR 30"              2662CE0A EC0D3C46 A662CE0A EC0D3C46
+r 2580.10
+*Want "MDTR/cc 30"                A6727479 E53018E2 20080000 10080000
+r 2590.8
+*Want "CDTR/FPC 30"               10080000 00080000
+r 25A0.10
+*Want "ADTR/SDTR 31"              2AC127E2 C271B400 AAC127E2 C271B400
+r 25B0.10
+*Want "MDTR/cc 31"                A23C1379 B6A39CE6 20080000 10080000
+r 25C0.8
+*Want "CDTR/FPC 31"               10080000 00080000
+r 25D0.10
+*Want "ADTR/SDTR 32"              3DE484E8 A2D03D63 BDE484DD CF4263B7
+r 25E0.10
+*Want "MDTR/cc 32"                25BF21E4 1EA19930 20080000 10080000
+r 25F0.8
+*Want "CDTR/FPC 32"               10080000 00080000
+r 2600.10
+*Want "ADTR/SDTR 33"              6ED0F06D 382B2577 6ED0F06D 382B2577
+r 2610.10
+*Want "MDTR/cc 33"                EABBBEB9 68A4AC37 20080000 20080000
+r 2620.8
+*Want "CDTR/FPC 33"               20080000 00080000
+r 2630.10
+*Want "ADTR/SDTR 34"              B1FCD93F CFF3FF21 31FCE000 000001F9
+r 2640.10
+*Want "MDTR/cc 34"                A1E00005 78AA0A00 10080000 20080000
+r 2650.8
+*Want "CDTR/FPC 34"               20080000 00080000
+r 2660.10
+*Want "ADTR/SDTR 35"              69D0DC00 00000000 69D0DC00 00000000
+r 2670.10
+*Want "MDTR/cc 35"                217C0000 001D7B90 20080000 20080000
+r 2680.8
+*Want "CDTR/FPC 35"               20080000 00080000
+r 2690.10
+*Want "ADTR/SDTR 36"              327C1126 E21C9640 327C1126 E21C9640
+r 26A0.10
+*Want "MDTR/cc 36"                A65B6483 C919665D 20080000 20080000
+r 26B0.8
+*Want "CDTR/FPC 36"               20080000 00080000
+r 26C0.10
+*Want "ADTR/SDTR 37"              2A50EC00 00000000 AA50EC00 00000000
+r 26D0.10
+*Want "MDTR/cc 37"                22780000 00054BCA 20080000 10080000
+r 26E0.8
+*Want "CDTR/FPC 37"               10080000 00080000
+r 26F0.10
+*Want "ADTR/SDTR 38"              2E785700 00000000 2E785700 00000000
+r 2700.10
+*Want "MDTR/cc 38"                22C80000 168FABA5 20080000 20080000
+r 2710.8
+*Want "CDTR/FPC 38"               20080000 00080000
+r 2720.10
+*Want "ADTR/SDTR 39"              365689EA C0000000 B65689EA C0000000
+r 2730.10
+*Want "MDTR/cc 39"                A620C4BD EBC07D1C 20080000 10080000
+r 2740.8
+*Want "CDTR/FPC 39"               10080000 00080000
+r 2750.10
+*Want "ADTR/SDTR 40"              EAB92E8E C763AD8A EAB92E8E C763AD8A
+r 2760.10
+*Want "MDTR/cc 40"                B72E6930 CB513837 10080000 10080000
+r 2770.8
+*Want "CDTR/FPC 40"               10080000 00080000
+r 3000.10
+*Want "AXTR 1"                    22078000 00000000 00000000 00004C23
+r 3010.10
+*Want "SXTR 1"                    22078000 00000000 00000000 00004767
+r 3020.10
+*Want "MXTR 1"                    22070000 00000000 00000000 0087A49C
+r 3030.10
+*Want "cc/FPC 1"                  20080000 20080000 20080000 00000000
+r 3040.10
+*Want "AXTR 2"                    22078000 00000000 00000000 00001745
+r 3050.10
+*Want "SXTR 2"                    22078000 00000000 00000000 00006445
+r 3060.10
+*Want "MXTR 2"                    A2078000 00000000 00000000 000CB495
+r 3070.10
+*Want "cc/FPC 2"                  20000000 20000000 20000000 00000000
+r 3080.10
+*Want "AXTR 3"                    22080000 00000000 00000000 00000000
+r 3090.10
+*Want "SXTR 3"                    22080000 00000000 00000000 00000000
+r 30A0.10
+*Want "MXTR 3"                    A2094000 00000000 00000000 00000000
+r 30B0.10
+*Want "cc/FPC 3"                  00000000 00000000 00000000 00000000
+r 30C0.10
+*Want "AXTR 4"                    26084000 00000000 00000000 00000000
+r 30D0.10
+*Want "SXTR 4"                    6E080FF3 FCFF3FCF F3FCFF3F CFF3FCFE
+r 30E0.10
+*Want "MXTR 4"                    6E080FF3 FCFF3FCF F3FCFF3F CFF3FCFF
+r 30F0.10
+*Want "cc/FPC 4"                  20000000 20000000 20000000 00000000
+r 3100.10
+*Want "AXTR 5"                    6E080FF3 FCFF3FCF F3FCFF3F CFF3FCFE
+r 3110.10
+*Want "SXTR 5"                    26084000 00000000 00000000 00000000
+r 3120.10
+*Want "MXTR 5"                    EE080FF3 FCFF3FCF F3FCFF3F CFF3FCFF
+r 3130.10
+*Want "cc/FPC 5"                  20000000 20000000 20000000 00000000
+r 3140.10
+*Want "AXTR 6"                    22080000 00000000 02400000 00000010
+r 3150.10
+*Want "SXTR 6"                    22080000 00000000 013CFF3F CFF3FF9E
+r 3160.10
+*Want "MXTR 6"                    26080000 00000000 0EC00000 00000021
+r 3170.10
+*Want "cc/FPC 6"                  20000000 20000000 20000000 00000000
+r 3180.10
+*Want "AXTR 7"                    22080000 00000000 04000000 00000010
+r 3190.10
+*Want "SXTR 7"                    A2080000 00000000 00000000 00000004
+r 31A0.10
+*Want "MXTR 7"                    26084000 00000000 02000000 00000002
+r 31B0.10
+*Want "cc/FPC 7"                  20000000 10000000 10000000 00080000
+r 31C0.10
+*Want "AXTR 8"                    22080000 00000008 00000000 00000008
+r 31D0.10
+*Want "SXTR 8"                    22080000 00000005 F3FCFF3F CFF3FCFE
+r 31E0.10
+*Want "MXTR 8"                    22080000 00000028 00000000 00000015
+r 31F0.10
+*Want "cc/FPC 8"                  20080000 20080000 20080000 00000000
+r 3200.10
+*Want "AXTR 9"                    C3FD0000 00000000 00000017 CFF3FCFF
+r 3210.10
+*Want "SXTR 9"                    C3FD0000 00000000 00000020 00000001
+r 3220.10
+*Want "MXTR 9"                    F8000000 00000000 00000000 00000000
+r 3230.10
+*Want "cc/FPC 9"                  10000000 10000000 10000000 00200000
+r 3240.10
+*Want "AXTR 10"                   04000000 00000000 00000000 00000003
+r 3250.10
+*Want "SXTR 10"                   00000FF3 FCFF3FCF F3FCFF3F CFF3FF9F
+r 3260.10
+*Want "MXTR 10"                   00000000 00000000 00000000 00000000
+r 3270.10
+*Want "cc/FPC 10"                 20200000 20200000 20200000 00180000
+r 3280.10
+*Want "AXTR 11"                   22080000 00000000 00000000 00000080
+r 3290.10
+*Want "SXTR 11"                   22080000 00000000 00000000 00000000
+r 32A0.10
+*Want "MXTR 11"                   22084000 00000000 00000000 00000150
+r 32B0.10
+*Want "cc/FPC 11"                 20180000 00180000 00180000 00000000
+r 32C0.10
+*Want "AXTR 12"                   F8000000 00000000 00000000 00000000
+r 32D0.10
+*Want "SXTR 12"                   F8000000 00000000 00000000 00000000
+r 32E0.10
+*Want "MXTR 12"                   F8000000 00000000 00000000 00000000
+r 32F0.10
+*Want "cc/FPC 12"                 10000000 10000000 10000000 00000000
+r 3300.10
+*Want "AXTR 13"                   7C000000 00000000 00000000 00000005
+r 3310.10
+*Want "SXTR 13"                   7C000000 00000000 00000000 00000005
+r 3320.10
+*Want "MXTR 13"                   7C000000 00000000 00000000 00000005
+r 3330.10
+*Want "cc/FPC 13"                 30000000 30000000 30000000 00800000
+r 3340.10
+*Want "AXTR 14"                   AE0DC6CB 1EDC4280 00000000 00000000
+r 3350.10
+*Want "SXTR 14"                   2E0DC6CB 1EDC4280 00000000 00000000
+r 3360.10
+*Want "MXTR 14"                   36057A1E 07769CEC 2FB34D69 F7B4620E
+r 3370.10
+*Want "cc/FPC 14"                 10800000 20800000 20800000 00080000
+r 3380.10
+*Want "AXTR 15"                   B20BF800 00000000 00000000 00000000
+r 3390.10
+*Want "SXTR 15"                   B20BF800 00000000 00000000 00000000
+r 33A0.10
+*Want "MXTR 15"                   220C0000 00000000 00000000 027FCF16
+r 33B0.10
+*Want "cc/FPC 15"                 10080000 10080000 10080000 00080000
+r 33C0.10
+*Want "AXTR 16"                   220C8000 00000003 28460501 108C5506
+r 33D0.10
+*Want "SXTR 16"                   A20C8000 00000003 28460501 108C66DA
+r 33E0.10
+*Want "MXTR 16"                   A2118000 00000039 121925EE 9B7197D6
+r 33F0.10
+*Want "cc/FPC 16"                 20080000 10080000 10080000 00000000
+r 3400.10
+*Want "AXTR 17"                   2A0A8BFA D3A2EECE 9E3CDC00 00000000
+r 3410.10
+*Want "SXTR 17"                   AA0A8BFA D3A2EECE 9E3CDC00 00000000
+r 3420.10
+*Want "MXTR 17"                   220CC000 0000B68A 56584E84 03AB1E2D
+r 3430.10
+*Want "cc/FPC 17"                 20000000 10000000 10000000 00080000
+r 3440.10
+*Want "AXTR 18"                   EA08A0A5 98EC0C57 710FA81B B817B400
+r 3450.10
+*Want "SXTR 18"                   6A08A0A5 98EC0C57 710FA81B B817B400
+r 3460.10
+*Want "MXTR 18"                   32059742 2769A6C0 34F5C031 0C3B969D
+r 3470.10
+*Want "cc/FPC 18"                 10080000 20080000 20080000 00080000
+r 3480.10
+*Want "AXTR 19"                   36101707 C43A2000 00000000 00000000
+r 3490.10
+*Want "SXTR 19"                   B6101707 C43A2000 00000000 00000000
+r 34A0.10
+*Want "MXTR 19"                   2211C000 00008ECD 57C2776A EC9A0A83
+r 34B0.10
+*Want "cc/FPC 19"                 20080000 10080000 10080000 00080000
+r 34C0.10
+*Want "AXTR 20"                   A60D3476 4083887F DC5B368F 5F1ED800
+r 34D0.10
+*Want "SXTR 20"                   260D3476 4083887F DC5B368F 5F1ED800
+r 34E0.10
+*Want "MXTR 20"                   A20F0035 6B204194 DB75335C F70F0E72
+r 34F0.10
+*Want "cc/FPC 20"                 10080000 20080000 20080000 00080000
+r 3500.10
+*Want "AXTR 21"                   AE0E644C 9E500000 00000000 00000000
+r 3510.10
+*Want "SXTR 21"                   AE0E644C 9E500000 00000000 00000000
+r 3520.10
+*Want "MXTR 21"                   260D0CDB 4CC74C27 55DAFBA6 95A332B9
+r 3530.10
+*Want "cc/FPC 21"                 10080000 10080000 10080000 00080000
+r 3540.10
+*Want "AXTR 22"                   B2134852 12F4B827 291325A9 83E00000
+r 3550.10
+*Want "SXTR 22"                   32134852 12F4B827 291325A9 83E00000
+r 3560.10
+*Want "MXTR 22"                   2A1ABBB7 53029094 1A980B51 0095D128
+r 3570.10
+*Want "cc/FPC 22"                 10080000 20080000 20080000 00080000
+r 3580.10
+*Want "AXTR 23"                   A20B000E 7F05D201 65743EE0 F947F7E0
+r 3590.10
+*Want "SXTR 23"                   A20B000E 7F0704BF 8AFB0EAE 97877240
+r 35A0.10
+*Want "MXTR 23"                   BA1330D9 DAF7A521 B24C7BAD 696B38D0
+r 35B0.10
+*Want "cc/FPC 23"                 10080000 10080000 10080000 00080000
+r 35C0.10
+*Want "AXTR 24"                   6E053D61 089BC722 1E43D9E0 00000000
+r 35D0.10
+*Want "SXTR 24"                   6E053D61 089BC722 1E43D9E0 00000000
+r 35E0.10
+*Want "MXTR 24"                   2DFBAF0A 8D3BC506 A0B527FD 31DA9D02
+r 35F0.10
+*Want "cc/FPC 24"                 20080000 20080000 20080000 00080000
+r 3600.10
+*Want "AXTR 25"                   6A039367 103D077A 70000000 00000002
+r 3610.10
+*Want "SXTR 25"                   6A039367 103D077A 63FCFF3F CFF3FCFE
+r 3620.10
+*Want "MXTR 25"                   25FF54E2 277654A1 2CFA6718 C1D12BDB
+r 3630.10
+*Want "cc/FPC 25"                 20080000 20080000 20080000 00080000
+r 3800.10
+*Want "LEDTR/LDXTR 1"             2634D2E7 00000000 263134B9 C1E28E56
+r 3820.10
+*Want "LEDTR/LDXTR 2"             A644D2E8 00080000 A63534B9 C1E28E57
+r 3840.10
+*Want "LEDTR/LDXTR 3"             43F00007 00000000 43FC0000 00000007
+r 3860.10
+*Want "LEDTR/LDXTR 4"             43F00070 00000000 43FC0000 00000070
+r 3880.10
+*Want "LEDTR/LDXTR 5"             00600007 00000000 003C0000 00000007
+r 38A0.10
+*Want "LEDTR/LDXTR 6"             00000007 00000000 00000000 00000007
+r 38C0.10
+*Want "LEDTR/LDXTR 7"             A2500000 00000000 A2380000 00000000
+r 38E0.10
+*Want "LEDTR/LDXTR 8"             43F00000 00000000 43FC0000 00000000
+r 3900.10
+*Want "LEDTR/LDXTR 9"             FC000005 00800000 7C000000 00000005
+r 3920.10
+*Want "LEDTR/LDXTR 10"            6E800000 00000000 6E440000 00000000
+r F10.10
+*Want "ADTR/SDTR RTMI zero"       A2380000 00000000 A2380000 00000000
+
+*Done
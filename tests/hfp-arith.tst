@@ -0,0 +1,254 @@
+*Testcase hfp-arith: HFP AD/SD/MD/DD and MXR/DXR results
+
+* Long operand pairs at 1000, each added, subtracted, multiplied and
+* divided with the results stored at 2000; extended operand pairs at
+* 1400 are multiplied and divided with the results stored at 3000.
+* The operands mix normalized, unnormalized and zero fractions over
+* exponents that can underflow but never overflow; the exponent
+* underflow and significance masks are off, so those results are true
+* zeros. The expected values were produced by the 64-bit fraction code.
+
+sysclear
+archlvl z/Arch
+
+r 1a0=00000001800000000000000000000200  # z/Arch restart PSW
+r 1d0=0002000180000000000000000000DEAD  # z/Arch pgm new PSW
+
+r 200=C05100001000                      # LGFI  R5,X'1000'     long operands
+r 206=C06100002000                      # LGFI  R6,X'2000'     long results
+r 20C=A7780018                          # LHI   R7,24
+r 210=68005000                          # LD    F0,0(R5)
+r 214=6A005008                          # AD    F0,8(R5)
+r 218=60006000                          # STD   F0,0(R6)
+r 21C=68005000                          # LD    F0,0(R5)
+r 220=6B005008                          # SD    F0,8(R5)
+r 224=60006008                          # STD   F0,8(R6)
+r 228=68005000                          # LD    F0,0(R5)
+r 22C=6C005008                          # MD    F0,8(R5)
+r 230=60006010                          # STD   F0,16(R6)
+r 234=68005000                          # LD    F0,0(R5)
+r 238=6D005008                          # DD    F0,8(R5)
+r 23C=60006018                          # STD   F0,24(R6)
+r 240=41550010                          # LA    R5,16(R5)
+r 244=41660020                          # LA    R6,32(R6)
+r 248=A776FFE4                          # BRCT  R7,*-56
+r 24C=C05100001400                      # LGFI  R5,X'1400'     extended operands
+r 252=C06100003000                      # LGFI  R6,X'3000'     extended results
+r 258=A778000C                          # LHI   R7,12
+r 25C=68005000                          # LD    F0,0(R5)
+r 260=68205008                          # LD    F2,8(R5)
+r 264=68405010                          # LD    F4,16(R5)
+r 268=68605018                          # LD    F6,24(R5)
+r 26C=2604                              # MXR   F0,F4
+r 26E=60006000                          # STD   F0,0(R6)
+r 272=60206008                          # STD   F2,8(R6)
+r 276=68005000                          # LD    F0,0(R5)
+r 27A=68205008                          # LD    F2,8(R5)
+r 27E=B22D0004                          # DXR   F0,F4
+r 282=60006010                          # STD   F0,16(R6)
+r 286=60206018                          # STD   F2,24(R6)
+r 28A=41550020                          # LA    R5,32(R5)
+r 28E=41660020                          # LA    R6,32(R6)
+r 292=A776FFE5                          # BRCT  R7,*-54
+r 296=B2B20300                          # LPSWE WAITPSW
+
+r 300=00020001800000000000000000000000  # WAITPSW
+
+r 1000=360B96BAC12776E447769DD0B2A724D8
+r 1010=4458358C97323AED43BA023F9F40AA42
+r 1020=4900000000000000397D0EE9872E3ACA
+r 1030=505FD926616187F9401A3A2E79BC971E
+r 1040=49001E03163737984A741AC05B1F2132
+r 1050=C07EF9C12DCA8A7E355F717EB2CE7B42
+r 1060=3F00000000000000CBDB120B2596CA18
+r 1070=B11114F5D7B25A9EC6000F2DD451DED8
+r 1080=B970BD09388DCAEE3400B856ED9B2C36
+r 1090=30716D2A8AFDBABF400F78C523F82FAA
+r 10A0=85BBBAFBA5AE32A0C7B2CD2576470A8B
+r 10B0=4A3236F742EDD7803F5CD14487BC664E
+r 10C0=C078ACBEC5EF911D4E0B088FE5CAB347
+r 10D0=B69103126739B37A3A57E36A9F0536C2
+r 10E0=439F163E360863BA3797C51DF241CA83
+r 10F0=4200F1350E1A8596FA003AABA15741D2
+r 1100=2F00000000000000C9DDBC5F27694568
+r 1110=B6D6A6F6DBA3470B50FBE3A70E39E7B3
+r 1120=4B570DADEADDD76C4C0718296E3FFE39
+r 1130=93DB048487FC478B2300F995A0A0CEC7
+r 1140=B401DDA0B721AF08C37C7C3EDC74BCBA
+r 1150=305C03EF8796E11345918FFC3F1203C3
+r 1160=B27E3D30248B2572B4187096F85330CB
+r 1170=3F0F556DE35F0FBD3AF806A42CEECAF5
+r 1400=3A01F6C1642CEA352CF594B998C856ED
+r 1410=CC0907A0DF36E3FFBE929F4C0EC8C96B
+r 1420=300034417374BBB3222E4A3C82FBF436
+r 1430=BB0094CA7DBE55D5AD3244CE00D1B96D
+r 1440=33D051F5368A904325BCD052447FBACD
+r 1450=4B137615BF0DE2D13DCD34DBC6D5E424
+r 1460=9B00304B604130C48D5BFCC91E72C0CD
+r 1470=B43DF680FC939E49A623CD619682E36E
+r 1480=41125A049C78EFCD331011FAFE67F766
+r 1490=BA0395E14DB99DF5AC35319CFD635AB8
+r 14A0=D0000F4ECC166C42C2C8BC11F65C3D8D
+r 14B0=C1DC70F4EFAF89CFB3636F1456CF98D2
+r 14C0=31136D1A51EABA3E2365F286C620452C
+r 14D0=4753450E7EB686FE39BCE7AA255583CB
+r 14E0=6396BECC846DF634555F65D4AF122915
+r 14F0=4200070BB1530DE434855D8DEB56E26F
+r 1500=BD0001DD83109CD7AF8C9914EDC2F7F7
+r 1510=BE3F63DB19E4916CB09037CED70851C3
+r 1520=BA73E048AD1FF1D7AC3FFA1E7E0EC8E3
+r 1530=39D43A619B1EB6F72BF7EA8D6F3A7D9F
+r 1540=BF994D9F94A47A04B1AD0DC6CF2BAB17
+r 1550=30BF3BB099A676052274E94B0A1975D6
+r 1560=BF00000000000000B100000000000000
+r 1570=B6790CE88D72D2DAA8179C4F70AB652E
+
+runtest .1
+
+*Compare
+r 2000.10
+*Want "AD/SD 1"                   47769DD0 B2A724D8 C7769DD0 B2A724D8
+r 2010.10
+*Want "MD/DD 1"                   3C55E9EF 81EC1CA2 2F1902D8 2033A594
+r 2020.10
+*Want "AD/SD 2"                   4463D5B0 91264591 444C9568 9D3E3048
+r 2030.10
+*Want "MD/DD 2"                   474017AE 7D00D0C9 41796683 9ABA3772
+r 2040.10
+*Want "AD/SD 3"                   00000000 00000000 00000000 00000000
+r 2050.10
+*Want "MD/DD 3"                   00000000 00000000 00000000 00000000
+r 2060.10
+*Want "AD/SD 4"                   505FD926 616187F9 505FD926 616187F9
+r 2070.10
+*Want "MD/DD 4"                   4F9D1D67 F2F1C982 513A78F0 153A2E3C
+r 2080.10
+*Want "AD/SD 5"                   4A741CA0 8C8294AB CA7418E0 29BBADB8
+r 2090.10
+*Want "MD/DD 5"                   50D9C88E E463518B 3D422C84 5A1D5D99
+r 20A0.10
+*Want "AD/SD 6"                   C07EF9C1 2DCA8486 C07EF9C1 2DCA9075
+r 20B0.10
+*Want "MD/DD 6"                   B52F56F9 C5E086C3 CC154939 2D0C43C1
+r 20C0.10
+*Want "AD/SD 7"                   CBDB120B 2596CA18 4BDB120B 2596CA18
+r 20D0.10
+*Want "MD/DD 7"                   00000000 00000000 00000000 00000000
+r 20E0.10
+*Want "AD/SD 8"                   C3F2DD45 1DED8000 43F2DD45 1DED8000
+r 20F0.10
+*Want "MD/DD 8"                   34103494 1AC74A90 2E12017A 661CEBC9
+r 2100.10
+*Want "AD/SD 9"                   B970BD09 2D085C14 B970BD09 441339C7
+r 2110.10
+*Want "MD/DD 9"                   AB512E26 C5165FB3 C79C9084 AB89774E
+r 2120.10
+*Want "AD/SD 10"                  3FF78C52 3F82FAA0 BFF78C52 3F82FAA0
+r 2130.10
+*Want "MD/DD 10"                  2F6DAE80 307A5868 31754C90 0D0C0501
+r 2140.10
+*Want "AD/SD 11"                  C7B2CD25 76470A8B 47B2CD25 76470A8B
+r 2150.10
+*Want "MD/DD 11"                  0C831E73 2D797339 00000000 00000000
+r 2160.10
+*Want "AD/SD 12"                  4A3236F7 42EDDD4D 4A3236F7 42EDD1B2
+r 2170.10
+*Want "MD/DD 12"                  491234CD 2D24BC39 4B8A7F4E 9D36670A
+r 2180.10
+*Want "AD/SD 13"                  4DB088FE 5CAB3469 CDB088FE 5CAB3477
+r 2190.10
+*Want "MD/DD 13"                  CD533756 D481EC17 B3AEFEB0 DCFD457B
+r 21A0.10
+*Want "AD/SD 14"                  3A57E2D9 9BF2CF88 BA57E3FB A2179DFB
+r 21B0.10
+*Want "MD/DD 14"                  B031C8DD 5FBF9F68 BD1A6639 69651390
+r 21C0.10
+*Want "AD/SD 15"                  439F163E 36086451 439F163E 36086322
+r 21D0.10
+*Want "MD/DD 15"                  3A5E509D 6BCF7CB4 4D10C578 509D7650
+r 21E0.10
+*Want "AD/SD 16"                  F83AABA1 5741D200 783AABA1 5741D200
+r 21F0.10
+*Want "MD/DD 16"                  F83747BB A702E606 8941C792 2C842F8D
+r 2200.10
+*Want "AD/SD 17"                  C9DDBC5F 27694568 49DDBC5F 27694568
+r 2210.10
+*Want "MD/DD 17"                  00000000 00000000 00000000 00000000
+r 2220.10
+*Want "AD/SD 18"                  50FBE3A7 0E39E7B3 D0FBE3A7 0E39E7B3
+r 2230.10
+*Want "MD/DD 18"                  C6D33496 291690AB A6DA27BD F7FBDC90
+r 2240.10
+*Want "AD/SD 19"                  4BC89044 CEDDBAFC CB1A74E8 F9220C24
+r 2250.10
+*Want "MD/DD 19"                  56269972 06893D95 40C45504 9538106A
+r 2260.10
+*Want "AD/SD 20"                  21F995A0 A0CEC700 A1F995A0 A0CEC700
+r 2270.10
+*Want "MD/DD 20"                  00000000 00000000 B2E0A5BF 56465B96
+r 2280.10
+*Want "AD/SD 21"                  C37C7C3E DC74BCBA 437C7C3E DC74BCBA
+r 2290.10
+*Want "MD/DD 21"                  35E841A7 D5415D21 303D639D 273644AF
+r 22A0.10
+*Want "AD/SD 22"                  45918FFC 3F1203C3 C5918FFC 3F1203C3
+r 22B0.10
+*Want "MD/DD 22"                  353451FB 89246DCF 2BA1D3B7 484427B8
+r 22C0.10
+*Want "AD/SD 23"                  B418EED4 2877BBF0 3417F259 C82EA5A5
+r 22D0.10
+*Want "MD/DD 23"                  25C0D41B ACB8A563 3F52A515 D39B2B28
+r 22E0.10
+*Want "AD/SD 24"                  3EF557D6 3C9528BE 3EF555E6 2F4CCEE2
+r 22F0.10
+*Want "MD/DD 24"                  38EDB284 A42CD99A 44FD3A1D 5E88024D
+r 3000.10
+*Want "MXR 1"                     C411BBC7 BE8E5531 B625933B BCFFAF5C
+r 3010.10
+*Want "DXR 1"                     AE37AD68 27DC0B02 A09E58AE 8F1E3C1B
+r 3020.10
+*Want "MXR 2"                     A71E5F2C 0F6618A2 997CE495 0B7F187F
+r 3030.10
+*Want "DXR 2"                     B559E85D 4F391F62 A75C6483 9983290F
+r 3040.10
+*Want "MXR 3"                     3DFD62CA C44FCBD1 2FD98B53 049A621B
+r 3050.10
+*Want "DXR 3"                     29AB44FF A2FD3544 1B07D7CC DFA34A33
+r 3060.10
+*Want "MXR 4"                     0CBB076B 35D7023C 7E0E6DAD 4DC88610
+r 3070.10
+*Want "DXR 4"                     25C78756 BE234702 1785F096 005EFE01
+r 3080.10
+*Want "MXR 5"                     B941CC99 34EC7C72 AB8BE2DB FF0D9F2F
+r 3090.10
+*Want "DXR 5"                     C851E4B3 7B4B549F BA61957D 8A598DB7
+r 30A0.10
+*Want "MXR 6"                     4ED2E788 1FE6DC4E 40D60894 2C33D308
+r 30B0.10
+*Want "DXR 6"                     4D11C6ED 700DFD3F 3FCAD26B E75A66B1
+r 30C0.10
+*Want "MXR 7"                     376519D0 A3C2BE4B 29C2FC29 6EF8FFEA
+r 30D0.10
+*Want "DXR 7"                     2A3BB909 743E60C7 1C81521B B4E5D9AE
+r 30E0.10
+*Want "MXR 8"                     624261A3 53C2494D 542D3955 5638B540
+r 30F0.10
+*Want "DXR 8"                     6515653B 93222C3C 5706D799 0651B074
+r 3100.10
+*Want "MXR 9"                     37763D83 75710DBD 294A12EE 93204009
+r 3110.10
+*Want "DXR 9"                     3C7886D2 44EC56C4 2E7CFA63 31A10E68
+r 3120.10
+*Want "MXR 10"                    B3601029 2E07EA37 A52E4C1F BA227B7D
+r 3130.10
+*Want "DXR 10"                    C18BC687 BBB78F6E B303CFEB C66B93C3
+r 3140.10
+*Want "MXR 11"                    AF7284A8 B50EC285 A10CD977 0228D7AB
+r 3150.10
+*Want "DXR 11"                    CFCD3954 2A6E1349 C179DD3F C531B27E
+r 3160.10
+*Want "MXR 12"                    00000000 00000000 00000000 00000000
+r 3170.10
+*Want "DXR 12"                    00000000 00000000 00000000 00000000
+
+*Done
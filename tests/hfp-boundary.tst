@@ -0,0 +1,1148 @@
+*Testcase hfp-boundary: HFP guard digit, underflow and overflow boundaries
+
+* Long operand pairs at 1000 are added, subtracted, multiplied and
+* divided (AD/SD/MD/DD); the high words of the same pairs are used
+* for AE/SE/MEE/DE; extended operand pairs at 1800 go through
+* AXR/SXR/MXR/DXR. Each instruction stores its result and the program
+* interruption code, if any, next to it. The vectors cover guard-digit
+* subtraction, results whose exponent is just inside or just outside
+* 00 and 7F, true zero results, divide by zero and seeded random
+* operands. The whole set is run first with the exponent-underflow
+* and significance masks off (results at 2000, 2800 and 3000) and then
+* with both masks on (results at 6000, 6800 and 7000).
+* The expected values were produced by the portable HFP code.
+
+sysclear
+archlvl z/Arch
+
+r 1a0=00000001800000000000000000000200  # z/Arch restart PSW
+r 1d0=00000001800000000000000000000700  # z/Arch pgm new PSW
+
+r 200=A7980002                          # LHI   R9,2            two passes
+r 204=A7A80000                          # LHI   R10,0           result offset
+r 208=C05100001000                      # LGFI  R5,X'1000'     long operands
+r 20E=C06100002000                      # LGFI  R6,X'2000'     long results
+r 214=B908006A                          # AGR   R6,R10
+r 218=A7780020                          # LHI   R7,32
+r 21C=68005000                          # LD    F0,0(R5)
+r 220=41806020                          # LA    R8,32(R6)
+r 224=6A005008                          # AD    F0,8(R5)
+r 228=60006000                          # STD   F0,0(R6)
+r 22C=68005000                          # LD    F0,0(R5)
+r 230=41806024                          # LA    R8,36(R6)
+r 234=6B005008                          # SD    F0,8(R5)
+r 238=60006008                          # STD   F0,8(R6)
+r 23C=68005000                          # LD    F0,0(R5)
+r 240=41806028                          # LA    R8,40(R6)
+r 244=6C005008                          # MD    F0,8(R5)
+r 248=60006010                          # STD   F0,16(R6)
+r 24C=68005000                          # LD    F0,0(R5)
+r 250=4180602C                          # LA    R8,44(R6)
+r 254=6D005008                          # DD    F0,8(R5)
+r 258=60006018                          # STD   F0,24(R6)
+r 25C=41550010                          # LA    R5,16(R5)
+r 260=41660030                          # LA    R6,48(R6)
+r 264=A776FFDC                          # BRCT  R7,LONG
+r 268=C05100001000                      # LGFI  R5,X'1000'     short operands
+r 26E=C06100002800                      # LGFI  R6,X'2800'     short results
+r 274=B908006A                          # AGR   R6,R10
+r 278=A7780020                          # LHI   R7,32
+r 27C=78005000                          # LE    F0,0(R5)
+r 280=41806010                          # LA    R8,16(R6)
+r 284=7A005008                          # AE    F0,8(R5)
+r 288=70006000                          # STE   F0,0(R6)
+r 28C=78005000                          # LE    F0,0(R5)
+r 290=41806014                          # LA    R8,20(R6)
+r 294=7B005008                          # SE    F0,8(R5)
+r 298=70006004                          # STE   F0,4(R6)
+r 29C=78005000                          # LE    F0,0(R5)
+r 2A0=41806018                          # LA    R8,24(R6)
+r 2A4=ED0050080037                      # MEE   F0,8(R5)
+r 2AA=70006008                          # STE   F0,8(R6)
+r 2AE=78005000                          # LE    F0,0(R5)
+r 2B2=4180601C                          # LA    R8,28(R6)
+r 2B6=7D005008                          # DE    F0,8(R5)
+r 2BA=7000600C                          # STE   F0,12(R6)
+r 2BE=41550010                          # LA    R5,16(R5)
+r 2C2=41660020                          # LA    R6,32(R6)
+r 2C6=A776FFDB                          # BRCT  R7,SHORT
+r 2CA=C05100001800                      # LGFI  R5,X'1800'     extended operands
+r 2D0=C06100003000                      # LGFI  R6,X'3000'     extended results
+r 2D6=B908006A                          # AGR   R6,R10
+r 2DA=A7780010                          # LHI   R7,16
+r 2DE=68005000                          # LD    F0,0(R5)
+r 2E2=68205008                          # LD    F2,8(R5)
+r 2E6=68405010                          # LD    F4,16(R5)
+r 2EA=68605018                          # LD    F6,24(R5)
+r 2EE=41806040                          # LA    R8,64(R6)
+r 2F2=3604                              # AXR   F0,F4
+r 2F4=60006000                          # STD   F0,0(R6)
+r 2F8=60206008                          # STD   F2,8(R6)
+r 2FC=68005000                          # LD    F0,0(R5)
+r 300=68205008                          # LD    F2,8(R5)
+r 304=68405010                          # LD    F4,16(R5)
+r 308=68605018                          # LD    F6,24(R5)
+r 30C=41806044                          # LA    R8,68(R6)
+r 310=3704                              # SXR   F0,F4
+r 312=60006010                          # STD   F0,16(R6)
+r 316=60206018                          # STD   F2,24(R6)
+r 31A=68005000                          # LD    F0,0(R5)
+r 31E=68205008                          # LD    F2,8(R5)
+r 322=68405010                          # LD    F4,16(R5)
+r 326=68605018                          # LD    F6,24(R5)
+r 32A=41806048                          # LA    R8,72(R6)
+r 32E=2604                              # MXR   F0,F4
+r 330=60006020                          # STD   F0,32(R6)
+r 334=60206028                          # STD   F2,40(R6)
+r 338=68005000                          # LD    F0,0(R5)
+r 33C=68205008                          # LD    F2,8(R5)
+r 340=68405010                          # LD    F4,16(R5)
+r 344=68605018                          # LD    F6,24(R5)
+r 348=4180604C                          # LA    R8,76(R6)
+r 34C=B22D0004                          # DXR   F0,F4
+r 350=60006030                          # STD   F0,48(R6)
+r 354=60206038                          # STD   F2,56(R6)
+r 358=41550020                          # LA    R5,32(R5)
+r 35C=41660050                          # LA    R6,80(R6)
+r 360=A776FFBF                          # BRCT  R7,EXT
+r 364=C01103000000                      # LGFI  R1,X'3000000'  EU and SG masks
+r 36A=0410                              # SPM   R1
+r 36C=A7A84000                          # LHI   R10,X'4000'
+r 370=A796FF4C                          # BRCT  R9,TOP
+r 374=B2B207E0                          # LPSWE X'7E0'
+
+r 7E0=00020001800000000000000000000000  # z/Arch disabled wait PSW
+
+r 700=D2038000008C                      # MVC   0(4,R8),X'8C'  interruption code
+r 706=B2B20150                          # LPSWE X'150'         resume
+
+r 1000=411000000000000040FFFFFFFFFFFFFF # guard digit
+r 1010=41100000000000003FFFFFFFFFFFFFFF # beyond guard
+r 1020=4110000000000001C0FFFFFFFFFFFFFF # cancel
+r 1030=01100000000000000010000000000000 # sub underflow
+r 1040=01100000000000004110000000000000 # mul underflow
+r 1050=7FFFFFFFFFFFFFFF7FFFFFFFFFFFFFFF # max
+r 1060=7F100000000000004110000000000000 # mul at 7F
+r 1070=7F100000000000004210000000000000 # mul overflow
+r 1080=00100000000000004210000000000000 # div underflow
+r 1090=41000000000000014000000000000001 # unnormalized
+r 10A0=4080000000000000C080000000000000 # zero sum
+r 10B0=00000000000000004110000000000000 # zero operand
+r 10C0=41100000000000000000000000000000 # divide by zero
+r 10D0=4FFFFFFFFFFFFFFF4FFFFFFFFFFFFFF0 # close large
+r 10E0=01800000000000003F80000000000000 # mul at 00
+r 10F0=01800000000000003F10000000000000 # mul below 00
+r 1100=7F100000000000003F80000000000000 # div overflow
+r 1110=7F100000000000004080000000000000 # div at 7F
+r 1120=3F800000000000FFC1FFFFFFFFFFFFF1 # low digits
+r 1130=41ABCDEF0123456742ABCDEF01234567 # div fract equal
+r 1140=FE10000000000000810000B15BA8A9FC # random 1
+r 1150=3F000B04F3834E23FF00985D85B27790 # random 2
+r 1160=411000000000000041FFFFFFFFFFFFFF # random 3
+r 1170=7E0251E04C4861A87F00000000000084 # random 4
+r 1180=800000000000DFEA40FFFFFFFFFFFFFF # random 5
+r 1190=8110000000000000FE10000000000000 # random 6
+r 11A0=FEFFFFFFFFFFFFFF3FB8348A311CA8B8 # random 7
+r 11B0=7E0DEE75B4E8887DC198590107A834F1 # random 8
+r 11C0=40100000000000007E00001555BD6359 # random 9
+r 11D0=4010000000000000C010000000000000 # random 10
+r 11E0=020000000000810A827C2028AC559890 # random 11
+r 11F0=C10000000000000702008001E8D5F17F # random 12
+r 1800=41100000000000003300000000000000 # guard digit
+r 1810=40FFFFFFFFFFFFFF32FFFFFFFFFFFFFF
+r 1820=7FFFFFFFFFFFFFFF71FFFFFFFFFFFFFF # max
+r 1830=7FFFFFFFFFFFFFFF71FFFFFFFFFFFFFF
+r 1840=01100000000000007300000000000000 # mul underflow
+r 1850=41100000000000003300000000000000
+r 1860=7F100000000000007100000000000000 # mul at 7F
+r 1870=41100000000000003300000000000000
+r 1880=7F100000000000007100000000000000 # mul overflow
+r 1890=42100000000000003400000000000000
+r 18A0=00100000000000007200000000000000 # div underflow
+r 18B0=42100000000000003400000000000000
+r 18C0=41800000000000003300000000000000 # zero sum
+r 18D0=C180000000000000B300000000000000
+r 18E0=41100000000000003300000000000000 # divide by zero
+r 18F0=00000000000000007200000000000000
+r 1900=01800000000000007300000000000000 # mul below 00
+r 1910=3F100000000000003100000000000000
+r 1920=01800000000000007300000000000000 # mul at 00
+r 1930=3F800000000000003100000000000000
+r 1940=3F8000000000000031000000000000FF # low digits
+r 1950=C1FFFFFFFFFFFFFFB3FFFFFFFFFFFFF1
+r 1960=7F100000000000007100000000000000 # div overflow
+r 1970=3F800000000000003100000000000000
+r 1980=81000045A0711005F3AEF3FD7D22737D # random 1
+r 1990=C010000000000000B200000000000000
+r 19A0=01FFFFFFFFFFFFFF73FFFFFFFFFFFFFF # random 2
+r 19B0=FE000000001A9AD0F0802F29CA56C78B
+r 19C0=400C77B21C51031C32BEBF5E4CD5B1B6 # random 3
+r 19D0=7E000008FC0D5031706CBED8C7196A98
+r 19E0=FF00000000000000F1000687F99692EF # random 4
+r 19F0=FF10000000000000F100000000000000
+
+runtest 1
+
+*Compare
+r 2000.10
+*Want "guard digit long off AD SD" 411FFFFF FFFFFFFF 33100000 00000000
+r 2010.10
+*Want "guard digit long off MD DD" 40FFFFFF FFFFFFFF 41100000 00000000
+r 2020.10
+*Want "guard digit long off codes" 00000000 00000000 00000000 00000000
+r 2030.10
+*Want "beyond guard long off AD SD" 4110FFFF FFFFFFFF 40F00000 00000001
+r 2040.10
+*Want "beyond guard long off MD DD" 3FFFFFFF FFFFFFFF 42100000 00000000
+r 2050.10
+*Want "beyond guard long off codes" 00000000 00000000 00000000 00000000
+r 2060.10
+*Want "cancel long off AD SD" 34110000 00000000 41200000 00000000
+r 2070.10
+*Want "cancel long off MD DD" C1100000 00000000 C1100000 00000001
+r 2080.10
+*Want "cancel long off codes" 00000000 00000000 00000000 00000000
+r 2090.10
+*Want "sub underflow long off AD SD" 01110000 00000000 00F00000 00000000
+r 20A0.10
+*Want "sub underflow long off MD DD" 00000000 00000000 42100000 00000000
+r 20B0.10
+*Want "sub underflow long off codes" 00000000 00000000 00000000 00000000
+r 20C0.10
+*Want "mul underflow long off AD SD" 41100000 00000000 C1100000 00000000
+r 20D0.10
+*Want "mul underflow long off MD DD" 01100000 00000000 01100000 00000000
+r 20E0.10
+*Want "mul underflow long off codes" 00000000 00000000 00000000 00000000
+r 20F0.10
+*Want "max long off AD SD" 001FFFFF FFFFFFFF 00000000 00000000
+r 2100.10
+*Want "max long off MD DD" 3EFFFFFF FFFFFFFE 41100000 00000000
+r 2110.10
+*Want "max long off codes" 0004000C 00000000 0004000C 00000000
+r 2120.10
+*Want "mul at 7F long off AD SD" 7F100000 00000000 7F100000 00000000
+r 2130.10
+*Want "mul at 7F long off MD DD" 7F100000 00000000 7F100000 00000000
+r 2140.10
+*Want "mul at 7F long off codes" 00000000 00000000 00000000 00000000
+r 2150.10
+*Want "mul overflow long off AD SD" 7F100000 00000000 7F100000 00000000
+r 2160.10
+*Want "mul overflow long off MD DD" 00100000 00000000 7E100000 00000000
+r 2170.10
+*Want "mul overflow long off codes" 00000000 00000000 0004000C 00000000
+r 2180.10
+*Want "div underflow long off AD SD" 42100000 00000000 C2100000 00000000
+r 2190.10
+*Want "div underflow long off MD DD" 01100000 00000000 00000000 00000000
+r 21A0.10
+*Want "div underflow long off codes" 00000000 00000000 00000000 00000000
+r 21B0.10
+*Want "unnormalized long off AD SD" 34110000 00000000 33F00000 00000000
+r 21C0.10
+*Want "unnormalized long off MD DD" 26100000 00000000 42100000 00000000
+r 21D0.10
+*Want "unnormalized long off codes" 00000000 00000000 00000000 00000000
+r 21E0.10
+*Want "zero sum long off AD SD" 00000000 00000000 41100000 00000000
+r 21F0.10
+*Want "zero sum long off MD DD" C0400000 00000000 C1100000 00000000
+r 2200.10
+*Want "zero sum long off codes" 00000000 00000000 00000000 00000000
+r 2210.10
+*Want "zero operand long off AD SD" 41100000 00000000 C1100000 00000000
+r 2220.10
+*Want "zero operand long off MD DD" 00000000 00000000 00000000 00000000
+r 2230.10
+*Want "zero operand long off codes" 00000000 00000000 00000000 00000000
+r 2240.10
+*Want "divide by zero long off AD SD" 41100000 00000000 41100000 00000000
+r 2250.10
+*Want "divide by zero long off MD DD" 00000000 00000000 41100000 00000000
+r 2260.10
+*Want "divide by zero long off codes" 00000000 00000000 00000000 0004000F
+r 2270.10
+*Want "close large long off AD SD" 501FFFFF FFFFFFFE 42F00000 00000000
+r 2280.10
+*Want "close large long off MD DD" 5EFFFFFF FFFFFFEF 41100000 00000000
+r 2290.10
+*Want "close large long off codes" 00000000 00000000 00000000 00000000
+r 22A0.10
+*Want "mul at 00 long off AD SD" 3F800000 00000000 BF800000 00000000
+r 22B0.10
+*Want "mul at 00 long off MD DD" 00400000 00000000 03100000 00000000
+r 22C0.10
+*Want "mul at 00 long off codes" 00000000 00000000 00000000 00000000
+r 22D0.10
+*Want "mul below 00 long off AD SD" 3F100000 00000000 BF100000 00000000
+r 22E0.10
+*Want "mul below 00 long off MD DD" 00000000 00000000 03800000 00000000
+r 22F0.10
+*Want "mul below 00 long off codes" 00000000 00000000 00000000 00000000
+r 2300.10
+*Want "div overflow long off AD SD" 7F100000 00000000 7F100000 00000000
+r 2310.10
+*Want "div overflow long off MD DD" 7D800000 00000000 00200000 00000000
+r 2320.10
+*Want "div overflow long off codes" 00000000 00000000 00000000 0004000C
+r 2330.10
+*Want "div at 7F long off AD SD" 7F100000 00000000 7F100000 00000000
+r 2340.10
+*Want "div at 7F long off MD DD" 7E800000 00000000 7F200000 00000000
+r 2350.10
+*Want "div at 7F long off codes" 00000000 00000000 00000000 00000000
+r 2360.10
+*Want "low digits long off AD SD" C1FF7FFF FFFFFFF0 421007FF FFFFFFFF
+r 2370.10
+*Want "low digits long off MD DD" C0800000 000000F7 BE800000 00000106
+r 2380.10
+*Want "low digits long off codes" 00000000 00000000 00000000 00000000
+r 2390.10
+*Want "div fract equal long off AD SD" 42B68ACD F13579BD C2A11110 11111110
+r 23A0.10
+*Want "div fract equal long off MD DD" 43734CC2 F42C1454 40100000 00000000
+r 23B0.10
+*Want "div fract equal long off codes" 00000000 00000000 00000000 00000000
+r 23C0.10
+*Want "random 1 long off AD SD" FE100000 00000000 FE100000 00000000
+r 23D0.10
+*Want "random 1 long off MD DD" 3AB15BA8 A9FC0000 41171832 E2A279A4
+r 23E0.10
+*Want "random 1 long off codes" 00000000 00000000 00000000 0004000C
+r 23F0.10
+*Want "random 2 long off AD SD" FD985D85 B2779000 7D985D85 B2779000
+r 2400.10
+*Want "random 2 long off MD DD" F968EF72 3AE32339 801283AF 2AB189EF
+r 2410.10
+*Want "random 2 long off codes" 00000000 00000000 00000000 00000000
+r 2420.10
+*Want "random 3 long off AD SD" 4210FFFF FFFFFFFF C1EFFFFF FFFFFFFF
+r 2430.10
+*Want "random 3 long off MD DD" 41FFFFFF FFFFFFFF 40100000 00000000
+r 2440.10
+*Want "random 3 long off codes" 00000000 00000000 00000000 00000000
+r 2450.10
+*Want "random 4 long off AD SD" 7D251E04 C4869E80 7D251E04 C4859680
+r 2460.10
+*Want "random 4 long off MD DD" 3013237A 755525AA 4A47FC28 46D588BA
+r 2470.10
+*Want "random 4 long off codes" 00000000 00000000 0004000C 00000000
+r 2480.10
+*Want "random 5 long off AD SD" 40FFFFFF FFFFFFFF C0FFFFFF FFFFFFFF
+r 2490.10
+*Want "random 5 long off MD DD" 00000000 00000000 00000000 00000000
+r 24A0.10
+*Want "random 5 long off codes" 00000000 00000000 00000000 00000000
+r 24B0.10
+*Want "random 6 long off AD SD" FE100000 00000000 7E100000 00000000
+r 24C0.10
+*Want "random 6 long off MD DD" 3E100000 00000000 00000000 00000000
+r 24D0.10
+*Want "random 6 long off codes" 00000000 00000000 00000000 00000000
+r 24E0.10
+*Want "random 7 long off AD SD" FEFFFFFF FFFFFFFF FEFFFFFF FFFFFFFF
+r 24F0.10
+*Want "random 7 long off MD DD" FDB8348A 311CA8B7 80163C6E EA9C8482
+r 2500.10
+*Want "random 7 long off codes" 00000000 00000000 00000000 0004000C
+r 2510.10
+*Want "random 8 long off AD SD" 7DDEE75B 4E8887D0 7DDEE75B 4E8887D0
+r 2520.10
+*Want "random 8 long off MD DD" FE84A6DD 8AF182D5 FD1768F6 19AAC601
+r 2530.10
+*Want "random 8 long off codes" 00000000 00000000 00000000 00000000
+r 2540.10
+*Want "random 9 long off AD SD" 7A1555BD 63590000 FA1555BD 63590000
+r 2550.10
+*Want "random 9 long off MD DD" 791555BD 63590000 06BFFC57 93B6770E
+r 2560.10
+*Want "random 9 long off codes" 00000000 00000000 00000000 00000000
+r 2570.10
+*Want "random 10 long off AD SD" 00000000 00000000 40200000 00000000
+r 2580.10
+*Want "random 10 long off MD DD" BF100000 00000000 C1100000 00000000
+r 2590.10
+*Want "random 10 long off codes" 00000000 00000000 00000000 00000000
+r 25A0.10
+*Want "random 11 long off AD SD" 827C2028 AC551786 027C2028 AC56199A
+r 25B0.10
+*Want "random 11 long off MD DD" 00000000 00000000 B710A223 4860E98B
+r 25C0.10
+*Want "random 11 long off codes" 00000000 00000000 00000000 00000000
+r 25D0.10
+*Want "random 12 long off AD SD" B4700000 00000000 B4700000 00000000
+r 25E0.10
+*Want "random 12 long off MD DD" 00000000 00000000 F4DFFCA8 965C3A44
+r 25F0.10
+*Want "random 12 long off codes" 00000000 00000000 00000000 00000000
+r 2800.10
+*Want "guard digit short off" 411FFFFF 3B100000 40FFFFFF 41100000
+r 2810.10
+*Want "guard digit short off codes" 00000000 00000000 00000000 00000000
+r 2820.10
+*Want "beyond guard short off" 4110FFFF 40F00001 3FFFFFFF 42100000
+r 2830.10
+*Want "beyond guard short off codes" 00000000 00000000 00000000 00000000
+r 2840.10
+*Want "cancel short off" 3B100000 411FFFFF C0FFFFFF C1100000
+r 2850.10
+*Want "cancel short off codes" 00000000 00000000 00000000 00000000
+r 2860.10
+*Want "sub underflow short off" 01110000 00F00000 00000000 42100000
+r 2870.10
+*Want "sub underflow short off codes" 00000000 00000000 00000000 00000000
+r 2880.10
+*Want "mul underflow short off" 41100000 C1100000 01100000 01100000
+r 2890.10
+*Want "mul underflow short off codes" 00000000 00000000 00000000 00000000
+r 28A0.10
+*Want "max short off" 001FFFFF 00000000 3EFFFFFE 41100000
+r 28B0.10
+*Want "max short off codes" 0004000C 00000000 0006000C 00000000
+r 28C0.10
+*Want "mul at 7F short off" 7F100000 7F100000 7F100000 7F100000
+r 28D0.10
+*Want "mul at 7F short off codes" 00000000 00000000 00000000 00000000
+r 28E0.10
+*Want "mul overflow short off" 7F100000 7F100000 00100000 7E100000
+r 28F0.10
+*Want "mul overflow short off codes" 00000000 00000000 0006000C 00000000
+r 2900.10
+*Want "div underflow short off" 42100000 C2100000 01100000 00000000
+r 2910.10
+*Want "div underflow short off codes" 00000000 00000000 00000000 00000000
+r 2920.10
+*Want "unnormalized short off" 00000000 00000000 00000000 41000000
+r 2930.10
+*Want "unnormalized short off codes" 00000000 00000000 00000000 0004000F
+r 2940.10
+*Want "zero sum short off" 00000000 41100000 C0400000 C1100000
+r 2950.10
+*Want "zero sum short off codes" 00000000 00000000 00000000 00000000
+r 2960.10
+*Want "zero operand short off" 41100000 C1100000 00000000 00000000
+r 2970.10
+*Want "zero operand short off codes" 00000000 00000000 00000000 00000000
+r 2980.10
+*Want "divide by zero short off" 41100000 41100000 00000000 41100000
+r 2990.10
+*Want "divide by zero short off codes" 00000000 00000000 00000000 0004000F
+r 29A0.10
+*Want "close large short off" 501FFFFF 00000000 5EFFFFFE 41100000
+r 29B0.10
+*Want "close large short off codes" 00000000 00000000 00000000 00000000
+r 29C0.10
+*Want "mul at 00 short off" 3F800000 BF800000 00400000 03100000
+r 29D0.10
+*Want "mul at 00 short off codes" 00000000 00000000 00000000 00000000
+r 29E0.10
+*Want "mul below 00 short off" 3F100000 BF100000 00000000 03800000
+r 29F0.10
+*Want "mul below 00 short off codes" 00000000 00000000 00000000 00000000
+r 2A00.10
+*Want "div overflow short off" 7F100000 7F100000 7D800000 00200000
+r 2A10.10
+*Want "div overflow short off codes" 00000000 00000000 00000000 0004000C
+r 2A20.10
+*Want "div at 7F short off" 7F100000 7F100000 7E800000 7F200000
+r 2A30.10
+*Want "div at 7F short off codes" 00000000 00000000 00000000 00000000
+r 2A40.10
+*Want "low digits short off" C1FF7FFF 421007FF C07FFFFF BE800000
+r 2A50.10
+*Want "low digits short off codes" 00000000 00000000 00000000 00000000
+r 2A60.10
+*Want "div fract equal short off" 42B68ACD C2A11110 43734CC2 40100000
+r 2A70.10
+*Want "div fract equal short off codes" 00000000 00000000 00000000 00000000
+r 2A80.10
+*Want "random 1 short off" FE100000 FE100000 3AB10000 41172428
+r 2A90.10
+*Want "random 1 short off codes" 00000000 00000000 00000000 0004000C
+r 2AA0.10
+*Want "random 2 short off" FD985D00 7D985D00 F968E607 80128226
+r 2AB0.10
+*Want "random 2 short off codes" 00000000 00000000 00000000 00000000
+r 2AC0.10
+*Want "random 3 short off" 4210FFFF C1EFFFFF 41FFFFFF 40100000
+r 2AD0.10
+*Want "random 3 short off codes" 00000000 00000000 00000000 00000000
+r 2AE0.10
+*Want "random 4 short off" 7D251E00 7D251E00 00000000 7E0251E0
+r 2AF0.10
+*Want "random 4 short off codes" 00000000 00000000 00000000 0004000F
+r 2B00.10
+*Want "random 5 short off" 40FFFFFF C0FFFFFF 00000000 00000000
+r 2B10.10
+*Want "random 5 short off codes" 00000000 00000000 00000000 00000000
+r 2B20.10
+*Want "random 6 short off" FE100000 7E100000 3E100000 00000000
+r 2B30.10
+*Want "random 6 short off codes" 00000000 00000000 00000000 00000000
+r 2B40.10
+*Want "random 7 short off" FEFFFFFF FEFFFFFF FDB83489 80163C6E
+r 2B50.10
+*Want "random 7 short off codes" 00000000 00000000 00000000 0004000C
+r 2B60.10
+*Want "random 8 short off" 7DDEE750 7DDEE750 FE84A6D6 FD1768F4
+r 2B70.10
+*Want "random 8 short off codes" 00000000 00000000 00000000 00000000
+r 2B80.10
+*Want "random 9 short off" 7A150000 FA150000 79150000 06C30C30
+r 2B90.10
+*Want "random 9 short off codes" 00000000 00000000 00000000 00000000
+r 2BA0.10
+*Want "random 10 short off" 00000000 40200000 BF100000 C1100000
+r 2BB0.10
+*Want "random 10 short off codes" 00000000 00000000 00000000 00000000
+r 2BC0.10
+*Want "random 11 short off" 827C2028 027C2028 00000000 00000000
+r 2BD0.10
+*Want "random 11 short off codes" 00000000 00000000 00000000 00000000
+r 2BE0.10
+*Want "random 12 short off" 00000000 00000000 00000000 00000000
+r 2BF0.10
+*Want "random 12 short off codes" 00000000 00000000 00000000 00000000
+r 3000.10
+*Want "guard digit ext off AXR" 411FFFFF FFFFFFFF 33FFFFFF FFFFFFFF
+r 3010.10
+*Want "guard digit ext off SXR" 25100000 00000000 17000000 00000000
+r 3020.10
+*Want "guard digit ext off MXR" 40FFFFFF FFFFFFFF 32FFFFFF FFFFFFFF
+r 3030.10
+*Want "guard digit ext off DXR" 41100000 00000000 33000000 00000000
+r 3040.10
+*Want "guard digit ext off codes" 00000000 00000000 00000000 00000000
+r 3050.10
+*Want "max ext off AXR" 001FFFFF FFFFFFFF 72FFFFFF FFFFFFFF
+r 3060.10
+*Want "max ext off SXR" 00000000 00000000 00000000 00000000
+r 3070.10
+*Want "max ext off MXR" 3EFFFFFF FFFFFFFF 30FFFFFF FFFFFFFE
+r 3080.10
+*Want "max ext off DXR" 41100000 00000000 33000000 00000000
+r 3090.10
+*Want "max ext off codes" 0002000C 00000000 0002000C 00000000
+r 30A0.10
+*Want "mul underflow ext off AXR" 41100000 00000000 33000000 00000000
+r 30B0.10
+*Want "mul underflow ext off SXR" C1100000 00000000 B3000000 00000000
+r 30C0.10
+*Want "mul underflow ext off MXR" 01100000 00000000 73000000 00000000
+r 30D0.10
+*Want "mul underflow ext off DXR" 01100000 00000000 73000000 00000000
+r 30E0.10
+*Want "mul underflow ext off codes" 00000000 00000000 00000000 00000000
+r 30F0.10
+*Want "mul at 7F ext off AXR" 7F100000 00000000 71000000 00000000
+r 3100.10
+*Want "mul at 7F ext off SXR" 7F100000 00000000 71000000 00000000
+r 3110.10
+*Want "mul at 7F ext off MXR" 7F100000 00000000 71000000 00000000
+r 3120.10
+*Want "mul at 7F ext off DXR" 7F100000 00000000 71000000 00000000
+r 3130.10
+*Want "mul at 7F ext off codes" 00000000 00000000 00000000 00000000
+r 3140.10
+*Want "mul overflow ext off AXR" 7F100000 00000000 71000000 00000000
+r 3150.10
+*Want "mul overflow ext off SXR" 7F100000 00000000 71000000 00000000
+r 3160.10
+*Want "mul overflow ext off MXR" 00100000 00000000 72000000 00000000
+r 3170.10
+*Want "mul overflow ext off DXR" 7E100000 00000000 70000000 00000000
+r 3180.10
+*Want "mul overflow ext off codes" 00000000 00000000 0002000C 00000000
+r 3190.10
+*Want "div underflow ext off AXR" 42100000 00000000 34000000 00000000
+r 31A0.10
+*Want "div underflow ext off SXR" C2100000 00000000 B4000000 00000000
+r 31B0.10
+*Want "div underflow ext off MXR" 01100000 00000000 73000000 00000000
+r 31C0.10
+*Want "div underflow ext off DXR" 00000000 00000000 00000000 00000000
+r 31D0.10
+*Want "div underflow ext off codes" 00000000 00000000 00000000 00000000
+r 31E0.10
+*Want "zero sum ext off AXR" 00000000 00000000 00000000 00000000
+r 31F0.10
+*Want "zero sum ext off SXR" 42100000 00000000 34000000 00000000
+r 3200.10
+*Want "zero sum ext off MXR" C2400000 00000000 B4000000 00000000
+r 3210.10
+*Want "zero sum ext off DXR" C1100000 00000000 B3000000 00000000
+r 3220.10
+*Want "zero sum ext off codes" 00000000 00000000 00000000 00000000
+r 3230.10
+*Want "divide by zero ext off AXR" 41100000 00000000 33000000 00000000
+r 3240.10
+*Want "divide by zero ext off SXR" 41100000 00000000 33000000 00000000
+r 3250.10
+*Want "divide by zero ext off MXR" 00000000 00000000 00000000 00000000
+r 3260.10
+*Want "divide by zero ext off DXR" 41100000 00000000 33000000 00000000
+r 3270.10
+*Want "divide by zero ext off codes" 00000000 00000000 00000000 0004000F
+r 3280.10
+*Want "mul below 00 ext off AXR" 3F100000 00000000 31000000 00000000
+r 3290.10
+*Want "mul below 00 ext off SXR" BF100000 00000000 B1000000 00000000
+r 32A0.10
+*Want "mul below 00 ext off MXR" 00000000 00000000 00000000 00000000
+r 32B0.10
+*Want "mul below 00 ext off DXR" 03800000 00000000 75000000 00000000
+r 32C0.10
+*Want "mul below 00 ext off codes" 00000000 00000000 00000000 00000000
+r 32D0.10
+*Want "mul at 00 ext off AXR" 3F800000 00000000 31000000 00000000
+r 32E0.10
+*Want "mul at 00 ext off SXR" BF800000 00000000 B1000000 00000000
+r 32F0.10
+*Want "mul at 00 ext off MXR" 00400000 00000000 72000000 00000000
+r 3300.10
+*Want "mul at 00 ext off DXR" 03100000 00000000 75000000 00000000
+r 3310.10
+*Want "mul at 00 ext off codes" 00000000 00000000 00000000 00000000
+r 3320.10
+*Want "low digits ext off AXR" C1FF7FFF FFFFFFFF B3FFFFFF FFFFFFF0
+r 3330.10
+*Want "low digits ext off SXR" 421007FF FFFFFFFF 34FFFFFF FFFFFFFF
+r 3340.10
+*Want "low digits ext off MXR" C0800000 00000000 B2000000 000000F7
+r 3350.10
+*Want "low digits ext off DXR" BE800000 00000000 B0000000 00000106
+r 3360.10
+*Want "low digits ext off codes" 00000000 00000000 00000000 00000000
+r 3370.10
+*Want "div overflow ext off AXR" 7F100000 00000000 71000000 00000000
+r 3380.10
+*Want "div overflow ext off SXR" 7F100000 00000000 71000000 00000000
+r 3390.10
+*Want "div overflow ext off MXR" 7D800000 00000000 6F000000 00000000
+r 33A0.10
+*Want "div overflow ext off DXR" 00200000 00000000 72000000 00000000
+r 33B0.10
+*Want "div overflow ext off codes" 00000000 00000000 00000000 0004000C
+r 33C0.10
+*Want "random 1 ext off AXR" C0100000 00000000 B2000000 00000000
+r 33D0.10
+*Want "random 1 ext off SXR" 40100000 00000000 32000000 00000000
+r 33E0.10
+*Want "random 1 ext off MXR" 00000000 00000000 00000000 00000000
+r 33F0.10
+*Want "random 1 ext off DXR" 00000000 00000000 00000000 00000000
+r 3400.10
+*Want "random 1 ext off codes" 00000000 00000000 00000000 00000000
+r 3410.10
+*Want "random 2 ext off AXR" F61A9AD0 802F29CA E856C78B 00000000
+r 3420.10
+*Want "random 2 ext off SXR" 761A9AD0 802F29CA 6856C78B 00000000
+r 3430.10
+*Want "random 2 ext off MXR" B71A9AD0 802F29CA A956C78A FFFFFFFF
+r 3440.10
+*Want "random 2 ext off DXR" 00000000 00000000 00000000 00000000
+r 3450.10
+*Want "random 2 ext off codes" 00000000 00000000 00000000 00000000
+r 3460.10
+*Want "random 3 ext off AXR" 798FC0D5 0316CBED 6B8C7196 A9800000
+r 3470.10
+*Want "random 3 ext off SXR" F98FC0D5 0316CBED EB8C7196 A9800000
+r 3480.10
+*Want "random 3 ext off MXR" 7870040A 324325CE 6AAF8358 B892E5E6
+r 3490.10
+*Want "random 3 ext off DXR" 071633DD 840AE5BF 79A5A4CB EA8D40FC
+r 34A0.10
+*Want "random 3 ext off codes" 00000000 00000000 00000000 00000000
+r 34B0.10
+*Want "random 4 ext off AXR" FF100000 00000000 F1000687 F99692EF
+r 34C0.10
+*Want "random 4 ext off SXR" 7EFFFFFF FFFFFFFF 70FF9780 6696D110
+r 34D0.10
+*Want "random 4 ext off MXR" 2C687F99 692EF000 1E000000 00000000
+r 34E0.10
+*Want "random 4 ext off DXR" 30687F99 692EF000 22000000 00000000
+r 34F0.10
+*Want "random 4 ext off codes" 00000000 00000000 0002000C 00000000
+r 6000.10
+*Want "guard digit long on AD SD" 411FFFFF FFFFFFFF 33100000 00000000
+r 6010.10
+*Want "guard digit long on MD DD" 40FFFFFF FFFFFFFF 41100000 00000000
+r 6020.10
+*Want "guard digit long on codes" 00000000 00000000 00000000 00000000
+r 6030.10
+*Want "beyond guard long on AD SD" 4110FFFF FFFFFFFF 40F00000 00000001
+r 6040.10
+*Want "beyond guard long on MD DD" 3FFFFFFF FFFFFFFF 42100000 00000000
+r 6050.10
+*Want "beyond guard long on codes" 00000000 00000000 00000000 00000000
+r 6060.10
+*Want "cancel long on AD SD" 34110000 00000000 41200000 00000000
+r 6070.10
+*Want "cancel long on MD DD" C1100000 00000000 C1100000 00000001
+r 6080.10
+*Want "cancel long on codes" 00000000 00000000 00000000 00000000
+r 6090.10
+*Want "sub underflow long on AD SD" 01110000 00000000 00F00000 00000000
+r 60A0.10
+*Want "sub underflow long on MD DD" 40100000 00000000 42100000 00000000
+r 60B0.10
+*Want "sub underflow long on codes" 00000000 00000000 0004000D 00000000
+r 60C0.10
+*Want "mul underflow long on AD SD" 41100000 00000000 C1100000 00000000
+r 60D0.10
+*Want "mul underflow long on MD DD" 01100000 00000000 01100000 00000000
+r 60E0.10
+*Want "mul underflow long on codes" 00000000 00000000 00000000 00000000
+r 60F0.10
+*Want "max long on AD SD" 001FFFFF FFFFFFFF 7F000000 00000000
+r 6100.10
+*Want "max long on MD DD" 3EFFFFFF FFFFFFFE 41100000 00000000
+r 6110.10
+*Want "max long on codes" 0004000C 0004000E 0004000C 00000000
+r 6120.10
+*Want "mul at 7F long on AD SD" 7F100000 00000000 7F100000 00000000
+r 6130.10
+*Want "mul at 7F long on MD DD" 7F100000 00000000 7F100000 00000000
+r 6140.10
+*Want "mul at 7F long on codes" 00000000 00000000 00000000 00000000
+r 6150.10
+*Want "mul overflow long on AD SD" 7F100000 00000000 7F100000 00000000
+r 6160.10
+*Want "mul overflow long on MD DD" 00100000 00000000 7E100000 00000000
+r 6170.10
+*Want "mul overflow long on codes" 00000000 00000000 0004000C 00000000
+r 6180.10
+*Want "div underflow long on AD SD" 42100000 00000000 C2100000 00000000
+r 6190.10
+*Want "div underflow long on MD DD" 01100000 00000000 7F100000 00000000
+r 61A0.10
+*Want "div underflow long on codes" 00000000 00000000 00000000 0004000D
+r 61B0.10
+*Want "unnormalized long on AD SD" 34110000 00000000 33F00000 00000000
+r 61C0.10
+*Want "unnormalized long on MD DD" 26100000 00000000 42100000 00000000
+r 61D0.10
+*Want "unnormalized long on codes" 00000000 00000000 00000000 00000000
+r 61E0.10
+*Want "zero sum long on AD SD" 40000000 00000000 41100000 00000000
+r 61F0.10
+*Want "zero sum long on MD DD" C0400000 00000000 C1100000 00000000
+r 6200.10
+*Want "zero sum long on codes" 0004000E 00000000 00000000 00000000
+r 6210.10
+*Want "zero operand long on AD SD" 41100000 00000000 C1100000 00000000
+r 6220.10
+*Want "zero operand long on MD DD" 00000000 00000000 00000000 00000000
+r 6230.10
+*Want "zero operand long on codes" 00000000 00000000 00000000 00000000
+r 6240.10
+*Want "divide by zero long on AD SD" 41100000 00000000 41100000 00000000
+r 6250.10
+*Want "divide by zero long on MD DD" 00000000 00000000 41100000 00000000
+r 6260.10
+*Want "divide by zero long on codes" 00000000 00000000 00000000 0004000F
+r 6270.10
+*Want "close large long on AD SD" 501FFFFF FFFFFFFE 42F00000 00000000
+r 6280.10
+*Want "close large long on MD DD" 5EFFFFFF FFFFFFEF 41100000 00000000
+r 6290.10
+*Want "close large long on codes" 00000000 00000000 00000000 00000000
+r 62A0.10
+*Want "mul at 00 long on AD SD" 3F800000 00000000 BF800000 00000000
+r 62B0.10
+*Want "mul at 00 long on MD DD" 00400000 00000000 03100000 00000000
+r 62C0.10
+*Want "mul at 00 long on codes" 00000000 00000000 00000000 00000000
+r 62D0.10
+*Want "mul below 00 long on AD SD" 3F100000 00000000 BF100000 00000000
+r 62E0.10
+*Want "mul below 00 long on MD DD" 7F800000 00000000 03800000 00000000
+r 62F0.10
+*Want "mul below 00 long on codes" 00000000 00000000 0004000D 00000000
+r 6300.10
+*Want "div overflow long on AD SD" 7F100000 00000000 7F100000 00000000
+r 6310.10
+*Want "div overflow long on MD DD" 7D800000 00000000 00200000 00000000
+r 6320.10
+*Want "div overflow long on codes" 00000000 00000000 00000000 0004000C
+r 6330.10
+*Want "div at 7F long on AD SD" 7F100000 00000000 7F100000 00000000
+r 6340.10
+*Want "div at 7F long on MD DD" 7E800000 00000000 7F200000 00000000
+r 6350.10
+*Want "div at 7F long on codes" 00000000 00000000 00000000 00000000
+r 6360.10
+*Want "low digits long on AD SD" C1FF7FFF FFFFFFF0 421007FF FFFFFFFF
+r 6370.10
+*Want "low digits long on MD DD" C0800000 000000F7 BE800000 00000106
+r 6380.10
+*Want "low digits long on codes" 00000000 00000000 00000000 00000000
+r 6390.10
+*Want "div fract equal long on AD SD" 42B68ACD F13579BD C2A11110 11111110
+r 63A0.10
+*Want "div fract equal long on MD DD" 43734CC2 F42C1454 40100000 00000000
+r 63B0.10
+*Want "div fract equal long on codes" 00000000 00000000 00000000 00000000
+r 63C0.10
+*Want "random 1 long on AD SD" FE100000 00000000 FE100000 00000000
+r 63D0.10
+*Want "random 1 long on MD DD" 3AB15BA8 A9FC0000 41171832 E2A279A4
+r 63E0.10
+*Want "random 1 long on codes" 00000000 00000000 00000000 0004000C
+r 63F0.10
+*Want "random 2 long on AD SD" FD985D85 B2779000 7D985D85 B2779000
+r 6400.10
+*Want "random 2 long on MD DD" F968EF72 3AE32339 801283AF 2AB189EF
+r 6410.10
+*Want "random 2 long on codes" 00000000 00000000 00000000 00000000
+r 6420.10
+*Want "random 3 long on AD SD" 4210FFFF FFFFFFFF C1EFFFFF FFFFFFFF
+r 6430.10
+*Want "random 3 long on MD DD" 41FFFFFF FFFFFFFF 40100000 00000000
+r 6440.10
+*Want "random 3 long on codes" 00000000 00000000 00000000 00000000
+r 6450.10
+*Want "random 4 long on AD SD" 7D251E04 C4869E80 7D251E04 C4859680
+r 6460.10
+*Want "random 4 long on MD DD" 3013237A 755525AA 4A47FC28 46D588BA
+r 6470.10
+*Want "random 4 long on codes" 00000000 00000000 0004000C 00000000
+r 6480.10
+*Want "random 5 long on AD SD" 40FFFFFF FFFFFFFF C0FFFFFF FFFFFFFF
+r 6490.10
+*Want "random 5 long on MD DD" F6DFE9FF FFFFFFFF F6DFEA00 00000000
+r 64A0.10
+*Want "random 5 long on codes" 00000000 00000000 0004000D 0004000D
+r 64B0.10
+*Want "random 6 long on AD SD" FE100000 00000000 7E100000 00000000
+r 64C0.10
+*Want "random 6 long on MD DD" 3E100000 00000000 44100000 00000000
+r 64D0.10
+*Want "random 6 long on codes" 00000000 00000000 00000000 0004000D
+r 64E0.10
+*Want "random 7 long on AD SD" FEFFFFFF FFFFFFFF FEFFFFFF FFFFFFFF
+r 64F0.10
+*Want "random 7 long on MD DD" FDB8348A 311CA8B7 80163C6E EA9C8482
+r 6500.10
+*Want "random 7 long on codes" 00000000 00000000 00000000 0004000C
+r 6510.10
+*Want "random 8 long on AD SD" 7DDEE75B 4E8887D0 7DDEE75B 4E8887D0
+r 6520.10
+*Want "random 8 long on MD DD" FE84A6DD 8AF182D5 FD1768F6 19AAC601
+r 6530.10
+*Want "random 8 long on codes" 00000000 00000000 00000000 00000000
+r 6540.10
+*Want "random 9 long on AD SD" 7A1555BD 63590000 FA1555BD 63590000
+r 6550.10
+*Want "random 9 long on MD DD" 791555BD 63590000 06BFFC57 93B6770E
+r 6560.10
+*Want "random 9 long on codes" 00000000 00000000 00000000 00000000
+r 6570.10
+*Want "random 10 long on AD SD" 40000000 00000000 40200000 00000000
+r 6580.10
+*Want "random 10 long on MD DD" BF100000 00000000 C1100000 00000000
+r 6590.10
+*Want "random 10 long on codes" 0004000E 00000000 00000000 00000000
+r 65A0.10
+*Want "random 11 long on AD SD" 827C2028 AC551786 027C2028 AC56199A
+r 65B0.10
+*Want "random 11 long on MD DD" BA3E910D C06DDD38 B710A223 4860E98B
+r 65C0.10
+*Want "random 11 long on codes" 00000000 00000000 0004000D 00000000
+r 65D0.10
+*Want "random 12 long on AD SD" B4700000 00000000 B4700000 00000000
+r 65E0.10
+*Want "random 12 long on MD DD" F43800D5 DD99A790 F4DFFCA8 965C3A44
+r 65F0.10
+*Want "random 12 long on codes" 00000000 00000000 0004000D 00000000
+r 6800.10
+*Want "guard digit short on" 411FFFFF 3B100000 40FFFFFF 41100000
+r 6810.10
+*Want "guard digit short on codes" 00000000 00000000 00000000 00000000
+r 6820.10
+*Want "beyond guard short on" 4110FFFF 40F00001 3FFFFFFF 42100000
+r 6830.10
+*Want "beyond guard short on codes" 00000000 00000000 00000000 00000000
+r 6840.10
+*Want "cancel short on" 3B100000 411FFFFF C0FFFFFF C1100000
+r 6850.10
+*Want "cancel short on codes" 00000000 00000000 00000000 00000000
+r 6860.10
+*Want "sub underflow short on" 01110000 00F00000 40100000 42100000
+r 6870.10
+*Want "sub underflow short on codes" 00000000 00000000 0006000D 00000000
+r 6880.10
+*Want "mul underflow short on" 41100000 C1100000 01100000 01100000
+r 6890.10
+*Want "mul underflow short on codes" 00000000 00000000 00000000 00000000
+r 68A0.10
+*Want "max short on" 001FFFFF 7F000000 3EFFFFFE 41100000
+r 68B0.10
+*Want "max short on codes" 0004000C 0004000E 0006000C 00000000
+r 68C0.10
+*Want "mul at 7F short on" 7F100000 7F100000 7F100000 7F100000
+r 68D0.10
+*Want "mul at 7F short on codes" 00000000 00000000 00000000 00000000
+r 68E0.10
+*Want "mul overflow short on" 7F100000 7F100000 00100000 7E100000
+r 68F0.10
+*Want "mul overflow short on codes" 00000000 00000000 0006000C 00000000
+r 6900.10
+*Want "div underflow short on" 42100000 C2100000 01100000 7F100000
+r 6910.10
+*Want "div underflow short on codes" 00000000 00000000 00000000 0004000D
+r 6920.10
+*Want "unnormalized short on" 41000000 41000000 00000000 41000000
+r 6930.10
+*Want "unnormalized short on codes" 0004000E 0004000E 00000000 0004000F
+r 6940.10
+*Want "zero sum short on" 40000000 41100000 C0400000 C1100000
+r 6950.10
+*Want "zero sum short on codes" 0004000E 00000000 00000000 00000000
+r 6960.10
+*Want "zero operand short on" 41100000 C1100000 00000000 00000000
+r 6970.10
+*Want "zero operand short on codes" 00000000 00000000 00000000 00000000
+r 6980.10
+*Want "divide by zero short on" 41100000 41100000 00000000 41100000
+r 6990.10
+*Want "divide by zero short on codes" 00000000 00000000 00000000 0004000F
+r 69A0.10
+*Want "close large short on" 501FFFFF 4F000000 5EFFFFFE 41100000
+r 69B0.10
+*Want "close large short on codes" 00000000 0004000E 00000000 00000000
+r 69C0.10
+*Want "mul at 00 short on" 3F800000 BF800000 00400000 03100000
+r 69D0.10
+*Want "mul at 00 short on codes" 00000000 00000000 00000000 00000000
+r 69E0.10
+*Want "mul below 00 short on" 3F100000 BF100000 7F800000 03800000
+r 69F0.10
+*Want "mul below 00 short on codes" 00000000 00000000 0006000D 00000000
+r 6A00.10
+*Want "div overflow short on" 7F100000 7F100000 7D800000 00200000
+r 6A10.10
+*Want "div overflow short on codes" 00000000 00000000 00000000 0004000C
+r 6A20.10
+*Want "div at 7F short on" 7F100000 7F100000 7E800000 7F200000
+r 6A30.10
+*Want "div at 7F short on codes" 00000000 00000000 00000000 00000000
+r 6A40.10
+*Want "low digits short on" C1FF7FFF 421007FF C07FFFFF BE800000
+r 6A50.10
+*Want "low digits short on codes" 00000000 00000000 00000000 00000000
+r 6A60.10
+*Want "div fract equal short on" 42B68ACD C2A11110 43734CC2 40100000
+r 6A70.10
+*Want "div fract equal short on codes" 00000000 00000000 00000000 00000000
+r 6A80.10
+*Want "random 1 short on" FE100000 FE100000 3AB10000 41172428
+r 6A90.10
+*Want "random 1 short on codes" 00000000 00000000 00000000 0004000C
+r 6AA0.10
+*Want "random 2 short on" FD985D00 7D985D00 F968E607 80128226
+r 6AB0.10
+*Want "random 2 short on codes" 00000000 00000000 00000000 00000000
+r 6AC0.10
+*Want "random 3 short on" 4210FFFF C1EFFFFF 41FFFFFF 40100000
+r 6AD0.10
+*Want "random 3 short on codes" 00000000 00000000 00000000 00000000
+r 6AE0.10
+*Want "random 4 short on" 7D251E00 7D251E00 00000000 7E0251E0
+r 6AF0.10
+*Want "random 4 short on codes" 00000000 00000000 00000000 0004000F
+r 6B00.10
+*Want "random 5 short on" 40FFFFFF C0FFFFFF 00000000 00000000
+r 6B10.10
+*Want "random 5 short on codes" 00000000 00000000 00000000 00000000
+r 6B20.10
+*Want "random 6 short on" FE100000 7E100000 3E100000 44100000
+r 6B30.10
+*Want "random 6 short on codes" 00000000 00000000 00000000 0004000D
+r 6B40.10
+*Want "random 7 short on" FEFFFFFF FEFFFFFF FDB83489 80163C6E
+r 6B50.10
+*Want "random 7 short on codes" 00000000 00000000 00000000 0004000C
+r 6B60.10
+*Want "random 8 short on" 7DDEE750 7DDEE750 FE84A6D6 FD1768F4
+r 6B70.10
+*Want "random 8 short on codes" 00000000 00000000 00000000 00000000
+r 6B80.10
+*Want "random 9 short on" 7A150000 FA150000 79150000 06C30C30
+r 6B90.10
+*Want "random 9 short on codes" 00000000 00000000 00000000 00000000
+r 6BA0.10
+*Want "random 10 short on" 40000000 40200000 BF100000 C1100000
+r 6BB0.10
+*Want "random 10 short on codes" 0004000E 00000000 00000000 00000000
+r 6BC0.10
+*Want "random 11 short on" 827C2028 027C2028 00000000 00000000
+r 6BD0.10
+*Want "random 11 short on codes" 00000000 00000000 00000000 00000000
+r 6BE0.10
+*Want "random 12 short on" 41000000 41000000 00000000 00000000
+r 6BF0.10
+*Want "random 12 short on codes" 0004000E 0004000E 00000000 00000000
+r 7000.10
+*Want "guard digit ext on AXR" 411FFFFF FFFFFFFF 33FFFFFF FFFFFFFF
+r 7010.10
+*Want "guard digit ext on SXR" 25100000 00000000 17000000 00000000
+r 7020.10
+*Want "guard digit ext on MXR" 40FFFFFF FFFFFFFF 32FFFFFF FFFFFFFF
+r 7030.10
+*Want "guard digit ext on DXR" 41100000 00000000 33000000 00000000
+r 7040.10
+*Want "guard digit ext on codes" 00000000 00000000 00000000 00000000
+r 7050.10
+*Want "max ext on AXR" 001FFFFF FFFFFFFF 72FFFFFF FFFFFFFF
+r 7060.10
+*Want "max ext on SXR" 7F000000 00000000 71000000 00000000
+r 7070.10
+*Want "max ext on MXR" 3EFFFFFF FFFFFFFF 30FFFFFF FFFFFFFE
+r 7080.10
+*Want "max ext on DXR" 41100000 00000000 33000000 00000000
+r 7090.10
+*Want "max ext on codes" 0002000C 0002000E 0002000C 00000000
+r 70A0.10
+*Want "mul underflow ext on AXR" 41100000 00000000 33000000 00000000
+r 70B0.10
+*Want "mul underflow ext on SXR" C1100000 00000000 B3000000 00000000
+r 70C0.10
+*Want "mul underflow ext on MXR" 01100000 00000000 73000000 00000000
+r 70D0.10
+*Want "mul underflow ext on DXR" 01100000 00000000 73000000 00000000
+r 70E0.10
+*Want "mul underflow ext on codes" 00000000 00000000 00000000 00000000
+r 70F0.10
+*Want "mul at 7F ext on AXR" 7F100000 00000000 71000000 00000000
+r 7100.10
+*Want "mul at 7F ext on SXR" 7F100000 00000000 71000000 00000000
+r 7110.10
+*Want "mul at 7F ext on MXR" 7F100000 00000000 71000000 00000000
+r 7120.10
+*Want "mul at 7F ext on DXR" 7F100000 00000000 71000000 00000000
+r 7130.10
+*Want "mul at 7F ext on codes" 00000000 00000000 00000000 00000000
+r 7140.10
+*Want "mul overflow ext on AXR" 7F100000 00000000 71000000 00000000
+r 7150.10
+*Want "mul overflow ext on SXR" 7F100000 00000000 71000000 00000000
+r 7160.10
+*Want "mul overflow ext on MXR" 00100000 00000000 72000000 00000000
+r 7170.10
+*Want "mul overflow ext on DXR" 7E100000 00000000 70000000 00000000
+r 7180.10
+*Want "mul overflow ext on codes" 00000000 00000000 0002000C 00000000
+r 7190.10
+*Want "div underflow ext on AXR" 42100000 00000000 34000000 00000000
+r 71A0.10
+*Want "div underflow ext on SXR" C2100000 00000000 B4000000 00000000
+r 71B0.10
+*Want "div underflow ext on MXR" 01100000 00000000 73000000 00000000
+r 71C0.10
+*Want "div underflow ext on DXR" 7F100000 00000000 71000000 00000000
+r 71D0.10
+*Want "div underflow ext on codes" 00000000 00000000 00000000 0004000D
+r 71E0.10
+*Want "zero sum ext on AXR" 41000000 00000000 33000000 00000000
+r 71F0.10
+*Want "zero sum ext on SXR" 42100000 00000000 34000000 00000000
+r 7200.10
+*Want "zero sum ext on MXR" C2400000 00000000 B4000000 00000000
+r 7210.10
+*Want "zero sum ext on DXR" C1100000 00000000 B3000000 00000000
+r 7220.10
+*Want "zero sum ext on codes" 0002000E 00000000 00000000 00000000
+r 7230.10
+*Want "divide by zero ext on AXR" 41100000 00000000 33000000 00000000
+r 7240.10
+*Want "divide by zero ext on SXR" 41100000 00000000 33000000 00000000
+r 7250.10
+*Want "divide by zero ext on MXR" 00000000 00000000 00000000 00000000
+r 7260.10
+*Want "divide by zero ext on DXR" 41100000 00000000 33000000 00000000
+r 7270.10
+*Want "divide by zero ext on codes" 00000000 00000000 00000000 0004000F
+r 7280.10
+*Want "mul below 00 ext on AXR" 3F100000 00000000 31000000 00000000
+r 7290.10
+*Want "mul below 00 ext on SXR" BF100000 00000000 B1000000 00000000
+r 72A0.10
+*Want "mul below 00 ext on MXR" 7F800000 00000000 71000000 00000000
+r 72B0.10
+*Want "mul below 00 ext on DXR" 03800000 00000000 75000000 00000000
+r 72C0.10
+*Want "mul below 00 ext on codes" 00000000 00000000 0002000D 00000000
+r 72D0.10
+*Want "mul at 00 ext on AXR" 3F800000 00000000 31000000 00000000
+r 72E0.10
+*Want "mul at 00 ext on SXR" BF800000 00000000 B1000000 00000000
+r 72F0.10
+*Want "mul at 00 ext on MXR" 00400000 00000000 72000000 00000000
+r 7300.10
+*Want "mul at 00 ext on DXR" 03100000 00000000 75000000 00000000
+r 7310.10
+*Want "mul at 00 ext on codes" 00000000 00000000 00000000 00000000
+r 7320.10
+*Want "low digits ext on AXR" C1FF7FFF FFFFFFFF B3FFFFFF FFFFFFF0
+r 7330.10
+*Want "low digits ext on SXR" 421007FF FFFFFFFF 34FFFFFF FFFFFFFF
+r 7340.10
+*Want "low digits ext on MXR" C0800000 00000000 B2000000 000000F7
+r 7350.10
+*Want "low digits ext on DXR" BE800000 00000000 B0000000 00000106
+r 7360.10
+*Want "low digits ext on codes" 00000000 00000000 00000000 00000000
+r 7370.10
+*Want "div overflow ext on AXR" 7F100000 00000000 71000000 00000000
+r 7380.10
+*Want "div overflow ext on SXR" 7F100000 00000000 71000000 00000000
+r 7390.10
+*Want "div overflow ext on MXR" 7D800000 00000000 6F000000 00000000
+r 73A0.10
+*Want "div overflow ext on DXR" 00200000 00000000 72000000 00000000
+r 73B0.10
+*Want "div overflow ext on codes" 00000000 00000000 00000000 0004000C
+r 73C0.10
+*Want "random 1 ext on AXR" C0100000 00000000 B2000000 00000000
+r 73D0.10
+*Want "random 1 ext on SXR" 40100000 00000000 32000000 00000000
+r 73E0.10
+*Want "random 1 ext on MXR" 7C45A071 1005AEF3 6EFD7D22 737D0000
+r 73F0.10
+*Want "random 1 ext on DXR" 7E45A071 1005AEF3 70FD7D22 737D0000
+r 7400.10
+*Want "random 1 ext on codes" 00000000 00000000 0002000D 0004000D
+r 7410.10
+*Want "random 2 ext on AXR" F61A9AD0 802F29CA E856C78B 00000000
+r 7420.10
+*Want "random 2 ext on SXR" 761A9AD0 802F29CA 6856C78B 00000000
+r 7430.10
+*Want "random 2 ext on MXR" B71A9AD0 802F29CA A956C78A FFFFFFFF
+r 7440.10
+*Want "random 2 ext on DXR" CC99F51F 0A986CB9 BE3644C1 645C9BD7
+r 7450.10
+*Want "random 2 ext on codes" 00000000 00000000 00000000 0004000D
+r 7460.10
+*Want "random 3 ext on AXR" 798FC0D5 0316CBED 6B8C7196 A9800000
+r 7470.10
+*Want "random 3 ext on SXR" F98FC0D5 0316CBED EB8C7196 A9800000
+r 7480.10
+*Want "random 3 ext on MXR" 7870040A 324325CE 6AAF8358 B892E5E6
+r 7490.10
+*Want "random 3 ext on DXR" 071633DD 840AE5BF 79A5A4CB EA8D40FC
+r 74A0.10
+*Want "random 3 ext on codes" 00000000 00000000 00000000 00000000
+r 74B0.10
+*Want "random 4 ext on AXR" FF100000 00000000 F1000687 F99692EF
+r 74C0.10
+*Want "random 4 ext on SXR" 7EFFFFFF FFFFFFFF 70FF9780 6696D110
+r 74D0.10
+*Want "random 4 ext on MXR" 2C687F99 692EF000 1E000000 00000000
+r 74E0.10
+*Want "random 4 ext on DXR" 30687F99 692EF000 22000000 00000000
+r 74F0.10
+*Want "random 4 ext on codes" 00000000 00000000 0002000C 00000000
+
+*Done
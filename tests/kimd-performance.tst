@@ -0,0 +1,93 @@
+*Testcase kimd-performance (KIMD and KLMD hashing throughput)
+
+# ------------------------------------------------------------------------------
+#  This ONLY tests the performance of the KIMD and KLMD instructions.
+#
+#  Each function code hashes the same 64K buffer the number of times
+#  given by the fullword at X'400' (default 1024, i.e. 64M per function
+#  code). Increase it for more stable numbers on a fast host.
+#
+#  Tests:
+#
+#        1. KIMD-SHA-1
+#        2. KIMD-SHA-256
+#        3. KIMD-SHA-512
+#        4. KIMD-GHASH
+#        5. KLMD-SHA-1
+#        6. KLMD-SHA-256
+#        7. KLMD-SHA-512
+#
+#     Output:
+#
+#        For each test, the "actual duration" of the runtest is shown,
+#        for example:
+#
+#        HHC02338I Script 1: test: actual duration: 0.095372 seconds
+# ------------------------------------------------------------------------------
+
+sysclear
+archlvl z/Arch
+msglevel +verbose
+
+r 1a0=00000001800000000000000000000200  # z/Arch restart PSW
+r 1d0=0002000180000000000000000000DEAD  # z/Arch pgm new PSW
+
+r 200=41000001                          # LA    R0,fc          (set below)
+r 204=41100500                          # LA    R1,X'500'      parameter block
+r 208=58900400                          # L     R9,X'400'      iterations
+r 20C=C02100010000                      # LGFI  R2,X'10000'    second operand
+r 212=C03100010000                      # LGFI  R3,X'10000'    length
+r 218=B93E0002                          # KIMD  R0,R2          (or KLMD)
+r 21C=A714FFFE                          # BRC   1,*-4
+r 220=A796FFF6                          # BRCT  R9,*-20
+r 224=B2B20300                          # LPSWE WAITPSW
+r 300=00020001800000000000000000000000  # WAITPSW
+
+r 400=00000400                          # iterations
+
+# KIMD-SHA-1
+r 200=41000001
+runtest 60
+gpr
+*Gpr 3 0
+
+# KIMD-SHA-256
+r 200=41000002
+runtest 60
+gpr
+*Gpr 3 0
+
+# KIMD-SHA-512
+r 200=41000003
+runtest 60
+gpr
+*Gpr 3 0
+
+# KIMD-GHASH
+r 200=41000041
+runtest 60
+gpr
+*Gpr 3 0
+
+# KLMD-SHA-1
+r 200=41000001
+r 218=B93F0002
+runtest 60
+gpr
+*Gpr 3 0
+
+# KLMD-SHA-256
+r 200=41000002
+runtest 60
+gpr
+*Gpr 3 0
+
+# KLMD-SHA-512
+r 200=41000003
+runtest 60
+gpr
+*Gpr 3 0
+
+msglevel -verbose
+
+*Done
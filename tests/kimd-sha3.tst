@@ -0,0 +1,124 @@
+*Testcase kimd-sha3: KIMD/KLMD SHA-3 and SHAKE
+
+* SHA3-256 and SHAKE-128 of "abc", SHAKE-256 of the empty message,
+* SHA3-224 of 200 bytes (one whole block and a padded one) and SHA3-384
+* and SHA3-512 of 0x5010 bytes starting 8 bytes before a page boundary,
+* which takes cc 3. The SHAKE-128 output also crosses a page boundary and
+* needs several squeezes. The data is the bytes 00-FF repeated.
+
+sysclear
+archlvl z/Arch
+
+r 1a0=00000001800000000000000000000200  # z/Arch restart PSW
+r 1d0=0002000180000000000000000000DEAD  # z/Arch pgm new PSW
+
+r 200=41000000                          # LA    R0,0           KIMD-Query
+r 204=41100400                          # LA    R1,X'400'      parameter block
+r 208=41200F00                          # LA    R2,X'F00'
+r 20C=B93E0002                          # KIMD  R0,R2
+r 210=41000021                          # LA    R0,33          KLMD-SHA3-256
+r 214=41100500                          # LA    R1,X'500'      parameter block
+r 218=41200F00                          # LA    R2,X'F00'      second operand
+r 21C=41300003                          # LA    R3,3           length
+r 220=B93F0002                          # KLMD  R0,R2
+r 224=C07100010000                      # LGFI  R7,X'10000'    data pattern
+r 22A=A7880060                          # LHI   R8,96          pages of 256
+r 22E=D2FF71007000                      # MVC   256(256,R7),0(R7)
+r 234=41770100                          # LA    R7,256(R7)
+r 238=A786FFFB                          # BRCT  R8,*-10
+r 23C=41000020                          # LA    R0,32          KLMD-SHA3-224
+r 240=41100600                          # LA    R1,X'600'      parameter block
+r 244=C02100010000                      # LGFI  R2,X'10000'    second operand
+r 24A=413000C8                          # LA    R3,200         length
+r 24E=B93F0002                          # KLMD  R0,R2
+r 252=41000023                          # LA    R0,35          KLMD-SHA3-512
+r 256=41100700                          # LA    R1,X'700'      parameter block
+r 25A=C02100010FF8                      # LGFI  R2,X'10FF8'    second operand
+r 260=C03100005010                      # LGFI  R3,X'5010'     length
+r 266=B93F0002                          # KLMD  R0,R2
+r 26A=A714FFFE                          # BRC   1,*-4
+r 26E=41000022                          # LA    R0,34          KLMD-SHA3-384
+r 272=41100800                          # LA    R1,X'800'      parameter block
+r 276=C02100010FF8                      # LGFI  R2,X'10FF8'    second operand
+r 27C=C03100005010                      # LGFI  R3,X'5010'     length
+r 282=B93F0002                          # KLMD  R0,R2
+r 286=A714FFFE                          # BRC   1,*-4
+r 28A=41000024                          # LA    R0,36          KLMD-SHAKE-128
+r 28E=41100900                          # LA    R1,X'900'      parameter block
+r 292=41200F00                          # LA    R2,X'F00'      second operand
+r 296=41300003                          # LA    R3,3           length
+r 29A=C04100020F80                      # LGFI  R4,X'20F80'    first operand
+r 2A0=41500200                          # LA    R5,X'200'      output length
+r 2A4=B93F0042                          # KLMD  R4,R2
+r 2A8=41000025                          # LA    R0,37          KLMD-SHAKE-256
+r 2AC=41100A00                          # LA    R1,X'A00'      parameter block
+r 2B0=41300000                          # LA    R3,0           length
+r 2B4=C04100022000                      # LGFI  R4,X'22000'    first operand
+r 2BA=41500020                          # LA    R5,32          output length
+r 2BE=B93F0042                          # KLMD  R4,R2
+r 2C2=B2B20300                          # LPSWE WAITPSW
+r 300=00020001800000000000000000000000  # WAITPSW
+
+r F00=616263                            # "abc" in ASCII
+
+r 10000=000102030405060708090A0B0C0D0E0F  # data pattern
+r 10010=101112131415161718191A1B1C1D1E1F
+r 10020=202122232425262728292A2B2C2D2E2F
+r 10030=303132333435363738393A3B3C3D3E3F
+r 10040=404142434445464748494A4B4C4D4E4F
+r 10050=505152535455565758595A5B5C5D5E5F
+r 10060=606162636465666768696A6B6C6D6E6F
+r 10070=707172737475767778797A7B7C7D7E7F
+r 10080=808182838485868788898A8B8C8D8E8F
+r 10090=909192939495969798999A9B9C9D9E9F
+r 100A0=A0A1A2A3A4A5A6A7A8A9AAABACADAEAF
+r 100B0=B0B1B2B3B4B5B6B7B8B9BABBBCBDBEBF
+r 100C0=C0C1C2C3C4C5C6C7C8C9CACBCCCDCECF
+r 100D0=D0D1D2D3D4D5D6D7D8D9DADBDCDDDEDF
+r 100E0=E0E1E2E3E4E5E6E7E8E9EAEBECEDEEEF
+r 100F0=F0F1F2F3F4F5F6F7F8F9FAFBFCFDFEFF
+
+runtest .1
+
+gpr
+*Gpr 2 F03
+*Gpr 3 0
+*Gpr 4 22020
+*Gpr 5 0
+
+r 400.10
+*Want "KIMD query"                  F0000000 FC000000 40000000 00000000
+r 500.10
+*Want "SHA3-256"                    3A985DA7 4FE225B2 045C172D 6BD390BD
+r 510.10
+*Want "SHA3-256"                    855F086E 3E9D525B 46BFE245 11431532
+r 600.10
+*Want "SHA3-224"                    8BCD90DB C5379549 B5E78A1F BE24AE12
+r 610.C
+*Want "SHA3-224"                    0D92CAEF 17750461 262B1E97
+r 700.10
+*Want "SHA3-512"                    71553139 BF7D8DC5 43EF1F69 12C83CA9
+r 710.10
+*Want "SHA3-512"                    B0C1D17E AB8A92FA F6BDCE59 908BA27E
+r 720.10
+*Want "SHA3-512"                    B99F1529 440F9A33 ABA47D1E 6BE7B407
+r 730.10
+*Want "SHA3-512"                    2C919903 BFFE80A7 E57CF268 C9561E9A
+r 800.10
+*Want "SHA3-384"                    2630CB6A 1E710EF4 0B21501A 45C0F45A
+r 810.10
+*Want "SHA3-384"                    389951B4 9BFA2181 6DE2690F 89AFCFD1
+r 820.10
+*Want "SHA3-384"                    0B2BCD1B B7663C85 E2BA94BD 5F1D36CA
+r 20F80.10
+*Want "SHAKE-128"                   5881092D D818BF5C F8A3DDB7 93FBCBA7
+r 21020.10
+*Want "SHAKE-128 second squeeze"    CC29082F 5647584E 6AA01B3F 5AF05780
+r 21170.10
+*Want "SHAKE-128 last"              5211A56B F13F0BF7 241268B5 0D3F1EC8
+r 22000.10
+*Want "SHAKE-256"                   46B9DD2B 0BA88D13 233B3FEB 743EEB24
+r 22010.10
+*Want "SHAKE-256"                   3FCD52EA 62B81B82 B50C2764 6ED5762F
+
+*Done
@@ -0,0 +1,101 @@
+*Testcase kimd-xpage: KLMD SHA-1/256/512 and KIMD GHASH across page boundaries
+
+* The second operand starts 8 bytes before a page boundary so that every
+* page contains a block that straddles two pages, and the length exceeds
+* the CPU-determined amount so that cc 3 is taken at least once. The data
+* is the bytes 00-FF repeated.
+
+sysclear
+archlvl z/Arch
+
+r 1a0=00000001800000000000000000000200  # z/Arch restart PSW
+r 1d0=0002000180000000000000000000DEAD  # z/Arch pgm new PSW
+
+r 200=C07100010000                      # LGFI  R7,X'10000'    data pattern
+r 206=A7880060                          # LHI   R8,96          pages of 256
+r 20A=D2FF71007000                      # MVC   256(256,R7),0(R7)
+r 210=41770100                          # LA    R7,256(R7)
+r 214=A786FFFB                          # BRCT  R8,*-10
+r 218=41000001                          # LA    R0,1           KLMD-SHA-1
+r 21C=41100500                          # LA    R1,X'500'      parameter block
+r 220=C02100010FF8                      # LGFI  R2,X'10FF8'    second operand
+r 226=C03100005010                      # LGFI  R3,X'5010'     length
+r 22C=B93F0002                          # KLMD  R0,R2
+r 230=A714FFFE                          # BRC   1,*-4
+r 234=41000002                          # LA    R0,2           KLMD-SHA-256
+r 238=41100600                          # LA    R1,X'600'      parameter block
+r 23C=C02100010FF8                      # LGFI  R2,X'10FF8'    second operand
+r 242=C03100005010                      # LGFI  R3,X'5010'     length
+r 248=B93F0002                          # KLMD  R0,R2
+r 24C=A714FFFE                          # BRC   1,*-4
+r 250=41000003                          # LA    R0,3           KLMD-SHA-512
+r 254=41100700                          # LA    R1,X'700'      parameter block
+r 258=C02100010FF8                      # LGFI  R2,X'10FF8'    second operand
+r 25E=C03100005010                      # LGFI  R3,X'5010'     length
+r 264=B93F0002                          # KLMD  R0,R2
+r 268=A714FFFE                          # BRC   1,*-4
+r 26C=41000041                          # LA    R0,65          KIMD-GHASH
+r 270=41100800                          # LA    R1,X'800'      parameter block
+r 274=C02100010FF8                      # LGFI  R2,X'10FF8'    second operand
+r 27A=C03100005010                      # LGFI  R3,X'5010'     length
+r 280=B93E0002                          # KIMD  R0,R2
+r 284=A714FFFE                          # BRC   1,*-4
+r 288=B2B20300                          # LPSWE WAITPSW
+r 300=00020001800000000000000000000000  # WAITPSW
+
+r 10000=000102030405060708090A0B0C0D0E0F  # data pattern
+r 10010=101112131415161718191A1B1C1D1E1F
+r 10020=202122232425262728292A2B2C2D2E2F
+r 10030=303132333435363738393A3B3C3D3E3F
+r 10040=404142434445464748494A4B4C4D4E4F
+r 10050=505152535455565758595A5B5C5D5E5F
+r 10060=606162636465666768696A6B6C6D6E6F
+r 10070=707172737475767778797A7B7C7D7E7F
+r 10080=808182838485868788898A8B8C8D8E8F
+r 10090=909192939495969798999A9B9C9D9E9F
+r 100A0=A0A1A2A3A4A5A6A7A8A9AAABACADAEAF
+r 100B0=B0B1B2B3B4B5B6B7B8B9BABBBCBDBEBF
+r 100C0=C0C1C2C3C4C5C6C7C8C9CACBCCCDCECF
+r 100D0=D0D1D2D3D4D5D6D7D8D9DADBDCDDDEDF
+r 100E0=E0E1E2E3E4E5E6E7E8E9EAEBECEDEEEF
+r 100F0=F0F1F2F3F4F5F6F7F8F9FAFBFCFDFEFF
+
+r 500=67452301EFCDAB8998BADCFE10325476  # SHA-1 ICV
+r 510=C3D2E1F00000000000028080          # SHA-1 ICV, MBL
+r 600=6A09E667BB67AE853C6EF372A54FF53A  # SHA-256 ICV
+r 610=510E527F9B05688C1F83D9AB5BE0CD19  # SHA-256 ICV
+r 620=0000000000028080                  # SHA-256 MBL
+r 700=6A09E667F3BCC908BB67AE8584CAA73B  # SHA-512 ICV
+r 710=3C6EF372FE94F82BA54FF53A5F1D36F1  # SHA-512 ICV
+r 720=510E527FADE682D19B05688C2B3E6C1F  # SHA-512 ICV
+r 730=1F83D9ABFB41BD6B5BE0CD19137E2179  # SHA-512 ICV
+r 740=00000000000000000000000000028080  # SHA-512 MBL
+r 800=000102030405060708090A0B0C0D0E0F  # GHASH ICV
+r 810=66E94BD4EF8A2C3B884CFA59CA342B2E  # GHASH H
+
+runtest .1
+
+gpr
+*Gpr 2 16008
+*Gpr 3 0
+
+r 500.10
+*Want "SHA-1"                       1C771D12 BC59FFB0 1E2F434D B9282B68
+r 510.4
+*Want "SHA-1"                       1C865065
+r 600.10
+*Want "SHA-256"                     16C1ABA1 E9C2A196 CBF54DB9 9E747BB6
+r 610.10
+*Want "SHA-256"                     601B427C 5B1D2A87 A612D161 D80AF9C8
+r 700.10
+*Want "SHA-512"                     E5FE2077 E4372E08 EF9EFD27 32423CDD
+r 710.10
+*Want "SHA-512"                     8296AE36 677B0D88 C3E36B2F EB351279
+r 720.10
+*Want "SHA-512"                     C571114B A5009A36 5341BF8F D67F2F2A
+r 730.10
+*Want "SHA-512"                     3508DA35 45F069DA 8399C97A C5AA279D
+r 800.10
+*Want "GHASH"                       4064658B 2A7DEFC4 E90DFF07 BEBA8B4B
+
+*Done
@@ -0,0 +1,87 @@
+*Testcase klmd-shake-long: KLMD-SHAKE output of more than one execution
+
+* KLMD-SHAKE stores a CPU-determined amount of output per execution.
+* When the output is not complete it ends with cc3, the squeeze in
+* progress bit (X'100') set in GR0 and the parameter block holding the
+* state for the next output block, so that executing it again continues
+* the output instead of absorbing a new message. The bit is reset when
+* the output is complete.
+* SHAKE-128 of "abc" with X'5000' bytes of output first stops after
+* X'3FA8' bytes (97 blocks of 168). SHAKE-256 of the empty message with
+* X'9C40' bytes of output needs three executions.
+
+mainsize    1
+sysclear
+archlvl     z/Arch
+
+r 1a0=00000001800000000000000000000200  # z/Arch restart PSW
+r 1d0=0002000180000000000000000000DEAD  # z/Arch pgm new PSW
+
+r 200=41000024                          # LA    R0,36          KLMD-SHAKE-128
+r 204=41100900                          # LA    R1,X'900'      parameter block
+r 208=41200F00                          # LA    R2,X'F00'      second operand
+r 20C=41300003                          # LA    R3,3           length
+r 210=C04100010000                      # LGFI  R4,X'10000'    first operand
+r 216=C05100005000                      # LGFI  R5,X'5000'     output length
+r 21C=B93F0042                          # KLMD  R4,R2
+r 220=B2220080                          # IPM   R8
+r 224=EB050A000024                      # STMG  R0,R5,X'A00'   after first
+r 22A=50800A30                          # ST    R8,X'A30'
+r 22E=B93F0042                          # KLMD  R4,R2
+r 232=A714FFFE                          # BRC   1,*-4
+r 236=EB050A400024                      # STMG  R0,R5,X'A40'   at end
+r 23C=B2220080                          # IPM   R8
+r 240=50800A70                          # ST    R8,X'A70'
+r 244=41000025                          # LA    R0,37          KLMD-SHAKE-256
+r 248=41100B00                          # LA    R1,X'B00'      parameter block
+r 24C=41300000                          # LA    R3,0           empty message
+r 250=C04100020000                      # LGFI  R4,X'20000'    first operand
+r 256=C05100009C40                      # LGFI  R5,X'9C40'     output length
+r 25C=B93F0042                          # KLMD  R4,R2
+r 260=A714FFFE                          # BRC   1,*-4
+r 264=B2220080                          # IPM   R8
+r 268=50800A74                          # ST    R8,X'A74'
+r 26C=EB050A800024                      # STMG  R0,R5,X'A80'   at end
+r 272=B2B20300                          # LPSWE WAITPSW
+
+r 300=00020001800000000000000000000000  # WAITPSW
+
+r F00=616263                            # "abc" in ASCII
+
+runtest .1
+
+r A00.10
+*Want "128: R0 and R1 after first"  00000000 00000124 00000000 00000900
+r A10.10
+*Want "128: R2 and R3 after first"  00000000 00000F03 00000000 00000000
+r A20.10
+*Want "128: R4 and R5 after first"  00000000 00013FA8 00000000 00001058
+r A30.4
+*Want "128: cc3 after first"        30000000
+r A40.10
+*Want "128: R0 and R1 at end"       00000000 00000024 00000000 00000900
+r A50.10
+*Want "128: R2 and R3 at end"       00000000 00000F03 00000000 00000000
+r A60.10
+*Want "128: R4 and R5 at end"       00000000 00015000 00000000 00000000
+r A70.4
+*Want "128: cc0 at end"             00000000
+r 10000.10
+*Want "128: first output"           5881092D D818BF5C F8A3DDB7 93FBCBA7
+r 13FA8.8
+*Want "128: second execution"       A6402BD9 F7418F68
+r 14FF0.10
+*Want "128: last output"            4BF94ABA 6709EEA0 5BFCBFEF B1937E5A
+
+r A74.4
+*Want "256: cc0 at end"             00000000
+r A80.10
+*Want "256: R0 and R1 at end"       00000000 00000025 00000000 00000B00
+r A90.10
+*Want "256: R2 and R3 at end"       00000000 00000F03 00000000 00000000
+r AA0.10
+*Want "256: R4 and R5 at end"       00000000 00029C40 00000000 00000000
+r 29C30.10
+*Want "256: last output"            D987AFB9 1637806A E190BADE 8922055F
+
+*Done
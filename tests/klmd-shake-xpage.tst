@@ -0,0 +1,66 @@
+*Testcase klmd-shake-xpage: KLMD-SHAKE output crossing into a bad page
+
+* SHAKE-128 of "abc" with 0x200 bytes of output starting at X'FFF00' in
+* a 1M machine. The second squeezed block crosses into X'100000', which
+* is not installed. The addressing exception must leave the registers,
+* the parameter block and the first operand untouched, so that the
+* instruction can be executed again. It is then re-executed with 0x100
+* bytes of output, which fits, and must produce the same output as if
+* it had never been interrupted.
+
+mainsize    1
+sysclear
+archlvl     z/Arch
+
+r 1a0=00000001800000000000000000000200  # z/Arch restart PSW
+r 1d0=00000001800000000000000000000400  # z/Arch pgm new PSW
+
+r 200=41000024                          # LA    R0,36          KLMD-SHAKE-128
+r 204=41100900                          # LA    R1,X'900'      parameter block
+r 208=41200F00                          # LA    R2,X'F00'      second operand
+r 20C=41300003                          # LA    R3,3           length
+r 210=C041000FFF00                      # LGFI  R4,X'FFF00'    first operand
+r 216=41500200                          # LA    R5,X'200'      output length
+r 21A=B93F0042                          # KLMD  R4,R2
+r 21E=B2B20310                          # LPSWE FAILPSW
+
+r 300=00020001800000000000000000000000  # WAITPSW
+r 310=0002000180000000000000000000DEAD  # FAILPSW
+
+r 400=EB250A000024                      # STMG  R2,R5,X'A00'   after pgm check
+r 406=D20F0A200900                      # MVC   X'A20'(16),X'900'
+r 40C=C061000FFF00                      # LGFI  R6,X'FFF00'
+r 412=D20F0A306000                      # MVC   X'A30'(16),0(R6)
+r 418=41200F00                          # LA    R2,X'F00'      second operand
+r 41C=41300003                          # LA    R3,3           length
+r 420=C041000FFF00                      # LGFI  R4,X'FFF00'    first operand
+r 426=41500100                          # LA    R5,X'100'      output length
+r 42A=B93F0042                          # KLMD  R4,R2
+r 42E=B2B20300                          # LPSWE WAITPSW
+
+r F00=616263                            # "abc" in ASCII
+
+runtest .1
+
+gpr
+*Gpr 2 F03
+*Gpr 3 0
+*Gpr 4 100000
+*Gpr 5 0
+
+r 8E.2
+*Want "Addressing exception"        0005
+r A00.10
+*Want "R2 and R3 unchanged"         00000000 00000F00 00000000 00000003
+r A10.10
+*Want "R4 and R5 unchanged"         00000000 000FFF00 00000000 00000200
+r A20.10
+*Want "Parameter block unchanged"   00000000 00000000 00000000 00000000
+r A30.10
+*Want "First operand unchanged"     00000000 00000000 00000000 00000000
+r FFF00.10
+*Want "SHAKE-128 first"             5881092D D818BF5C F8A3DDB7 93FBCBA7
+r FFFF0.10
+*Want "SHAKE-128 last"              23D6DBB8 04E23357 E50732F5 CFC904B1
+
+*Done
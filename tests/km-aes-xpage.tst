@@ -0,0 +1,112 @@
+*Testcase km-aes-xpage: KMC, KM-XTS and KMCTR AES across page boundaries
+
+* Each operand starts 8 bytes before a page boundary so that every
+* page contains a block that straddles two pages, and the length
+* exceeds the CPU-determined amount so that cc 3 is taken once.
+
+sysclear
+archlvl z/Arch
+
+r 1a0=00000001800000000000000000000200  # z/Arch restart PSW
+r 1d0=0002000180000000000000000000DEAD  # z/Arch pgm new PSW
+
+r 200=41000012                          # LA    R0,18          KMC-AES-128 encrypt
+r 204=41100500                          # LA    R1,X'500'      parameter block
+r 208=C02100020FF8                      # LGFI  R2,X'20FF8'    first operand
+r 20E=C04100010FF8                      # LGFI  R4,X'10FF8'    second operand (zeros)
+r 214=C05100004010                      # LGFI  R5,X'4010'     length
+r 21A=B92F0024                          # KMC   R2,R4
+r 21E=A714FFFE                          # BRC   1,*-4
+r 222=41000092                          # LA    R0,X'92'       KMC-AES-128 decrypt
+r 226=41100600                          # LA    R1,X'600'      parameter block
+r 22A=C02100030FF8                      # LGFI  R2,X'30FF8'    first operand
+r 230=C04100020FF8                      # LGFI  R4,X'20FF8'    second operand (KMC output)
+r 236=C05100004010                      # LGFI  R5,X'4010'     length
+r 23C=B92F0024                          # KMC   R2,R4
+r 240=A714FFFE                          # BRC   1,*-4
+r 244=41000032                          # LA    R0,50          KM-XTS-AES-128 encrypt
+r 248=41100700                          # LA    R1,X'700'      parameter block
+r 24C=C02100040FF8                      # LGFI  R2,X'40FF8'    first operand
+r 252=C04100030FF8                      # LGFI  R4,X'30FF8'    second operand (KMC decrypted)
+r 258=C05100004010                      # LGFI  R5,X'4010'     length
+r 25E=B92E0024                          # KM    R2,R4
+r 262=A714FFFE                          # BRC   1,*-4
+r 266=41000012                          # LA    R0,18          KMCTR-AES-128
+r 26A=41100800                          # LA    R1,X'800'      parameter block
+r 26E=C02100050FF8                      # LGFI  R2,X'50FF8'    first operand
+r 274=C04100030FF8                      # LGFI  R4,X'30FF8'    second operand (KMC decrypted)
+r 27A=C06100020FF8                      # LGFI  R6,X'20FF8'    third operand (KMC output)
+r 280=C05100004010                      # LGFI  R5,X'4010'     length
+r 286=B92D6024                          # KMCTR R2,R6,R4
+r 28A=A714FFFE                          # BRC   1,*-4
+r 28E=B2B20300                          # LPSWE WAITPSW
+r 300=00020001800000000000000000000000  # WAITPSW
+
+r 500=000102030405060708090A0B0C0D0E0F  # KMC ICV
+r 510=2B7E151628AED2A6ABF7158809CF4F3C  # KMC key
+r 600=000102030405060708090A0B0C0D0E0F  # KMC ICV
+r 610=2B7E151628AED2A6ABF7158809CF4F3C  # KMC key
+r 700=2B7E151628AED2A6ABF7158809CF4F3C  # XTS key
+r 710=F0F1F2F3F4F5F6F7F8F9FAFBFCFDFEFF  # XTS parameter
+r 800=2B7E151628AED2A6ABF7158809CF4F3C  # KMCTR key
+
+runtest .1
+
+gpr
+*Gpr 2 55008
+*Gpr 4 35008
+*Gpr 5 0
+*Gpr 6 25008
+
+r 500.10
+*Want "KMC OCV"                     32045864 5FD8AA3C 5963F635 191E4422
+r 20FF8.8
+*Want "KMC first block"             50FE67CC 996D32B6
+r 21000.8
+*Want "KMC first block"             DA0937E9 9BAFEC60
+r 21FF8.8
+*Want "KMC block crossing page"     8C4EFFE5 E2688ED8
+r 22000.8
+*Want "KMC block crossing page"     40481A25 60B57360
+r 24FF8.8
+*Want "KMC last block"              32045864 5FD8AA3C
+r 25000.8
+*Want "KMC last block"              5963F635 191E4422
+r 31FF8.8
+*Want "KMC decrypt crossing page"   00000000 00000000
+r 32000.8
+*Want "KMC decrypt crossing page"   00000000 00000000
+r 34FF8.8
+*Want "KMC decrypt last block"      00000000 00000000
+r 35000.8
+*Want "KMC decrypt last block"      00000000 00000000
+r 600.10
+*Want "KMC decrypt OCV"             32045864 5FD8AA3C 5963F635 191E4422
+r 710.10
+*Want "XTS parameter"               30C821F7 F4E9EEF3 10081018 10181008
+r 40FF8.8
+*Want "XTS first block"             1C7D2D80 6C958A47
+r 41000.8
+*Want "XTS first block"             0A2BEC8E 16635F1B
+r 42FF8.8
+*Want "XTS block crossing page"     E8D70D65 A9F00967
+r 43000.8
+*Want "XTS block crossing page"     06FBB2B2 463488EC
+r 44FF8.8
+*Want "XTS last block"              50344D63 9DF628CF
+r 45000.8
+*Want "XTS last block"              CA137A7A 6674B003
+r 50FF8.8
+*Want "KMCTR first block"           D9A4DADA 0892239F
+r 51000.8
+*Want "KMCTR first block"           6B8B3D76 80E15674
+r 53FF8.8
+*Want "KMCTR block crossing page"   E444481D 5F1A0FCB
+r 54000.8
+*Want "KMCTR block crossing page"   B5BEDC96 8717A01A
+r 54FF8.8
+*Want "KMCTR last block"            9C033D48 F69BDE4B
+r 55000.8
+*Want "KMCTR last block"            401123A0 1C2FA2FE
+
+*Done
@@ -0,0 +1,157 @@
+*Testcase kma-gcm: KMA GCM-AES encrypt and decrypt
+
+* The first pair is test case 4 of the GCM specification: a 20-byte AAD
+* and a 60-byte message with a partial last block, hash subkey computed
+* by the instruction. The second pair uses AES-256 with operands that
+* start in the middle of a page so that blocks straddle pages, and with
+* a message longer than the CPU-determined amount so that cc 3 is taken.
+
+sysclear
+archlvl z/Arch
+
+r 1a0=00000001800000000000000000000200  # z/Arch restart PSW
+r 1d0=0002000180000000000000000000DEAD  # z/Arch pgm new PSW
+
+r 200=41000612                          # LA    R0,X'612'      KMA-GCM-AES-128 LPC LAAD encrypt
+r 204=41100500                          # LA    R1,X'500'      parameter block
+r 208=C02100001000                      # LGFI  R2,X'1000'     first operand
+r 20E=C04100001100                      # LGFI  R4,X'1100'     second operand
+r 214=C0510000003C                      # LGFI  R5,X'3C'       length
+r 21A=C06100001200                      # LGFI  R6,X'1200'     third operand (AAD)
+r 220=C07100000014                      # LGFI  R7,X'14'       AAD length
+r 226=B9296024                          # KMA   R2,R6,R4       
+r 22A=A714FFFE                          # BRC   1,*-4          
+r 22E=41000692                          # LA    R0,X'692'      KMA-GCM-AES-128 LPC LAAD decrypt
+r 232=41100600                          # LA    R1,X'600'      parameter block
+r 236=C02100001300                      # LGFI  R2,X'1300'     first operand
+r 23C=C04100001000                      # LGFI  R4,X'1000'     second operand (ciphertext)
+r 242=C0510000003C                      # LGFI  R5,X'3C'       length
+r 248=C06100001200                      # LGFI  R6,X'1200'     third operand (AAD)
+r 24E=C07100000014                      # LGFI  R7,X'14'       AAD length
+r 254=B9296024                          # KMA   R2,R6,R4       
+r 258=A714FFFE                          # BRC   1,*-4          
+r 25C=C07100010000                      # LGFI  R7,X'10000'    data pattern
+r 262=A7880070                          # LHI   R8,112         pages of 256
+r 266=D2FF71007000                      # MVC   256(256,R7),0(R7)
+r 26C=41770100                          # LA    R7,256(R7)     
+r 270=A786FFFB                          # BRCT  R8,*-10        
+r 274=41000614                          # LA    R0,X'614'      KMA-GCM-AES-256 LPC LAAD encrypt
+r 278=41100700                          # LA    R1,X'700'      parameter block
+r 27C=C02100020FF8                      # LGFI  R2,X'20FF8'    first operand
+r 282=C04100010FF8                      # LGFI  R4,X'10FF8'    second operand
+r 288=C05100005009                      # LGFI  R5,X'5009'     length
+r 28E=C06100011FF0                      # LGFI  R6,X'11FF0'    third operand (AAD)
+r 294=C07100000025                      # LGFI  R7,X'25'       AAD length
+r 29A=B9296024                          # KMA   R2,R6,R4       
+r 29E=A714FFFE                          # BRC   1,*-4          
+r 2A2=41000694                          # LA    R0,X'694'      KMA-GCM-AES-256 LPC LAAD decrypt
+r 2A6=41100800                          # LA    R1,X'800'      parameter block
+r 2AA=C02100030FF8                      # LGFI  R2,X'30FF8'    first operand
+r 2B0=C04100020FF8                      # LGFI  R4,X'20FF8'    second operand (ciphertext)
+r 2B6=C05100005009                      # LGFI  R5,X'5009'     length
+r 2BC=C06100011FF0                      # LGFI  R6,X'11FF0'    third operand (AAD)
+r 2C2=C07100000025                      # LGFI  R7,X'25'       AAD length
+r 2C8=B9296024                          # KMA   R2,R6,R4       
+r 2CC=A714FFFE                          # BRC   1,*-4          
+r 2D0=B2B20300                          # LPSWE WAITPSW        
+r 300=00020001800000000000000000000000  # WAITPSW
+
+r 500=00000000000000000000000000000001  # GCM CV
+r 530=00000000000000A000000000000001E0  # GCM TAADL, TPCL
+r 540=CAFEBABEFACEDBADDECAF88800000001  # GCM J0
+r 550=FEFFE9928665731C6D6A8F9467308308  # GCM key
+r 600=00000000000000000000000000000001  # GCM CV
+r 630=00000000000000A000000000000001E0  # GCM TAADL, TPCL
+r 640=CAFEBABEFACEDBADDECAF88800000001  # GCM J0
+r 650=FEFFE9928665731C6D6A8F9467308308  # GCM key
+r 700=00000000000000000000000000000001  # GCM CV
+r 730=00000000000001280000000000028048  # GCM TAADL, TPCL
+r 740=000102030405060708090A0B00000001  # GCM J0
+r 750=603DEB1015CA71BE2B73AEF0857D7781  # GCM key
+r 760=1F352C073B6108D72D9810A30914DFF4  # GCM key
+r 800=00000000000000000000000000000001  # GCM CV
+r 830=00000000000001280000000000028048  # GCM TAADL, TPCL
+r 840=000102030405060708090A0B00000001  # GCM J0
+r 850=603DEB1015CA71BE2B73AEF0857D7781  # GCM key
+r 860=1F352C073B6108D72D9810A30914DFF4  # GCM key
+
+r 1100=D9313225F88406E5A55909C5AFF5269A # plaintext
+r 1110=86A7A9531534F7DA2E4C303D8A318A72
+r 1120=1C3C0C95956809532FCF0E2449A6B525
+r 1130=B16AEDF5AA0DE657BA637B39
+r 1200=FEEDFACEDEADBEEFFEEDFACEDEADBEEF # AAD
+r 1210=ABADDAD2
+
+r 10000=000102030405060708090A0B0C0D0E0F  # data pattern
+r 10010=101112131415161718191A1B1C1D1E1F
+r 10020=202122232425262728292A2B2C2D2E2F
+r 10030=303132333435363738393A3B3C3D3E3F
+r 10040=404142434445464748494A4B4C4D4E4F
+r 10050=505152535455565758595A5B5C5D5E5F
+r 10060=606162636465666768696A6B6C6D6E6F
+r 10070=707172737475767778797A7B7C7D7E7F
+r 10080=808182838485868788898A8B8C8D8E8F
+r 10090=909192939495969798999A9B9C9D9E9F
+r 100A0=A0A1A2A3A4A5A6A7A8A9AAABACADAEAF
+r 100B0=B0B1B2B3B4B5B6B7B8B9BABBBCBDBEBF
+r 100C0=C0C1C2C3C4C5C6C7C8C9CACBCCCDCECF
+r 100D0=D0D1D2D3D4D5D6D7D8D9DADBDCDDDEDF
+r 100E0=E0E1E2E3E4E5E6E7E8E9EAEBECEDEEEF
+r 100F0=F0F1F2F3F4F5F6F7F8F9FAFBFCFDFEFF
+
+runtest .1
+
+gpr
+*Gpr 2 36001
+*Gpr 4 26001
+*Gpr 5 0
+*Gpr 6 12015
+*Gpr 7 0
+
+r 1000.10
+*Want "GCM ciphertext"              42831EC2 21777424 4B7221B7 84D0D49C
+r 1030.10
+*Want "GCM ciphertext last block"   1BA30B39 6A0AAC97 3D58E091 00000000
+r 50C.4
+*Want "GCM CV"                      00000005
+r 510.10
+*Want "GCM tag"                     5BC94FBC 3221A5DB 94FAE95A E7121A47
+r 520.10
+*Want "GCM hash subkey"             B83B5337 08BF535D 0AA6E529 80D53B78
+r 1300.10
+*Want "GCM decrypt"                 D9313225 F88406E5 A55909C5 AFF5269A
+r 1330.10
+*Want "GCM decrypt last block"      B16AEDF5 AA0DE657 BA637B39 00000000
+r 610.10
+*Want "GCM decrypt tag"             5BC94FBC 3221A5DB 94FAE95A E7121A47
+
+r 20FF8.8
+*Want "GCM-256 first block"         F0984BA8 78B96581
+r 21000.8
+*Want "GCM-256 first block"         A6A140AA 893B9FEC
+r 21FF8.8
+*Want "GCM-256 block crossing page" 0010F1D1 2553AE34
+r 22000.8
+*Want "GCM-256 block crossing page" DC04A0C7 190C61B9
+r 25FF8.8
+*Want "GCM-256 last block"          696250AB 9EDCA0E3
+r 26000.8
+*Want "GCM-256 last block"          AE000000 00000000
+r 70C.4
+*Want "GCM-256 CV"                  00000502
+r 710.10
+*Want "GCM-256 tag"                 88785E41 2EFCD216 7ED4AB1A A3A2FBA0
+r 720.10
+*Want "GCM-256 hash subkey"         E568F681 94CF76D6 174D4CC0 4310A854
+r 31FF8.8
+*Want "GCM-256 decrypt crossing"    F8F9FAFB FCFDFEFF
+r 32000.8
+*Want "GCM-256 decrypt crossing"    00010203 04050607
+r 35FF8.8
+*Want "GCM-256 decrypt last block"  F8F9FAFB FCFDFEFF
+r 36000.8
+*Want "GCM-256 decrypt last block"  00000000 00000000
+r 810.10
+*Want "GCM-256 decrypt tag"         88785E41 2EFCD216 7ED4AB1A A3A2FBA0
+
+*Done
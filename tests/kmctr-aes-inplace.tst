@@ -0,0 +1,73 @@
+*Testcase kmctr-aes-inplace: KMCTR-AES with the first and second operands equal
+
+* KMCTR-AES-128 of the NIST SP 800-38A F.5.1 plaintext, first in place
+* (R1 equal to R2) and then to a separate first operand. Both must give
+* the F.5.1 ciphertext, which needs a new counter block from the third
+* operand for every block, and must advance the third operand address.
+
+sysclear
+archlvl z/Arch
+
+r 1a0=00000001800000000000000000000200  # z/Arch restart PSW
+r 1d0=0002000180000000000000000000DEAD  # z/Arch pgm new PSW
+
+r 200=41000012                          # LA    R0,18          KMCTR-AES-128
+r 204=41100800                          # LA    R1,X'800'      parameter block
+r 208=C02100001000                      # LGFI  R2,X'1000'     first and second operand
+r 20E=41300040                          # LA    R3,64          length
+r 212=C06100002000                      # LGFI  R6,X'2000'     third operand
+r 218=B92D6022                          # KMCTR R2,R6,R2
+r 21C=A714FFFE                          # BRC   1,*-4
+r 220=C08100003000                      # LGFI  R8,X'3000'     first operand
+r 226=C04100001100                      # LGFI  R4,X'1100'     second operand
+r 22C=41500040                          # LA    R5,64          length
+r 230=C0A100002000                      # LGFI  R10,X'2000'    third operand
+r 236=B92DA084                          # KMCTR R8,R10,R4
+r 23A=A714FFFE                          # BRC   1,*-4
+r 23E=B2B20300                          # LPSWE WAITPSW
+r 300=00020001800000000000000000000000  # WAITPSW
+
+r 800=2B7E151628AED2A6ABF7158809CF4F3C  # key
+r 1000=6BC1BEE22E409F96E93D7E117393172A # plaintext
+r 1010=AE2D8A571E03AC9C9EB76FAC45AF8E51
+r 1020=30C81C46A35CE411E5FBC1191A0A52EF
+r 1030=F69F2445DF4F9B17AD2B417BE66C3710
+r 1100=6BC1BEE22E409F96E93D7E117393172A # plaintext
+r 1110=AE2D8A571E03AC9C9EB76FAC45AF8E51
+r 1120=30C81C46A35CE411E5FBC1191A0A52EF
+r 1130=F69F2445DF4F9B17AD2B417BE66C3710
+r 2000=F0F1F2F3F4F5F6F7F8F9FAFBFCFDFEFF # counter blocks
+r 2010=F0F1F2F3F4F5F6F7F8F9FAFBFCFDFF00
+r 2020=F0F1F2F3F4F5F6F7F8F9FAFBFCFDFF01
+r 2030=F0F1F2F3F4F5F6F7F8F9FAFBFCFDFF02
+
+runtest .1
+
+*Compare
+r 1000.10
+*Want "in place 1" 874D6191 B620E326 1BEF6864 990DB6CE
+r 1010.10
+*Want "in place 2" 9806F66B 7970FDFF 8617187B B9FFFDFF
+r 1020.10
+*Want "in place 3" 5AE4DF3E DBD5D35E 5B4F0902 0DB03EAB
+r 1030.10
+*Want "in place 4" 1E031DDA 2FBE03D1 792170A0 F3009CEE
+r 3000.10
+*Want "separate 1" 874D6191 B620E326 1BEF6864 990DB6CE
+r 3010.10
+*Want "separate 2" 9806F66B 7970FDFF 8617187B B9FFFDFF
+r 3020.10
+*Want "separate 3" 5AE4DF3E DBD5D35E 5B4F0902 0DB03EAB
+r 3030.10
+*Want "separate 4" 1E031DDA 2FBE03D1 792170A0 F3009CEE
+
+gpr
+*Gpr 2 1040
+*Gpr 3 0
+*Gpr 6 2040
+*Gpr 4 1140
+*Gpr 5 0
+*Gpr 10 2040
+*Gpr 8 3040
+
+*Done
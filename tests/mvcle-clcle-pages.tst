@@ -0,0 +1,113 @@
+*Testcase mvcle-clcle-pages: MVCLE and CLCLE over more than 16 pages
+
+* MVCLE and CLCLE process at most 16 pages (X'10000' bytes) per
+* execution. MVCLE first pads X'18000' bytes with X'FF', which must
+* stop with cc3 after X'10000' bytes and complete with cc2 on the next
+* execution. It then moves X'14000' bytes from a X'18000' byte operand,
+* which must stop with cc3 after X'10000' bytes and complete with cc1.
+* Finally CLCLE compares two equal operands of exactly X'10000' bytes,
+* which must complete in one execution with cc0 rather than cc3.
+
+mainsize    4
+sysclear
+archlvl     z/Arch
+
+r 1a0=00000001800000000000000000000200  # z/Arch restart PSW
+r 1d0=0002000180000000000000000000DEAD  # z/Arch pgm new PSW
+
+r 200=C02100100000                      # LGFI  R2,X'100000'
+r 206=C03100018000                      # LGFI  R3,X'18000'
+r 20C=41400000                          # LA    R4,0
+r 210=41500000                          # LA    R5,0
+r 214=A82400FF                          # MVCLE R2,R4,X'FF'   pad only
+r 218=41700000                          # LA    R7,0
+r 21C=B2220070                          # IPM   R7
+r 220=507008F0                          # ST    R7,X'8F0'       cc after first
+r 224=EB2508000024                      # STMG  R2,R5,X'800'   regs after first
+r 22A=A82400FF                          # MVCLE R2,R4,X'FF'
+r 22E=A714FFFE                          # BRC   1,*-4
+r 232=41700000                          # LA    R7,0
+r 236=B2220070                          # IPM   R7
+r 23A=507008F4                          # ST    R7,X'8F4'       cc at end
+r 23E=EB2508200024                      # STMG  R2,R5,X'820'   regs at end
+r 244=C02100100000                      # LGFI  R2,X'100000'
+r 24A=C03100014000                      # LGFI  R3,X'14000'
+r 250=C04100200000                      # LGFI  R4,X'200000'
+r 256=C05100018000                      # LGFI  R5,X'18000'
+r 25C=A8240040                          # MVCLE R2,R4,X'40'   move
+r 260=41700000                          # LA    R7,0
+r 264=B2220070                          # IPM   R7
+r 268=507008F8                          # ST    R7,X'8F8'       cc after first
+r 26C=EB2508400024                      # STMG  R2,R5,X'840'   regs after first
+r 272=A8240040                          # MVCLE R2,R4,X'40'
+r 276=A714FFFE                          # BRC   1,*-4
+r 27A=41700000                          # LA    R7,0
+r 27E=B2220070                          # IPM   R7
+r 282=507008FC                          # ST    R7,X'8FC'       cc at end
+r 286=EB2508600024                      # STMG  R2,R5,X'860'   regs at end
+r 28C=C02100100000                      # LGFI  R2,X'100000'
+r 292=C03100010000                      # LGFI  R3,X'10000'
+r 298=C04100200000                      # LGFI  R4,X'200000'
+r 29E=C05100010000                      # LGFI  R5,X'10000'
+r 2A4=A9240000                          # CLCLE R2,R4,0       exactly 16 pages
+r 2A8=41700000                          # LA    R7,0
+r 2AC=B2220070                          # IPM   R7
+r 2B0=507008E0                          # ST    R7,X'8E0'       cc CLCLE
+r 2B4=EB2508800024                      # STMG  R2,R5,X'880'   regs CLCLE
+r 2BA=B2B20300                          # LPSWE WAITPSW
+
+r 300=00020001800000000000000000000000  # WAITPSW
+
+r 200000=11                             # first source byte
+r 213FFF=22                             # last source byte moved
+r 214000=33                             # first source byte not moved
+
+runtest .1
+
+r 800.10
+*Want "Pad: R2 and R3 after first"      00000000 00110000 00000000 00008000
+r 810.10
+*Want "Pad: R4 and R5 after first"      00000000 00000000 00000000 00000000
+r 8F0.4
+*Want "Pad: cc3 after first"            30000000
+r 820.10
+*Want "Pad: R2 and R3 at end"           00000000 00118000 00000000 00000000
+r 830.10
+*Want "Pad: R4 and R5 at end"           00000000 00000000 00000000 00000000
+r 8F4.4
+*Want "Pad: cc2 at end"                 20000000
+
+r 840.10
+*Want "Move: R2 and R3 after first"     00000000 00110000 00000000 00004000
+r 850.10
+*Want "Move: R4 and R5 after first"     00000000 00210000 00000000 00008000
+r 8F8.4
+*Want "Move: cc3 after first"           30000000
+r 860.10
+*Want "Move: R2 and R3 at end"          00000000 00114000 00000000 00000000
+r 870.10
+*Want "Move: R4 and R5 at end"          00000000 00214000 00000000 00004000
+r 8FC.4
+*Want "Move: cc1 at end"                10000000
+
+r 100000.10
+*Want "First byte moved"                11000000 00000000 00000000 00000000
+r 10FFF0.10
+*Want "Zeros moved over pad"            00000000 00000000 00000000 00000000
+r 113FF0.10
+*Want "Last byte moved"                 00000000 00000000 00000000 00000022
+r 114000.10
+*Want "Pad beyond move kept"            FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF
+r 117FF0.10
+*Want "Last byte padded"                FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF
+r 118000.10
+*Want "Nothing padded beyond"           00000000 00000000 00000000 00000000
+
+r 880.10
+*Want "CLCLE: R2 and R3"                00000000 00110000 00000000 00000000
+r 890.10
+*Want "CLCLE: R4 and R5"                00000000 00210000 00000000 00000000
+r 8E0.4
+*Want "CLCLE: cc0"                      00000000
+
+*Done
@@ -0,0 +1,80 @@
+*Testcase timer-wait: clock comparator and CPU timer end an enabled wait
+
+* The program sets the clock comparator 10ms ahead and loads an
+* enabled wait PSW. The clock comparator interrupt handler checks
+* that the TOD clock has passed the comparator, sets the CPU timer
+* to 10ms and waits again. The CPU timer interrupt handler checks
+* that the CPU timer is negative and loads a disabled wait PSW.
+*
+*   440  CC of CLC TOD clock,clock comparator (2 == high)
+*   444  external interruption code of the first interrupt
+*   446  external interruption code of the second interrupt
+*   448  CC of LTG CPU timer (1 == negative)
+
+sysclear
+archlvl z/Arch
+
+r 1a0=00000001800000000000000000000200  # z/Arch restart PSW
+r 1b0=00000001800000000000000000000300  # z/Arch ext new PSW
+r 1d0=0002000180000000000000000000DEAD  # z/Arch pgm new PSW
+
+r 200=B2080480                          # SPT   X'480'         CPU timer far away
+r 204=B7000400                          # LCTL  R0,R0,X'400'   enable CKC and CPT
+r 208=B2050410                          # STCK  X'410'
+r 20C=E31004100004                      # LG    R1,X'410'
+r 212=C21802800000                      # AGFI  R1,X'2800000'  plus 10ms
+r 218=E31004180024                      # STG   R1,X'418'
+r 21E=B2060418                          # SCKC  X'418'
+r 222=B2B20420                          # LPSWE X'420'         enabled wait
+
+r 300=B2050430                          # STCK  X'430'
+r 304=1B11                              # SR    R1,R1
+r 306=D50704300418                      # CLC   X'430'(8),X'418'
+r 30C=B2220010                          # IPM   R1
+r 310=50100440                          # ST    R1,X'440'
+r 314=D20104440086                      # MVC   X'444'(2),X'86'
+r 31A=B2060450                          # SCKC  X'450'         comparator far away
+r 31E=B2080458                          # SPT   X'458'         10ms
+r 322=D20701B80468                      # MVC   X'1B8'(8),X'468'
+r 328=B2B20420                          # LPSWE X'420'         enabled wait
+
+r 380=B2090460                          # STPT  X'460'
+r 384=D20104460086                      # MVC   X'446'(2),X'86'
+r 38A=1B22                              # SR    R2,R2
+r 38C=E31004600002                      # LTG   R1,X'460'
+r 392=B2220020                          # IPM   R2
+r 396=50200448                          # ST    R2,X'448'
+r 39A=B2B20470                          # LPSWE X'470'         disabled wait
+
+r 400=00000C00                          # CR0 low word
+r 420=01020001800000000000000000000000  # z/Arch enabled wait PSW
+r 450=FFFFFFFFFFFFFFFF                  # clock comparator
+r 458=0000000002800000                  # CPU timer 10ms
+r 468=0000000000000380                  # second ext new PSW address
+r 470=00020001800000000000000000000000  # z/Arch disabled wait PSW
+r 480=7FFFFFFFFFFFFFFF                  # CPU timer
+
+runtest 1
+
+*Compare
+r 440.10
+*Want "timer-wait results" 20000000 10041005 10000000 00000000
+
+*Done
+
+*Testcase timer-wait-spin: as above with the enabled waits spinning
+
+waitspin 10000
+
+r 1b0=00000001800000000000000000000300  # z/Arch ext new PSW
+r 440=00000000000000000000000000000000  # results
+
+runtest 1
+
+*Compare
+r 440.10
+*Want "timer-wait-spin results" 20000000 10041005 10000000 00000000
+
+*Done
+
+waitspin default
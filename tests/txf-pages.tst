@@ -0,0 +1,67 @@
+*Testcase txf-pages: transaction storing into and fetching from 300 pages
+
+* The first transaction stores a different value into each of 300
+* pages, more pages than the transaction page map has hash entries,
+* and fetches each value back. The sums of the values fetched within
+* the transaction and of the values committed by TEND are both 44850.
+* The second transaction stores into the first page and is aborted
+* by TABORT, which must leave that page unchanged.
+*
+*   500  sum of the values fetched within the first transaction
+*   508  sum of the values committed by TEND
+*   510  01 when the second transaction was aborted
+*   518  first page value after the aborted transaction
+
+sysclear
+archlvl z/Arch
+
+r 1a0=00000001800000000000000000000200  # z/Arch restart PSW
+r 1d0=0002000180000000000000000000DEAD  # z/Arch pgm new PSW
+r 300=00020001800000000000000000000000  # z/Arch disabled wait PSW
+r 310=0002000180000000000000000000BAD0  # z/Arch failure wait PSW
+r 600=0080000000000000                  # CR0 with TXC
+
+r 200=EB000600002F                      # LCTLG R0,R0,X'600'      CR0 with TXC
+r 206=A7390000                          # LGHI  R3,0              value stored
+r 20A=C04100010000                      # LGFI  R4,X'10000'       first page
+r 210=A759012C                          # LGHI  R5,300            page count
+r 214=A7790000                          # LGHI  R7,0              sum of values read back
+r 218=E5600000FF00                      # TBEGIN 0,X'FF00'        save R0-R15, no TDB
+r 21E=A7740043                          # JNZ   FAIL
+r 222=E33040800024                      # STG   R3,X'80'(,R4)
+r 228=E36040800004                      # LG    R6,X'80'(,R4)
+r 22E=B9080076                          # AGR   R7,R6
+r 232=A73B0001                          # AGHI  R3,1
+r 236=C24800001000                      # AGFI  R4,4096
+r 23C=A756FFF3                          # BRCT  R5,LOOP1
+r 240=B2F80000                          # TEND
+r 244=E37005000024                      # STG   R7,X'500'
+r 24A=C04100010000                      # LGFI  R4,X'10000'
+r 250=A759012C                          # LGHI  R5,300
+r 254=A7890000                          # LGHI  R8,0              sum of committed values
+r 258=E38040800008                      # AG    R8,X'80'(,R4)
+r 25E=C24800001000                      # AGFI  R4,4096
+r 264=A756FFFA                          # BRCT  R5,LOOP2
+r 268=E38005080024                      # STG   R8,X'508'
+r 26E=C04100010000                      # LGFI  R4,X'10000'
+r 274=A799FFFF                          # LGHI  R9,-1
+r 278=E5600000FF00                      # TBEGIN 0,X'FF00'
+r 27E=A7740009                          # JNZ   ABORTED
+r 282=E39040800024                      # STG   R9,X'80'(,R4)
+r 288=B2FC0200                          # TABORT 512
+r 28C=A7F4000C                          # J     FAIL
+r 290=92010510                          # MVI   X'510',X'01'      aborted
+r 294=E3B040800004                      # LG    R11,X'80'(,R4)
+r 29A=E3B005180024                      # STG   R11,X'518'
+r 2A0=B2B20300                          # LPSWE X'300'            success
+r 2A4=B2B20310                          # LPSWE X'310'            failure
+
+runtest 1
+
+*Compare
+r 500.10
+*Want "txf-pages sums" 00000000 0000AF32 00000000 0000AF32
+r 510.10
+*Want "txf-pages abort" 01000000 00000000 00000000 00000000
+
+*Done
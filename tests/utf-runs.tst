@@ -0,0 +1,252 @@
+*Testcase utf-runs: Unicode conversion and checksum of long runs
+
+* Each case at 800 executes one CU12, CU21, CU14, CU41, CU24, CU42
+* or CKSM instruction and stores R2-R8 (R8 holding the condition
+* code from IPM) and the checksum of the converted output at 3000.
+* The sources are long runs of ASCII or non-surrogate characters,
+* built by the program from the 16-byte patterns below, which are
+* followed by a few multi-byte characters. The cases exercise the
+* CPU-determined limit, runs crossing source and destination pages,
+* runs ending at other characters and too short a destination.
+
+sysclear
+archlvl z/Arch
+mainsize 4
+
+r 1a0=00000001800000000000000000000200  # z/Arch restart PSW
+r 1d0=0002000180000000000000000000DEAD  # z/Arch pgm new PSW
+r 300=00020001800000000000000000000000  # z/Arch disabled wait PSW
+
+r 200=41900700                          # LA    R9,X'700'      pattern fills
+r 204=A7B80005                          # LHI   R11,5
+r 208=58109000                          # L     R1,0(R9)
+r 20C=58C09004                          # L     R12,4(R9)
+r 210=D2EF10101000                      # MVC   16(240,R1),0(R1)
+r 216=D2FF11001000                      # MVC   256(256,R1),0(R1)
+r 21C=41110100                          # LA    R1,256(R1)
+r 220=A7C6FFFB                          # BRCT  R12,*-10
+r 224=41990008                          # LA    R9,8(R9)
+r 228=A7B6FFF0                          # BRCT  R11,*-32
+r 22C=41900800                          # LA    R9,X'800'      cases
+r 230=C0A100003000                      # LGFI  R10,X'3000'    results
+r 236=A7B8001E                          # LHI   R11,30
+r 23A=98279008                          # LM    R2,R7,8(R9)
+r 23E=44009000                          # EX    R0,0(R9)
+r 242=B2220080                          # IPM   R8
+r 246=9028A000                          # STM   R2,R8,0(R10)
+r 24A=58C09010                          # L     R12,16(R9)
+r 24E=18D4                              # LR    R13,R4
+r 250=1BDC                              # SR    R13,R12
+r 252=1BEE                              # SR    R14,R14
+r 254=B24100EC                          # CKSM  R14,R12
+r 258=A714FFFE                          # BRC   1,*-4
+r 25C=50E0A01C                          # ST    R14,28(R10)
+r 260=41990020                          # LA    R9,32(R9)
+r 264=41AA0020                          # LA    R10,32(R10)
+r 268=A7B6FFE9                          # BRCT  R11,*-46
+r 26C=B2B20300                          # LPSWE X'300'
+
+r 700=000200000000001F                  # 20000: 31 more 256-byte copies
+r 708=000300000000001F                  # 30000: 31 more 256-byte copies
+r 710=000400000000003F                  # 40000: 63 more 256-byte copies
+r 718=000500000000001F                  # 50000: 31 more 256-byte copies
+r 720=000600000000003F                  # 60000: 63 more 256-byte copies
+
+r 20000=4142434445464748494A4B4C4D4E4F50# UTF-8 ASCII
+r 22000=C3A941E282ACF09F98804280
+r 30000=00410042004300440045004600470048# UTF-16 ASCII
+r 32000=00E920ACD83DDE000041D8000041
+r 40000=00000041000000420000004300000044# UTF-32 ASCII
+r 44000=000000E9000020AC0001F600000000410000D800
+r 50000=004100E920ACFFFD4E2D0391DC01E000# UTF-16 non-surrogates
+r 52000=D83DDE000042D800
+r 60000=00000041000000E9000020AC0000FFFD# UTF-32 non-surrogates
+r 64000=0001F600000000420000D800
+
+r 800=B2A70042000000000002000000003000  # CU12 limit
+r 810=00100000000100000000000000000000
+r 820=B2A700420000000000021F9000000100  # CU12 invalid
+r 830=00110FF1000010000000000000000000
+r 840=B2A700420000000000020F330000012C  # CU12 page cross
+r 850=00120F81000010000000000000000000
+r 860=B2A70042000000000002000000000100  # CU12 short dest
+r 870=00130000000000510000000000000000
+r 880=B2A710420000000000021FF000000040  # CU12 M3=1 invalid
+r 890=00140000000010000000000000000000
+r 8A0=B2A60042000000000003000000003000  # CU21 limit
+r 8B0=00150000000100000000000000000000
+r 8C0=B2A600420000000000031F8000000100  # CU21 mixed
+r 8D0=00160FF3000010000000000000000000
+r 8E0=B2A600420000000000030F8A00000300  # CU21 page cross
+r 8F0=00170FC3000004000000000000000000
+r 900=B2A60042000000000003000000000100  # CU21 short dest
+r 910=00180000000000330000000000000000
+r 920=B9B00042000000000002000000003000  # CU14 limit
+r 930=00190000000100000000000000000000
+r 940=B9B000420000000000021F9000000100  # CU14 invalid
+r 950=001A0FF4000010000000000000000000
+r 960=B9B000420000000000020F330000012C  # CU14 page cross
+r 970=001B0F86000010000000000000000000
+r 980=B9B00042000000000002000000000100  # CU14 short dest
+r 990=001C00000000003E0000000000000000
+r 9A0=B9B20042000000000004000000005000  # CU41 limit
+r 9B0=001D0000000100000000000000000000
+r 9C0=B9B200420000000000043F8000000100  # CU41 invalid
+r 9D0=001E0FF5000010000000000000000000
+r 9E0=B9B200420000000000040F3C00000300  # CU41 page cross
+r 9F0=001F0FC1000010000000000000000000
+r A00=B9B20042000000000004000000000100  # CU41 short dest
+r A10=00200000000000130000000000000000
+r A20=B9B10042000000000005000000003000  # CU24 limit
+r A30=00210000000100000000000000000000
+r A40=B9B100420000000000051F8000000100  # CU24 mixed
+r A50=00220FF4000010000000000000000000
+r A60=B9B100420000000000050F8A00000300  # CU24 page cross
+r A70=00230FC6000010000000000000000000
+r A80=B9B10042000000000005000000000100  # CU24 short dest
+r A90=002400000000003E0000000000000000
+r AA0=B9B30042000000000006000000005000  # CU42 limit
+r AB0=00250000000100000000000000000000
+r AC0=B9B300420000000000063F8000000100  # CU42 invalid
+r AD0=00260FF2000010000000000000000000
+r AE0=B9B300420000000000060F3C00000300  # CU42 page cross
+r AF0=00270FC1000010000000000000000000
+r B00=B9B30042000000000006000000000100  # CU42 short dest
+r B10=00280000000000330000000000000000
+r B20=B2410062000000000002000000003000  # CKSM page
+r B30=00000000000000000000000000000000
+r B40=B24100620000000000020F0300003000  # CKSM page end
+r B50=00000000000000001234567800000000
+r B60=B2410062000000000006000000001000  # CKSM carries
+r B70=0000000000000000FFFFFFF000000000
+r B80=B24100620000000000050FFE0000000A  # CKSM page cross
+r B90=00000000000000000000000000000000
+r BA0=B2410062000000000002200000000013  # CKSM tail
+r BB0=00000000000000000000000000000000
+
+runtest .5
+
+*Compare
+
+r 3000.10
+*Want "CU12 limit 1"              00021000 00002000 00102000 0000E000
+r 3010.10
+*Want "CU12 limit 2"              00000000 00000000 30000000 40024802
+r 3020.10
+*Want "CU12 invalid 1"            0002200B 00000085 001110DD 00000F14
+r 3030.10
+*Want "CU12 invalid 2"            00000000 00000000 20000000 0F55E8B9
+r 3040.10
+*Want "CU12 page cross 1"         0002105F 00000000 001211D9 00000DA8
+r 3050.10
+*Want "CU12 page cross 2"         00000000 00000000 00000000 2AC62A3C
+r 3060.10
+*Want "CU12 short dest 1"         00020028 000000D8 00130050 00000001
+r 3070.10
+*Want "CU12 short dest 2"         00000000 00000000 10000000 059005A4
+r 3080.10
+*Want "CU12 M3=1 invalid 1"       0002200B 00000025 0014002C 00000FD4
+r 3090.10
+*Want "CU12 M3=1 invalid 2"       00000000 00000000 20000000 01D5DB09
+r 30A0.10
+*Want "CU21 limit 1"              00032000 00001000 00151000 0000F000
+r 30B0.10
+*Want "CU21 limit 2"              00000000 00000000 30000000 1115190D
+r 30C0.10
+*Want "CU21 mixed 1"              00032080 00000000 0016107A 00000F79
+r 30D0.10
+*Want "CU21 mixed 2"              00000000 00000000 00000000 A6A1C710
+r 30E0.10
+*Want "CU21 page cross 1"         0003128A 00000000 00171143 00000280
+r 30F0.10
+*Want "CU21 page cross 2"         00000000 00000000 00000000 99FA5939
+r 3100.10
+*Want "CU21 short dest 1"         00030066 0000009A 00180033 00000000
+r 3110.10
+*Want "CU21 short dest 2"         00000000 00000000 10000000 6875824B
+r 3120.10
+*Want "CU14 limit 1"              00021000 00002000 00194000 0000C000
+r 3130.10
+*Want "CU14 limit 2"              00000000 00000000 30000000 00048800
+r 3140.10
+*Want "CU14 invalid 1"            0002200B 00000085 001A11C8 00000E2C
+r 3150.10
+*Want "CU14 invalid 2"            00000000 00000000 20000000 000237D0
+r 3160.10
+*Want "CU14 page cross 1"         0002105F 00000000 001B1436 00000B50
+r 3170.10
+*Want "CU14 page cross 2"         00000000 00000000 00000000 00005502
+r 3180.10
+*Want "CU14 short dest 1"         0002000F 000000F1 001C003C 00000002
+r 3190.10
+*Want "CU14 short dest 2"         00000000 00000000 10000000 00000438
+r 31A0.10
+*Want "CU41 limit 1"              00041000 00004000 001D0400 0000FC00
+r 31B0.10
+*Want "CU41 limit 2"              00000000 00000000 30000000 42434441
+r 31C0.10
+*Want "CU41 invalid 1"            00044010 00000070 001E101F 00000FD6
+r 31D0.10
+*Want "CU41 invalid 2"            00000000 00000000 20000000 FAED9C3D
+r 31E0.10
+*Want "CU41 page cross 1"         0004123C 00000000 001F1081 00000F40
+r 31F0.10
+*Want "CU41 page cross 2"         00000000 00000000 00000000 CC3C6C9C
+r 3200.10
+*Want "CU41 short dest 1"         0004004C 000000B4 00200013 00000000
+r 3210.10
+*Want "CU41 short dest 2"         00000000 00000000 10000000 464B5011
+r 3220.10
+*Want "CU24 limit 1"              00051000 00002000 00212000 0000E000
+r 3230.10
+*Want "CU24 limit 2"              00000000 00000000 30000000 032F9200
+r 3240.10
+*Want "CU24 mixed 1"              00052080 00000000 002211EC 00000E08
+r 3250.10
+*Want "CU24 mixed 2"              00000000 00000000 00000000 001C72D2
+r 3260.10
+*Want "CU24 page cross 1"         0005128A 00000000 002315C6 00000A00
+r 3270.10
+*Want "CU24 page cross 2"         00000000 00000000 00000000 0098EB60
+r 3280.10
+*Want "CU24 short dest 1"         0005001E 000000E2 0024003C 00000002
+r 3290.10
+*Want "CU24 short dest 2"         00000000 00000000 10000000 00057F24
+r 32A0.10
+*Want "CU42 limit 1"              00061000 00004000 00250800 0000F800
+r 32B0.10
+*Want "CU42 limit 2"              00000000 00000000 30000000 EE00E620
+r 32C0.10
+*Want "CU42 invalid 1"            00064008 00000078 00261038 00000FBA
+r 32D0.10
+*Want "CU42 invalid 2"            00000000 00000000 20000000 DFEFE531
+r 32E0.10
+*Want "CU42 page cross 1"         0006123C 00000000 00271141 00000E80
+r 32F0.10
+*Want "CU42 page cross 2"         00000000 00000000 00000000 2B262CA0
+r 3300.10
+*Want "CU42 short dest 1"         00060064 0000009C 00280032 00000001
+r 3310.10
+*Want "CU42 short dest 2"         00000000 00000000 10000000 C5D50564
+r 3320.10
+*Want "CKSM page 1"               00021000 00002000 00000000 00000000
+r 3330.10
+*Want "CKSM page 2"               2125291D 00000000 30000000 00000000
+r 3340.10
+*Want "CKSM page end 1"           00020FFF 00002F04 00000000 00000000
+r 3350.10
+*Want "CKSM page end 2"           53C52687 00000000 30000000 00000000
+r 3360.10
+*Want "CKSM carries 1"            00061000 00000000 00000000 00000000
+r 3370.10
+*Want "CKSM carries 2"            0121D2F1 00000000 00000000 00000000
+r 3380.10
+*Want "CKSM page cross 1"         00051002 00000006 00000000 00000000
+r 3390.10
+*Want "CKSM page cross 2"         E0000041 00000000 30000000 00000000
+r 33A0.10
+*Want "CKSM tail 1"               00022010 00000003 00000000 00000000
+r 33B0.10
+*Want "CKSM tail 2"               DED67502 00000000 30000000 00000000
+
+*Done
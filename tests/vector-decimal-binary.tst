@@ -0,0 +1,455 @@
+*Testcase vector-decimal-binary: VAP, VSP, VMP, VDP, VRP and VSRP edge cases
+
+* Results, signs and condition codes of the vector packed decimal
+* instructions where the 128-bit binary and decNumber paths meet:
+* VSRP left-shift overflow and round-by-5 on negative operands, VDP
+* and VRP result signs and overflow, VMP operands just above and
+* below the signed 64-bit limit, and VAP/VSP overflow to zero.
+* Every instruction sets the condition code (CS) and masks the
+* decimal overflow exception through the PSW program mask.
+
+sysclear
+archlvl z/Arch
+
+r 1a0=00000001800000000000000000000200  # z/Arch restart PSW
+r 1d0=0002000180000000000000000000DEAD  # z/Arch pgm new PSW
+r FF0=00020001800000000000000000000000  # z/Arch disabled wait PSW
+
+r 200=B7000FE0                          # LCTL  R0,R0,CR0      AFP and vector
+r 204=C09100001000                      # LGFI  R9,X'1000'     operands
+r 20A=C0A100003000                      # LGFI  R10,X'3000'    results
+r 210=E72090000006                      # VL    V2,X'000'(R9)
+r 216=E6120311F059                      # VSRP  V1,V2,31,3,1
+r 21C=B2220070                          # IPM   R7
+r 220=5070A010                          # ST    R7,X'010'(R10)
+r 224=E710A000000E                      # VST   V1,X'000'(R10)
+r 22A=E72090100006                      # VL    V2,X'010'(R9)
+r 230=E61207108059                      # VSRP  V1,V2,8,7,1
+r 236=B2220070                          # IPM   R7
+r 23A=5070A030                          # ST    R7,X'030'(R10)
+r 23E=E710A020000E                      # VST   V1,X'020'(R10)
+r 244=E72090200006                      # VL    V2,X'020'(R9)
+r 24A=E6120711F059                      # VSRP  V1,V2,31,7,1
+r 250=B2220070                          # IPM   R7
+r 254=5070A050                          # ST    R7,X'050'(R10)
+r 258=E710A040000E                      # VST   V1,X'040'(R10)
+r 25E=E72090300006                      # VL    V2,X'030'(R9)
+r 264=E6120711F059                      # VSRP  V1,V2,31,7,1
+r 26A=B2220070                          # IPM   R7
+r 26E=5070A070                          # ST    R7,X'070'(R10)
+r 272=E710A060000E                      # VST   V1,X'060'(R10)
+r 278=E72090400006                      # VL    V2,X'040'(R9)
+r 27E=E6120A11F059                      # VSRP  V1,V2,31,10,1
+r 284=B2220070                          # IPM   R7
+r 288=5070A090                          # ST    R7,X'090'(R10)
+r 28C=E710A080000E                      # VST   V1,X'080'(R10)
+r 292=E72090500006                      # VL    V2,X'050'(R9)
+r 298=E612FE11F059                      # VSRP  V1,V2,31,X'80'+-2,1
+r 29E=B2220070                          # IPM   R7
+r 2A2=5070A0B0                          # ST    R7,X'0B0'(R10)
+r 2A6=E710A0A0000E                      # VST   V1,X'0A0'(R10)
+r 2AC=E72090600006                      # VL    V2,X'060'(R9)
+r 2B2=E612FE11F059                      # VSRP  V1,V2,31,X'80'+-2,1
+r 2B8=B2220070                          # IPM   R7
+r 2BC=5070A0D0                          # ST    R7,X'0D0'(R10)
+r 2C0=E710A0C0000E                      # VST   V1,X'0C0'(R10)
+r 2C6=E72090700006                      # VL    V2,X'070'(R9)
+r 2CC=E612FE11F059                      # VSRP  V1,V2,31,X'80'+-2,1
+r 2D2=B2220070                          # IPM   R7
+r 2D6=5070A0F0                          # ST    R7,X'0F0'(R10)
+r 2DA=E710A0E0000E                      # VST   V1,X'0E0'(R10)
+r 2E0=E72090800006                      # VL    V2,X'080'(R9)
+r 2E6=E612FF11F059                      # VSRP  V1,V2,31,X'80'+-1,1
+r 2EC=B2220070                          # IPM   R7
+r 2F0=5070A110                          # ST    R7,X'110'(R10)
+r 2F4=E710A100000E                      # VST   V1,X'100'(R10)
+r 2FA=E72090900006                      # VL    V2,X'090'(R9)
+r 300=E612FF11F059                      # VSRP  V1,V2,31,X'80'+-1,1
+r 306=B2220070                          # IPM   R7
+r 30A=5070A130                          # ST    R7,X'130'(R10)
+r 30E=E710A120000E                      # VST   V1,X'120'(R10)
+r 314=E72090A00006                      # VL    V2,X'0A0'(R9)
+r 31A=E612FF11F059                      # VSRP  V1,V2,31,X'80'+-1,1
+r 320=B2220070                          # IPM   R7
+r 324=5070A150                          # ST    R7,X'150'(R10)
+r 328=E710A140000E                      # VST   V1,X'140'(R10)
+r 32E=E72090B00006                      # VL    V2,X'0B0'(R9)
+r 334=E612FF11E059                      # VSRP  V1,V2,30,X'80'+-1,1
+r 33A=B2220070                          # IPM   R7
+r 33E=5070A170                          # ST    R7,X'170'(R10)
+r 342=E710A160000E                      # VST   V1,X'160'(R10)
+r 348=E72090C00006                      # VL    V2,X'0C0'(R9)
+r 34E=E612E011F059                      # VSRP  V1,V2,31,X'80'+-32,1
+r 354=B2220070                          # IPM   R7
+r 358=5070A190                          # ST    R7,X'190'(R10)
+r 35C=E710A180000E                      # VST   V1,X'180'(R10)
+r 362=E72090D00006                      # VL    V2,X'0D0'(R9)
+r 368=E6127D11F059                      # VSRP  V1,V2,31,-3,1
+r 36E=B2220070                          # IPM   R7
+r 372=5070A1B0                          # ST    R7,X'1B0'(R10)
+r 376=E710A1A0000E                      # VST   V1,X'1A0'(R10)
+r 37C=E72090E00006                      # VL    V2,X'0E0'(R9)
+r 382=E612FE31F059                      # VSRP  V1,V2,31,X'80'+-2,3
+r 388=B2220070                          # IPM   R7
+r 38C=5070A1D0                          # ST    R7,X'1D0'(R10)
+r 390=E710A1C0000E                      # VST   V1,X'1C0'(R10)
+r 396=E72090F00006                      # VL    V2,X'0F0'(R9)
+r 39C=E73091000006                      # VL    V3,X'100'(R9)
+r 3A2=E6123011F07A                      # VDP   V1,V2,V3,31,1
+r 3A8=B2220070                          # IPM   R7
+r 3AC=5070A1F0                          # ST    R7,X'1F0'(R10)
+r 3B0=E710A1E0000E                      # VST   V1,X'1E0'(R10)
+r 3B6=E72091100006                      # VL    V2,X'110'(R9)
+r 3BC=E73091200006                      # VL    V3,X'120'(R9)
+r 3C2=E6123011F07A                      # VDP   V1,V2,V3,31,1
+r 3C8=B2220070                          # IPM   R7
+r 3CC=5070A210                          # ST    R7,X'210'(R10)
+r 3D0=E710A200000E                      # VST   V1,X'200'(R10)
+r 3D6=E72091300006                      # VL    V2,X'130'(R9)
+r 3DC=E73091400006                      # VL    V3,X'140'(R9)
+r 3E2=E6123011F07A                      # VDP   V1,V2,V3,31,1
+r 3E8=B2220070                          # IPM   R7
+r 3EC=5070A230                          # ST    R7,X'230'(R10)
+r 3F0=E710A220000E                      # VST   V1,X'220'(R10)
+r 3F6=E72091500006                      # VL    V2,X'150'(R9)
+r 3FC=E73091600006                      # VL    V3,X'160'(R9)
+r 402=E6123011F07A                      # VDP   V1,V2,V3,31,1
+r 408=B2220070                          # IPM   R7
+r 40C=5070A250                          # ST    R7,X'250'(R10)
+r 410=E710A240000E                      # VST   V1,X'240'(R10)
+r 416=E72091700006                      # VL    V2,X'170'(R9)
+r 41C=E73091800006                      # VL    V3,X'180'(R9)
+r 422=E6123010507A                      # VDP   V1,V2,V3,5,1
+r 428=B2220070                          # IPM   R7
+r 42C=5070A270                          # ST    R7,X'270'(R10)
+r 430=E710A260000E                      # VST   V1,X'260'(R10)
+r 436=E72091900006                      # VL    V2,X'190'(R9)
+r 43C=E73091A00006                      # VL    V3,X'1A0'(R9)
+r 442=E6123010A07A                      # VDP   V1,V2,V3,10,1
+r 448=B2220070                          # IPM   R7
+r 44C=5070A290                          # ST    R7,X'290'(R10)
+r 450=E710A280000E                      # VST   V1,X'280'(R10)
+r 456=E72091B00006                      # VL    V2,X'1B0'(R9)
+r 45C=E73091C00006                      # VL    V3,X'1C0'(R9)
+r 462=E6123011F07B                      # VRP   V1,V2,V3,31,1
+r 468=B2220070                          # IPM   R7
+r 46C=5070A2B0                          # ST    R7,X'2B0'(R10)
+r 470=E710A2A0000E                      # VST   V1,X'2A0'(R10)
+r 476=E72091D00006                      # VL    V2,X'1D0'(R9)
+r 47C=E73091E00006                      # VL    V3,X'1E0'(R9)
+r 482=E6123011F07B                      # VRP   V1,V2,V3,31,1
+r 488=B2220070                          # IPM   R7
+r 48C=5070A2D0                          # ST    R7,X'2D0'(R10)
+r 490=E710A2C0000E                      # VST   V1,X'2C0'(R10)
+r 496=E72091F00006                      # VL    V2,X'1F0'(R9)
+r 49C=E73092000006                      # VL    V3,X'200'(R9)
+r 4A2=E6123011F07B                      # VRP   V1,V2,V3,31,1
+r 4A8=B2220070                          # IPM   R7
+r 4AC=5070A2F0                          # ST    R7,X'2F0'(R10)
+r 4B0=E710A2E0000E                      # VST   V1,X'2E0'(R10)
+r 4B6=E72092100006                      # VL    V2,X'210'(R9)
+r 4BC=E73092200006                      # VL    V3,X'220'(R9)
+r 4C2=E6123011F07B                      # VRP   V1,V2,V3,31,1
+r 4C8=B2220070                          # IPM   R7
+r 4CC=5070A310                          # ST    R7,X'310'(R10)
+r 4D0=E710A300000E                      # VST   V1,X'300'(R10)
+r 4D6=E72092300006                      # VL    V2,X'230'(R9)
+r 4DC=E73092400006                      # VL    V3,X'240'(R9)
+r 4E2=E6123010507B                      # VRP   V1,V2,V3,5,1
+r 4E8=B2220070                          # IPM   R7
+r 4EC=5070A330                          # ST    R7,X'330'(R10)
+r 4F0=E710A320000E                      # VST   V1,X'320'(R10)
+r 4F6=E72092500006                      # VL    V2,X'250'(R9)
+r 4FC=E73092600006                      # VL    V3,X'260'(R9)
+r 502=E6123011F078                      # VMP   V1,V2,V3,31,1
+r 508=B2220070                          # IPM   R7
+r 50C=5070A350                          # ST    R7,X'350'(R10)
+r 510=E710A340000E                      # VST   V1,X'340'(R10)
+r 516=E72092700006                      # VL    V2,X'270'(R9)
+r 51C=E73092800006                      # VL    V3,X'280'(R9)
+r 522=E6123011F078                      # VMP   V1,V2,V3,31,1
+r 528=B2220070                          # IPM   R7
+r 52C=5070A370                          # ST    R7,X'370'(R10)
+r 530=E710A360000E                      # VST   V1,X'360'(R10)
+r 536=E72092900006                      # VL    V2,X'290'(R9)
+r 53C=E73092A00006                      # VL    V3,X'2A0'(R9)
+r 542=E6123011F078                      # VMP   V1,V2,V3,31,1
+r 548=B2220070                          # IPM   R7
+r 54C=5070A390                          # ST    R7,X'390'(R10)
+r 550=E710A380000E                      # VST   V1,X'380'(R10)
+r 556=E72092B00006                      # VL    V2,X'2B0'(R9)
+r 55C=E73092C00006                      # VL    V3,X'2C0'(R9)
+r 562=E6123011F078                      # VMP   V1,V2,V3,31,1
+r 568=B2220070                          # IPM   R7
+r 56C=5070A3B0                          # ST    R7,X'3B0'(R10)
+r 570=E710A3A0000E                      # VST   V1,X'3A0'(R10)
+r 576=E72092D00006                      # VL    V2,X'2D0'(R9)
+r 57C=E73092E00006                      # VL    V3,X'2E0'(R9)
+r 582=E6123011F078                      # VMP   V1,V2,V3,31,1
+r 588=B2220070                          # IPM   R7
+r 58C=5070A3D0                          # ST    R7,X'3D0'(R10)
+r 590=E710A3C0000E                      # VST   V1,X'3C0'(R10)
+r 596=E72092F00006                      # VL    V2,X'2F0'(R9)
+r 59C=E73093000006                      # VL    V3,X'300'(R9)
+r 5A2=E6123011F078                      # VMP   V1,V2,V3,31,1
+r 5A8=B2220070                          # IPM   R7
+r 5AC=5070A3F0                          # ST    R7,X'3F0'(R10)
+r 5B0=E710A3E0000E                      # VST   V1,X'3E0'(R10)
+r 5B6=E72093100006                      # VL    V2,X'310'(R9)
+r 5BC=E73093200006                      # VL    V3,X'320'(R9)
+r 5C2=E6123011F078                      # VMP   V1,V2,V3,31,1
+r 5C8=B2220070                          # IPM   R7
+r 5CC=5070A410                          # ST    R7,X'410'(R10)
+r 5D0=E710A400000E                      # VST   V1,X'400'(R10)
+r 5D6=E72093300006                      # VL    V2,X'330'(R9)
+r 5DC=E73093400006                      # VL    V3,X'340'(R9)
+r 5E2=E61230101078                      # VMP   V1,V2,V3,1,1
+r 5E8=B2220070                          # IPM   R7
+r 5EC=5070A430                          # ST    R7,X'430'(R10)
+r 5F0=E710A420000E                      # VST   V1,X'420'(R10)
+r 5F6=E72093500006                      # VL    V2,X'350'(R9)
+r 5FC=E73093600006                      # VL    V3,X'360'(R9)
+r 602=E6123011F078                      # VMP   V1,V2,V3,31,1
+r 608=B2220070                          # IPM   R7
+r 60C=5070A450                          # ST    R7,X'450'(R10)
+r 610=E710A440000E                      # VST   V1,X'440'(R10)
+r 616=E72093700006                      # VL    V2,X'370'(R9)
+r 61C=E73093800006                      # VL    V3,X'380'(R9)
+r 622=E6123011F071                      # VAP   V1,V2,V3,31,1
+r 628=B2220070                          # IPM   R7
+r 62C=5070A470                          # ST    R7,X'470'(R10)
+r 630=E710A460000E                      # VST   V1,X'460'(R10)
+r 636=E72093900006                      # VL    V2,X'390'(R9)
+r 63C=E73093A00006                      # VL    V3,X'3A0'(R9)
+r 642=E6123011F073                      # VSP   V1,V2,V3,31,1
+r 648=B2220070                          # IPM   R7
+r 64C=5070A490                          # ST    R7,X'490'(R10)
+r 650=E710A480000E                      # VST   V1,X'480'(R10)
+r 656=E72093B00006                      # VL    V2,X'3B0'(R9)
+r 65C=E73093C00006                      # VL    V3,X'3C0'(R9)
+r 662=E6123011F071                      # VAP   V1,V2,V3,31,1
+r 668=B2220070                          # IPM   R7
+r 66C=5070A4B0                          # ST    R7,X'4B0'(R10)
+r 670=E710A4A0000E                      # VST   V1,X'4A0'(R10)
+r 676=B2B20FF0                          # LPSWE z/Arch disabled wait PSW
+
+r FE0=00060000                          # CR0: AFP and vector enabled
+
+r 1000=1234567890123456789012345678901C
+r 1010=0000000000000000000000000000123C
+r 1020=0000000000000000000000000000123D
+r 1030=0000009876543210987654321098765D
+r 1040=0000000001234567890123456789012D
+r 1050=0000000000000000000000000012345D
+r 1060=0000000000000000000000000012355D
+r 1070=0000000000000000000000000012350D
+r 1080=0000000000000000000000000000005D
+r 1090=0000000000000000000000000000004D
+r 10A0=9999999999999999999999999999999D
+r 10B0=9999999999999999999999999999999D
+r 10C0=9999999999999999999999999999999D
+r 10D0=0000000000000000000000000099999D
+r 10E0=0000000000000000000000000012355D
+r 10F0=0000000000000000000000000000100C
+r 1100=0000000000000000000000000000007D
+r 1110=0000000000000000000000000000100D
+r 1120=0000000000000000000000000000007D
+r 1130=0000000000000000000000000000100D
+r 1140=0000000000000000000000000000007C
+r 1150=0000000000000000000000000000005D
+r 1160=0000000000000000000000000000007C
+r 1170=9999999999999999999999999999999C
+r 1180=0000000000000000000000000000001C
+r 1190=9999999999999999999999999999999D
+r 11A0=0000000000000000000000000000003C
+r 11B0=0000000000000000000000000000100C
+r 11C0=0000000000000000000000000000007D
+r 11D0=0000000000000000000000000000100D
+r 11E0=0000000000000000000000000000007C
+r 11F0=0000000000000000000000000000100D
+r 1200=0000000000000000000000000000007D
+r 1210=0000000000000000000000000000014D
+r 1220=0000000000000000000000000000007C
+r 1230=0000000000000000000000123456789D
+r 1240=0000000000000000001000000000000C
+r 1250=0000000000009223372036854775807C
+r 1260=0000000000009223372036854775807C
+r 1270=0000000000009223372036854775808C
+r 1280=0000000000000000000000000000002C
+r 1290=0000000000009223372036854775808D
+r 12A0=0000000000009223372036854775808D
+r 12B0=0000000000009223372036854775809D
+r 12C0=0000000000000000000000000000003C
+r 12D0=0000000000009223372036854775807C
+r 12E0=0000000000009223372036854775808D
+r 12F0=0000000000009223372036854775808D
+r 1300=0000000000000000000000000000001C
+r 1310=0000000000009223372036854775808C
+r 1320=0000000000000000000000000000001D
+r 1330=0000000000000000000000000000003D
+r 1340=0000000000000000000000000000004C
+r 1350=0000000000000009999999999999999C
+r 1360=0000000000000009999999999999999D
+r 1370=9999999999999999999999999999999C
+r 1380=0000000000000000000000000000001C
+r 1390=9999999999999999999999999999999D
+r 13A0=0000000000000000000000000000001C
+r 13B0=0000000000000000000000000000007D
+r 13C0=0000000000000000000000000000007C
+
+runtest .1
+
+r 3000.10
+*Want "VSRP <<3 overflow"         45678901 23456789 01234567 8901000C
+r 3010.4
+*Want "VSRP <<3 overflow cc"      30000000
+r 3020.10
+*Want "VSRP <<7 overflow rdc 8"   00000000 00000000 00000003 0000000C
+r 3030.4
+*Want "VSRP <<7 overflow rdc 8 cc" 30000000
+r 3040.10
+*Want "VSRP <<7 negative"         00000000 00000000 00000123 0000000D
+r 3050.4
+*Want "VSRP <<7 negative cc"      10000000
+r 3060.10
+*Want "VSRP <<7 negative ovfl"    87654321 09876543 21098765 0000000D
+r 3070.4
+*Want "VSRP <<7 negative ovfl cc" 30000000
+r 3080.10
+*Want "VSRP <<10 overflow"        23456789 01234567 89012000 0000000D
+r 3090.4
+*Want "VSRP <<10 overflow cc"     30000000
+r 30A0.10
+*Want "VSRP >>2 round -45"        00000000 00000000 00000000 0000123D
+r 30B0.4
+*Want "VSRP >>2 round -45 cc"     10000000
+r 30C0.10
+*Want "VSRP >>2 round -55"        00000000 00000000 00000000 0000124D
+r 30D0.4
+*Want "VSRP >>2 round -55 cc"     10000000
+r 30E0.10
+*Want "VSRP >>2 round -50"        00000000 00000000 00000000 0000124D
+r 30F0.4
+*Want "VSRP >>2 round -50 cc"     10000000
+r 3100.10
+*Want "VSRP >>1 round -5"         00000000 00000000 00000000 0000001D
+r 3110.4
+*Want "VSRP >>1 round -5 cc"      10000000
+r 3120.10
+*Want "VSRP >>1 round -4"         00000000 00000000 00000000 0000000C
+r 3130.4
+*Want "VSRP >>1 round -4 cc"      00000000
+r 3140.10
+*Want "VSRP >>1 round nines"      10000000 00000000 00000000 0000000D
+r 3150.4
+*Want "VSRP >>1 round nines cc"   10000000
+r 3160.10
+*Want "VSRP >>1 round ovfl"       00000000 00000000 00000000 0000000C
+r 3170.4
+*Want "VSRP >>1 round ovfl cc"    30000000
+r 3180.10
+*Want "VSRP >>32 round"           00000000 00000000 00000000 0000000C
+r 3190.4
+*Want "VSRP >>32 round cc"        00000000
+r 31A0.10
+*Want "VSRP >>3 no round"         00000000 00000000 00000000 0000099D
+r 31B0.4
+*Want "VSRP >>3 no round cc"      10000000
+r 31C0.10
+*Want "VSRP >>2 round P1"         00000000 00000000 00000000 0000124F
+r 31D0.4
+*Want "VSRP >>2 round P1 cc"      20000000
+r 31E0.10
+*Want "VDP + / -"                 00000000 00000000 00000000 0000014D
+r 31F0.4
+*Want "VDP + / - cc"              10000000
+r 3200.10
+*Want "VDP - / -"                 00000000 00000000 00000000 0000014C
+r 3210.4
+*Want "VDP - / - cc"              20000000
+r 3220.10
+*Want "VDP - / +"                 00000000 00000000 00000000 0000014D
+r 3230.4
+*Want "VDP - / + cc"              10000000
+r 3240.10
+*Want "VDP -0"                    00000000 00000000 00000000 0000000C
+r 3250.4
+*Want "VDP -0 cc"                 00000000
+r 3260.10
+*Want "VDP overflow"              00000000 00000000 00000000 0099999C
+r 3270.4
+*Want "VDP overflow cc"           30000000
+r 3280.10
+*Want "VDP - ovfl"                00000000 00000000 00000333 3333333D
+r 3290.4
+*Want "VDP - ovfl cc"             30000000
+r 32A0.10
+*Want "VRP + / -"                 00000000 00000000 00000000 0000002C
+r 32B0.4
+*Want "VRP + / - cc"              20000000
+r 32C0.10
+*Want "VRP - / +"                 00000000 00000000 00000000 0000002D
+r 32D0.4
+*Want "VRP - / + cc"              10000000
+r 32E0.10
+*Want "VRP - / -"                 00000000 00000000 00000000 0000002D
+r 32F0.4
+*Want "VRP - / - cc"              10000000
+r 3300.10
+*Want "VRP -0"                    00000000 00000000 00000000 0000000C
+r 3310.4
+*Want "VRP -0 cc"                 00000000
+r 3320.10
+*Want "VRP overflow"              00000000 00000000 00000000 0056789D
+r 3330.4
+*Want "VRP overflow cc"           30000000
+r 3340.10
+*Want "VMP max64 sq"              17302346 15847396 90778423 2501249C
+r 3350.4
+*Want "VMP max64 sq cc"           30000000
+r 3360.10
+*Want "VMP max64+1"               00000000 00018446 74407370 9551616C
+r 3370.4
+*Want "VMP max64+1 cc"            20000000
+r 3380.10
+*Want "VMP min64 sq"              17302346 15865843 65185794 2052864C
+r 3390.4
+*Want "VMP min64 sq cc"           30000000
+r 33A0.10
+*Want "VMP min64-1"               00000000 00027670 11611056 4327427D
+r 33B0.4
+*Want "VMP min64-1 cc"            10000000
+r 33C0.10
+*Want "VMP max x min"             17302346 15856620 27982108 7277056D
+r 33D0.4
+*Want "VMP max x min cc"          30000000
+r 33E0.10
+*Want "VMP min64 x 1"             00000000 00009223 37203685 4775808D
+r 33F0.4
+*Want "VMP min64 x 1 cc"          10000000
+r 3400.10
+*Want "VMP max+1 x -1"            00000000 00009223 37203685 4775808D
+r 3410.4
+*Want "VMP max+1 x -1 cc"         10000000
+r 3420.10
+*Want "VMP rdc 1"                 00000000 00000000 00000000 0000002D
+r 3430.4
+*Want "VMP rdc 1 cc"              30000000
+r 3440.10
+*Want "VMP 16x16 dig"             99999999 99999980 00000000 0000001D
+r 3450.4
+*Want "VMP 16x16 dig cc"          30000000
+r 3460.10
+*Want "VAP overflow"              00000000 00000000 00000000 0000000C
+r 3470.4
+*Want "VAP overflow cc"           30000000
+r 3480.10
+*Want "VSP overflow"              00000000 00000000 00000000 0000000C
+r 3490.4
+*Want "VSP overflow cc"           30000000
+r 34A0.10
+*Want "VAP -0"                    00000000 00000000 00000000 0000000C
+r 34B0.4
+*Want "VAP -0 cc"                 00000000
+
+*Done
@@ -0,0 +1,288 @@
+*Testcase vector-nnp-convert: NNP-data-type-1 conversion boundaries
+
+* VCNF, VCFN, VCLFNH, VCLFNL and VCRNF convert a whole vector at once
+* when every element is zero or a normal whose result is a normal,
+* and otherwise convert element by element. Each case clears the FPC,
+* converts one vector and stores the result and the FPC. The cases
+* cover the largest and smallest normals of each format, the
+* NNP-data-type-1 NaN-infinity value 7FFF and values that round to it,
+* a rounding carry into the exponent, +0 and -0, and vectors in which
+* a single element needs the element-by-element conversion.
+* The expected values were taken from a build without the vector
+* conversion.
+
+sysclear
+archlvl z/Arch
+
+r 1a0=00000001800000000000000000000200  # z/Arch restart PSW
+r 1d0=0002000180000000000000000000DEAD  # z/Arch pgm new PSW
+r FF0=00020001800000000000000000000000  # z/Arch disabled wait PSW
+
+r 200=B7000FE0                          # LCTL  R0,R0,X'FE0'   AFP and vector
+r 204=C09100001000                      # LGFI  R9,X'1000'     operands
+r 20A=C0A100002000                      # LGFI  R10,X'2000'    results
+r 210=B29D0FE4                          # LFPC  X'FE4'         clear FPC
+r 214=E72090000006                      # VL    V2,X'000'(R9)
+r 21A=E61200010055                      # VCNF  V1,V2,0,1
+r 220=B29CA010                          # STFPC X'010'(R10)
+r 224=E710A000000E                      # VST   V1,X'000'(R10)
+r 22A=B29D0FE4                          # LFPC  X'FE4'         clear FPC
+r 22E=E72090100006                      # VL    V2,X'010'(R9)
+r 234=E61200010055                      # VCNF  V1,V2,0,1
+r 23A=B29CA030                          # STFPC X'030'(R10)
+r 23E=E710A020000E                      # VST   V1,X'020'(R10)
+r 244=B29D0FE4                          # LFPC  X'FE4'         clear FPC
+r 248=E72090200006                      # VL    V2,X'020'(R9)
+r 24E=E61200010055                      # VCNF  V1,V2,0,1
+r 254=B29CA050                          # STFPC X'050'(R10)
+r 258=E710A040000E                      # VST   V1,X'040'(R10)
+r 25E=B29D0FE4                          # LFPC  X'FE4'         clear FPC
+r 262=E72090300006                      # VL    V2,X'030'(R9)
+r 268=E61200010055                      # VCNF  V1,V2,0,1
+r 26E=B29CA070                          # STFPC X'070'(R10)
+r 272=E710A060000E                      # VST   V1,X'060'(R10)
+r 278=B29D0FE4                          # LFPC  X'FE4'         clear FPC
+r 27C=E72090400006                      # VL    V2,X'040'(R9)
+r 282=E61200010055                      # VCNF  V1,V2,0,1
+r 288=B29CA090                          # STFPC X'090'(R10)
+r 28C=E710A080000E                      # VST   V1,X'080'(R10)
+r 292=B29D0FE4                          # LFPC  X'FE4'         clear FPC
+r 296=E72090500006                      # VL    V2,X'050'(R9)
+r 29C=E6120000105D                      # VCFN  V1,V2,1,0
+r 2A2=B29CA0B0                          # STFPC X'0B0'(R10)
+r 2A6=E710A0A0000E                      # VST   V1,X'0A0'(R10)
+r 2AC=B29D0FE4                          # LFPC  X'FE4'         clear FPC
+r 2B0=E72090600006                      # VL    V2,X'060'(R9)
+r 2B6=E6120000105D                      # VCFN  V1,V2,1,0
+r 2BC=B29CA0D0                          # STFPC X'0D0'(R10)
+r 2C0=E710A0C0000E                      # VST   V1,X'0C0'(R10)
+r 2C6=B29D0FE4                          # LFPC  X'FE4'         clear FPC
+r 2CA=E72090700006                      # VL    V2,X'070'(R9)
+r 2D0=E6120000105D                      # VCFN  V1,V2,1,0
+r 2D6=B29CA0F0                          # STFPC X'0F0'(R10)
+r 2DA=E710A0E0000E                      # VST   V1,X'0E0'(R10)
+r 2E0=B29D0FE4                          # LFPC  X'FE4'         clear FPC
+r 2E4=E72090800006                      # VL    V2,X'080'(R9)
+r 2EA=E6120000105D                      # VCFN  V1,V2,1,0
+r 2F0=B29CA110                          # STFPC X'110'(R10)
+r 2F4=E710A100000E                      # VST   V1,X'100'(R10)
+r 2FA=B29D0FE4                          # LFPC  X'FE4'         clear FPC
+r 2FE=E72090900006                      # VL    V2,X'090'(R9)
+r 304=E6120000105D                      # VCFN  V1,V2,1,0
+r 30A=B29CA130                          # STFPC X'130'(R10)
+r 30E=E710A120000E                      # VST   V1,X'120'(R10)
+r 314=B29D0FE4                          # LFPC  X'FE4'         clear FPC
+r 318=E72090A00006                      # VL    V2,X'0A0'(R9)
+r 31E=E6120000105D                      # VCFN  V1,V2,1,0
+r 324=B29CA150                          # STFPC X'150'(R10)
+r 328=E710A140000E                      # VST   V1,X'140'(R10)
+r 32E=B29D0FE4                          # LFPC  X'FE4'         clear FPC
+r 332=E72090B00006                      # VL    V2,X'0B0'(R9)
+r 338=E61200002056                      # VCLFNH V1,V2,2,0
+r 33E=B29CA170                          # STFPC X'170'(R10)
+r 342=E710A160000E                      # VST   V1,X'160'(R10)
+r 348=B29D0FE4                          # LFPC  X'FE4'         clear FPC
+r 34C=E72090C00006                      # VL    V2,X'0C0'(R9)
+r 352=E6120000205E                      # VCLFNL V1,V2,2,0
+r 358=B29CA190                          # STFPC X'190'(R10)
+r 35C=E710A180000E                      # VST   V1,X'180'(R10)
+r 362=B29D0FE4                          # LFPC  X'FE4'         clear FPC
+r 366=E72090D00006                      # VL    V2,X'0D0'(R9)
+r 36C=E61200002056                      # VCLFNH V1,V2,2,0
+r 372=B29CA1B0                          # STFPC X'1B0'(R10)
+r 376=E710A1A0000E                      # VST   V1,X'1A0'(R10)
+r 37C=B29D0FE4                          # LFPC  X'FE4'         clear FPC
+r 380=E72090E00006                      # VL    V2,X'0E0'(R9)
+r 386=E6120000205E                      # VCLFNL V1,V2,2,0
+r 38C=B29CA1D0                          # STFPC X'1D0'(R10)
+r 390=E710A1C0000E                      # VST   V1,X'1C0'(R10)
+r 396=B29D0FE4                          # LFPC  X'FE4'         clear FPC
+r 39A=E72090F00006                      # VL    V2,X'0F0'(R9)
+r 3A0=E61200002056                      # VCLFNH V1,V2,2,0
+r 3A6=B29CA1F0                          # STFPC X'1F0'(R10)
+r 3AA=E710A1E0000E                      # VST   V1,X'1E0'(R10)
+r 3B0=B29D0FE4                          # LFPC  X'FE4'         clear FPC
+r 3B4=E72091000006                      # VL    V2,X'100'(R9)
+r 3BA=E6120000205E                      # VCLFNL V1,V2,2,0
+r 3C0=B29CA210                          # STFPC X'210'(R10)
+r 3C4=E710A200000E                      # VST   V1,X'200'(R10)
+r 3CA=B29D0FE4                          # LFPC  X'FE4'         clear FPC
+r 3CE=E72091100006                      # VL    V2,X'110'(R9)
+r 3D4=E73091200006                      # VL    V3,X'120'(R9)
+r 3DA=E61230020075                      # VCRNF V1,V2,V3,0,2
+r 3E0=B29CA230                          # STFPC X'230'(R10)
+r 3E4=E710A220000E                      # VST   V1,X'220'(R10)
+r 3EA=B29D0FE4                          # LFPC  X'FE4'         clear FPC
+r 3EE=E72091300006                      # VL    V2,X'130'(R9)
+r 3F4=E73091400006                      # VL    V3,X'140'(R9)
+r 3FA=E61230020075                      # VCRNF V1,V2,V3,0,2
+r 400=B29CA250                          # STFPC X'250'(R10)
+r 404=E710A240000E                      # VST   V1,X'240'(R10)
+r 40A=B29D0FE4                          # LFPC  X'FE4'         clear FPC
+r 40E=E72091500006                      # VL    V2,X'150'(R9)
+r 414=E73091600006                      # VL    V3,X'160'(R9)
+r 41A=E61230020075                      # VCRNF V1,V2,V3,0,2
+r 420=B29CA270                          # STFPC X'270'(R10)
+r 424=E710A260000E                      # VST   V1,X'260'(R10)
+r 42A=B29D0FE4                          # LFPC  X'FE4'         clear FPC
+r 42E=E72091700006                      # VL    V2,X'170'(R9)
+r 434=E73091800006                      # VL    V3,X'180'(R9)
+r 43A=E61230020075                      # VCRNF V1,V2,V3,0,2
+r 440=B29CA290                          # STFPC X'290'(R10)
+r 444=E710A280000E                      # VST   V1,X'280'(R10)
+r 44A=B29D0FE4                          # LFPC  X'FE4'         clear FPC
+r 44E=E72091900006                      # VL    V2,X'190'(R9)
+r 454=E73091A00006                      # VL    V3,X'1A0'(R9)
+r 45A=E61230020075                      # VCRNF V1,V2,V3,0,2
+r 460=B29CA2B0                          # STFPC X'2B0'(R10)
+r 464=E710A2A0000E                      # VST   V1,X'2A0'(R10)
+r 46A=B29D0FE4                          # LFPC  X'FE4'         clear FPC
+r 46E=E72091B00006                      # VL    V2,X'1B0'(R9)
+r 474=E73091C00006                      # VL    V3,X'1C0'(R9)
+r 47A=E61230020075                      # VCRNF V1,V2,V3,0,2
+r 480=B29CA2D0                          # STFPC X'2D0'(R10)
+r 484=E710A2C0000E                      # VST   V1,X'2C0'(R10)
+r 48A=B29D0FE4                          # LFPC  X'FE4'         clear FPC
+r 48E=E72091D00006                      # VL    V2,X'1D0'(R9)
+r 494=E73091E00006                      # VL    V3,X'1E0'(R9)
+r 49A=E61230020075                      # VCRNF V1,V2,V3,0,2
+r 4A0=B29CA2F0                          # STFPC X'2F0'(R10)
+r 4A4=E710A2E0000E                      # VST   V1,X'2E0'(R10)
+r 4AA=B2B20FF0                          # LPSWE X'FF0'         disabled wait
+
+r FE0=00060000                          # CR0: AFP and vector enabled
+r FE4=00000000                          # FPC
+
+r 1000=7BFFFBFF040084003C003C017BFE3FFF # VCNF top and carry
+r 1010=00008000000080000000800000008000 # VCNF zeros
+r 1020=800000003C00BC00000080007BFF0401 # VCNF zero and normal
+r 1030=3C0000017BFF80003C01BC0004008400 # VCNF subnormal
+r 1040=3C003C017C000000FE00800004007BFF # VCNF inf and nan
+r 1050=22005DFFA200DDFF3E00BE0122015DFE # VCFN range ends
+r 1060=00008000800000000000000080008000 # VCFN zeros
+r 1070=3E007FFF220080005DFFFFFF00003E01 # VCFN top exponent
+r 1080=3E005E00220021FF5DFF000080007FFE # VCFN out of range
+r 1090=3E005E002200A2005DFF00008000DDFF # VCFN just above
+r 10A0=3E005DFF2200A1FF5DFF00008000DDFF # VCFN just below
+r 10B0=7FFE0001000080003E00FFFE80013E01 # VCLFNH finite
+r 10C0=7FFE0001000080003E00FFFE80013E01 # VCLFNL finite
+r 10D0=3E007FFF000080003E003E0100008000 # VCLFNH top high
+r 10E0=3E007FFF000080003E003E0100008000 # VCLFNL top high
+r 10F0=3E003E0100008000FFFF3E0000008000 # VCLFNH top low
+r 1100=3E003E0100008000FFFF3E0000008000 # VCLFNL top low
+r 1110=3F800000BF8000003F7FFFFF30000000 # VCRNF normal
+r 1120=00000000800000004FFF0000CFFF0000
+r 1130=4FFF80003F8000000000000080000000 # VCRNF top exponent
+r 1140=3F8000004FFF7FFF4FFFC000CFFF8000
+r 1150=3F7FE0003F7FDFFFBF7FE000307FE000 # VCRNF carry
+r 1160=3F8000003F8040003F803FFF4F7FE000
+r 1170=3F8000004FFFE000BF8000004FFFDFFF # VCRNF round past top
+r 1180=3F800000BF8000003F800000BF800000
+r 1190=00000000800000000000000080000000 # VCRNF zeros
+r 11A0=80000000000000008000000000000000
+r 11B0=3F800000000000013F8000007F800000 # VCRNF mixed v2
+r 11C0=3F800000BF8000003F800000BF800000
+r 11D0=3F800000BF8000003F800000BF800000 # VCRNF mixed v3
+r 11E0=500000002F8000007FC000003F800000
+
+runtest .1
+
+*Compare
+r 2000.10
+*Want "VCNF top and carry" 5E00DE00 2200A200 3E003E01 5DFF4000
+r 2010.4
+*Want "VCNF top and carry FPC" 00000000
+r 2020.10
+*Want "VCNF zeros" 00008000 00008000 00008000 00008000
+r 2030.4
+*Want "VCNF zeros FPC" 00000000
+r 2040.10
+*Want "VCNF zero and normal" 80000000 3E00BE00 00008000 5E002201
+r 2050.4
+*Want "VCNF zero and normal FPC" 00000000
+r 2060.10
+*Want "VCNF subnormal" 3E000E00 5E008000 3E01BE00 2200A200
+r 2070.4
+*Want "VCNF subnormal FPC" 00000000
+r 2080.10
+*Want "VCNF inf and nan" 3E003E01 7FFF0000 FFFF8000 22005E00
+r 2090.4
+*Want "VCNF inf and nan FPC" 00000000
+r 20A0.10
+*Want "VCFN range ends" 04007BFE 8400FBFE 3C00BC02 04027BFC
+r 20B0.4
+*Want "VCFN range ends FPC" 00000000
+r 20C0.10
+*Want "VCFN zeros" 00008000 80000000 00000000 80008000
+r 20D0.4
+*Want "VCFN zeros FPC" 00000000
+r 20E0.10
+*Want "VCFN top exponent" 3C007E00 04008000 7BFEFE00 00003C02
+r 20F0.4
+*Want "VCFN top exponent FPC" 00805100
+r 2100.10
+*Want "VCFN out of range" 3C007C00 040003FF 7BFE0000 80007C00
+r 2110.4
+*Want "VCFN out of range FPC" 00207300
+r 2120.10
+*Want "VCFN just above" 3C007C00 04008400 7BFE0000 8000FBFE
+r 2130.4
+*Want "VCFN just above FPC" 00201300
+r 2140.10
+*Want "VCFN just below" 3C007BFE 040083FF 7BFE0000 8000FBFE
+r 2150.4
+*Want "VCFN just below FPC" 00000000
+r 2160.10
+*Want "VCLFNH finite" 4FFF8000 30004000 00000000 80000000
+r 2170.4
+*Want "VCLFNH finite FPC" 00000000
+r 2180.10
+*Want "VCLFNL finite" 3F800000 CFFF8000 B0004000 3F804000
+r 2190.4
+*Want "VCLFNL finite FPC" 00000000
+r 21A0.10
+*Want "VCLFNH top high" 3F800000 7FC00000 00000000 80000000
+r 21B0.4
+*Want "VCLFNH top high FPC" 00801100
+r 21C0.10
+*Want "VCLFNL top high" 3F800000 3F804000 00000000 80000000
+r 21D0.4
+*Want "VCLFNL top high FPC" 00000000
+r 21E0.10
+*Want "VCLFNH top low" 3F800000 3F804000 00000000 80000000
+r 21F0.4
+*Want "VCLFNH top low FPC" 00000000
+r 2200.10
+*Want "VCLFNL top low" FFC00000 3F800000 00000000 80000000
+r 2210.4
+*Want "VCLFNL top low FPC" 00804100
+r 2220.10
+*Want "VCRNF normal" 3E00BE00 3E000000 00008000 7FFCFFFC
+r 2230.4
+*Want "VCRNF normal FPC" 00000000
+r 2240.10
+*Want "VCRNF top exponent" 7FFE3E00 00008000 3E007FFE 7FFFFFFE
+r 2250.4
+*Want "VCRNF top exponent FPC" 00000000
+r 2260.10
+*Want "VCRNF carry" 3E003DFF BE000200 3E003E01 3E017E00
+r 2270.4
+*Want "VCRNF carry FPC" 00000000
+r 2280.10
+*Want "VCRNF round past top" 3E007FFE BE007FFF 3E00BE00 3E00BE00
+r 2290.4
+*Want "VCRNF round past top FPC" 00201300
+r 22A0.10
+*Want "VCRNF zeros" 00008000 00008000 80000000 80000000
+r 22B0.4
+*Want "VCRNF zeros FPC" 00000000
+r 22C0.10
+*Want "VCRNF mixed v2" 3E000000 3E007FFF 3E00BE00 3E00BE00
+r 22D0.4
+*Want "VCRNF mixed v2 FPC" 00101400
+r 22E0.10
+*Want "VCRNF mixed v3" 3E00BE00 3E00BE00 7FFE0000 7FFF3E00
+r 22F0.4
+*Want "VCRNF mixed v3 FPC" 00305400
+
+*Done
@@ -0,0 +1,456 @@
+*Testcase vector-sse: SSE paths of the element-wise vector instructions
+
+* Each case runs one VA, VS, logical, VSEL, VPERM, VCEQ, VCH, VCHL,
+* VREP, VMRH, VMRL, VSUM, VSUMG or element shift instruction for the
+* element sizes that use SSE with FEATURE_V128_SSE. It stores V1 at
+* X'1000' + 16 * case and, for the compares, the condition code from
+* IPM at X'1800' + 4 * case. V2 and V3 mix signs and carries across
+* element boundaries, V4 is a select and permute mask, V5 a permute
+* index with bit X'10' set in some bytes and V6 is all ones, the
+* largest input for VSUM and VSUMG.
+* The expected values were taken from the scalar build.
+
+sysclear
+archlvl z/Arch
+
+r 1a0=00000001800000000000000000000200  # z/Arch restart PSW
+r 1d0=0002000180000000000000000000DEAD  # z/Arch pgm new PSW
+r 6E0=00020001800000000000000000000000  # z/Arch disabled wait PSW
+r 6F0=00060000                          # CR0 AFP and vector enable
+
+r 200=B70006F0                          # LCTL  R0,R0,X'6F0'
+r 204=C09100001000                      # LGFI  R9,X'1000'    results
+r 20A=E72007000006                      # VL    V2,X'700'
+r 210=E73007100006                      # VL    V3,X'710'
+r 216=E74007200006                      # VL    V4,X'720'
+r 21C=E75007300006                      # VL    V5,X'730'
+r 222=E76007400006                      # VL    V6,X'740'
+r 228=E712300000F3                      # VAB
+r 22E=E7109000000E                      # VST   V1,X'0'(R9)
+r 234=E712300010F3                      # VAH
+r 23A=E7109010000E                      # VST   V1,X'10'(R9)
+r 240=E712300020F3                      # VAF
+r 246=E7109020000E                      # VST   V1,X'20'(R9)
+r 24C=E712300030F3                      # VAG
+r 252=E7109030000E                      # VST   V1,X'30'(R9)
+r 258=E712300000F7                      # VSB
+r 25E=E7109040000E                      # VST   V1,X'40'(R9)
+r 264=E712300010F7                      # VSH
+r 26A=E7109050000E                      # VST   V1,X'50'(R9)
+r 270=E712300020F7                      # VSF
+r 276=E7109060000E                      # VST   V1,X'60'(R9)
+r 27C=E712300030F7                      # VSG
+r 282=E7109070000E                      # VST   V1,X'70'(R9)
+r 288=E71230000068                      # VN
+r 28E=E7109080000E                      # VST   V1,X'80'(R9)
+r 294=E71230000069                      # VNC
+r 29A=E7109090000E                      # VST   V1,X'90'(R9)
+r 2A0=E7123000006A                      # VO
+r 2A6=E71090A0000E                      # VST   V1,X'A0'(R9)
+r 2AC=E7123000006B                      # VNO
+r 2B2=E71090B0000E                      # VST   V1,X'B0'(R9)
+r 2B8=E7123000006C                      # VNX
+r 2BE=E71090C0000E                      # VST   V1,X'C0'(R9)
+r 2C4=E7123000006D                      # VX
+r 2CA=E71090D0000E                      # VST   V1,X'D0'(R9)
+r 2D0=E7123000006E                      # VNN
+r 2D6=E71090E0000E                      # VST   V1,X'E0'(R9)
+r 2DC=E7123000006F                      # VOC
+r 2E2=E71090F0000E                      # VST   V1,X'F0'(R9)
+r 2E8=E7123000408D                      # VSEL
+r 2EE=E7109100000E                      # VST   V1,X'100'(R9)
+r 2F4=E7123000408C                      # VPERM
+r 2FA=E7109110000E                      # VST   V1,X'110'(R9)
+r 300=E7123000508C                      # VPERM index bit X'10'
+r 306=E7109120000E                      # VST   V1,X'120'(R9)
+r 30C=E712301000F8                      # VCEQBS unequal
+r 312=E7109130000E                      # VST   V1,X'130'(R9)
+r 318=B2220010                          # IPM   R1
+r 31C=5010984C                          # ST    R1,X'84C'(R9)
+r 320=E712201000F8                      # VCEQBS equal
+r 326=E7109140000E                      # VST   V1,X'140'(R9)
+r 32C=B2220010                          # IPM   R1
+r 330=50109850                          # ST    R1,X'850'(R9)
+r 334=E712301000FB                      # VCHBS
+r 33A=E7109150000E                      # VST   V1,X'150'(R9)
+r 340=B2220010                          # IPM   R1
+r 344=50109854                          # ST    R1,X'854'(R9)
+r 348=E713201000FB                      # VCHBS reversed
+r 34E=E7109160000E                      # VST   V1,X'160'(R9)
+r 354=B2220010                          # IPM   R1
+r 358=50109858                          # ST    R1,X'858'(R9)
+r 35C=E712301000F9                      # VCHLBS
+r 362=E7109170000E                      # VST   V1,X'170'(R9)
+r 368=B2220010                          # IPM   R1
+r 36C=5010985C                          # ST    R1,X'85C'(R9)
+r 370=E713201000F9                      # VCHLBS reversed
+r 376=E7109180000E                      # VST   V1,X'180'(R9)
+r 37C=B2220010                          # IPM   R1
+r 380=50109860                          # ST    R1,X'860'(R9)
+r 384=E712601000F9                      # VCHLBS none
+r 38A=E7109190000E                      # VST   V1,X'190'(R9)
+r 390=B2220010                          # IPM   R1
+r 394=50109864                          # ST    R1,X'864'(R9)
+r 398=E712301010F8                      # VCEQHS unequal
+r 39E=E71091A0000E                      # VST   V1,X'1A0'(R9)
+r 3A4=B2220010                          # IPM   R1
+r 3A8=50109868                          # ST    R1,X'868'(R9)
+r 3AC=E712201010F8                      # VCEQHS equal
+r 3B2=E71091B0000E                      # VST   V1,X'1B0'(R9)
+r 3B8=B2220010                          # IPM   R1
+r 3BC=5010986C                          # ST    R1,X'86C'(R9)
+r 3C0=E712301010FB                      # VCHHS
+r 3C6=E71091C0000E                      # VST   V1,X'1C0'(R9)
+r 3CC=B2220010                          # IPM   R1
+r 3D0=50109870                          # ST    R1,X'870'(R9)
+r 3D4=E713201010FB                      # VCHHS reversed
+r 3DA=E71091D0000E                      # VST   V1,X'1D0'(R9)
+r 3E0=B2220010                          # IPM   R1
+r 3E4=50109874                          # ST    R1,X'874'(R9)
+r 3E8=E712301010F9                      # VCHLHS
+r 3EE=E71091E0000E                      # VST   V1,X'1E0'(R9)
+r 3F4=B2220010                          # IPM   R1
+r 3F8=50109878                          # ST    R1,X'878'(R9)
+r 3FC=E713201010F9                      # VCHLHS reversed
+r 402=E71091F0000E                      # VST   V1,X'1F0'(R9)
+r 408=B2220010                          # IPM   R1
+r 40C=5010987C                          # ST    R1,X'87C'(R9)
+r 410=E712601010F9                      # VCHLHS none
+r 416=E7109200000E                      # VST   V1,X'200'(R9)
+r 41C=B2220010                          # IPM   R1
+r 420=50109880                          # ST    R1,X'880'(R9)
+r 424=E712301020F8                      # VCEQFS unequal
+r 42A=E7109210000E                      # VST   V1,X'210'(R9)
+r 430=B2220010                          # IPM   R1
+r 434=50109884                          # ST    R1,X'884'(R9)
+r 438=E712201020F8                      # VCEQFS equal
+r 43E=E7109220000E                      # VST   V1,X'220'(R9)
+r 444=B2220010                          # IPM   R1
+r 448=50109888                          # ST    R1,X'888'(R9)
+r 44C=E712301020FB                      # VCHFS
+r 452=E7109230000E                      # VST   V1,X'230'(R9)
+r 458=B2220010                          # IPM   R1
+r 45C=5010988C                          # ST    R1,X'88C'(R9)
+r 460=E713201020FB                      # VCHFS reversed
+r 466=E7109240000E                      # VST   V1,X'240'(R9)
+r 46C=B2220010                          # IPM   R1
+r 470=50109890                          # ST    R1,X'890'(R9)
+r 474=E712301020F9                      # VCHLFS
+r 47A=E7109250000E                      # VST   V1,X'250'(R9)
+r 480=B2220010                          # IPM   R1
+r 484=50109894                          # ST    R1,X'894'(R9)
+r 488=E713201020F9                      # VCHLFS reversed
+r 48E=E7109260000E                      # VST   V1,X'260'(R9)
+r 494=B2220010                          # IPM   R1
+r 498=50109898                          # ST    R1,X'898'(R9)
+r 49C=E712601020F9                      # VCHLFS none
+r 4A2=E7109270000E                      # VST   V1,X'270'(R9)
+r 4A8=B2220010                          # IPM   R1
+r 4AC=5010989C                          # ST    R1,X'89C'(R9)
+r 4B0=E712301030F8                      # VCEQGS unequal
+r 4B6=E7109280000E                      # VST   V1,X'280'(R9)
+r 4BC=B2220010                          # IPM   R1
+r 4C0=501098A0                          # ST    R1,X'8A0'(R9)
+r 4C4=E712201030F8                      # VCEQGS equal
+r 4CA=E7109290000E                      # VST   V1,X'290'(R9)
+r 4D0=B2220010                          # IPM   R1
+r 4D4=501098A4                          # ST    R1,X'8A4'(R9)
+r 4D8=E712301030FB                      # VCHGS
+r 4DE=E71092A0000E                      # VST   V1,X'2A0'(R9)
+r 4E4=B2220010                          # IPM   R1
+r 4E8=501098A8                          # ST    R1,X'8A8'(R9)
+r 4EC=E713201030FB                      # VCHGS reversed
+r 4F2=E71092B0000E                      # VST   V1,X'2B0'(R9)
+r 4F8=B2220010                          # IPM   R1
+r 4FC=501098AC                          # ST    R1,X'8AC'(R9)
+r 500=E712301030F9                      # VCHLGS
+r 506=E71092C0000E                      # VST   V1,X'2C0'(R9)
+r 50C=B2220010                          # IPM   R1
+r 510=501098B0                          # ST    R1,X'8B0'(R9)
+r 514=E713201030F9                      # VCHLGS reversed
+r 51A=E71092D0000E                      # VST   V1,X'2D0'(R9)
+r 520=B2220010                          # IPM   R1
+r 524=501098B4                          # ST    R1,X'8B4'(R9)
+r 528=E712601030F9                      # VCHLGS none
+r 52E=E71092E0000E                      # VST   V1,X'2E0'(R9)
+r 534=B2220010                          # IPM   R1
+r 538=501098B8                          # ST    R1,X'8B8'(R9)
+r 53C=E7130001004D                      # VREPB
+r 542=E71092F0000E                      # VST   V1,X'2F0'(R9)
+r 548=E7130002104D                      # VREPH
+r 54E=E7109300000E                      # VST   V1,X'300'(R9)
+r 554=E7130003204D                      # VREPF
+r 55A=E7109310000E                      # VST   V1,X'310'(R9)
+r 560=E7130000304D                      # VREPG
+r 566=E7109320000E                      # VST   V1,X'320'(R9)
+r 56C=E71230000061                      # VMRHB
+r 572=E7109330000E                      # VST   V1,X'330'(R9)
+r 578=E71230000060                      # VMRLB
+r 57E=E7109340000E                      # VST   V1,X'340'(R9)
+r 584=E71230001061                      # VMRHH
+r 58A=E7109350000E                      # VST   V1,X'350'(R9)
+r 590=E71230001060                      # VMRLH
+r 596=E7109360000E                      # VST   V1,X'360'(R9)
+r 59C=E71230002061                      # VMRHF
+r 5A2=E7109370000E                      # VST   V1,X'370'(R9)
+r 5A8=E71230002060                      # VMRLF
+r 5AE=E7109380000E                      # VST   V1,X'380'(R9)
+r 5B4=E71230003061                      # VMRHG
+r 5BA=E7109390000E                      # VST   V1,X'390'(R9)
+r 5C0=E71230003060                      # VMRLG
+r 5C6=E71093A0000E                      # VST   V1,X'3A0'(R9)
+r 5CC=E71230000064                      # VSUMB
+r 5D2=E71093B0000E                      # VST   V1,X'3B0'(R9)
+r 5D8=E71230001064                      # VSUMH
+r 5DE=E71093C0000E                      # VST   V1,X'3C0'(R9)
+r 5E4=E71230001065                      # VSUMGH
+r 5EA=E71093D0000E                      # VST   V1,X'3D0'(R9)
+r 5F0=E71230002065                      # VSUMGF
+r 5F6=E71093E0000E                      # VST   V1,X'3E0'(R9)
+r 5FC=E71660000064                      # VSUMB all ones
+r 602=E71093F0000E                      # VST   V1,X'3F0'(R9)
+r 608=E71660001064                      # VSUMH all ones
+r 60E=E7109400000E                      # VST   V1,X'400'(R9)
+r 614=E71660001065                      # VSUMGH all ones
+r 61A=E7109410000E                      # VST   V1,X'410'(R9)
+r 620=E71660002065                      # VSUMGF all ones
+r 626=E7109420000E                      # VST   V1,X'420'(R9)
+r 62C=E713000D1030                      # VESLH
+r 632=E7109430000E                      # VST   V1,X'430'(R9)
+r 638=E713000D1038                      # VESRLH
+r 63E=E7109440000E                      # VST   V1,X'440'(R9)
+r 644=E713000D103A                      # VESRAH
+r 64A=E7109450000E                      # VST   V1,X'450'(R9)
+r 650=E71300152030                      # VESLF
+r 656=E7109460000E                      # VST   V1,X'460'(R9)
+r 65C=E71300152038                      # VESRLF
+r 662=E7109470000E                      # VST   V1,X'470'(R9)
+r 668=E7130015203A                      # VESRAF
+r 66E=E7109480000E                      # VST   V1,X'480'(R9)
+r 674=E713001D3030                      # VESLG
+r 67A=E7109490000E                      # VST   V1,X'490'(R9)
+r 680=E713001D3038                      # VESRLG
+r 686=E71094A0000E                      # VST   V1,X'4A0'(R9)
+r 68C=E713001D303A                      # VESRAG
+r 692=E71094B0000E                      # VST   V1,X'4B0'(R9)
+r 698=B2B206E0                          # LPSWE X'6E0'
+
+r 700=FFFFFFFF80007FFF0001FFFE8123F567  # V2
+r 710=0000000180017FFE0001000180007F67  # V3
+r 720=001F100F31E58A7B1203FF2011C84E16  # V4 select and permute mask
+r 730=10111213F0F1F2F31F1E1D1C00010203  # V5 permute index
+r 740=FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF  # V6 all ones
+
+runtest 1
+
+*Compare
+r 1000.10
+*Want "VAB" FFFFFF00 0001FEFD 0002FFFF 012374CE
+r 1010.10
+*Want "VAH" FFFF0000 0001FFFD 0002FFFF 012374CE
+r 1020.10
+*Want "VAF" 00000000 0001FFFD 0002FFFF 012474CE
+r 1030.10
+*Want "VAG" 00000001 0001FFFD 00030000 012474CE
+r 1040.10
+*Want "VSB" FFFFFFFE 00FF0001 0000FFFD 01237600
+r 1050.10
+*Want "VSH" FFFFFFFE FFFF0001 0000FFFD 01237600
+r 1060.10
+*Want "VSF" FFFFFFFE FFFF0001 0000FFFD 01237600
+r 1070.10
+*Want "VSG" FFFFFFFD FFFF0001 0000FFFD 01237600
+r 1080.10
+*Want "VN" 00000001 80007FFE 00010000 80007567
+r 1090.10
+*Want "VNC" FFFFFFFE 00000001 0000FFFE 01238000
+r 10A0.10
+*Want "VO" FFFFFFFF 80017FFF 0001FFFF 8123FF67
+r 10B0.10
+*Want "VNO" 00000000 7FFE8000 FFFE0000 7EDC0098
+r 10C0.10
+*Want "VNX" 00000001 FFFEFFFE FFFF0000 FEDC75FF
+r 10D0.10
+*Want "VX" FFFFFFFE 00010001 0000FFFF 01238A00
+r 10E0.10
+*Want "VNN" FFFFFFFE 7FFF8001 FFFEFFFF 7FFF8A98
+r 10F0.10
+*Want "VOC" FFFFFFFF FFFEFFFF FFFFFFFE FFFFF5FF
+r 1100.10
+*Want "VSEL" 001F100F 80007FFF 0001FF21 81007567
+r 1110.10
+*Want "VPERM" FF670067 0000FF01 00FF67FF 0000F57F
+r 1120.10
+*Want "VPERM index bit X'10'" 00000001 00000001 677F0080 FFFFFFFF
+r 1130.10
+*Want "VCEQBS unequal" 00000000 FF00FF00 FFFF0000 000000FF
+r 184C.4
+*Want "VCEQBS unequal cc" 10000000
+r 1140.10
+*Want "VCEQBS equal" FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF
+r 1850.4
+*Want "VCEQBS equal cc" 00000000
+r 1150.10
+*Want "VCHBS" 00000000 000000FF 00000000 FFFF0000
+r 1854.4
+*Want "VCHBS cc" 10000000
+r 1160.10
+*Want "VCHBS reversed" FFFFFFFF 00FF0000 0000FFFF 0000FF00
+r 1858.4
+*Want "VCHBS reversed cc" 10000000
+r 1170.10
+*Want "VCHLBS" FFFFFFFF 000000FF 0000FFFF FFFFFF00
+r 185C.4
+*Want "VCHLBS cc" 10000000
+r 1180.10
+*Want "VCHLBS reversed" 00000000 00FF0000 00000000 00000000
+r 1860.4
+*Want "VCHLBS reversed cc" 10000000
+r 1190.10
+*Want "VCHLBS none" 00000000 00000000 00000000 00000000
+r 1864.4
+*Want "VCHLBS none cc" 30000000
+r 11A0.10
+*Want "VCEQHS unequal" 00000000 00000000 FFFF0000 00000000
+r 1868.4
+*Want "VCEQHS unequal cc" 10000000
+r 11B0.10
+*Want "VCEQHS equal" FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF
+r 186C.4
+*Want "VCEQHS equal cc" 00000000
+r 11C0.10
+*Want "VCHHS" 00000000 0000FFFF 00000000 FFFF0000
+r 1870.4
+*Want "VCHHS cc" 10000000
+r 11D0.10
+*Want "VCHHS reversed" FFFFFFFF FFFF0000 0000FFFF 0000FFFF
+r 1874.4
+*Want "VCHHS reversed cc" 10000000
+r 11E0.10
+*Want "VCHLHS" FFFFFFFF 0000FFFF 0000FFFF FFFFFFFF
+r 1878.4
+*Want "VCHLHS cc" 10000000
+r 11F0.10
+*Want "VCHLHS reversed" 00000000 FFFF0000 00000000 00000000
+r 187C.4
+*Want "VCHLHS reversed cc" 10000000
+r 1200.10
+*Want "VCHLHS none" 00000000 00000000 00000000 00000000
+r 1880.4
+*Want "VCHLHS none cc" 30000000
+r 1210.10
+*Want "VCEQFS unequal" 00000000 00000000 00000000 00000000
+r 1884.4
+*Want "VCEQFS unequal cc" 30000000
+r 1220.10
+*Want "VCEQFS equal" FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF
+r 1888.4
+*Want "VCEQFS equal cc" 00000000
+r 1230.10
+*Want "VCHFS" 00000000 00000000 FFFFFFFF FFFFFFFF
+r 188C.4
+*Want "VCHFS cc" 10000000
+r 1240.10
+*Want "VCHFS reversed" FFFFFFFF FFFFFFFF 00000000 00000000
+r 1890.4
+*Want "VCHFS reversed cc" 10000000
+r 1250.10
+*Want "VCHLFS" FFFFFFFF 00000000 FFFFFFFF FFFFFFFF
+r 1894.4
+*Want "VCHLFS cc" 10000000
+r 1260.10
+*Want "VCHLFS reversed" 00000000 FFFFFFFF 00000000 00000000
+r 1898.4
+*Want "VCHLFS reversed cc" 10000000
+r 1270.10
+*Want "VCHLFS none" 00000000 00000000 00000000 00000000
+r 189C.4
+*Want "VCHLFS none cc" 30000000
+r 1280.10
+*Want "VCEQGS unequal" 00000000 00000000 00000000 00000000
+r 18A0.4
+*Want "VCEQGS unequal cc" 30000000
+r 1290.10
+*Want "VCEQGS equal" FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF
+r 18A4.4
+*Want "VCEQGS equal cc" 00000000
+r 12A0.10
+*Want "VCHGS" 00000000 00000000 FFFFFFFF FFFFFFFF
+r 18A8.4
+*Want "VCHGS cc" 10000000
+r 12B0.10
+*Want "VCHGS reversed" FFFFFFFF FFFFFFFF 00000000 00000000
+r 18AC.4
+*Want "VCHGS reversed cc" 10000000
+r 12C0.10
+*Want "VCHLGS" FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF
+r 18B0.4
+*Want "VCHLGS cc" 00000000
+r 12D0.10
+*Want "VCHLGS reversed" 00000000 00000000 00000000 00000000
+r 18B4.4
+*Want "VCHLGS reversed cc" 30000000
+r 12E0.10
+*Want "VCHLGS none" 00000000 00000000 00000000 00000000
+r 18B8.4
+*Want "VCHLGS none cc" 30000000
+r 12F0.10
+*Want "VREPB" 00000000 00000000 00000000 00000000
+r 1300.10
+*Want "VREPH" 80018001 80018001 80018001 80018001
+r 1310.10
+*Want "VREPF" 80007F67 80007F67 80007F67 80007F67
+r 1320.10
+*Want "VREPG" 00000001 80017FFE 00000001 80017FFE
+r 1330.10
+*Want "VMRHB" FF00FF00 FF00FF01 80800001 7F7FFFFE
+r 1340.10
+*Want "VMRLB" 00000101 FF00FE01 81802300 F57F6767
+r 1350.10
+*Want "VMRHH" FFFF0000 FFFF0001 80008001 7FFF7FFE
+r 1360.10
+*Want "VMRLH" 00010001 FFFE0001 81238000 F5677F67
+r 1370.10
+*Want "VMRHF" FFFFFFFF 00000001 80007FFF 80017FFE
+r 1380.10
+*Want "VMRLF" 0001FFFE 00010001 8123F567 80007F67
+r 1390.10
+*Want "VMRHG" FFFFFFFF 80007FFF 00000001 80017FFE
+r 13A0.10
+*Want "VMRLG" 0001FFFE 8123F567 00010001 80007F67
+r 13B0.10
+*Want "VSUMB" 000003FD 000002FC 000001FF 00000267
+r 13C0.10
+*Want "VSUMH" 0001FFFF 00017FFD 00010000 0001F5F1
+r 13D0.10
+*Want "VSUMGH" 00000000 00037FFB 00000000 0002F5F0
+r 13E0.10
+*Want "VSUMGF" 00000002 0001FFFC 00000001 012674CC
+r 13F0.10
+*Want "VSUMB all ones" 000004FB 000004FB 000004FB 000004FB
+r 1400.10
+*Want "VSUMH all ones" 0002FFFD 0002FFFD 0002FFFD 0002FFFD
+r 1410.10
+*Want "VSUMGH all ones" 00000000 0004FFFB 00000000 0004FFFB
+r 1420.10
+*Want "VSUMGF all ones" 00000002 FFFFFFFD 00000002 FFFFFFFD
+r 1430.10
+*Want "VESLH" 00002000 2000C000 20002000 0000E000
+r 1440.10
+*Want "VESRLH" 00000000 00040003 00000000 00040003
+r 1450.10
+*Want "VESRAH" 00000000 FFFC0003 00000000 FFFC0003
+r 1460.10
+*Want "VESLF" 00200000 FFC00000 00200000 ECE00000
+r 1470.10
+*Want "VESRLF" 00000000 00000400 00000000 00000400
+r 1480.10
+*Want "VESRAF" 00000000 FFFFFC00 00000000 FFFFFC00
+r 1490.10
+*Want "VESLG" 30002FFF C0000000 30000FEC E0000000
+r 14A0.10
+*Want "VESRLG" 00000000 0000000C 00000000 0008000C
+r 14B0.10
+*Want "VESRAG" 00000000 0000000C 00000000 0008000C
+
+*Done
@@ -0,0 +1,116 @@
+*Testcase vector-strings: VSTRC and VFAE element sizes and flags
+
+* Each case runs one VSTRC or VFAE with V2 holding a short string,
+* V3 the ranges or characters to find and V4 the range controls,
+* then stores V1 at 500 and the condition code from IPM at 600.
+* The ranges are A-Z, 0-9 and X'81'-X'FE' (logical compares).
+
+sysclear
+archlvl z/Arch
+
+r 1a0=00000001800000000000000000000200  # z/Arch restart PSW
+r 1d0=0002000180000000000000000000DEAD  # z/Arch pgm new PSW
+r 3e0=00020001800000000000000000000000  # z/Arch disabled wait PSW
+r 3f0=00060000                          # CR0 AFP and vector enable
+
+r 200=B70003F0                          # LCTL  R0,R0,X'3F0'
+r 204=E72004000006                      # VL    V2,X'400'
+r 20A=E73004100006                      # VL    V3,X'410'
+r 210=E74004200006                      # VL    V4,X'420'
+r 216=E7123010408A                      # VSTRCBS   ranges, index
+r 21C=E7100500000E                      # VST   V1,X'500'
+r 222=B2220010                          # IPM   R1
+r 226=50100600                          # ST    R1,X'600'
+r 22A=E7123030408A                      # VSTRCZBS  ranges, zero search
+r 230=E7100510000E                      # VST   V1,X'510'
+r 236=B2220010                          # IPM   R1
+r 23A=50100604                          # ST    R1,X'604'
+r 23E=E7123050408A                      # VSTRCBS   ranges, result type
+r 244=E7100520000E                      # VST   V1,X'520'
+r 24A=B2220010                          # IPM   R1
+r 24E=50100608                          # ST    R1,X'608'
+r 252=E71230D0408A                      # VSTRCBS   inverted, result type
+r 258=E7100530000E                      # VST   V1,X'530'
+r 25E=B2220010                          # IPM   R1
+r 262=5010060C                          # ST    R1,X'60C'
+r 266=E7123110408A                      # VSTRCHS   ranges, index
+r 26C=E7100540000E                      # VST   V1,X'540'
+r 272=B2220010                          # IPM   R1
+r 276=50100610                          # ST    R1,X'610'
+r 27A=E7123170408A                      # VSTRCZHS  zero search, result type
+r 280=E7100550000E                      # VST   V1,X'550'
+r 286=B2220010                          # IPM   R1
+r 28A=50100614                          # ST    R1,X'614'
+r 28E=E7123210408A                      # VSTRCFS   ranges, index
+r 294=E7100560000E                      # VST   V1,X'560'
+r 29A=B2220010                          # IPM   R1
+r 29E=50100618                          # ST    R1,X'618'
+r 2A2=E71232B0408A                      # VSTRCZFS  inverted, zero search
+r 2A8=E7100570000E                      # VST   V1,X'570'
+r 2AE=B2220010                          # IPM   R1
+r 2B2=5010061C                          # ST    R1,X'61C'
+r 2B6=E71230100082                      # VFAEBS    any equal, index
+r 2BC=E7100580000E                      # VST   V1,X'580'
+r 2C2=B2220010                          # IPM   R1
+r 2C6=50100620                          # ST    R1,X'620'
+r 2CA=E71230300082                      # VFAEZBS   any equal, zero search
+r 2D0=E7100590000E                      # VST   V1,X'590'
+r 2D6=B2220010                          # IPM   R1
+r 2DA=50100624                          # ST    R1,X'624'
+r 2DE=E71230501082                      # VFAEHS    any equal, result type
+r 2E4=E71005A0000E                      # VST   V1,X'5A0'
+r 2EA=B2220010                          # IPM   R1
+r 2EE=50100628                          # ST    R1,X'628'
+r 2F2=E71230902082                      # VFAEFS    inverted, index
+r 2F8=E71005B0000E                      # VST   V1,X'5B0'
+r 2FE=B2220010                          # IPM   R1
+r 302=5010062C                          # ST    R1,X'62C'
+r 306=E71230B00082                      # VFAEZBS   inverted, zero search
+r 30C=E71005C0000E                      # VST   V1,X'5C0'
+r 312=B2220010                          # IPM   R1
+r 316=50100630                          # ST    R1,X'630'
+r 31A=B2B203E0                          # LPSWE X'3E0'
+
+r 400=2E627A2030395A41000080FE617F415A  # V2 string
+r 410=415A303980FE00000000000000000000  # V3 range bounds
+r 420=A0C0A0C0204000000000000000000000  # V4 range controls
+
+runtest 1
+
+*Compare
+r 500.10
+*Want "VSTRCBS ranges, index" 00000000 00000004 00000000 00000000
+r 510.10
+*Want "VSTRCZBS ranges, zero search" 00000000 00000004 00000000 00000000
+r 520.10
+*Want "VSTRCBS ranges, result type" 00000000 FFFFFFFF 00000000 0000FFFF
+r 530.10
+*Want "VSTRCBS inverted, result type" FFFFFFFF 00000000 FFFFFFFF FFFF0000
+r 540.10
+*Want "VSTRCHS ranges, index" 00000000 00000002 00000000 00000000
+r 550.10
+*Want "VSTRCZHS zero search, result type" 0000FFFF 0000FFFF 0000FFFF FFFFFFFF
+r 560.10
+*Want "VSTRCFS ranges, index" 00000000 00000010 00000000 00000000
+r 570.10
+*Want "VSTRCZFS inverted, zero search" 00000000 00000000 00000000 00000000
+r 580.10
+*Want "VFAEBS any equal, index" 00000000 00000004 00000000 00000000
+r 590.10
+*Want "VFAEZBS any equal, zero search" 00000000 00000004 00000000 00000000
+r 5A0.10
+*Want "VFAEHS any equal, result type" 00000000 FFFF0000 FFFFFFFF 0000FFFF
+r 5B0.10
+*Want "VFAEFS inverted, index" 00000000 00000000 00000000 00000000
+r 5C0.10
+*Want "VFAEZBS inverted, zero search" 00000000 00000000 00000000 00000000
+r 600.10
+*Want "cc 1-4" 10000000 20000000 10000000 10000000
+r 610.10
+*Want "cc 5-8" 10000000 20000000 30000000 10000000
+r 620.10
+*Want "cc 9-12" 10000000 20000000 10000000 10000000
+r 630.4
+*Want "cc 13-13" 20000000
+
+*Done
@@ -0,0 +1,156 @@
+*Testcase xc-mvcin-mvc: XC, MVCIN and MVC across page boundaries
+
+* XC of an operand with itself clears it and sets cc0, also when the
+* operand crosses a 4K boundary. MVCIN reverses operands of 16 bytes
+* or more and of odd lengths, also when both operands cross a page.
+* MVC with the destination one byte past the source propagates that
+* byte, also across a page boundary.
+
+sysclear
+archlvl z/Arch
+mainsize 1
+
+r 1a0=00000001800000000000000000000200  # z/Arch restart PSW
+r 1d0=0002000180000000000000000000DEAD  # z/Arch pgm new PSW
+
+r 200=C02100001F80                      # LGFI  R2,X'1F80'     XC operand
+r 206=41100001                          # LA    R1,1
+r 20A=1211                              # LTR   R1,R1          cc2
+r 20C=D7FF20002000                      # XC    0(256,R2),0(R2)
+r 212=B2220080                          # IPM   R8
+r 216=50800900                          # ST    R8,X'900'
+r 21A=C04100006F00                      # LGFI  R4,X'6F00'     MVCIN source
+r 220=C03100004000                      # LGFI  R3,X'4000'
+r 226=E80F3000400F                      # MVCIN 0(16,R3),X'F'(R4)
+r 22C=C03100004100                      # LGFI  R3,X'4100'
+r 232=E82030004020                      # MVCIN 0(33,R3),X'20'(R4)
+r 238=C03100004200                      # LGFI  R3,X'4200'
+r 23E=E8FF300040FF                      # MVCIN 0(256,R3),X'FF'(R4)
+r 244=C03100004400                      # LGFI  R3,X'4400'
+r 24A=E80630004006                      # MVCIN 0(7,R3),X'6'(R4)
+r 250=C03100004FF4                      # LGFI  R3,X'4FF4'
+r 256=E81830004108                      # MVCIN 0(25,R3),X'108'(R4)
+r 25C=C05100007FF0                      # LGFI  R5,X'7FF0'
+r 262=D23F50015000                      # MVC   1(64,R5),0(R5)
+r 268=C05100008200                      # LGFI  R5,X'8200'
+r 26E=D2FE50015000                      # MVC   1(255,R5),0(R5)
+r 274=B2B20300                          # LPSWE z/Arch disabled wait PSW
+
+r 300=00020001800000000000000000000000  # z/Arch disabled wait PSW
+
+r 1F70=AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAA
+r 1F90=AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAA
+r 1FB0=AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAA
+r 1FD0=AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAA
+r 1FF0=AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAA
+r 2010=AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAA
+r 2030=AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAA
+r 2050=AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAA
+r 2070=AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAA
+r 6F00=000102030405060708090A0B0C0D0E0F101112131415161718191A1B1C1D1E1F
+r 6F20=202122232425262728292A2B2C2D2E2F303132333435363738393A3B3C3D3E3F
+r 6F40=404142434445464748494A4B4C4D4E4F505152535455565758595A5B5C5D5E5F
+r 6F60=606162636465666768696A6B6C6D6E6F707172737475767778797A7B7C7D7E7F
+r 6F80=808182838485868788898A8B8C8D8E8F909192939495969798999A9B9C9D9E9F
+r 6FA0=A0A1A2A3A4A5A6A7A8A9AAABACADAEAFB0B1B2B3B4B5B6B7B8B9BABBBCBDBEBF
+r 6FC0=C0C1C2C3C4C5C6C7C8C9CACBCCCDCECFD0D1D2D3D4D5D6D7D8D9DADBDCDDDEDF
+r 6FE0=E0E1E2E3E4E5E6E7E8E9EAEBECEDEEEFF0F1F2F3F4F5F6F7F8F9FAFBFCFDFEFF
+r 7000=000102030405060708090A0B0C0D0E0F101112131415161718191A1B1C1D1E1F
+r 7020=202122232425262728292A2B2C2D2E2F303132333435363738393A3B3C3D3E3F
+r 7040=404142434445464748494A4B4C4D4E4F505152535455565758595A5B5C5D5E5F
+r 7060=606162636465666768696A6B6C6D6E6F707172737475767778797A7B7C7D7E7F
+r 7080=808182838485868788898A8B8C8D8E8F909192939495969798999A9B9C9D9E9F
+r 70A0=A0A1A2A3A4A5A6A7A8A9AAABACADAEAFB0B1B2B3B4B5B6B7B8B9BABBBCBDBEBF
+r 70C0=C0C1C2C3C4C5C6C7C8C9CACBCCCDCECFD0D1D2D3D4D5D6D7D8D9DADBDCDDDEDF
+r 70E0=E0E1E2E3E4E5E6E7E8E9EAEBECEDEEEFF0F1F2F3F4F5F6F7F8F9FAFBFCFDFEFF
+r 7FF0=5A                               # byte to propagate
+r 8031=11                               # byte after the move
+r 8200=C3                               # byte to propagate
+r 8300=22                               # byte after the move
+
+runtest .1
+
+r 1F70.10
+*Want "XC before operand"           AAAAAAAA AAAAAAAA AAAAAAAA AAAAAAAA
+r 1F80.10
+*Want "XC first"                    00000000 00000000 00000000 00000000
+r 1FF0.10
+*Want "XC before page end"          00000000 00000000 00000000 00000000
+r 2000.10
+*Want "XC after page end"           00000000 00000000 00000000 00000000
+r 2070.10
+*Want "XC last"                     00000000 00000000 00000000 00000000
+r 2080.10
+*Want "XC after operand"            AAAAAAAA AAAAAAAA AAAAAAAA AAAAAAAA
+r 900.4
+*Want "XC cc0"                      00000000
+r 4000.10
+*Want "MVCIN 16 at 4000"            0F0E0D0C 0B0A0908 07060504 03020100
+r 4010.10
+*Want "MVCIN 16 at 4010"            00000000 00000000 00000000 00000000
+r 4100.10
+*Want "MVCIN 33 at 4100"            201F1E1D 1C1B1A19 18171615 14131211
+r 4110.10
+*Want "MVCIN 33 at 4110"            100F0E0D 0C0B0A09 08070605 04030201
+r 4120.10
+*Want "MVCIN 33 at 4120"            00000000 00000000 00000000 00000000
+r 4200.10
+*Want "MVCIN 256 at 4200"           FFFEFDFC FBFAF9F8 F7F6F5F4 F3F2F1F0
+r 4210.10
+*Want "MVCIN 256 at 4210"           EFEEEDEC EBEAE9E8 E7E6E5E4 E3E2E1E0
+r 4220.10
+*Want "MVCIN 256 at 4220"           DFDEDDDC DBDAD9D8 D7D6D5D4 D3D2D1D0
+r 4230.10
+*Want "MVCIN 256 at 4230"           CFCECDCC CBCAC9C8 C7C6C5C4 C3C2C1C0
+r 4240.10
+*Want "MVCIN 256 at 4240"           BFBEBDBC BBBAB9B8 B7B6B5B4 B3B2B1B0
+r 4250.10
+*Want "MVCIN 256 at 4250"           AFAEADAC ABAAA9A8 A7A6A5A4 A3A2A1A0
+r 4260.10
+*Want "MVCIN 256 at 4260"           9F9E9D9C 9B9A9998 97969594 93929190
+r 4270.10
+*Want "MVCIN 256 at 4270"           8F8E8D8C 8B8A8988 87868584 83828180
+r 4280.10
+*Want "MVCIN 256 at 4280"           7F7E7D7C 7B7A7978 77767574 73727170
+r 4290.10
+*Want "MVCIN 256 at 4290"           6F6E6D6C 6B6A6968 67666564 63626160
+r 42A0.10
+*Want "MVCIN 256 at 42A0"           5F5E5D5C 5B5A5958 57565554 53525150
+r 42B0.10
+*Want "MVCIN 256 at 42B0"           4F4E4D4C 4B4A4948 47464544 43424140
+r 42C0.10
+*Want "MVCIN 256 at 42C0"           3F3E3D3C 3B3A3938 37363534 33323130
+r 42D0.10
+*Want "MVCIN 256 at 42D0"           2F2E2D2C 2B2A2928 27262524 23222120
+r 42E0.10
+*Want "MVCIN 256 at 42E0"           1F1E1D1C 1B1A1918 17161514 13121110
+r 42F0.10
+*Want "MVCIN 256 at 42F0"           0F0E0D0C 0B0A0908 07060504 03020100
+r 4300.10
+*Want "MVCIN 256 at 4300"           00000000 00000000 00000000 00000000
+r 4400.10
+*Want "MVCIN 7 at 4400"             06050403 02010000 00000000 00000000
+r 4FF0.10
+*Want "MVCIN 25 at 4FF0"            00000000 08070605 04030201 00FFFEFD
+r 5000.10
+*Want "MVCIN 25 at 5000"            FCFBFAF9 F8F7F6F5 F4F3F2F1 F0000000
+r 7FF0.10
+*Want "MVC propagate 7FF0"          5A5A5A5A 5A5A5A5A 5A5A5A5A 5A5A5A5A
+r 8000.10
+*Want "MVC propagate 8000"          5A5A5A5A 5A5A5A5A 5A5A5A5A 5A5A5A5A
+r 8010.10
+*Want "MVC propagate 8010"          5A5A5A5A 5A5A5A5A 5A5A5A5A 5A5A5A5A
+r 8020.10
+*Want "MVC propagate 8020"          5A5A5A5A 5A5A5A5A 5A5A5A5A 5A5A5A5A
+r 8030.10
+*Want "MVC propagate 8030"          5A110000 00000000 00000000 00000000
+r 8200.10
+*Want "MVC propagate 8200"          C3C3C3C3 C3C3C3C3 C3C3C3C3 C3C3C3C3
+r 8270.10
+*Want "MVC propagate 8270"          C3C3C3C3 C3C3C3C3 C3C3C3C3 C3C3C3C3
+r 82F0.10
+*Want "MVC propagate 82F0"          C3C3C3C3 C3C3C3C3 C3C3C3C3 C3C3C3C3
+r 8300.10
+*Want "MVC propagate 8300"          22000000 00000000 00000000 00000000
+
+*Done
@@ -29,17 +29,78 @@
 /* [3] Interval timer                                                */
 /* CPUs with an outstanding interrupt are signalled                  */
 /*                                                                   */
-/* tod_delta is in hercules internal clock format (>> 8)             */
+/* The clock comparator and CPU timer of each CPU are first checked  */
+/* without the intlock, which is then only obtained when one of the  */
+/* interrupt flags needs to be set or reset, or when an interval     */
+/* timer or a SIE guest has to be polled.                            */
+/*                                                                   */
+/* Returns the hw_clock() value at which the next clock comparator   */
+/* or CPU timer interrupt becomes pending (all ones if none), or     */
+/* zero if the CPUs must be polled again after the next timerint.    */
 /*-------------------------------------------------------------------*/
-void update_cpu_timer(void)
+TOD update_cpu_timer( void )
 {
 int             cpu;                    /* CPU counter               */
 REGS           *regs;                   /* -> CPU register context   */
 CPU_BITMAP      intmask = 0;            /* Interrupt CPU mask        */
+TOD             hw;                     /* Hardware clock            */
+TOD             tod;                    /* TOD clock of the CPU      */
+TOD             next = ~0ULL;           /* Next timer deadline       */
+bool            poll = false;           /* true == must poll CPUs    */
+bool            change = false;         /* true == flag must change  */
 
     /* If no CPUs are available, just return (device server mode) */
     if (!sysblk.hicpu)
-      return;
+      return next;
+
+    hw = hw_clock();
+
+    /* Find the next deadline and whether any interrupt flag needs
+       to change, without obtaining the intlock */
+    for (cpu = 0; cpu < sysblk.hicpu; cpu++)
+    {
+        /* Ignore this CPU if it is not started */
+        if (!IS_CPU_ONLINE(cpu)
+         || CPUSTATE_STOPPED == sysblk.regs[cpu]->cpustate)
+            continue;
+
+        /* Point to the CPU register context */
+        regs = sysblk.regs[cpu];
+
+        /* The interval timer and SIE guest timers are polled */
+        if (regs->arch_mode == ARCH_370_IDX
+#if defined(_FEATURE_SIE)
+         || regs->sie_active
+#endif
+        )
+        {
+            poll = true;
+            break;
+        }
+
+        /* [1] Clock comparator */
+        tod = TOD_CLOCK(regs);
+        if (tod > regs->clkc)
+            change |= !IS_IC_CLKC(regs);
+        else
+        {
+            change |= IS_IC_CLKC(regs) != 0;
+            next = min( next, hw + (regs->clkc - tod) + 1 );
+        }
+
+        /* [2] CPU timer */
+        if ((S64) ETOD_high64_to_TOD_high56( regs->cpu_timer - hw ) < 0)
+            change |= !IS_IC_PTIMER(regs);
+        else
+        {
+            change |= IS_IC_PTIMER(regs) != 0;
+            next = min( next, (TOD) regs->cpu_timer + 1 );
+        }
+
+    } /* end for(cpu) */
+
+    if (!poll && !change)
+        return next;
 
     /* Access the diffent register contexts with the intlock held */
     OBTAIN_INTLOCK(NULL);
@@ -152,17 +213,45 @@ CPU_BITMAP      intmask = 0;            /* Interrupt CPU mask        */
 
     RELEASE_INTLOCK(NULL);
 
-} /* end function check_timer_event */
+    return poll ? 0 : next;
+
+} /* end function update_cpu_timer */
+
+
+/*-------------------------------------------------------------------*/
+/* Arm a timer deadline                                              */
+/*                                                                   */
+/* Called whenever a clock comparator, CPU timer or TOD epoch has    */
+/* been changed. If the new deadline (a hw_clock() value, or zero    */
+/* to force an immediate check) is earlier than when the timer       */
+/* thread would next wake up, the timer thread is woken up now.      */
+/*-------------------------------------------------------------------*/
+void arm_timer_deadline( TOD deadline )
+{
+    obtain_lock( &sysblk.todlock );
+    {
+        if (deadline < sysblk.todwake)
+        {
+            sysblk.todwake = deadline;
+            signal_condition( &sysblk.todcond );
+        }
+    }
+    release_lock( &sysblk.todlock );
+}
 
 
 /*-------------------------------------------------------------------*/
 /* TOD clock and timer thread                                        */
 /*                                                                   */
-/* This function runs as a separate thread.  It wakes up every       */
-/* 1 microsecond, updates the TOD clock, and decrements the          */
-/* CPU timer for each CPU.  If any CPU timer goes negative, or       */
-/* if the TOD clock exceeds the clock comparator for any CPU,        */
-/* it signals any waiting CPUs to wake up and process interrupts.    */
+/* This function runs as a separate thread.  It updates the TOD      */
+/* clock and checks the timers of each CPU.  If any CPU timer goes   */
+/* negative, or if the TOD clock exceeds the clock comparator for    */
+/* any CPU, it signals any waiting CPUs to wake up and process       */
+/* interrupts.  It then sleeps until the next such deadline (or      */
+/* until arm_timer_deadline wakes it up for an earlier one), but no  */
+/* longer than until the next MIPS rate calculation or PSW sample.   */
+/* While interval timers or SIE guests are active it instead wakes   */
+/* up every timerint microseconds to poll them.                      */
 /*-------------------------------------------------------------------*/
 void* timer_thread ( void* argp )
 {
@@ -181,6 +270,9 @@ U64     saved_then;                     /* (saved original value)    */
 U64     intv_secs;                      /* Interval                  */
 U64     half_intv;                      /* One-half interval         */
 U64     wait_secs;                      /* Wait time                 */
+TOD     deadline;                       /* Next timer deadline       */
+TOD     wake;                           /* Next periodic wakeup      */
+TOD     hw;                             /* Hardware clock            */
 const U64   one_sec  = ETOD_SEC;        /* MIPS calculation period   */
 #if defined( _FEATURE_073_TRANSACT_EXEC_FACILITY )
 bool    txf_PPA;                        /* true == PPA assist needed */
@@ -199,6 +291,10 @@ bool    txf_PPA;                        /* true == PPA assist needed */
 
     then = host_tod();
 
+    obtain_lock( &sysblk.todlock );
+    sysblk.todwake = ~0ULL;
+    release_lock( &sysblk.todlock );
+
     while (!sysblk.shutfini)
     {
 #if defined( _FEATURE_073_TRANSACT_EXEC_FACILITY )
@@ -207,6 +303,9 @@ bool    txf_PPA;                        /* true == PPA assist needed */
         /* Update TOD clock and save TOD clock value */
         now = update_tod_clock();
 
+        /* Check the CPU timers and clock comparators */
+        deadline = update_cpu_timer();
+
         intv_secs = now - then;
 
         if (intv_secs >= one_sec)             /* Period expired? */
@@ -323,17 +422,67 @@ bool    txf_PPA;                        /* true == PPA assist needed */
 
         } /* end if (intv_secs >= one_sec) */
 
-        /* Sleep for another timer update interval... */
+        /* Ask each running CPU for a PSW sample if sampling is active */
+        if (sysblk.psample && now >= sysblk.psample_next)
+        {
+            sysblk.psample_next = now + (one_sec / sysblk.psample_rate);
 
+            for (i=0; i < sysblk.hicpu; i++)
+            {
+                obtain_lock( &sysblk.cpulock[ i ]);
+                {
+                    /* (a stopped or waiting CPU has nothing to show) */
+                    if (1
+                        && IS_CPU_ONLINE( i )
+                        && sysblk.regs[i]->cpustate == CPUSTATE_STARTED
+                        && !WAITSTATE( &sysblk.regs[i]->psw )
+                    )
+                        sysblk.regs[i]->psample_req = true;
+                }
+                release_lock( &sysblk.cpulock[ i ]);
+            }
+        }
+
+        /* Sleep for another timer update interval if the timers
+           must be polled... */
+        if (!deadline)
+        {
 #if defined( _FEATURE_073_TRANSACT_EXEC_FACILITY )
-        /* Do we need to temporarily reduce the frequency of timer
-           interrupts? (By waiting slightly longer than normal?)
-        */
-        if (txf_PPA)
-            USLEEP( sysblk.txf_timerint );
-        else
+            /* Do we need to temporarily reduce the frequency of timer
+               interrupts? (By waiting slightly longer than normal?)
+            */
+            if (txf_PPA)
+                USLEEP( sysblk.txf_timerint );
+            else
 #endif
-            USLEEP( sysblk.timerint );
+                USLEEP( sysblk.timerint );
+
+            continue;
+        }
+
+        /* ...otherwise sleep until the next timer deadline, but wake
+           up in time for the next MIPS rate calculation or PSW sample */
+        wake = then + one_sec;
+        if (sysblk.psample)
+            wake = min( wake, sysblk.psample_next );
+
+        hw = hw_clock();
+        deadline = min( deadline, hw + (wake > now ? wake - now : 0) );
+
+        obtain_lock( &sysblk.todlock );
+        {
+            /* (a deadline armed since the above check may be earlier) */
+            sysblk.todwake = min( sysblk.todwake, deadline );
+
+            if (sysblk.todwake > hw)
+                timed_wait_condition_relative_usecs( &sysblk.todcond,
+                    &sysblk.todlock, (U32)(min( one_sec,
+                    sysblk.todwake - hw + ETOD_USEC - 1 ) / ETOD_USEC), NULL );
+
+            /* Record any deadline armed while we are awake */
+            sysblk.todwake = ~0ULL;
+        }
+        release_lock( &sysblk.todlock );
 
     } /* end while */
 
@@ -753,7 +753,6 @@ void ARCH_DEP( process_tbegin )( bool txf_contran, REGS* regs, S16 i2,
                                  U64 tdba, int b1 )
 {
 int         n, tdc;
-TPAGEMAP   *pmap;
 
     /* Temporarily pause other CPUs while TBEGIN/TBEGINC is processed.
        NOTE: this *must* be done *BEFORE* checking nesting depth. */
@@ -803,16 +802,11 @@ TPAGEMAP   *pmap;
         /* Set internal TDB to invalid until it's actually populated */
         memset( &regs->txf_tdb, 0, sizeof( TDB ));
 
-        /* Initialize the page map */
+        /* Initialize the page map. Entries are initialized
+           as they are used by txf_maddr_l. */
 
-        pmap = regs->txf_pagesmap;
         regs->txf_pgcnt = 0;
-
-        for (n=0; n < MAX_TXF_PAGES; n++, pmap++)
-        {
-            pmap->mainpageaddr = NULL;
-            memset( pmap->cachemap, CM_CLEAN, sizeof( pmap->cachemap ));
-        }
+        memset( regs->txf_pagehash, 0, sizeof( regs->txf_pagehash ));
 
         /* Initialize other fields */
 
@@ -1854,9 +1848,12 @@ TPAGEMAP*  pmap = regs->txf_pagesmap;
         pmap->virtpageaddr = 0;
         pmap->mainpageaddr = NULL;
         pmap->altpageaddr  = altpage;
+        pmap->hashnext     = 0;
         memset( pmap->cachemap, CM_CLEAN, sizeof( pmap->cachemap ));
     }
 
+    memset( regs->txf_pagehash, 0, sizeof( regs->txf_pagehash ));
+
     regs->txf_tnd      = 0;
     regs->txf_abortctr = 0;
     regs->txf_contran  = false;
@@ -1911,6 +1908,16 @@ void txf_abort_all( U16 cpuad, int why, const char* location )
         )
             continue;
 
+        /* Skip without locking any CPU not executing a transaction.
+           One starting a transaction now will see the change that
+           caused this abort, just as if it started after we looked.
+        */
+        if (1
+            && !regs->txf_tnd
+            && !(GUESTREGS && GUESTREGS->txf_tnd)
+        )
+            continue;
+
         /* If this CPU is executing a transaction, then force it
            to eventually fail by setting a transation abort code.
         */
@@ -1979,15 +1986,17 @@ void txf_abort_all( U16 cpuad, int why, const char* location )
 /*  to "translate" the passed address to an alternate address in     */
 /*  a different page. Both vaddr and regs must be valid.             */
 /*                                                                   */
-/*  The real storage address is mapped to an alternate address and   */
-/*  the contents of the real page are saved.  The cache line being   */
-/*  accessed within the page is marked as having been accessed.      */
+/*  The real storage address is mapped to an alternate address in a  */
+/*  page found through the page map hash table.  The cache lines     */
+/*  being accessed within the page are marked as having been         */
+/*  accessed.                                                        */
 /*                                                                   */
 /*  The first time that a cache line is accessed, it is captured     */
-/*  from the real page.  When a cache line or page is captured two   */
-/*  copies are made:  one copy is presented to the caller and one    */
-/*  is a saved copy to be used at TEND commit time to see if that    */
-/*  cache line was changed by anyone.                                */
+/*  from the real page.  Only the cache lines accessed are captured, */
+/*  never the whole page.  When a cache line is captured two copies  */
+/*  are made:  one copy is presented to the caller and one is a      */
+/*  saved copy to be used at TEND commit time to see if that cache   */
+/*  line was changed by anyone.                                      */
 /*                                                                   */
 /*  Input:                                                           */
 /*       vaddr    Logical address as passed to maddr_l               */
@@ -2007,8 +2016,8 @@ DLL_EXPORT BYTE* txf_maddr_l( const U64  vaddr,   const size_t  len,
                               const int  arn,     REGS*         regs,
                               const int  acctype, BYTE*         maddr )
 {
-    BYTE *pageaddr, *pageaddrc;
-    BYTE *savepage, *savepagec;
+    BYTE *pageaddrc;
+    BYTE *savepagec;
     BYTE *altpage,  *altpagec;
 
     U64  addrwork;              /* maddr converted to U64            */
@@ -2018,6 +2027,7 @@ DLL_EXPORT BYTE* txf_maddr_l( const U64  vaddr,   const size_t  len,
     int  cacheidx;              /* Corresponding cache line          */
     int  cacheidxe;             /* Corresponding ending cache line   */
     int  i;                     /* Work variable                     */
+    int  hash;                  /* Page map hash table index         */
     int  txf_acctype;           /* ACC_READ or ACC_WRITE             */
 
     BYTE cmtype;                /* Cache Map access type             */
@@ -2089,16 +2099,18 @@ DLL_EXPORT BYTE* txf_maddr_l( const U64  vaddr,   const size_t  len,
             cacheidxe = (ZCACHE_LINE_PAGE - 1);
     }
 
-    /* Check if we have already captured this page and if not,
-       capture it and save a copy.  The copy is used at commit
-       time to determine if any unexpected changes were made.
+    /* Check if we have already mapped this page and if not, map
+       it.  Its cache lines are captured as they are accessed.
     */
     altpage = NULL;
-    pmap = regs->txf_pagesmap;
+    pmap = NULL;
+    hash = TXF_PAGEHASH( addrpage );
 
     /* Check if page already mapped. If so, use it */
-    for (i=0; i < regs->txf_pgcnt; i++, pmap++)
+    for (i = regs->txf_pagehash[ hash ]; i; i = pmap->hashnext)
     {
+        pmap = &regs->txf_pagesmap[ i - 1 ];
+
         if (addrpage == (U64) pmap->mainpageaddr)
         {
             altpage = pmap->altpageaddr;
@@ -2106,7 +2118,7 @@ DLL_EXPORT BYTE* txf_maddr_l( const U64  vaddr,   const size_t  len,
         }
     }
 
-    /* If not mapped yet, capture real page and save a copy */
+    /* If not mapped yet, map it with all cache lines clean */
     if (!altpage)
     {
         /* Abort transaction if too many pages were touched */
@@ -2121,19 +2133,17 @@ DLL_EXPORT BYTE* txf_maddr_l( const U64  vaddr,   const size_t  len,
             UNREACHABLE_CODE( return maddr );
         }
 
-        pageaddr = (BYTE*) addrpage;
         pmap     = &regs->txf_pagesmap[ regs->txf_pgcnt ];
         altpage  = pmap->altpageaddr;
-        savepage = altpage + ZPAGEFRAME_PAGESIZE;
 
-        /* Capture a copy of this page */
-        memcpy( altpage,  pageaddr, ZPAGEFRAME_PAGESIZE );
-        memcpy( savepage, altpage,  ZPAGEFRAME_PAGESIZE );
+        memset( pmap->cachemap, CM_CLEAN, sizeof( pmap->cachemap ));
 
         /* Finish mapping this page */
         pmap->mainpageaddr = (BYTE*) addrpage;
         pmap->virtpageaddr = vaddr & ZPAGEFRAME_PAGEMASK;
+        pmap->hashnext     = regs->txf_pagehash[ hash ];
         regs->txf_pgcnt++;
+        regs->txf_pagehash[ hash ] = (U16) regs->txf_pgcnt;
     }
 
     /* Calculate alternate address and cache map access type */
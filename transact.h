@@ -35,6 +35,10 @@
                                       /* Cache lines per 4K page     */
 #define  ZOCTOWORD_SIZE       (8*4)   /* IBM z "octoword" size       */
 
+#define  TXF_PAGEHASH_SIZE      256   /* Page map hash table entries */
+#define  TXF_PAGEHASH( _addr )      (((_addr) >> 12) & (TXF_PAGEHASH_SIZE - 1))
+                                      /* Page map hash table index   */
+
 #define  PPA_SOME_HELP_THRESHOLD  1   /* Provide SOME assistance     */
 #define  PPA_MUCH_HELP_THRESHOLD  2   /* Provide LOTS of assistance! */
 
@@ -73,6 +77,7 @@ struct TPAGEMAP
     U64     virtpageaddr;       /* virtual address of mapped page    */
     BYTE*   mainpageaddr;       /* address of main page being mapped */
     BYTE*   altpageaddr;        /* addesss of alternate & save pages */
+    U16     hashnext;           /* next entry+1 with same hash or 0  */
     BYTE    cachemap[ ZCACHE_LINE_PAGE ];  /* cache line indicators  */
 
 #define CM_CLEAN    0           /* clean cache line (init default)   */
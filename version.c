@@ -703,6 +703,12 @@ static const char *build_info[] = {
     "Without \"Optimized\" instructions",
 #endif
 
+#if defined( OPTION_INSTR_COUNT_AND_TIME )
+    "With    Instruction counting (icount) support",
+#else
+    "Without Instruction counting (icount) support",
+#endif
+
 
 
 
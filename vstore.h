@@ -175,6 +175,14 @@ inline void concpy( REGS* regs, void* d, void* s, int n )
     BYTE* u8d = d;
     BYTE* u8s = s;
 
+    /* Destination one byte past the source is the classic MVC
+       propagation idiom: every byte receives the first source byte */
+    if (u8d == u8s + 1)
+    {
+        memset( u8d, *u8s, n );
+        return;
+    }
+
     /* Copy until ready or 8 byte integral boundary */
     while (n && ((uintptr_t) u8d & 7))
     {
@@ -1061,6 +1069,7 @@ int     len;                            /* Length for page crossing  */
         /* Update the AIA values */
         regs->AIV = addr & PAGEFRAME_PAGEMASK;
         regs->aip = (BYTE*)((uintptr_t)ip & ~PAGEFRAME_BYTEMASK);
+        regs->aipte = regs->tlb.TLB_PTE( TLBIX( addr ));
 
         /* If tracing, stepping or PER is still active,
            force another instfetch after this instruction.
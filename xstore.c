@@ -571,8 +571,10 @@ BYTE    xpkey1 = 0, xpkey2 = 0;         /* Expanded storage keys     */
         /* Set the main storage reference and change bits */
         ARCH_DEP( or_storage_key_by_ptr )( sk1, (STORKEY_REF | STORKEY_CHANGE) );
 
-        /* Move 4K bytes from main storage to main storage */
-        memcpy (main1, main2, XSTORE_PAGESIZE);
+        /* Move 4K bytes from main storage to main storage
+           (nothing to move if both operands are the same frame) */
+        if (main1 != main2)
+            memcpy (main1, main2, XSTORE_PAGESIZE);
     }
 
     /* Return condition code zero */
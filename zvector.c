@@ -227,6 +227,15 @@ static inline void S256_add_S128( U128 *ahi, U128 *alo, U128 b, U128 *chi, U128
 static inline U64 gf_mul_32( U32 m1, U32 m2);
 static inline void gf_mul_64( U64 m1, U64 m2, U64* accu128h, U64* accu128l);
 
+#if defined( FEATURE_V128_SSE )
+static inline int vec_mask_count( __m128i mask, int el );
+static inline int vec_first_byte( int bits );
+static inline int vec_next_byte( int bits, int k );
+static inline __m128i vec_cmpeq( __m128i a, __m128i b, int m );
+static inline __m128i vec_cmpeq_any( __m128i a, const QW* b, int m );
+static inline void vec_string_result( REGS* regs, int v1, __m128i irt1, __m128i irt2, bool rt, bool cs );
+#endif
+
 /*-------------------------------------------------------------------*/
 /* Debug helper for U128                                             */
 /*                                                                   */
@@ -1289,6 +1298,150 @@ static inline void gf_mul_64( U64 m1, U64 m2, U64* accu128h, U64* accu128l)
     }
 }
 
+#if defined( FEATURE_V128_SSE )
+/*-------------------------------------------------------------------*/
+/* Count true elements of an SSE compare result                      */
+/*                                                                   */
+/* Input:                                                            */
+/*      mask        compare result (each element all ones or zero)   */
+/*      el          number of elements in the vector                 */
+/*                                                                   */
+/* Returns el if all elements are true, 0 if none are, and 1 if some */
+/* are: which is all the compare condition codes need to know.       */
+/*                                                                   */
+/* Note: the vector registers are host 128-bit values, so the SSE    */
+/* element-wise operations in this file apply to the whole register  */
+/* directly. Host element n is z element (el-1-n), which only        */
+/* matters to operations that move elements between positions.       */
+/*-------------------------------------------------------------------*/
+static inline int vec_mask_count( __m128i mask, int el )
+{
+    int     bits;                     /* one bit per result byte       */
+
+    bits = _mm_movemask_epi8( mask );
+
+    return bits == 0xFFFF ? el : bits != 0 ? 1 : 0;
+}
+
+/*-------------------------------------------------------------------*/
+/* Byte index of the first true element of a compare result          */
+/*                                                                   */
+/* Input:                                                            */
+/*      bits        _mm_movemask_epi8 of the compare result          */
+/*                                                                   */
+/* Returns the z byte index (0-15) of the lowest indexed true        */
+/* element, or 16 if there is none. Host byte n is z byte 15-n, so   */
+/* the first z element is the one holding the highest mask bit.      */
+/*-------------------------------------------------------------------*/
+static inline int vec_first_byte( int bits )
+{
+    return bits ? 15 - (int) highest_set_bit( (U32) bits ) : 16;
+}
+
+/*-------------------------------------------------------------------*/
+/* Byte index of the first true element at or after byte k           */
+/*                                                                   */
+/* Input:                                                            */
+/*      bits        _mm_movemask_epi8 of the compare result          */
+/*      k           z byte index (0-16) to start from                */
+/*                                                                   */
+/* Returns the z byte index of the next true element, or 16.         */
+/*-------------------------------------------------------------------*/
+static inline int vec_next_byte( int bits, int k )
+{
+    return vec_first_byte( bits & ((1 << (16 - k)) - 1) );
+}
+
+/*-------------------------------------------------------------------*/
+/* Compare equal for element size m (0=byte, 1=halfword, 2=word)     */
+/*-------------------------------------------------------------------*/
+static inline __m128i vec_cmpeq( __m128i a, __m128i b, int m )
+{
+    switch (m)
+    {
+    case 0:  return _mm_cmpeq_epi8 ( a, b );
+    case 1:  return _mm_cmpeq_epi16( a, b );
+    default: return _mm_cmpeq_epi32( a, b );
+    }
+}
+
+/*-------------------------------------------------------------------*/
+/* Compare each element of a with every element of b                 */
+/*                                                                   */
+/* Input:                                                            */
+/*      a           elements to be found                             */
+/*      b           set of elements to search for                    */
+/*      m           element size (0=byte, 1=halfword, 2=word)        */
+/*                                                                   */
+/* Returns all ones in the elements of a that equal any element of   */
+/* b. The order of b does not matter, so it is scanned in host order.*/
+/*-------------------------------------------------------------------*/
+static inline __m128i vec_cmpeq_any( __m128i a, const QW* b, int m )
+{
+    __m128i any = _mm_setzero_si128();
+    int     i;
+
+    switch (m)
+    {
+    case 0:
+        for (i=0; i < 16; i++)
+            any = _mm_or_si128( any, _mm_cmpeq_epi8( a, _mm_set1_epi8( (char) b->b[i] )));
+        break;
+    case 1:
+        for (i=0; i < 8; i++)
+            any = _mm_or_si128( any, _mm_cmpeq_epi16( a, _mm_set1_epi16( (short) b->h[i] )));
+        break;
+    default:
+        for (i=0; i < 4; i++)
+            any = _mm_or_si128( any, _mm_cmpeq_epi32( a, _mm_set1_epi32( (int) b->f[i] )));
+        break;
+    }
+    return any;
+}
+
+/*-------------------------------------------------------------------*/
+/* Store the result of VFAE or VSTRC                                 */
+/*                                                                   */
+/* Input:                                                            */
+/*      regs        CPU register context                             */
+/*      v1          first operand vector register                    */
+/*      irt1        first intermediate result (after any inversion)  */
+/*      irt2        second intermediate result (zero search)         */
+/*      rt          result type: element masks rather than an index  */
+/*      cs          set the condition code                           */
+/*                                                                   */
+/* Byte indexes order the same as element indexes, so the condition  */
+/* code can be set from them for every element size.                 */
+/*-------------------------------------------------------------------*/
+static inline void vec_string_result( REGS* regs, int v1, __m128i irt1, __m128i irt2, bool rt, bool cs )
+{
+    int     lxt1, lxt2;               /* lowest indexed true bytes     */
+
+    lxt1 = vec_first_byte( _mm_movemask_epi8( irt1 ));
+    lxt2 = vec_first_byte( _mm_movemask_epi8( irt2 ));
+
+    if (rt)
+        regs->VR_Q(v1).v = irt1;
+    else
+    {
+        regs->VR_D(v1, 0) = min(lxt1, lxt2);
+        regs->VR_D(v1, 1) = 0;
+    }
+
+    if (cs)
+    {
+        if (lxt1 == 16 && lxt2 == 16)
+            regs->psw.cc = 3;
+        else if (lxt2 == 16)
+            regs->psw.cc = 1;
+        else if (lxt1 < lxt2)
+            regs->psw.cc = 2;
+        else
+            regs->psw.cc = 0;
+    }
+}
+#endif
+
 #endif /*!defined(_ZVECTOR_ARCH_INDEPENDENT_)*/
 
 /*===================================================================*/
@@ -1893,18 +2046,30 @@ DEF_INST( vector_element_shift_left )
         break;
     case 1:
         shift %= 16;
+#if defined( FEATURE_V128_SSE )
+        regs->VR_Q(v1).v = _mm_sll_epi16( regs->VR_Q(v3).v, _mm_cvtsi32_si128( shift ));
+#else
         for (i=0; i < 8; i++)
             regs->VR_H( v1, i ) = regs->VR_H( v3, i ) << shift;
+#endif
         break;
     case 2:
         shift %= 32;
+#if defined( FEATURE_V128_SSE )
+        regs->VR_Q(v1).v = _mm_sll_epi32( regs->VR_Q(v3).v, _mm_cvtsi32_si128( shift ));
+#else
         for (i=0; i < 4; i++)
             regs->VR_F( v1, i ) = regs->VR_F( v3, i ) << shift;
+#endif
         break;
     case 3:
         shift %= 64;
+#if defined( FEATURE_V128_SSE )
+        regs->VR_Q(v1).v = _mm_sll_epi64( regs->VR_Q(v3).v, _mm_cvtsi32_si128( shift ));
+#else
         for (i=0; i < 2; i++)
             regs->VR_D( v1, i ) = regs->VR_D( v3, i ) << shift;
+#endif
         break;
     default:
         ARCH_DEP( program_interrupt )( regs, PGM_SPECIFICATION_EXCEPTION );
@@ -2044,18 +2209,30 @@ DEF_INST( vector_element_shift_right_logical )
         break;
     case 1:
         shift %= 16;
+#if defined( FEATURE_V128_SSE )
+        regs->VR_Q(v1).v = _mm_srl_epi16( regs->VR_Q(v3).v, _mm_cvtsi32_si128( shift ));
+#else
         for (i=0; i < 8; i++)
             regs->VR_H( v1, i ) = regs->VR_H( v3, i ) >> shift;
+#endif
         break;
     case 2:
         shift %= 32;
+#if defined( FEATURE_V128_SSE )
+        regs->VR_Q(v1).v = _mm_srl_epi32( regs->VR_Q(v3).v, _mm_cvtsi32_si128( shift ));
+#else
         for (i=0; i < 4; i++)
             regs->VR_F( v1, i ) = regs->VR_F( v3, i ) >> shift;
+#endif
         break;
     case 3:
         shift %= 64;
+#if defined( FEATURE_V128_SSE )
+        regs->VR_Q(v1).v = _mm_srl_epi64( regs->VR_Q(v3).v, _mm_cvtsi32_si128( shift ));
+#else
         for (i=0; i < 2; i++)
             regs->VR_D( v1, i ) = regs->VR_D( v3, i ) >> shift;
+#endif
         break;
     default:
         ARCH_DEP( program_interrupt )( regs, PGM_SPECIFICATION_EXCEPTION );
@@ -2088,13 +2265,21 @@ DEF_INST( vector_element_shift_right_arithmetic )
         break;
     case 1:
         shift %= 16;
+#if defined( FEATURE_V128_SSE )
+        regs->VR_Q(v1).v = _mm_sra_epi16( regs->VR_Q(v3).v, _mm_cvtsi32_si128( shift ));
+#else
         for (i=0; i < 8; i++)
             regs->VR_H( v1, i ) = (S16) regs->VR_H( v3, i ) >> shift;
+#endif
         break;
     case 2:
         shift %= 32;
+#if defined( FEATURE_V128_SSE )
+        regs->VR_Q(v1).v = _mm_sra_epi32( regs->VR_Q(v3).v, _mm_cvtsi32_si128( shift ));
+#else
         for (i=0; i < 4; i++)
             regs->VR_F( v1, i ) = (S32) regs->VR_F( v3, i ) >> shift;
+#endif
         break;
     case 3:
         shift %= 64;
@@ -2403,7 +2588,10 @@ DEF_INST( vector_generate_mask )
 /*-------------------------------------------------------------------*/
 DEF_INST( vector_replicate )
 {
-    int     v1, v3, i2, m4, i;
+    int     v1, v3, i2, m4;
+#if !defined( FEATURE_V128_SSE )
+    int     i;
+#endif
 
     VRI_C( inst, regs, v1, v3, i2, m4 );
 
@@ -2415,20 +2603,36 @@ DEF_INST( vector_replicate )
     switch (m4)
     {
     case 0:
+#if defined( FEATURE_V128_SSE )
+        regs->VR_Q(v1).v = _mm_set1_epi8( (char) regs->VR_B(v3, i2) );
+#else
         for (i=0; i < 16; i++)
             regs->VR_B(v1, i) = regs->VR_B(v3, i2);
+#endif
         break;
     case 1:
+#if defined( FEATURE_V128_SSE )
+        regs->VR_Q(v1).v = _mm_set1_epi16( (short) regs->VR_H(v3, i2) );
+#else
         for (i=0; i < 8; i++)
             regs->VR_H(v1, i) = regs->VR_H(v3, i2);
+#endif
         break;
     case 2:
+#if defined( FEATURE_V128_SSE )
+        regs->VR_Q(v1).v = _mm_set1_epi32( (int) regs->VR_F(v3, i2) );
+#else
         for (i=0; i < 4; i++)
             regs->VR_F(v1, i) = regs->VR_F(v3, i2);
+#endif
         break;
     case 3:
+#if defined( FEATURE_V128_SSE )
+        regs->VR_Q(v1).v = _mm_set1_epi64x( (S64) regs->VR_D(v3, i2) );
+#else
         for (i=0; i < 2; i++)
             regs->VR_D(v1, i) = regs->VR_D(v3, i2);
+#endif
         break;
     default:
         ARCH_DEP( program_interrupt )( regs, PGM_SPECIFICATION_EXCEPTION );
@@ -2764,7 +2968,11 @@ DEF_INST( vector_load_vector )
 DEF_INST( vector_isolate_string )
 {
     int     v1, v2, m3, m4, m5;
+#if defined( FEATURE_V128_SSE )
+    int     zi;
+#else
     int     i;
+#endif
     BYTE    newcc = 3;
 
     VRR_A( inst, regs, v1, v2, m3, m4, m5 );
@@ -2776,6 +2984,19 @@ DEF_INST( vector_isolate_string )
 
 #define M5_CS ((m5 & 0x1) != 0)  // Condition Code Set
 
+#if defined( FEATURE_V128_SSE )
+    if (m3 > 2)
+        ARCH_DEP( program_interrupt )( regs, PGM_SPECIFICATION_EXCEPTION );
+
+    /* Keep the bytes before the first zero element: z byte i is host */
+    /* byte 15-i, so those are the host bytes above 15-zi              */
+    zi = vec_first_byte( _mm_movemask_epi8( vec_cmpeq( regs->VR_Q(v2).v, _mm_setzero_si128(), m3 )));
+    if (zi < 16)
+        newcc = 0;
+    regs->VR_Q(v1).v = _mm_and_si128( regs->VR_Q(v2).v,
+        _mm_cmpgt_epi8( _mm_setr_epi8( 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 ),
+                        _mm_set1_epi8( (char) (15 - zi) )));
+#else
     switch (m3)
     {
     case 0:  /* Byte */
@@ -2836,6 +3057,7 @@ DEF_INST( vector_isolate_string )
         ARCH_DEP( program_interrupt )( regs, PGM_SPECIFICATION_EXCEPTION );
         break;
     }
+#endif
 
     if (M5_CS)               // if M5_CS (Condition Code Set)
         regs->psw.cc = newcc;
@@ -2907,8 +3129,10 @@ DEF_INST( vector_sign_extend_to_doubleword )
 DEF_INST( vector_merge_low )
 {
     int     v1, v2, v3, m4, m5, m6;
+#if !defined( FEATURE_V128_SSE )
     int     i, j;
     SV      temp;
+#endif
 
     VRR_C( inst, regs, v1, v2, v3, m4, m5, m6 );
 
@@ -2918,6 +3142,28 @@ DEF_INST( vector_merge_low )
 
     ZVECTOR_CHECK( regs );
 
+#if defined( FEATURE_V128_SSE )
+    /* z element 0 is the high order host element, hence the operands */
+    /* are swapped: host unpack interleaves its first operand lowest  */
+    switch (m4)
+    {
+    case 0:  /* Byte */
+        regs->VR_Q(v1).v = _mm_unpacklo_epi8( regs->VR_Q(v3).v, regs->VR_Q(v2).v );
+        break;
+    case 1:  /* Halfword */
+        regs->VR_Q(v1).v = _mm_unpacklo_epi16( regs->VR_Q(v3).v, regs->VR_Q(v2).v );
+        break;
+    case 2:  /* Word */
+        regs->VR_Q(v1).v = _mm_unpacklo_epi32( regs->VR_Q(v3).v, regs->VR_Q(v2).v );
+        break;
+    case 3:  /* Doubleword */
+        regs->VR_Q(v1).v = _mm_unpacklo_epi64( regs->VR_Q(v3).v, regs->VR_Q(v2).v );
+        break;
+    default:
+        ARCH_DEP(program_interrupt) (regs, PGM_SPECIFICATION_EXCEPTION);
+        break;
+    }
+#else
     switch (m4)
     {
     case 0:  /* Byte */
@@ -2952,6 +3198,7 @@ DEF_INST( vector_merge_low )
 
     regs->VR_D( v1, 0 ) = SV_D( temp, 0 );
     regs->VR_D( v1, 1 ) = SV_D( temp, 1 );
+#endif
 
     ZVECTOR_END( regs );
 }
@@ -2962,8 +3209,10 @@ DEF_INST( vector_merge_low )
 DEF_INST( vector_merge_high )
 {
     int     v1, v2, v3, m4, m5, m6;
+#if !defined( FEATURE_V128_SSE )
     int     i, j;
     SV      temp;
+#endif
 
     VRR_C( inst, regs, v1, v2, v3, m4, m5, m6 );
 
@@ -2973,6 +3222,28 @@ DEF_INST( vector_merge_high )
 
     ZVECTOR_CHECK( regs );
 
+#if defined( FEATURE_V128_SSE )
+    /* z element 0 is the high order host element, hence the operands */
+    /* are swapped: host unpack interleaves its first operand lowest  */
+    switch (m4)
+    {
+    case 0:  /* Byte */
+        regs->VR_Q(v1).v = _mm_unpackhi_epi8( regs->VR_Q(v3).v, regs->VR_Q(v2).v );
+        break;
+    case 1:  /* Halfword */
+        regs->VR_Q(v1).v = _mm_unpackhi_epi16( regs->VR_Q(v3).v, regs->VR_Q(v2).v );
+        break;
+    case 2:  /* Word */
+        regs->VR_Q(v1).v = _mm_unpackhi_epi32( regs->VR_Q(v3).v, regs->VR_Q(v2).v );
+        break;
+    case 3:  /* Doubleword */
+        regs->VR_Q(v1).v = _mm_unpackhi_epi64( regs->VR_Q(v3).v, regs->VR_Q(v2).v );
+        break;
+    default:
+        ARCH_DEP(program_interrupt) (regs, PGM_SPECIFICATION_EXCEPTION);
+        break;
+    }
+#else
     switch (m4)
     {
     case 0:  /* Byte */
@@ -3007,6 +3278,7 @@ DEF_INST( vector_merge_high )
 
     regs->VR_D( v1, 0 ) = SV_D( temp, 0 );
     regs->VR_D( v1, 1 ) = SV_D( temp, 1 );
+#endif
 
     ZVECTOR_END( regs );
 }
@@ -3034,8 +3306,12 @@ DEF_INST( vector_load_vr_from_grs_disjoint )
 DEF_INST( vector_sum_across_word )
 {
     int     v1, v2, v3, m4, m5, m6;
+#if defined( FEATURE_V128_SSE )
+    __m128i pair;
+#else
     int     i, j;
     U32     sum[4];
+#endif
 
     VRR_C( inst, regs, v1, v2, v3, m4, m5, m6 );
 
@@ -3045,6 +3321,27 @@ DEF_INST( vector_sum_across_word )
 
     ZVECTOR_CHECK( regs );
 
+#if defined( FEATURE_V128_SSE )
+    switch (m4)
+    {
+    case 0:  /* Byte */
+        /* add the byte pairs of each halfword, then the halfword pairs */
+        pair = _mm_add_epi16( _mm_and_si128( regs->VR_Q(v2).v, _mm_set1_epi16( 0x00FF )),
+                              _mm_srli_epi16( regs->VR_Q(v2).v, 8 ));
+        regs->VR_Q(v1).v = _mm_add_epi32( _mm_madd_epi16( pair, _mm_set1_epi16( 1 )),
+                              _mm_and_si128( regs->VR_Q(v3).v, _mm_set1_epi32( 0xFF )));
+        break;
+    case 1:  /* Halfword */
+        pair = _mm_add_epi32( _mm_and_si128( regs->VR_Q(v2).v, _mm_set1_epi32( 0xFFFF )),
+                              _mm_srli_epi32( regs->VR_Q(v2).v, 16 ));
+        regs->VR_Q(v1).v = _mm_add_epi32( pair,
+                              _mm_and_si128( regs->VR_Q(v3).v, _mm_set1_epi32( 0xFFFF )));
+        break;
+    default:
+        ARCH_DEP(program_interrupt) (regs, PGM_SPECIFICATION_EXCEPTION);
+        break;
+    }
+#else
     switch (m4)
     {
     case 0:  /* Byte */
@@ -3076,6 +3373,7 @@ DEF_INST( vector_sum_across_word )
     regs->VR_F(v1, 1) = sum[1];
     regs->VR_F(v1, 2) = sum[2];
     regs->VR_F(v1, 3) = sum[3];
+#endif
 
     ZVECTOR_END( regs );
 }
@@ -3086,8 +3384,12 @@ DEF_INST( vector_sum_across_word )
 DEF_INST( vector_sum_across_doubleword )
 {
     int     v1, v2, v3, m4, m5, m6;
+#if defined( FEATURE_V128_SSE )
+    __m128i pair;
+#else
     int     i, j;
     U64     sum[2];
+#endif
 
     VRR_C( inst, regs, v1, v2, v3, m4, m5, m6 );
 
@@ -3097,6 +3399,29 @@ DEF_INST( vector_sum_across_doubleword )
 
     ZVECTOR_CHECK( regs );
 
+#if defined( FEATURE_V128_SSE )
+    switch (m4)
+    {
+    case 1:  /* Halfword */
+        /* add the halfword pairs of each word, then the word pairs */
+        pair = _mm_add_epi32( _mm_and_si128( regs->VR_Q(v2).v, _mm_set1_epi32( 0xFFFF )),
+                              _mm_srli_epi32( regs->VR_Q(v2).v, 16 ));
+        regs->VR_Q(v1).v = _mm_add_epi64( _mm_add_epi64(
+                              _mm_and_si128( pair, _mm_set1_epi64x( 0xFFFFFFFF )),
+                              _mm_srli_epi64( pair, 32 )),
+                              _mm_and_si128( regs->VR_Q(v3).v, _mm_set1_epi64x( 0xFFFF )));
+        break;
+    case 2:  /* Word */
+        regs->VR_Q(v1).v = _mm_add_epi64( _mm_add_epi64(
+                              _mm_and_si128( regs->VR_Q(v2).v, _mm_set1_epi64x( 0xFFFFFFFF )),
+                              _mm_srli_epi64( regs->VR_Q(v2).v, 32 )),
+                              _mm_and_si128( regs->VR_Q(v3).v, _mm_set1_epi64x( 0xFFFFFFFF )));
+        break;
+    default:
+        ARCH_DEP(program_interrupt) (regs, PGM_SPECIFICATION_EXCEPTION);
+        break;
+    }
+#else
     switch (m4)
     {
     case 1:  /* Halfword */
@@ -3130,6 +3455,7 @@ DEF_INST( vector_sum_across_doubleword )
 
     regs->VR_D(v1, 0) = sum[0];
     regs->VR_D(v1, 1) = sum[1];
+#endif
 
     ZVECTOR_END( regs );
 }
@@ -3240,8 +3566,12 @@ DEF_INST( vector_and )
 
     ZVECTOR_CHECK( regs );
 
+#if defined( FEATURE_V128_SSE )
+    regs->VR_Q(v1).v = _mm_and_si128( regs->VR_Q(v2).v, regs->VR_Q(v3).v );
+#else
     regs->VR_D(v1, 0) = regs->VR_D(v2, 0) & regs->VR_D(v3, 0);
     regs->VR_D(v1, 1) = regs->VR_D(v2, 1) & regs->VR_D(v3, 1);
+#endif
 
     ZVECTOR_END( regs );
 }
@@ -3262,8 +3592,12 @@ DEF_INST( vector_and_with_complement )
 
     ZVECTOR_CHECK( regs );
 
+#if defined( FEATURE_V128_SSE )
+    regs->VR_Q(v1).v = _mm_andnot_si128( regs->VR_Q(v3).v, regs->VR_Q(v2).v );
+#else
     regs->VR_D(v1, 0) = regs->VR_D(v2, 0) & ~regs->VR_D(v3, 0);
     regs->VR_D(v1, 1) = regs->VR_D(v2, 1) & ~regs->VR_D(v3, 1);
+#endif
 
     ZVECTOR_END( regs );
 }
@@ -3284,8 +3618,12 @@ DEF_INST( vector_or )
 
     ZVECTOR_CHECK( regs );
 
+#if defined( FEATURE_V128_SSE )
+    regs->VR_Q(v1).v = _mm_or_si128( regs->VR_Q(v2).v, regs->VR_Q(v3).v );
+#else
     regs->VR_D(v1, 0) = regs->VR_D(v2, 0) | regs->VR_D(v3, 0);
     regs->VR_D(v1, 1) = regs->VR_D(v2, 1) | regs->VR_D(v3, 1);
+#endif
 
     ZVECTOR_END( regs );
 }
@@ -3306,8 +3644,12 @@ DEF_INST( vector_nor )
 
     ZVECTOR_CHECK( regs );
 
+#if defined( FEATURE_V128_SSE )
+    regs->VR_Q(v1).v = _mm_xor_si128( _mm_or_si128( regs->VR_Q(v2).v, regs->VR_Q(v3).v ), _mm_set1_epi32( -1 ) );
+#else
     regs->VR_D(v1, 0) = ~regs->VR_D(v2, 0) & ~regs->VR_D(v3, 0);
     regs->VR_D(v1, 1) = ~regs->VR_D(v2, 1) & ~regs->VR_D(v3, 1);
+#endif
 
     ZVECTOR_END( regs );
 }
@@ -3329,8 +3671,12 @@ DEF_INST( vector_not_exclusive_or )
 
     ZVECTOR_CHECK( regs );
 
+#if defined( FEATURE_V128_SSE )
+    regs->VR_Q(v1).v = _mm_xor_si128( _mm_xor_si128( regs->VR_Q(v2).v, regs->VR_Q(v3).v ), _mm_set1_epi32( -1 ) );
+#else
     regs->VR_D(v1, 0) = ~(regs->VR_D(v2, 0) ^ regs->VR_D(v3, 0));
     regs->VR_D(v1, 1) = ~(regs->VR_D(v2, 1) ^ regs->VR_D(v3, 1));
+#endif
 
     ZVECTOR_END( regs );
 }
@@ -3352,8 +3698,12 @@ DEF_INST( vector_exclusive_or )
 
     ZVECTOR_CHECK( regs );
 
+#if defined( FEATURE_V128_SSE )
+    regs->VR_Q(v1).v = _mm_xor_si128( regs->VR_Q(v2).v, regs->VR_Q(v3).v );
+#else
     regs->VR_D(v1, 0) = regs->VR_D(v2, 0) ^ regs->VR_D(v3, 0);
     regs->VR_D(v1, 1) = regs->VR_D(v2, 1) ^ regs->VR_D(v3, 1);
+#endif
 
     ZVECTOR_END( regs );
 }
@@ -3375,8 +3725,12 @@ DEF_INST( vector_nand )
 
     ZVECTOR_CHECK( regs );
 
+#if defined( FEATURE_V128_SSE )
+    regs->VR_Q(v1).v = _mm_xor_si128( _mm_and_si128( regs->VR_Q(v2).v, regs->VR_Q(v3).v ), _mm_set1_epi32( -1 ) );
+#else
     regs->VR_D(v1, 0) = ~regs->VR_D(v2, 0) | ~regs->VR_D(v3, 0);
     regs->VR_D(v1, 1) = ~regs->VR_D(v2, 1) | ~regs->VR_D(v3, 1);
+#endif
 
     ZVECTOR_END( regs );
 }
@@ -3399,8 +3753,12 @@ DEF_INST( vector_or_with_complement )
 
     ZVECTOR_CHECK( regs );
 
+#if defined( FEATURE_V128_SSE )
+    regs->VR_Q(v1).v = _mm_or_si128( regs->VR_Q(v2).v, _mm_xor_si128( regs->VR_Q(v3).v, _mm_set1_epi32( -1 ) ));
+#else
     regs->VR_D(v1, 0) = regs->VR_D(v2, 0) | ~regs->VR_D(v3, 0);
     regs->VR_D(v1, 1) = regs->VR_D(v2, 1) | ~regs->VR_D(v3, 1);
+#endif
 
     ZVECTOR_END( regs );
 }
@@ -3907,7 +4265,10 @@ DEF_INST( vector_shift_right_arithmetic_by_byte )
 DEF_INST( vector_find_element_equal )
 {
     int     v1, v2, v3, m4, m5;
-    int     ef, ei, zf, zi, i;
+    int     ef, ei, zf, zi;
+#if !defined( FEATURE_V128_SSE )
+    int     i;
+#endif
     BYTE    newcc;
 
     VRR_B( inst, regs, v1, v2, v3, m4, m5 );
@@ -3924,6 +4285,15 @@ DEF_INST( vector_find_element_equal )
     zf = ef = FALSE;
     zi = ei = 16;     // Number of bytes in vector
 
+#if defined( FEATURE_V128_SSE )
+    ei = vec_first_byte( _mm_movemask_epi8( vec_cmpeq( regs->VR_Q(v2).v, regs->VR_Q(v3).v, m4 )));
+    ef = ei < 16;
+    if (M5_ZS)
+    {
+        zi = vec_first_byte( _mm_movemask_epi8( vec_cmpeq( regs->VR_Q(v2).v, _mm_setzero_si128(), m4 )));
+        zf = zi < 16;
+    }
+#else
     switch (m4)
     {
     case 0:  /* Byte */
@@ -3996,6 +4366,7 @@ DEF_INST( vector_find_element_equal )
         }
         break;
     }
+#endif
 
     if (ef == TRUE)
     {
@@ -4048,7 +4419,10 @@ DEF_INST( vector_find_element_equal )
 DEF_INST( vector_find_element_not_equal )
 {
     int     v1, v2, v3, m4, m5;
-    int     nef, nei, zf, zi, i;
+    int     nef, nei, zf, zi;
+#if !defined( FEATURE_V128_SSE )
+    int     i;
+#endif
     BYTE    newcc;
 
     VRR_B( inst, regs, v1, v2, v3, m4, m5 );
@@ -4066,6 +4440,30 @@ DEF_INST( vector_find_element_not_equal )
     zi = nei = 16;  // Number of bytes in vector
     newcc = 3;  // All equal, no zero
 
+#if defined( FEATURE_V128_SSE )
+    nei = vec_first_byte( _mm_movemask_epi8( vec_cmpeq( regs->VR_Q(v2).v, regs->VR_Q(v3).v, m4 )) ^ 0xFFFF );
+    if (nei < 16)
+    {
+        nef = TRUE;
+        switch (m4)
+        {
+        case 0:  /* Byte */
+            newcc = (regs->VR_B(v2,nei) < regs->VR_B(v3,nei)) ? 1 : 2;
+            break;
+        case 1:  /* Halfword */
+            newcc = (regs->VR_H(v2,nei/2) < regs->VR_H(v3,nei/2)) ? 1 : 2;
+            break;
+        case 2:  /* Word */
+            newcc = (regs->VR_F(v2,nei/4) < regs->VR_F(v3,nei/4)) ? 1 : 2;
+            break;
+        }
+    }
+    if (M5_ZS)
+    {
+        zi = vec_first_byte( _mm_movemask_epi8( vec_cmpeq( regs->VR_Q(v2).v, _mm_setzero_si128(), m4 )));
+        zf = zi < 16;
+    }
+#else
     switch (m4)
     {
     case 0:  /* Byte */
@@ -4141,6 +4539,7 @@ DEF_INST( vector_find_element_not_equal )
         }
         break;
     }
+#endif
 
     if (nef == TRUE)
     {
@@ -4211,10 +4610,14 @@ DEF_INST( vector_find_any_element_equal )
 {
 
     int     v1, v2, v3, m4, m5;
+#if defined( FEATURE_V128_SSE )
+    __m128i irt1, irt2;                // First and second intermediate results
+#else
     int     i, j;
     int     lxt1, lxt2;                // Lowest indexed true
     int     mxt;                       // Maximum indexed true
     BYTE    irt1[16], irt2[16];        // First and second intermediate results
+#endif
 
     VRR_B( inst, regs, v1, v2, v3, m4, m5 );
 
@@ -4225,6 +4628,18 @@ DEF_INST( vector_find_any_element_equal )
 #define M5_ZS ((m5 & 0x2) != 0) // Zero Search
 #define M5_CS ((m5 & 0x1) != 0) // Condition Code Set
 
+#if defined( FEATURE_V128_SSE )
+    if (m4 > 2)
+        ARCH_DEP( program_interrupt )( regs, PGM_SPECIFICATION_EXCEPTION );
+
+    irt1 = vec_cmpeq_any( regs->VR_Q(v2).v, &regs->VR_Q(v3), m4 );
+    if (M5_IN)
+        irt1 = _mm_xor_si128( irt1, _mm_set1_epi32( -1 ));
+    irt2 = M5_ZS ? vec_cmpeq( regs->VR_Q(v2).v, _mm_setzero_si128(), m4 )
+                 : _mm_setzero_si128();
+
+    vec_string_result( regs, v1, irt1, irt2, M5_RT, M5_CS );
+#else
     for (i=0; i<16; i++)
     {
         irt1[i] = irt2[i] = FALSE;
@@ -4391,6 +4806,7 @@ DEF_INST( vector_find_any_element_equal )
         else
             regs->psw.cc = 0;
     }
+#endif
 
 #undef M5_IN
 #undef M5_RT
@@ -4665,11 +5081,18 @@ DEF_INST( vector_blend )
 DEF_INST( vector_string_range_compare )
 {
     int     v1, v2, v3, v4, m5, m6;
+#if defined( FEATURE_V128_SSE )
+    int     j;
+    __m128i irt1, irt2;                // First and second intermediate results
+    __m128i erc, orc;                  // Even and Odd range comparison results
+    __m128i bias, op2;                 // Sign flip for logical compares
+#else
     int     i, j;
     int     lxt1, lxt2;                // Lowest indexed true
     int     mxt;                       // Maximum indexed true
     BYTE    irt1[16], irt2[16];        // First and second intermediate results
     BYTE    erc, orc;                  // Even and Odd range comparison results
+#endif
 
     VRR_D( inst, regs, v1, v2, v3, v4, m5, m6 );
 
@@ -4680,6 +5103,67 @@ DEF_INST( vector_string_range_compare )
 #define M6_ZS ((m6 & 0x2) != 0) // Zero Search
 #define M6_CS ((m6 & 0x1) != 0) // Condition Code Set
 
+#if defined( FEATURE_V128_SSE )
+    /* Each range is an even/odd pair of third operand elements with  */
+    /* equal, low and high controls in the fourth operand elements     */
+    irt1 = erc = _mm_setzero_si128();
+
+    switch (m5)
+    {
+    case 0:  /* Byte */
+        bias = _mm_set1_epi8( (char) 0x80 );
+        op2  = _mm_xor_si128( regs->VR_Q(v2).v, bias );
+        for (j=0; j<16; j++)
+        {
+            __m128i op3 = _mm_set1_epi8( (char) (regs->VR_B(v3, j) ^ 0x80) );
+            __m128i rc  = _mm_setzero_si128();
+            if (regs->VR_B(v4, j) & 0x80) rc = _mm_or_si128( rc, _mm_cmpeq_epi8( op2, op3 ));
+            if (regs->VR_B(v4, j) & 0x40) rc = _mm_or_si128( rc, _mm_cmpgt_epi8( op3, op2 ));
+            if (regs->VR_B(v4, j) & 0x20) rc = _mm_or_si128( rc, _mm_cmpgt_epi8( op2, op3 ));
+            if (j & 1) { orc = rc; irt1 = _mm_or_si128( irt1, _mm_and_si128( erc, orc )); }
+            else         erc = rc;
+        }
+        break;
+    case 1:  /* Halfword */
+        bias = _mm_set1_epi16( (short) 0x8000 );
+        op2  = _mm_xor_si128( regs->VR_Q(v2).v, bias );
+        for (j=0; j<8; j++)
+        {
+            __m128i op3 = _mm_set1_epi16( (short) (regs->VR_H(v3, j) ^ 0x8000) );
+            __m128i rc  = _mm_setzero_si128();
+            if (regs->VR_H(v4, j) & 0x8000) rc = _mm_or_si128( rc, _mm_cmpeq_epi16( op2, op3 ));
+            if (regs->VR_H(v4, j) & 0x4000) rc = _mm_or_si128( rc, _mm_cmpgt_epi16( op3, op2 ));
+            if (regs->VR_H(v4, j) & 0x2000) rc = _mm_or_si128( rc, _mm_cmpgt_epi16( op2, op3 ));
+            if (j & 1) { orc = rc; irt1 = _mm_or_si128( irt1, _mm_and_si128( erc, orc )); }
+            else         erc = rc;
+        }
+        break;
+    case 2:  /* Word */
+        bias = _mm_set1_epi32( (int) 0x80000000 );
+        op2  = _mm_xor_si128( regs->VR_Q(v2).v, bias );
+        for (j=0; j<4; j++)
+        {
+            __m128i op3 = _mm_set1_epi32( (int) (regs->VR_F(v3, j) ^ 0x80000000) );
+            __m128i rc  = _mm_setzero_si128();
+            if (regs->VR_F(v4, j) & 0x80000000) rc = _mm_or_si128( rc, _mm_cmpeq_epi32( op2, op3 ));
+            if (regs->VR_F(v4, j) & 0x40000000) rc = _mm_or_si128( rc, _mm_cmpgt_epi32( op3, op2 ));
+            if (regs->VR_F(v4, j) & 0x20000000) rc = _mm_or_si128( rc, _mm_cmpgt_epi32( op2, op3 ));
+            if (j & 1) { orc = rc; irt1 = _mm_or_si128( irt1, _mm_and_si128( erc, orc )); }
+            else         erc = rc;
+        }
+        break;
+    default:
+        ARCH_DEP( program_interrupt )( regs, PGM_SPECIFICATION_EXCEPTION );
+        break;
+    }
+
+    if (M6_IN)
+        irt1 = _mm_xor_si128( irt1, _mm_set1_epi32( -1 ));
+    irt2 = M6_ZS ? vec_cmpeq( regs->VR_Q(v2).v, _mm_setzero_si128(), m5 )
+                 : _mm_setzero_si128();
+
+    vec_string_result( regs, v1, irt1, irt2, M6_RT, M6_CS );
+#else
     for (i=0; i<16; i++)
     {
         irt1[i] = irt2[i] = FALSE;
@@ -4858,6 +5342,7 @@ DEF_INST( vector_string_range_compare )
         else
             regs->psw.cc = 0;
     }
+#endif
 
 #undef M6_IN
 #undef M6_RT
@@ -4884,8 +5369,14 @@ DEF_INST( vector_string_range_compare )
 DEF_INST( vector_string_search )
 {
     int     v1, v2, v3, v4, m5, m6;
-    char    v2_temp[16], v3_temp[16], nulls[16];
+    char    v2_temp[16], v3_temp[16];
     int     substr_len, char_size, str_len, eos, i, k;
+#if defined( FEATURE_V128_SSE )
+    __m128i first;                      /* first substring character     */
+    int     cand;                       /* positions starting with it    */
+#else
+    char    nulls[16];
+#endif
 
     VRR_D( inst, regs, v1, v2, v3, v4, m5, m6 );
 
@@ -4925,8 +5416,23 @@ DEF_INST( vector_string_search )
 
     str_len = eos = i = k = 0;
 
+#if defined( FEATURE_V128_SSE )
+    /* A match can only start where the first character of the       */
+    /* substring is found, so the searches below skip to those       */
+    switch (m5)
+    {
+    case 0:  first = _mm_set1_epi8 ( (char)  regs->VR_B( v3, 0 ) ); break;
+    case 1:  first = _mm_set1_epi16( (short) regs->VR_H( v3, 0 ) ); break;
+    default: first = _mm_set1_epi32( (int)   regs->VR_F( v3, 0 ) ); break;
+    }
+    cand = _mm_movemask_epi8( vec_cmpeq( regs->VR_Q(v2).v, first, m5 ));
+#endif
+
     if (M6_ZS)
     {
+#if defined( FEATURE_V128_SSE )
+        i = vec_first_byte( _mm_movemask_epi8( vec_cmpeq( regs->VR_Q(v3).v, _mm_setzero_si128(), m5 )));
+#else
         memset( nulls, 0, sizeof(nulls) );
 
         for (i = 0; i < 16; i += char_size)
@@ -4936,6 +5442,7 @@ DEF_INST( vector_string_search )
                 break;
             }
         }
+#endif
 
         if ( i < substr_len )
         {
@@ -4953,6 +5460,10 @@ DEF_INST( vector_string_search )
                 substr_len = 16;
             }
 
+#if defined( FEATURE_V128_SSE )
+            k = vec_first_byte( _mm_movemask_epi8( vec_cmpeq( regs->VR_Q(v2).v, _mm_setzero_si128(), m5 )));
+            eos = k < 16;
+#else
             for ( ; k < 16 ; k += char_size )
             {
                 if ( memcmp(&v2_temp[k], &nulls, char_size) == 0 )
@@ -4961,6 +5472,7 @@ DEF_INST( vector_string_search )
                     break;
                 }
             }
+#endif
 
             str_len = k;
             k = 0;
@@ -4972,6 +5484,9 @@ DEF_INST( vector_string_search )
 
             for ( ; ; k += char_size )
             {
+#if defined( FEATURE_V128_SSE )
+                k = vec_next_byte( cand, k );
+#endif
                 if ( k < str_len )
                 {
                     if ( eos == 0 || ( k + substr_len ) <= str_len )
@@ -5021,6 +5536,9 @@ DEF_INST( vector_string_search )
             }
             for ( ; ; k += char_size )
             {
+#if defined( FEATURE_V128_SSE )
+                k = vec_next_byte( cand, k );
+#endif
                 if (k == 16)
                 {
                     goto vector_string_search_no_match;
@@ -5093,8 +5611,12 @@ vector_string_search_end:
 DEF_INST( vector_permute )
 {
     int     v1, v2, v3, v4, m5, m6;
+#if defined( FEATURE_V128_SSE )
+    __m128i idx, hi;
+#else
     int     i, j;
     SV      temp;
+#endif
 
     VRR_E( inst, regs, v1, v2, v3, v4, m5, m6 );
 
@@ -5104,6 +5626,16 @@ DEF_INST( vector_permute )
 
     ZVECTOR_CHECK( regs );
 
+#if defined( FEATURE_V128_SSE )
+    /* Byte j of the 32-byte source v2||v3 is host byte 15-(j & 15)   */
+    /* of v2 or v3, so shuffle both and select by bit 0x10 of j        */
+    idx = _mm_xor_si128( _mm_and_si128( regs->VR_Q(v4).v, _mm_set1_epi8( 0x0F )),
+                         _mm_set1_epi8( 0x0F ));
+    hi  = _mm_cmpeq_epi8( _mm_and_si128( regs->VR_Q(v4).v, _mm_set1_epi8( 0x10 )),
+                          _mm_set1_epi8( 0x10 ));
+    regs->VR_Q(v1).v = _mm_or_si128( _mm_and_si128( hi, _mm_shuffle_epi8( regs->VR_Q(v3).v, idx )),
+                                    _mm_andnot_si128( hi, _mm_shuffle_epi8( regs->VR_Q(v2).v, idx )));
+#else
     SV_D( temp, 0 ) = regs->VR_D( v2, 0 );
     SV_D( temp, 1 ) = regs->VR_D( v2, 1 );
     SV_D( temp, 2 ) = regs->VR_D( v3, 0 );
@@ -5113,6 +5645,7 @@ DEF_INST( vector_permute )
         j = regs->VR_B(v4, i) & 0x1f;
         regs->VR_B(v1, i) = SV_B( temp, j );
     }
+#endif
 
     ZVECTOR_END( regs );
 }
@@ -5132,8 +5665,13 @@ DEF_INST( vector_select )
 
     ZVECTOR_CHECK( regs );
 
+#if defined( FEATURE_V128_SSE )
+    regs->VR_Q(v1).v = _mm_or_si128( _mm_and_si128( regs->VR_Q(v4).v, regs->VR_Q(v2).v ),
+                                    _mm_andnot_si128( regs->VR_Q(v4).v, regs->VR_Q(v3).v ));
+#else
     regs->VR_D(v1, 1) = (regs->VR_D(v4, 1) & regs->VR_D(v2, 1)) | (~regs->VR_D(v4, 1) & regs->VR_D(v3, 1));
     regs->VR_D(v1, 0) = (regs->VR_D(v4, 0) & regs->VR_D(v2, 0)) | (~regs->VR_D(v4, 0) & regs->VR_D(v3, 0));
+#endif
 
     ZVECTOR_END( regs );
 }
@@ -7565,7 +8103,10 @@ DEF_INST( vector_average )
 /*-------------------------------------------------------------------*/
 DEF_INST(vector_add)
 {
-    int     v1, v2, v3, m4, m5, m6, i;
+    int     v1, v2, v3, m4, m5, m6;
+#if !defined( FEATURE_V128_SSE )
+    int     i;
+#endif
     U128    temp;
 #if defined( _MSVC_ )
     U128    copyv2, copyv3;
@@ -7582,24 +8123,40 @@ DEF_INST(vector_add)
     switch (m4)
     {
     case 0:  /* Byte */
+#if defined( FEATURE_V128_SSE )
+        regs->VR_Q(v1).v = _mm_add_epi8( regs->VR_Q(v2).v, regs->VR_Q(v3).v );
+#else
         for (i=0; i < 16; i++) {
             regs->VR_B(v1, i) = (S8) regs->VR_B(v2, i) + (S8) regs->VR_B(v3, i);
         }
+#endif
         break;
     case 1:  /* Halfword */
+#if defined( FEATURE_V128_SSE )
+        regs->VR_Q(v1).v = _mm_add_epi16( regs->VR_Q(v2).v, regs->VR_Q(v3).v );
+#else
         for (i=0; i < 8; i++) {
             regs->VR_H(v1, i) = (S16) regs->VR_H(v2, i) + (S16) regs->VR_H(v3, i);
         }
+#endif
         break;
     case 2:  /* Word */
+#if defined( FEATURE_V128_SSE )
+        regs->VR_Q(v1).v = _mm_add_epi32( regs->VR_Q(v2).v, regs->VR_Q(v3).v );
+#else
         for (i=0; i < 4; i++) {
             regs->VR_F(v1, i) = (S32) regs->VR_F(v2, i) + (S32) regs->VR_F(v3, i);
         }
+#endif
         break;
     case 3:  /* Doubleword */
+#if defined( FEATURE_V128_SSE )
+        regs->VR_Q(v1).v = _mm_add_epi64( regs->VR_Q(v2).v, regs->VR_Q(v3).v );
+#else
         for (i=0; i < 2; i++) {
             regs->VR_D(v1, i) = (S64) regs->VR_D(v2, i) + (S64) regs->VR_D(v3, i);
         }
+#endif
         break;
     case 4:  /* Quadword */
 #if defined( _MSVC_ )
@@ -7678,7 +8235,10 @@ DEF_INST( vector_subtract_compute_borrow_indication )
 /*-------------------------------------------------------------------*/
 DEF_INST(vector_subtract)
 {
-    int     v1, v2, v3, m4, m5, m6, i;
+    int     v1, v2, v3, m4, m5, m6;
+#if !defined( FEATURE_V128_SSE )
+    int     i;
+#endif
     U128    temp;
 #if defined( _MSVC_ )
     U128    copyv2, copyv3;
@@ -7695,24 +8255,40 @@ DEF_INST(vector_subtract)
     switch (m4)
     {
     case 0:  /* Byte */
+#if defined( FEATURE_V128_SSE )
+        regs->VR_Q(v1).v = _mm_sub_epi8( regs->VR_Q(v2).v, regs->VR_Q(v3).v );
+#else
         for (i=0; i < 16; i++) {
             regs->VR_B(v1, i) = (S8) regs->VR_B(v2, i) - (S8) regs->VR_B(v3, i);
         }
+#endif
         break;
     case 1:  /* Halfword */
+#if defined( FEATURE_V128_SSE )
+        regs->VR_Q(v1).v = _mm_sub_epi16( regs->VR_Q(v2).v, regs->VR_Q(v3).v );
+#else
         for (i=0; i < 8; i++) {
             regs->VR_H(v1, i) = (S16) regs->VR_H(v2, i) - (S16) regs->VR_H(v3, i);
         }
+#endif
         break;
     case 2:  /* Word */
+#if defined( FEATURE_V128_SSE )
+        regs->VR_Q(v1).v = _mm_sub_epi32( regs->VR_Q(v2).v, regs->VR_Q(v3).v );
+#else
         for (i=0; i < 4; i++) {
             regs->VR_F(v1, i) = (S32) regs->VR_F(v2, i) - (S32) regs->VR_F(v3, i);
         }
+#endif
         break;
     case 3:  /* Doubleword */
+#if defined( FEATURE_V128_SSE )
+        regs->VR_Q(v1).v = _mm_sub_epi64( regs->VR_Q(v2).v, regs->VR_Q(v3).v );
+#else
         for (i=0; i < 2; i++) {
             regs->VR_D(v1, i) = (S64)regs->VR_D(v2, i) - (S64)regs->VR_D(v3, i);
         }
+#endif
         break;
     case 4:  /* Quadword */
 #if defined( _MSVC_ )
@@ -7738,7 +8314,10 @@ DEF_INST(vector_subtract)
 DEF_INST( vector_compare_equal )
 {
     int     v1, v2, v3, m4, m5;
-    int     i, el, eq = 0;
+    int     el, eq = 0;
+#if !defined( FEATURE_V128_SSE )
+    int     i;
+#endif
 
     VRR_B( inst, regs, v1, v2, v3, m4, m5 );
 
@@ -7749,6 +8328,11 @@ DEF_INST( vector_compare_equal )
     switch (m4)
     {
     case 0:  /* Byte */
+#if defined( FEATURE_V128_SSE )
+        regs->VR_Q(v1).v = _mm_cmpeq_epi8( regs->VR_Q(v2).v, regs->VR_Q(v3).v );
+        el = 16;
+        eq = vec_mask_count( regs->VR_Q(v1).v, el );
+#else
         for (el=16, i=0; i < 16; i++) {
             if (regs->VR_B(v2, i) == regs->VR_B(v3, i)) {
                 regs->VR_B(v1, i) = 0xff;
@@ -7758,8 +8342,14 @@ DEF_INST( vector_compare_equal )
                 regs->VR_B(v1, i) = 0x00;
             }
         }
+#endif
         break;
     case 1:  /* Halfword */
+#if defined( FEATURE_V128_SSE )
+        regs->VR_Q(v1).v = _mm_cmpeq_epi16( regs->VR_Q(v2).v, regs->VR_Q(v3).v );
+        el = 8;
+        eq = vec_mask_count( regs->VR_Q(v1).v, el );
+#else
         for (el=8, i=0; i < 8; i++) {
             if (regs->VR_H(v2, i) == regs->VR_H(v3, i)) {
                 regs->VR_H(v1, i) = 0xffff;
@@ -7769,8 +8359,14 @@ DEF_INST( vector_compare_equal )
                 regs->VR_H(v1, i) = 0x0000;
             }
         }
+#endif
         break;
     case 2:  /* Word */
+#if defined( FEATURE_V128_SSE )
+        regs->VR_Q(v1).v = _mm_cmpeq_epi32( regs->VR_Q(v2).v, regs->VR_Q(v3).v );
+        el = 4;
+        eq = vec_mask_count( regs->VR_Q(v1).v, el );
+#else
         for (el=4, i=0; i < 4; i++) {
             if (regs->VR_F(v2, i) == regs->VR_F(v3, i)) {
                 regs->VR_F(v1, i) = 0xFFFFFFFF;
@@ -7780,8 +8376,14 @@ DEF_INST( vector_compare_equal )
                 regs->VR_F(v1, i) = 0x00000000;
             }
         }
+#endif
         break;
     case 3:  /* Doubleword */
+#if defined( FEATURE_V128_SSE )
+        regs->VR_Q(v1).v = _mm_cmpeq_epi64( regs->VR_Q(v2).v, regs->VR_Q(v3).v );
+        el = 2;
+        eq = vec_mask_count( regs->VR_Q(v1).v, el );
+#else
         for (el=2, i=0; i < 2; i++) {
             if (regs->VR_D(v2, i) == regs->VR_D(v3, i)) {
                 regs->VR_D(v1, i) = 0xFFFFFFFFFFFFFFFFull;
@@ -7791,6 +8393,7 @@ DEF_INST( vector_compare_equal )
                 regs->VR_D(v1, i) = 0x0000000000000000ull;
             }
         }
+#endif
         break;
     default:
         ARCH_DEP( program_interrupt )( regs, PGM_SPECIFICATION_EXCEPTION );
@@ -7817,7 +8420,10 @@ DEF_INST( vector_compare_equal )
 DEF_INST( vector_compare_high_logical )
 {
     int     v1, v2, v3, m4, m5;
-    int     i, el, hi = 0;
+    int     el, hi = 0;
+#if !defined( FEATURE_V128_SSE )
+    int     i;
+#endif
 
     VRR_B( inst, regs, v1, v2, v3, m4, m5 );
 
@@ -7828,6 +8434,12 @@ DEF_INST( vector_compare_high_logical )
     switch (m4)
     {
     case 0:         /* Byte */
+#if defined( FEATURE_V128_SSE )
+        regs->VR_Q(v1).v = _mm_cmpgt_epi8( _mm_xor_si128( regs->VR_Q(v2).v, _mm_set1_epi8( (char) 0x80 ) ),
+                                          _mm_xor_si128( regs->VR_Q(v3).v, _mm_set1_epi8( (char) 0x80 ) ));
+        el = 16;
+        hi = vec_mask_count( regs->VR_Q(v1).v, el );
+#else
         for (el=16, i=0; i < 16; i++) {
             if (regs->VR_B(v2, i) > regs->VR_B(v3, i)) {
                 regs->VR_B(v1, i) = 0xff;
@@ -7837,9 +8449,16 @@ DEF_INST( vector_compare_high_logical )
                 regs->VR_B(v1, i) = 0x00;
             }
         }
+#endif
         break;
 
     case 1:        /* Halfword */
+#if defined( FEATURE_V128_SSE )
+        regs->VR_Q(v1).v = _mm_cmpgt_epi16( _mm_xor_si128( regs->VR_Q(v2).v, _mm_set1_epi16( (short) 0x8000 ) ),
+                                          _mm_xor_si128( regs->VR_Q(v3).v, _mm_set1_epi16( (short) 0x8000 ) ));
+        el = 8;
+        hi = vec_mask_count( regs->VR_Q(v1).v, el );
+#else
         for (el=8, i=0; i < 8; i++) {
             if (regs->VR_H(v2, i) > regs->VR_H(v3, i)) {
                 regs->VR_H(v1, i) = 0xffff;
@@ -7849,9 +8468,16 @@ DEF_INST( vector_compare_high_logical )
                 regs->VR_H(v1, i) = 0x0000;
             }
         }
+#endif
         break;
 
     case 2:         /* Word */
+#if defined( FEATURE_V128_SSE )
+        regs->VR_Q(v1).v = _mm_cmpgt_epi32( _mm_xor_si128( regs->VR_Q(v2).v, _mm_set1_epi32( (int) 0x80000000 ) ),
+                                          _mm_xor_si128( regs->VR_Q(v3).v, _mm_set1_epi32( (int) 0x80000000 ) ));
+        el = 4;
+        hi = vec_mask_count( regs->VR_Q(v1).v, el );
+#else
         for (el=4, i=0; i < 4; i++) {
             if (regs->VR_F(v2, i) > regs->VR_F(v3, i)) {
                 regs->VR_F(v1, i) = 0xFFFFFFFF;
@@ -7861,9 +8487,16 @@ DEF_INST( vector_compare_high_logical )
                 regs->VR_F(v1, i) = 0x00000000;
             }
         }
+#endif
         break;
 
     case 3:        /* Doubleword */
+#if defined( FEATURE_V128_SSE )
+        regs->VR_Q(v1).v = _mm_cmpgt_epi64( _mm_xor_si128( regs->VR_Q(v2).v, _mm_set1_epi64x( (S64) 0x8000000000000000ull ) ),
+                                          _mm_xor_si128( regs->VR_Q(v3).v, _mm_set1_epi64x( (S64) 0x8000000000000000ull ) ));
+        el = 2;
+        hi = vec_mask_count( regs->VR_Q(v1).v, el );
+#else
         for (el=2, i=0; i < 2; i++) {
             if (regs->VR_D(v2, i) > regs->VR_D(v3, i)) {
                 regs->VR_D(v1, i) = 0xFFFFFFFFFFFFFFFFull;
@@ -7873,6 +8506,7 @@ DEF_INST( vector_compare_high_logical )
                 regs->VR_D(v1, i) = 0x0000000000000000ull;
             }
         }
+#endif
         break;
 
     default:
@@ -7900,7 +8534,10 @@ DEF_INST( vector_compare_high_logical )
 DEF_INST( vector_compare_high )
 {
     int     v1, v2, v3, m4, m5;
-    int     i, el, hi = 0;
+    int     el, hi = 0;
+#if !defined( FEATURE_V128_SSE )
+    int     i;
+#endif
 
     VRR_B( inst, regs, v1, v2, v3, m4, m5 );
 
@@ -7911,6 +8548,11 @@ DEF_INST( vector_compare_high )
     switch (m4)
     {
     case 0:         /* Byte */
+#if defined( FEATURE_V128_SSE )
+        regs->VR_Q(v1).v = _mm_cmpgt_epi8( regs->VR_Q(v2).v, regs->VR_Q(v3).v );
+        el = 16;
+        hi = vec_mask_count( regs->VR_Q(v1).v, el );
+#else
         for (el=16, i=0; i < 16; i++) {
             if ( (S8) regs->VR_B(v2, i) > (S8) regs->VR_B(v3, i) ) {
                 regs->VR_B(v1, i) = 0xff;
@@ -7920,9 +8562,15 @@ DEF_INST( vector_compare_high )
                 regs->VR_B(v1, i) = 0x00;
             }
         }
+#endif
         break;
 
     case 1:        /* Halfword */
+#if defined( FEATURE_V128_SSE )
+        regs->VR_Q(v1).v = _mm_cmpgt_epi16( regs->VR_Q(v2).v, regs->VR_Q(v3).v );
+        el = 8;
+        hi = vec_mask_count( regs->VR_Q(v1).v, el );
+#else
         for (el=8, i=0; i < 8; i++) {
             if ( (S16) regs->VR_H(v2, i) > (S16) regs->VR_H(v3, i) ) {
                 regs->VR_H(v1, i) = 0xffff;
@@ -7932,9 +8580,15 @@ DEF_INST( vector_compare_high )
                 regs->VR_H(v1, i) = 0x0000;
             }
         }
+#endif
         break;
 
     case 2:         /* Word */
+#if defined( FEATURE_V128_SSE )
+        regs->VR_Q(v1).v = _mm_cmpgt_epi32( regs->VR_Q(v2).v, regs->VR_Q(v3).v );
+        el = 4;
+        hi = vec_mask_count( regs->VR_Q(v1).v, el );
+#else
         for (el=4, i=0; i < 4; i++) {
             if ( (S32) regs->VR_F(v2, i) > (S32) regs->VR_F(v3, i) ) {
                 regs->VR_F(v1, i) = 0xFFFFFFFF;
@@ -7944,9 +8598,15 @@ DEF_INST( vector_compare_high )
                 regs->VR_F(v1, i) = 0x00000000;
             }
         }
+#endif
         break;
 
     case 3:        /* Doubleword */
+#if defined( FEATURE_V128_SSE )
+        regs->VR_Q(v1).v = _mm_cmpgt_epi64( regs->VR_Q(v2).v, regs->VR_Q(v3).v );
+        el = 2;
+        hi = vec_mask_count( regs->VR_Q(v1).v, el );
+#else
         for (el=2, i=0; i < 2; i++) {
             if ( (S64) regs->VR_D(v2, i) > (S64) regs->VR_D(v3, i) ) {
                 regs->VR_D(v1, i) = 0xFFFFFFFFFFFFFFFFull;
@@ -7956,6 +8616,7 @@ DEF_INST( vector_compare_high )
                 regs->VR_D(v1, i) = 0x0000000000000000ull;
             }
         }
+#endif
         break;
 
     default:
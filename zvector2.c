@@ -459,6 +459,103 @@ static inline void dc_logmsg( const char * msg, decContext* set  )
     logmsg("%s: decContext: rounding %d \n", msg, rounding);
 }
 
+/*===================================================================*/
+/* Packed Decimal Digit Helpers                                      */
+/*===================================================================*/
+/* Programmer's note:                                                */
+/*                                                                   */
+/* A signed packed decimal VR is handled as two U64 values:          */
+/* VR_D( v, 0 ) holds digits 1-16 and VR_D( v, 1 ) holds digits      */
+/* 17-31 followed by the sign. Each digit is a nibble, so sixteen    */
+/* digits are tested or converted at once rather than one nibble at  */
+/* a time.                                                           */
+/*===================================================================*/
+
+/*-------------------------------------------------------------------*/
+/* Invalid digits of sixteen packed digits                           */
+/*                                                                   */
+/* Input:                                                            */
+/*      packed  sixteen packed digits                                */
+/*                                                                   */
+/* Returns:                                                          */
+/*              the 8 bit of each digit that is A-F (the 8 bit and   */
+/*              the 4 or 2 bit are set); zero if all are 0-9         */
+/*-------------------------------------------------------------------*/
+static inline U64 packed16_invalid_digits( U64 packed )
+{
+    return packed & ( ( packed << 1 ) | ( packed << 2 ) ) & 0x8888888888888888ULL;
+}
+
+/*-------------------------------------------------------------------*/
+/* Convert sixteen packed digits to binary                           */
+/*                                                                   */
+/* Input:                                                            */
+/*      packed  sixteen valid packed digits                          */
+/*                                                                   */
+/* Returns:                                                          */
+/*              binary value (0 to 10**16 - 1)                       */
+/*-------------------------------------------------------------------*/
+static inline U64 packed16_to_binary( U64 packed )
+{
+    /* combine digits into 2, 4, 8 and then 16 digit values */
+    packed = (packed       & 0x0F0F0F0F0F0F0F0FULL) + ((packed >>  4) & 0x0F0F0F0F0F0F0F0FULL) * 10;
+    packed = (packed       & 0x00FF00FF00FF00FFULL) + ((packed >>  8) & 0x00FF00FF00FF00FFULL) * 100;
+    packed = (packed       & 0x0000FFFF0000FFFFULL) + ((packed >> 16) & 0x0000FFFF0000FFFFULL) * 10000;
+    return   (packed       & 0x00000000FFFFFFFFULL) +  (packed >> 32)                          * 100000000;
+}
+
+/*-------------------------------------------------------------------*/
+/* Convert binary to sixteen packed digits                           */
+/*                                                                   */
+/* Input:                                                            */
+/*      binary  value to convert (0 to 10**16 - 1)                   */
+/*                                                                   */
+/* Returns:                                                          */
+/*              sixteen packed digits                                */
+/*-------------------------------------------------------------------*/
+static inline U64 binary_to_packed16( U64 binary )
+{
+    U64     packed = 0;        /* packed digits                      */
+    U32     pair;              /* next two digits                    */
+    int     shift;             /* position of the two digits         */
+
+    for ( shift = 0; binary != 0; shift += 8, binary /= 100 )
+    {
+        pair    = (U32) (binary % 100);
+        packed |= (U64) (((pair / 10) << 4) | (pair % 10)) << shift;
+    }
+
+    return packed;
+}
+
+#if defined( _USE_128_ )
+/*-------------------------------------------------------------------*/
+/* Power of ten as an unsigned 128 bit value                         */
+/*                                                                   */
+/* Input:                                                            */
+/*      n       exponent (0-38)                                      */
+/*                                                                   */
+/*-------------------------------------------------------------------*/
+static inline unsigned __int128 pow10_128( int n )
+{
+    static const U64 pow10[20] =
+    {
+        1ULL,                   10ULL,                  100ULL,
+        1000ULL,                10000ULL,               100000ULL,
+        1000000ULL,             10000000ULL,            100000000ULL,
+        1000000000ULL,          10000000000ULL,         100000000000ULL,
+        1000000000000ULL,       10000000000000ULL,      100000000000000ULL,
+        1000000000000000ULL,    10000000000000000ULL,   100000000000000000ULL,
+        1000000000000000000ULL, 10000000000000000000ULL
+    };
+
+    if ( n < 20 )
+        return pow10[ n ];
+
+    return (unsigned __int128) pow10[ n - 19 ] * pow10[ 19 ];
+}
+#endif /* defined( _USE_128_ ) */
+
 /*===================================================================*/
 /* Local Vector Register Helpers                                     */
 /*===================================================================*/
@@ -493,18 +590,9 @@ static inline void dc_logmsg( const char * msg, decContext* set  )
 /*-------------------------------------------------------------------*/
 static inline bool  lv_packed_valid_digits ( LOCAL_REGS* regs, int v1 )
 {
-    int     i, j;                           /* Array subscript       */
-    bool    valid = true;                   /* valid result          */
-
-    for (i=0, j=0; i < MAX_DECIMAL_DIGITS && valid; i++)
-    {
-        if (i & 1)
-            valid = PACKED_LOW ( regs->VR_B( v1, j++ ) ) < 10;
-        else
-            valid = PACKED_HIGH ( regs->VR_B( v1, j ) ) < 10;
-    } /* end for */
-
-    return valid;
+    /* digits 1-16 and digits 17-31 (the sign nibble is not a digit) */
+    return ( packed16_invalid_digits( regs->VR_D( v1, 0 ) ) |
+            (packed16_invalid_digits( regs->VR_D( v1, 1 ) ) & ~0x0FULL) ) == 0;
 }
 
 /*-------------------------------------------------------------------*/
@@ -669,18 +757,9 @@ static inline bool vr_is_true_zero(REGS* regs, int v1)
 /*-------------------------------------------------------------------*/
 static inline bool  vr_packed_valid_digits ( REGS* regs, int v1 )
 {
-    int     i, j;                           /* Array subscript           */
-    bool    valid = true;                   /* valid result              */
-
-    for (i=0, j=0; i < MAX_DECIMAL_DIGITS && valid; i++)
-    {
-        if (i & 1)
-            valid = PACKED_LOW ( regs->VR_B( v1, j++ ) ) < 10;
-        else
-            valid = PACKED_HIGH ( regs->VR_B( v1, j ) ) < 10;
-    } /* end for */
-
-    return valid;
+    /* digits 1-16 and digits 17-31 (the sign nibble is not a digit) */
+    return ( packed16_invalid_digits( regs->VR_D( v1, 0 ) ) |
+            (packed16_invalid_digits( regs->VR_D( v1, 1 ) ) & ~0x0FULL) ) == 0;
 }
 
 static inline bool  vr_packed_valid_digits_enhanced ( REGS* regs, int v1,
@@ -695,13 +774,7 @@ static inline bool  vr_packed_valid_digits_enhanced ( REGS* regs, int v1,
     {
         /* Enhanced Testing (ET) is not required. */
         /* Codes 0-9 are considered valid in all digit positions. */
-        for (i=0, j=0; i < MAX_DECIMAL_DIGITS && valid; i++)
-        {
-            if (i & 1)
-                valid = PACKED_LOW ( regs->VR_B( v1, j++ ) ) < 10;
-            else
-                valid = PACKED_HIGH ( regs->VR_B( v1, j ) ) < 10;
-        }
+        valid = vr_packed_valid_digits( regs, v1 );
     }
     else
     {
@@ -922,46 +995,18 @@ static inline bool  vr_packed_valid ( REGS* regs, int v1 )
 
 static inline U128 vr_to_U128( REGS* regs, int v1, bool forcePositive )
 {
-    int     i;                   /* Loop variable                    */
-    int     packedix;            /* packed byte index                */
-
-    U8      digit;               /* digit of packed byte             */
     U128    result;              /* converted binary                 */
-    U128    scale;               /* current digit scale              */
-    U128    temp128;             /* temp U128                        */
+    U128    low;                 /* digits 17-31 as binary           */
     U128    zero128;             /* zero U128                        */
 
-    packedix = VR_PACKED_SIGN;
-
-    scale.Q.D.H.D  = 0;     scale.Q.D.L.D  = 1;
-    result.Q.D.H.D = 0;     result.Q.D.L.D = 0;
-
-    for ( i=MAX_DECIMAL_DIGITS-1; packedix >= 0 ; i--)
-    {
-        if (i & 1)
-            digit = PACKED_LOW ( regs->VR_B( v1, packedix ) ) ;
-        else
-            digit = PACKED_HIGH ( regs->VR_B( v1, packedix-- ) ) ;
-
-        /* increment curent digit and adjust scale */
-        /*      result += scale * digit;           */
-        /*      scale  *= 10;                      */
-
-        if (digit != 0)
-        {
-            temp128 = U128_U32_mul (scale, digit);
-            result  = U128_add ( result, temp128 );
-        }
-        scale = U128_U32_mul (scale, 10);
+    /* digits 1-16 scaled by 10**15, plus digits 17-31 */
+    result.Q.D.H.D = 0;     result.Q.D.L.D = packed16_to_binary( regs->VR_D( v1, 0 ) );
+    low.Q.D.H.D    = 0;     low.Q.D.L.D    = packed16_to_binary( regs->VR_D( v1, 1 ) >> 4 );
 
-        // debug
-        // logmsg("vr_to_u128: i=%d, digit=%d \n", i, digit);
-        // u128_logmsg("...temp128", temp128);
-        // u128_logmsg("...scale  ", scale);
-        // u128_logmsg("...result ", result);
-    }
+    result = U128_U32_mul( U128_U32_mul( result, 100000000 ), 10000000 );
+    result = U128_add( result, low );
 
-    /* temp128 is positive */
+    /* result is positive */
     if (!forcePositive && IS_MINUS_SIGN( GET_VR_SIGN( v1 ) ) )
     {
         /* negate **/
@@ -1020,16 +1065,9 @@ static inline void vr_copy_to_vr(REGS* regs, int v1, int v2, int count)
 /*-------------------------------------------------------------------*/
 static inline bool vr_is_zero(REGS* regs, int v1)
 {
-    int     i;                 /* loop index                         */
-
-    /* first 30 digits, two at a time */
-    for ( i = 0; i < VR_PACKED_SIGN; i ++)
-        if ( regs->VR_B( v1, i)  != 0 ) return false;
-
-    /* 31st digit */
-    if ( ( regs->VR_B( v1,  VR_PACKED_SIGN ) & 0xF0) != 0 ) return false;
-
-    return true;
+    /* digits 1-16, then digits 17-31 ignoring the sign */
+    return regs->VR_D( v1, 0 ) == 0 &&
+          (regs->VR_D( v1, 1 ) & ~0x0FULL) == 0;
 }
 
 /*-------------------------------------------------------------------*/
@@ -1180,6 +1218,58 @@ static inline bool vr_from_decNumber( REGS* regs, int v1, decNumber* pdn, bool f
     return overflow;
 }
 
+#if defined( _USE_128_ )
+/*-------------------------------------------------------------------*/
+/* Load a vector register from a signed binary value                 */
+/*                                                                   */
+/* Input:                                                            */
+/*      regs    CPU register context for VR access                   */
+/*      v1      vector register to load                              */
+/*      value   signed binary value; magnitude less than 10**38      */
+/*      forcePositive   boolean to inicate whether the value should  */
+/*              forced to a positive value                           */
+/*      rdc     result digit count: the number of rightmost digits   */
+/*              to load                                              */
+/*                                                                   */
+/* Returns:                                                          */
+/*              true:  if an overflow was recognized                 */
+/*                     - number of digits is greater than result     */
+/*                       digit count                                 */
+/*              false: no overflow                                   */
+/*                                                                   */
+/* The vector register is loaded exactly as vr_from_decNumber would  */
+/* load it from the same integer value.                              */
+/*-------------------------------------------------------------------*/
+static inline bool vr_from_S128( REGS* regs, int v1, U128 value, bool forcePositive, int rdc )
+{
+    bool    overflow = false;          /* overflow recognized        */
+    unsigned __int128  mag;            /* magnitude of value         */
+    unsigned __int128  limit;          /* 10**rdc                    */
+    BYTE    ps;                        /* packed sign                */
+
+    /* rdc safety check */
+    if ( rdc <= 0 ) rdc = MAX_DECIMAL_DIGITS;
+
+    mag = ( value.s_128 < 0 ) ? -value.u_128 : value.u_128;
+
+    /* keep the rightmost rdc digits */
+    limit = pow10_128( rdc );
+    if ( mag >= limit )
+    {
+        mag %= limit;
+        overflow = true;
+    }
+
+    ps = ( forcePositive ) ? PREFERRED_ZONE : ( ( value.s_128 < 0 ) ? PREFERRED_MINUS : PREFERRED_PLUS);
+
+    /* digits 1-16, then digits 17-31 and the sign */
+    regs->VR_D( v1, 0 ) = binary_to_packed16( (U64) (mag / 1000000000000000ULL) );
+    regs->VR_D( v1, 1 ) = binary_to_packed16( (U64) (mag % 1000000000000000ULL) ) << 4 | ps;
+
+    return overflow;
+}
+#endif /* defined( _USE_128_ ) */
+
 /*-------------------------------------------------------------------*/
 /* Set a decContext to the default for Z/vector numbers (fixed)      */
 /*       - no traps                                                  */
@@ -2901,6 +2991,10 @@ DEF_INST( vector_shift_and_round_decimal )
     decNumber dntemp;          /* temp decNumber                     */
     decNumber dnshift;         /* -shamt as decNumber (note:negative)*/
     decContext set;            /* zn default context                 */
+    bool    zero;              /* is the result zero?                */
+#if defined( _USE_128_ )
+    U128    result;            /* binary result                      */
+#endif
 
     VRI_G( inst, regs, v1, v2, i4, m5, i3 );
 
@@ -2943,52 +3037,85 @@ DEF_INST( vector_shift_and_round_decimal )
         ARCH_DEP(program_interrupt) ( regs, PGM_DATA_EXCEPTION );
     }
 
-    /* operand as decNumbers  and set context */
-    vr_to_decNumber( regs, v2, &dnv2, p2);
-    zn_ContextDefault( &set );
+#if defined( _USE_128_ )
+    /* right shifts, and left shifts that stay within 38 digits */
+    if ( shamt <= 7 )
+    {
+        U128    op2;           /* v2 as binary                       */
+        unsigned __int128  mag;    /* magnitude of v2                */
+        int     digits;        /* right shift before rounding        */
 
-    /* rounding by 5 and right shift */
-    if (  shamt < 0  && drd )
+        op2 = vr_to_U128( regs, v2, p2 );
+        mag = ( op2.s_128 < 0 ) ? -op2.u_128 : op2.u_128;
+
+        if ( shamt >= 0 )
+            mag *= pow10_128( shamt );
+        else
+        {
+            /* rounding by 5 needs one more digit before the last shift */
+            digits = -shamt - (drd ? 1 : 0);
+            mag = ( digits <= MAX_DECIMAL_DIGITS ) ? mag / pow10_128( digits ) : 0;
+            if ( drd )
+                mag = ( mag + 5 ) / 10;
+        }
+
+        result.s_128 = ( op2.s_128 < 0 ) ? -(__int128) mag : (__int128) mag;
+
+        /* store shifted result in vector register */
+        overflow = vr_from_S128( regs, v1, result, p1, rdc );
+        zero = ( mag == 0 );
+    }
+    else
+#endif
     {
-        /* note: shift is negative so shift +1 to allow rounding */
-        decNumberFromInt32( &dnshift, shamt +1 );
-        decNumberShift( &dntemp, &dnv2, &dnshift, &set );
+        /* operand as decNumbers  and set context */
+        vr_to_decNumber( regs, v2, &dnv2, p2);
+        zn_ContextDefault( &set );
 
-    // dn_logmsg("dntemp: ", &dntemp);
+        /* rounding by 5 and right shift */
+        if (  shamt < 0  && drd )
+        {
+            /* note: shift is negative so shift +1 to allow rounding */
+            decNumberFromInt32( &dnshift, shamt +1 );
+            decNumberShift( &dntemp, &dnv2, &dnshift, &set );
 
-        /* rounding is on a positive value */
-        if (decNumberIsNegative( &dnv2) )
-            decNumberMinus( &dntemp, &dntemp, &set );
+        // dn_logmsg("dntemp: ", &dntemp);
 
-    // dn_logmsg("dntemp: ", &dntemp);
+            /* rounding is on a positive value */
+            if (decNumberIsNegative( &dnv2) )
+                decNumberMinus( &dntemp, &dntemp, &set );
 
-        decNumberFromInt32( &dnshift, 5 ); /*use shift as rounding digit */
-        decNumberAdd( &dntemp, &dntemp, &dnshift, &set);
+        // dn_logmsg("dntemp: ", &dntemp);
 
-    // dn_logmsg("dntemp: ", &dntemp);
+            decNumberFromInt32( &dnshift, 5 ); /*use shift as rounding digit */
+            decNumberAdd( &dntemp, &dntemp, &dnshift, &set);
 
-        /* do last 1 position shift right */
-        decNumberFromInt32( &dnshift, -1 );
-        decNumberShift( &dnv1, &dntemp, &dnshift, &set );
+        // dn_logmsg("dntemp: ", &dntemp);
 
-        /* rounding was on a positive value, switch back to negative  */
-        if (decNumberIsNegative( &dnv2) )
-            decNumberMinus( &dnv1, &dnv1, &set );
-    }
-    else
-    {
-        /* get shift as decNumber and shift v2 */
-        decNumberFromInt32(&dnshift, shamt);
-        decNumberShift(&dnv1, &dnv2, &dnshift, &set);
-    }
+            /* do last 1 position shift right */
+            decNumberFromInt32( &dnshift, -1 );
+            decNumberShift( &dnv1, &dntemp, &dnshift, &set );
 
-    // logmsg("... shamt=%d, rdc= %d, drd=%d, p1=%d, p2=%d \n",shamt, rdc, drd, p1, p2);
-    // dn_logmsg("dnv2: ", &dnv2);
-    // dn_logmsg("dnshift: ", &dnshift);
-    // dn_logmsg("dnv1: ", &dnv1);
+            /* rounding was on a positive value, switch back to negative  */
+            if (decNumberIsNegative( &dnv2) )
+                decNumberMinus( &dnv1, &dnv1, &set );
+        }
+        else
+        {
+            /* get shift as decNumber and shift v2 */
+            decNumberFromInt32(&dnshift, shamt);
+            decNumberShift(&dnv1, &dnv2, &dnshift, &set);
+        }
 
-    /* store shifted result in vector register */
-    overflow = vr_from_decNumber( regs, v1, &dnv1, p1, rdc);
+        // logmsg("... shamt=%d, rdc= %d, drd=%d, p1=%d, p2=%d \n",shamt, rdc, drd, p1, p2);
+        // dn_logmsg("dnv2: ", &dnv2);
+        // dn_logmsg("dnshift: ", &dnshift);
+        // dn_logmsg("dnv1: ", &dnv1);
+
+        /* store shifted result in vector register */
+        overflow = vr_from_decNumber( regs, v1, &dnv1, p1, rdc);
+        zero = decNumberIsZero( &dnv1 );
+    }
 
     /* if the result is 0 & the sign is negative; change to positive */
     if ( vr_is_minus_zero( regs, v1 ) )
@@ -2997,7 +3124,7 @@ DEF_INST( vector_shift_and_round_decimal )
     /* set condition code */
     if (cs)
     {
-        cc = ( decNumberIsZero( &dnv1 ) ) ? 0 : ( VR_HAS_MINUS_SIGN( v1 ) ) ? 1 : 2;
+        cc = ( zero ) ? 0 : ( VR_HAS_MINUS_SIGN( v1 ) ) ? 1 : 2;
         if ( overflow ) cc = 3;
         regs->psw.cc = cc;
     }
@@ -3626,10 +3753,15 @@ DEF_INST( vector_add_decimal )
     BYTE    cc;                /* condition code                     */
     bool    overflow = false;  /* overflowed?                        */
 
+    bool    zero;              /* is the result zero?                */
+#if defined( _USE_128_ )
+    U128    result;            /* binary result                      */
+#else
     decNumber dnv1;            /* v1 as decNumber                    */
     decNumber dnv2;            /* v2 as decNumber                    */
     decNumber dnv3;            /* v3 as decNumber                    */
     decContext set;            /* zn default contect                 */
+#endif
 
     VRI_F( inst, regs, v1, v2, v3, m5, i4 );
 
@@ -3670,6 +3802,14 @@ DEF_INST( vector_add_decimal )
         ARCH_DEP(program_interrupt) ( regs, PGM_DATA_EXCEPTION );
     }
 
+#if defined( _USE_128_ )
+    /* 31 digit operands: the sum fits in 128 bits */
+    result.s_128 = vr_to_U128( regs, v2, p2 ).s_128 + vr_to_U128( regs, v3, p3 ).s_128;
+
+    /* store sum in vector register */
+    overflow = vr_from_S128( regs, v1, result, p1, rdc );
+    zero = ( result.s_128 == 0 );
+#else
     /* operands as decNumbers */
     vr_to_decNumber( regs, v2, &dnv2, p2);
     vr_to_decNumber( regs, v3, &dnv3, p3);
@@ -3685,6 +3825,8 @@ DEF_INST( vector_add_decimal )
 
     /* store product in vector register */
     overflow = vr_from_decNumber( regs, v1, &dnv1, p1, rdc);
+    zero = decNumberIsZero( &dnv1 );
+#endif
 
     /* if the result is 0 & the sign is negative; change to positive */
     if ( vr_is_minus_zero( regs, v1 ) )
@@ -3693,7 +3835,7 @@ DEF_INST( vector_add_decimal )
     /* set condition code */
     if (cs)
     {
-        cc = ( decNumberIsZero( &dnv1 ) ) ? 0 : ( VR_HAS_MINUS_SIGN( v1 ) ) ? 1 : 2;
+        cc = ( zero ) ? 0 : ( VR_HAS_MINUS_SIGN( v1 ) ) ? 1 : 2;
         if ( overflow ) cc = 3;
         regs->psw.cc = cc;
     }
@@ -3871,10 +4013,15 @@ DEF_INST( vector_subtract_decimal )
     BYTE    cc;                /* condition code                     */
     bool    overflow = false;  /* overflowed?                        */
 
+    bool    zero;              /* is the result zero?                */
+#if defined( _USE_128_ )
+    U128    result;            /* binary result                      */
+#else
     decNumber dnv1;            /* v1 as decNumber                    */
     decNumber dnv2;            /* v2 as decNumber                    */
     decNumber dnv3;            /* v3 as decNumber                    */
     decContext set;            /* zn default contect                 */
+#endif
 
     VRI_F( inst, regs, v1, v2, v3, m5, i4 );
 
@@ -3915,6 +4062,14 @@ DEF_INST( vector_subtract_decimal )
         ARCH_DEP(program_interrupt) ( regs, PGM_DATA_EXCEPTION );
     }
 
+#if defined( _USE_128_ )
+    /* 31 digit operands: the difference fits in 128 bits */
+    result.s_128 = vr_to_U128( regs, v2, p2 ).s_128 - vr_to_U128( regs, v3, p3 ).s_128;
+
+    /* store difference in vector register */
+    overflow = vr_from_S128( regs, v1, result, p1, rdc );
+    zero = ( result.s_128 == 0 );
+#else
     /* operands as decNumbers */
     vr_to_decNumber( regs, v2, &dnv2, p2);
     vr_to_decNumber( regs, v3, &dnv3, p3);
@@ -3930,6 +4085,8 @@ DEF_INST( vector_subtract_decimal )
 
     /* store product in vector register */
     overflow = vr_from_decNumber( regs, v1, &dnv1, p1, rdc);
+    zero = decNumberIsZero( &dnv1 );
+#endif
 
     /* if the result is 0 & the sign is negative; change to positive */
     if ( vr_is_minus_zero( regs, v1 ) )
@@ -3938,7 +4095,7 @@ DEF_INST( vector_subtract_decimal )
     /* set condition code */
     if (cs)
     {
-        cc = ( decNumberIsZero( &dnv1 ) ) ? 0 : ( VR_HAS_MINUS_SIGN( v1 ) ) ? 1 : 2;
+        cc = ( zero ) ? 0 : ( VR_HAS_MINUS_SIGN( v1 ) ) ? 1 : 2;
         if ( overflow ) cc = 3;
         regs->psw.cc = cc;
     }
@@ -4106,10 +4263,12 @@ DEF_INST( vector_compare_decimal )
     bool    valid_decimals2;   /* v2: are decimals valid?            */
     BYTE    cc;                /* condition code                     */
 
+#if !defined( _USE_128_ )
     decNumber dnv1;            /* v1 as decNumber                    */
     decNumber dnv2;            /* v2 as decNumber                    */
     decNumber dncompared;      /* compared as decNumber              */
     decContext set;            /* zn default contect                 */
+#endif
 
     VRR_H(inst, regs, v1, v2, m3);
 
@@ -4132,6 +4291,18 @@ DEF_INST( vector_compare_decimal )
         ARCH_DEP(program_interrupt) ( regs, PGM_DATA_EXCEPTION );
     }
 
+#if defined( _USE_128_ )
+    /* operands as binary */
+    {
+        U128    op1;           /* v1 as binary                       */
+        U128    op2;           /* v2 as binary                       */
+
+        op1 = vr_to_U128( regs, v1, p1 );
+        op2 = vr_to_U128( regs, v2, p2 );
+
+        cc = ( op1.s_128 == op2.s_128 ) ? 0 : ( op1.s_128 < op2.s_128 ) ? 1 : 2;
+    }
+#else
     /* operands as decNumbers */
     vr_to_decNumber( regs, v1, &dnv1, p1);
     vr_to_decNumber( regs, v2, &dnv2, p2);
@@ -4141,6 +4312,7 @@ DEF_INST( vector_compare_decimal )
     decNumberCompare( &dncompared,  &dnv1, &dnv2, &set );
 
     cc =  ( decNumberIsZero( &dncompared ) ) ? 0 : ( decNumberIsNegative( &dncompared ) ) ? 1 : 2;
+#endif
     regs->psw.cc = cc;
 
     ZVECTOR_END( regs );
@@ -4171,6 +4343,12 @@ DEF_INST( vector_multiply_decimal )
     decNumber dnv2;            /* v2 as decNumber                    */
     decNumber dnv3;            /* v3 as decNumber                    */
     decContext set;            /* zn default contect                 */
+    bool    zero;              /* is the result zero?                */
+#if defined( _USE_128_ )
+    U128    op2;               /* v2 as binary                       */
+    U128    op3;               /* v3 as binary                       */
+    U128    result;            /* binary result                      */
+#endif
 
     VRI_F( inst, regs, v1, v2, v3, m5, i4 );
 
@@ -4211,21 +4389,39 @@ DEF_INST( vector_multiply_decimal )
         ARCH_DEP(program_interrupt) ( regs, PGM_DATA_EXCEPTION );
     }
 
-    /* operands as decNumbers */
-    vr_to_decNumber( regs, v2, &dnv2, p2);
-    vr_to_decNumber( regs, v3, &dnv3, p3);
-
-    /* get product */
-    zn_ContextDefault( &set );
-    decNumberMultiply( &dnv1,  &dnv2, &dnv3, &set );
+#if defined( _USE_128_ )
+    op2 = vr_to_U128( regs, v2, p2 );
+    op3 = vr_to_U128( regs, v3, p3 );
 
-    // DEBUG
-    // dn_logmsg("dnv2: ", &dnv2);
-    // dn_logmsg("dnv3: ", &dnv3);
-    // dn_logmsg("dnv1: ", &dnv1);
+    /* operands that fit in 64 bits: the product fits in 128 bits */
+    if ( op2.s_128 == (S64) op2.s_128 && op3.s_128 == (S64) op3.s_128 )
+    {
+        result.s_128 = op2.s_128 * op3.s_128;
 
-    /* store product in vector register */
-    overflow = vr_from_decNumber( regs, v1, &dnv1, p1, rdc);
+        /* store product in vector register */
+        overflow = vr_from_S128( regs, v1, result, p1, rdc );
+        zero = ( result.s_128 == 0 );
+    }
+    else
+#endif
+    {
+        /* operands as decNumbers */
+        vr_to_decNumber( regs, v2, &dnv2, p2);
+        vr_to_decNumber( regs, v3, &dnv3, p3);
+
+        /* get product */
+        zn_ContextDefault( &set );
+        decNumberMultiply( &dnv1,  &dnv2, &dnv3, &set );
+
+        // DEBUG
+        // dn_logmsg("dnv2: ", &dnv2);
+        // dn_logmsg("dnv3: ", &dnv3);
+        // dn_logmsg("dnv1: ", &dnv1);
+
+        /* store product in vector register */
+        overflow = vr_from_decNumber( regs, v1, &dnv1, p1, rdc);
+        zero = decNumberIsZero( &dnv1 );
+    }
 
     /* if the result is 0 & the sign is negative; change to positive */
     if ( vr_is_minus_zero( regs, v1 ) )
@@ -4234,7 +4430,7 @@ DEF_INST( vector_multiply_decimal )
     /* set condition code */
     if (cs)
     {
-        cc = ( decNumberIsZero( &dnv1 ) ) ? 0 : ( VR_HAS_MINUS_SIGN( v1 ) ) ? 1 : 2;
+        cc = ( zero ) ? 0 : ( VR_HAS_MINUS_SIGN( v1 ) ) ? 1 : 2;
         if ( overflow ) cc = 3;
         regs->psw.cc = cc;
     }
@@ -4376,10 +4572,15 @@ DEF_INST( vector_divide_decimal )
     BYTE    cc;                /* condition code                     */
     bool    overflow = false;  /* overflowed?                        */
 
+    bool    zero;              /* is the result zero?                */
+#if defined( _USE_128_ )
+    U128    result;            /* binary result                      */
+#else
     decNumber dnv1;            /* v1 as decNumber                    */
     decNumber dnv2;            /* v2 as decNumber                    */
     decNumber dnv3;            /* v3 as decNumber                    */
     decContext set;            /* zn default contect                 */
+#endif
 
     VRI_F( inst, regs, v1, v2, v3, m5, i4 );
 
@@ -4420,6 +4621,26 @@ DEF_INST( vector_divide_decimal )
         ARCH_DEP(program_interrupt) ( regs, PGM_DATA_EXCEPTION );
     }
 
+#if defined( _USE_128_ )
+    {
+        U128    dividend;      /* v2 as binary                       */
+        U128    divisor;       /* v3 as binary                       */
+
+        dividend = vr_to_U128( regs, v2, p2 );
+        divisor  = vr_to_U128( regs, v3, p3 );
+
+        /* Program check if divisor (v3) is zero */
+        if ( divisor.s_128 == 0 )
+            ARCH_DEP(program_interrupt) (regs, PGM_DECIMAL_DIVIDE_EXCEPTION);
+
+        /* quotient truncates toward zero, as decNumber does */
+        result.s_128 = dividend.s_128 / divisor.s_128;
+    }
+
+    /* store quotient in vector register */
+    overflow = vr_from_S128( regs, v1, result, p1, rdc );
+    zero = ( result.s_128 == 0 );
+#else
     /* operands as decNumbers */
     vr_to_decNumber( regs, v2, &dnv2, p2);
     vr_to_decNumber( regs, v3, &dnv3, p3);
@@ -4439,6 +4660,8 @@ DEF_INST( vector_divide_decimal )
 
     /* store product in vector register */
     overflow = vr_from_decNumber( regs, v1, &dnv1, p1, rdc);
+    zero = decNumberIsZero( &dnv1 );
+#endif
 
     /* if the result is 0 & the sign is negative; change to positive */
     if ( vr_is_minus_zero( regs, v1 ) )
@@ -4447,7 +4670,7 @@ DEF_INST( vector_divide_decimal )
     /* set condition code */
     if (cs)
     {
-        cc = ( decNumberIsZero( &dnv1 ) ) ? 0 : ( VR_HAS_MINUS_SIGN( v1 ) ) ? 1 : 2;
+        cc = ( zero ) ? 0 : ( VR_HAS_MINUS_SIGN( v1 ) ) ? 1 : 2;
         if ( overflow ) cc = 3;
         regs->psw.cc = cc;
     }
@@ -4481,10 +4704,15 @@ DEF_INST( vector_remainder_decimal )
     BYTE    cc;                /* condition code                     */
     bool    overflow = false;  /* overflowed?                        */
 
+    bool    zero;              /* is the result zero?                */
+#if defined( _USE_128_ )
+    U128    result;            /* binary result                      */
+#else
     decNumber dnv1;            /* v1 as decNumber                    */
     decNumber dnv2;            /* v2 as decNumber                    */
     decNumber dnv3;            /* v3 as decNumber                    */
     decContext set;            /* zn default contect                 */
+#endif
 
     VRI_F( inst, regs, v1, v2, v3, m5, i4 );
 
@@ -4525,6 +4753,26 @@ DEF_INST( vector_remainder_decimal )
         ARCH_DEP(program_interrupt) ( regs, PGM_DATA_EXCEPTION );
     }
 
+#if defined( _USE_128_ )
+    {
+        U128    dividend;      /* v2 as binary                       */
+        U128    divisor;       /* v3 as binary                       */
+
+        dividend = vr_to_U128( regs, v2, p2 );
+        divisor  = vr_to_U128( regs, v3, p3 );
+
+        /* Program check if divisor (v3) is zero */
+        if ( divisor.s_128 == 0 )
+            ARCH_DEP(program_interrupt) (regs, PGM_DECIMAL_DIVIDE_EXCEPTION);
+
+        /* remainder has the sign of the dividend, as decNumber's does */
+        result.s_128 = dividend.s_128 % divisor.s_128;
+    }
+
+    /* store remainder in vector register */
+    overflow = vr_from_S128( regs, v1, result, p1, rdc );
+    zero = ( result.s_128 == 0 );
+#else
     /* operands as decNumbers */
     vr_to_decNumber( regs, v2, &dnv2, p2);
     vr_to_decNumber( regs, v3, &dnv3, p3);
@@ -4544,6 +4792,8 @@ DEF_INST( vector_remainder_decimal )
 
     /* store product in vector register */
     overflow = vr_from_decNumber( regs, v1, &dnv1, p1, rdc);
+    zero = decNumberIsZero( &dnv1 );
+#endif
 
     /* if the result is 0 & the sign is negative; change to positive */
     if ( vr_is_minus_zero( regs, v1 ) )
@@ -4552,7 +4802,7 @@ DEF_INST( vector_remainder_decimal )
     /* set condition code */
     if (cs)
     {
-        cc = ( decNumberIsZero( &dnv1 ) ) ? 0 : ( VR_HAS_MINUS_SIGN( v1 ) ) ? 1 : 2;
+        cc = ( zero ) ? 0 : ( VR_HAS_MINUS_SIGN( v1 ) ) ? 1 : 2;
         if ( overflow ) cc = 3;
         regs->psw.cc = cc;
     }